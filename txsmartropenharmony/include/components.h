@@ -17,8 +17,16 @@ typedef struct image{
     uint8_t *img;
     int width;
     int height;
+    int bpp;                    /* 0或16为RGB565(原始或RLE)，1/2/4为调色板索引 */
+    const uint16_t *palette;    /* 调色板索引图片的调色板 */
 }image_t;
 
+/* image_t初始化 */
+#define IMAGE_RGB565(data, w, h) \
+    { .img = (uint8_t *)(data), .width = (w), .height = (h), .bpp = 16, .palette = NULL }
+#define IMAGE_INDEXED(data, w, h, b, pal) \
+    { .img = (uint8_t *)(data), .width = (w), .height = (h), .bpp = (b), .palette = (pal) }
+
 typedef struct lcd_menu{
     image_t img;
     text_t text;
@@ -35,11 +43,120 @@ typedef struct lcd_display_board{
     text_t text;
     int base_x;
     int base_y;
+    char drawn[32];     /* 上一次显示的文字,用于按字符比较变化 */
 }lcd_display_board_t;
 
+/* 趋势图的采样点数,每个点占一列 */
+#define LCD_CHART_POINTS        120
+/* 趋势图最多同时显示的曲线条数 */
+#define LCD_CHART_SERIES        2
+/* 趋势图的最大高度,一列像素在栈上拼好后一次下发 */
+#define LCD_CHART_HEIGHT_MAX    32
+
+/* 扫描式趋势图:第n个样本固定画在第n%LCD_CHART_POINTS列,
+ * 新样本只画新的一列和它后面作为扫描光标的一列空白,不需要整图重画 */
+typedef struct lcd_chart{
+    int base_x;
+    int base_y;
+    int height;                 /* 不超过LCD_CHART_HEIGHT_MAX */
+    int bc;
+    int series_num;
+    int fc[LCD_CHART_SERIES];
+    int min[LCD_CHART_SERIES];  /* 纵轴范围,与样本单位相同 */
+    int max[LCD_CHART_SERIES];
+    int16_t samples[LCD_CHART_SERIES][LCD_CHART_POINTS];   /* 环形缓冲区 */
+    uint32_t count;             /* 累计样本数 */
+    uint32_t drawn;             /* 已经画到屏幕上的样本数 */
+}lcd_chart_t;
+
+/* 控制台最多显示的行数 */
+#define LCD_CONSOLE_LINES_MAX   8
+
+/* 文字控制台:第n行固定写在第n%lines个行槽里,每追加一行只下发一行像素.
+ * 竖屏且占满整行宽度时用硬件滚动把最老的行槽滚到最上面,
+ * 否则行槽循环使用,最新一行前面显示'>'标记 */
+typedef struct lcd_console{
+    int base_x;
+    int base_y;
+    int width;
+    int lines;                  /* 不超过LCD_CONSOLE_LINES_MAX */
+    int font_size;
+    int fc;
+    int bc;
+    char text[LCD_CONSOLE_LINES_MAX][32];
+    uint32_t count;             /* 累计行数 */
+    uint32_t drawn;             /* 已经画到屏幕上的行数 */
+    bool hw_scroll;             /* 由lcd_console_init决定 */
+}lcd_console_t;
+
+/* 控件类型 */
+typedef enum {
+    UI_CONTAINER = 0,   /* 容器,可以设置背景色 */
+    UI_LABEL,           /* 文字标签 */
+    UI_IMAGE,           /* 图片 */
+    UI_MENU,            /* 菜单项,显示lcd_menu_t */
+    UI_BOARD,           /* 显示面板,显示lcd_display_board_t */
+    UI_CHART,           /* 趋势图,显示lcd_chart_t */
+    UI_CONSOLE,         /* 控制台,显示lcd_console_t */
+} ui_type_t;
+
+/* 容器不绘制背景 */
+#define UI_COLOR_NONE   (-1)
+
+/* 控件树节点,子控件必须位于父控件区域内 */
+typedef struct ui_widget{
+    ui_type_t type;
+    int x;
+    int y;
+    int width;
+    int height;
+    bool dirty;                 /* 控件自身需要整体重画 */
+    bool is_static;             /* 静态控件只在自身失效或整屏刷新时绘制 */
+    struct ui_widget *parent;
+    struct ui_widget *child;    /* 第一个子控件 */
+    struct ui_widget *next;     /* 下一个兄弟控件 */
+    int bc;                     /* 容器背景色 */
+    text_t text;                /* 标签文字 */
+    char drawn[32];             /* 标签上一次显示的文字 */
+    image_t img;                /* 图片 */
+    lcd_menu_t *menu;
+    lcd_display_board_t *db;
+    lcd_chart_t *chart;
+    lcd_console_t *console;
+}ui_widget_t;
+
 int lcd_menu_init(void);
 int  lcd_menu_show(lcd_menu_t *menus[] , int menu_num);
 
 int lcd_menu_entry(lcd_menu_t *menu);
 
+int lcd_db_show(lcd_display_board_t *lcd_dbs[] , int db_num);
+void lcd_db_set_text(lcd_display_board_t *db, const char *name);
+void lcd_db_set_color(lcd_display_board_t *db, int fc);
+void lcd_db_set_image(lcd_display_board_t *db, const image_t *img);
+
+void lcd_chart_push(lcd_chart_t *chart, const int *values);
+int lcd_chart_draw(lcd_chart_t *chart, bool full);
+void lcd_chart_commit(lcd_chart_t *chart);
+int lcd_console_init(lcd_console_t *con);
+void lcd_console_append(lcd_console_t *con, const char *text);
+int lcd_console_draw(lcd_console_t *con, bool full);
+void lcd_console_commit(lcd_console_t *con, bool full);
+
+void ui_container_init(ui_widget_t *w, int x, int y, int width, int height, int bc);
+void ui_label_init(ui_widget_t *w, int x, int y, const char *str, int fc, int bc, int font_size);
+void ui_image_init(ui_widget_t *w, int x, int y, const image_t *img);
+void ui_menu_init(ui_widget_t *w, lcd_menu_t *menu);
+void ui_board_init(ui_widget_t *w, lcd_display_board_t *db);
+void ui_chart_init(ui_widget_t *w, lcd_chart_t *chart);
+void ui_console_init(ui_widget_t *w, lcd_console_t *con);
+void ui_add(ui_widget_t *parent, ui_widget_t *child);
+void ui_set_static(ui_widget_t *w, bool is_static);
+void ui_invalidate(ui_widget_t *w);
+void ui_label_set_text(ui_widget_t *w, const char *str);
+void ui_label_set_color(ui_widget_t *w, int fc, int bc);
+void ui_image_set(ui_widget_t *w, const image_t *img);
+void ui_set_yield(bool (*yield)(void));
+bool ui_render(ui_widget_t *root);
+
 #endif
\ No newline at end of file
@@ -12,6 +12,7 @@ typedef struct
     bool motor_state;
     bool light_state;
     bool auto_state;
+    const char *mqtt_test;  // 服药位置,为NULL或空字符串时不上传
 } e_iot_data;
 
 #define IOT_CMD_LIGHT_ON 0x01
@@ -25,7 +26,7 @@ int wait_message();
 void mqtt_init();
 unsigned int mqtt_is_connected();
 void send_msg_to_mqtt(e_iot_data *iot_data);
-void handle_mqtt_control(char *value);  // 添加新函数声明
+int handle_mqtt_control(char *value);   // 添加新函数声明
 void beep_set_state(bool state);        // 添加蜂鸣器控制函数声明
 
 #endif // _IOT_H_
\ No newline at end of file
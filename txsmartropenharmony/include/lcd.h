@@ -16,6 +16,7 @@
 #define _LCD_H_
 
 #include <stdint.h>
+#include <stdbool.h>
 
 /* 设置横屏或者竖屏显示 0或1为竖屏 2或3为横屏 */
 #define USE_HORIZONTAL      3
@@ -29,6 +30,32 @@
 #define LCD_H 240
 #endif
 
+/* 硬件滚动沿屏幕原生的320行方向进行，只有USE_HORIZONTAL为0时与显示的上下方向一致，
+ * 横屏时滚动方向是左右，且滚动区域总是覆盖整个屏幕高度
+ */
+#define LCD_SCROLL_VERTICAL (USE_HORIZONTAL == 0)
+
+/* 屏幕电源状态 */
+typedef enum
+{
+    LCD_POWER_ON = 0,       /* 正常显示 */
+    LCD_POWER_PARTIAL,      /* 局部显示(PTLON)，只有局部区域在显示 */
+    LCD_POWER_OFF,          /* 关显示(DISPOFF)，显存保持 */
+    LCD_POWER_SLEEP,        /* 睡眠(SLPIN)，关闭升压和扫描 */
+} lcd_power_t;
+
+/* 接口像素格式，取值即COLMOD(0x3A)的参数。RGB444两个像素共3个字节，
+ * 比RGB565少25%的传输量，各分量只保留高4位
+ */
+typedef enum
+{
+    LCD_FORMAT_RGB444 = 0x03,
+    LCD_FORMAT_RGB565 = 0x05,
+} lcd_pixel_format_t;
+
+/* 上电时打印两种像素格式的整屏填充耗时 */
+#define LCD_BENCHMARK_ON_BOOT   0
+
 /* 画笔颜色 */
 #define LCD_WHITE           0xFFFF
 #define LCD_BLACK           0x0000
@@ -52,6 +79,96 @@
 #define LCD_LGRAYBLUE       0XA651 //浅灰蓝色(中间层颜色)
 #define LCD_LBBLUE          0X2B12 //浅棕蓝色(选择条目的反色)
 
+/* 发送缓冲区大小，以行为单位，整屏清屏需要 LCD_H / LCD_BAND_LINES 次传输 */
+#define LCD_BAND_LINES      2
+#define LCD_BAND_BYTES      (LCD_W * LCD_BAND_LINES * 2)
+
+/* 每帧最多记录的脏矩形个数，超出后合并到代价最小的矩形中 */
+#define LCD_DIRTY_RECT_MAX  8
+
+/* 条带渲染的行数，帧内按条带把所有控件先画到内存再整条下发，
+ * 占用LCD_W * LCD_RENDER_BAND_LINES * 2字节内存，为0时直接绘制到屏幕
+ */
+#define LCD_RENDER_BAND_LINES   16
+
+/* 影子缓冲区行数，保存已下发到屏幕的像素供帧外的叠加模式混合使用，为0时不使用。
+ * 条带渲染时叠加模式与条带缓冲区混合，不需要影子缓冲区
+ */
+#if LCD_RENDER_BAND_LINES > 0
+#define LCD_SHADOW_LINES    0
+#else
+#define LCD_SHADOW_LINES    24
+#endif
+
+/* 字形缓存大小(字节)，缓存光栅化后的RGB565字形，为0时不使用。
+ * 24号汉字每个1152字节，24号ASCII每个576字节
+ */
+#define LCD_GLYPH_CACHE_BYTES   (16 * 1024)
+
+/* RLE压缩图片格式，数据均为高字节在前：
+ *   0~3字节：'R','L','E','1'
+ *   4~5字节：图片宽度
+ *   6~7字节：图片高度
+ * 之后是按扫描顺序排列的数据包，包头字节bit7为1表示重复包，后跟1个像素，
+ * 重复(低7位+1)次；bit7为0表示原始包，后跟(低7位+1)个像素。
+ * 由tools/asset_compiler.py生成。
+ */
+#define LCD_RLE_HEADER_SIZE     8
+#define LCD_RLE_MAX_RUN         128
+
+/* 预先打包的RGB444图片格式，数据均为高字节在前：
+ *   0~3字节：'R','4','4','4'
+ *   4~5字节：图片宽度
+ *   6~7字节：图片高度
+ * 之后是按扫描顺序连续打包的像素，每两个像素3个字节，像素数为奇数时
+ * 最后一个像素占2个字节(低4位补0)。RGB444模式下可以整块拷贝直接下发。
+ * 由tools/asset_compiler.py生成。
+ */
+#define LCD_R444_HEADER_SIZE    8
+/* 非RGB444模式或窗口被裁剪时，每次展开的像素数 */
+#define LCD_R444_CHUNK          64
+
+/* 图片描述，像素为屏幕原生字节序(高字节在前)，可以不经转换直接下发。
+ * RGB565图片的stride为相邻两行的字节间距，为0时等于w*2，
+ * 用lcd_image_sub取大图中的一块时不需要拷贝；
+ * RGB444图片按R444格式整图连续打包，data指向文件头之后，忽略stride
+ */
+typedef struct lcd_image
+{
+    const uint8_t *data;
+    uint16_t w;
+    uint16_t h;
+    uint16_t stride;
+    lcd_pixel_format_t format;
+} lcd_image_t;
+
+#define LCD_IMAGE_RGB565(d, iw, ih) \
+    { .data = (const uint8_t *)(d), .w = (iw), .h = (ih), .stride = (iw) * 2, .format = LCD_FORMAT_RGB565 }
+#define LCD_IMAGE_RGB444(d, iw, ih) \
+    { .data = (const uint8_t *)(d) + LCD_R444_HEADER_SIZE, .w = (iw), .h = (ih), .stride = 0, \
+      .format = LCD_FORMAT_RGB444 }
+
+/* 屏幕矩形区域，坐标均为闭区间 */
+typedef struct lcd_rect
+{
+    uint16_t x1;
+    uint16_t y1;
+    uint16_t x2;
+    uint16_t y2;
+} lcd_rect_t;
+
+/* 总线统计，用于衡量每帧的SPI开销 */
+typedef struct lcd_stats
+{
+    uint32_t frame_hal_calls;   /* 上一帧的HAL调用次数 */
+    uint32_t frame_bytes;       /* 上一帧下发的字节数 */
+    uint32_t total_hal_calls;   /* 累计HAL调用次数 */
+    uint32_t total_bytes;       /* 累计下发的字节数 */
+    uint32_t glyph_cache_hits;      /* 字形缓存命中次数 */
+    uint32_t glyph_cache_misses;    /* 字形缓存未命中次数 */
+    uint32_t glyph_cache_evictions; /* 字形缓存淘汰次数 */
+} lcd_stats_t;
+
 
 /***************************************************************
  * 函数名称: lcd_init
@@ -138,6 +255,87 @@ void lcd_draw_rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint
 void lcd_draw_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color);
 
 
+/***************************************************************
+ * 函数名称: lcd_draw_hline
+ * 说    明: 画水平线，整条线只设置一次窗口
+ * 参    数:
+ *       @x：线的起始点X坐标
+ *       @y：线的Y坐标
+ *       @len：线的长度
+ *       @color：线的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_hline(uint16_t x, uint16_t y, uint16_t len, uint16_t color);
+
+
+/***************************************************************
+ * 函数名称: lcd_draw_vline
+ * 说    明: 画垂直线，整条线只设置一次窗口
+ * 参    数:
+ *       @x：线的X坐标
+ *       @y：线的起始点Y坐标
+ *       @len：线的长度
+ *       @color：线的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_vline(uint16_t x, uint16_t y, uint16_t len, uint16_t color);
+
+
+/***************************************************************
+ * 函数名称: lcd_fill_rectangle
+ * 说    明: 指定位置画实心矩形，与lcd_draw_rectangle一样包含结束点
+ * 参    数:
+ *       @x1：指定矩形的起始点X坐标
+ *       @y1：指定矩形的起始点Y坐标
+ *       @x2：指定矩形的结束点X坐标
+ *       @y2：指定矩形的结束点Y坐标
+ *       @color：指定矩形的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);
+
+
+/***************************************************************
+ * 函数名称: lcd_fill_circle
+ * 说    明: 指定位置画实心圆，边缘与lcd_draw_circle一致
+ * 参    数:
+ *       @x0：指定圆的中心点X坐标
+ *       @y0：指定圆的中心点Y坐标
+ *       @r：指定圆的半径
+ *       @color：指定圆的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color);
+
+
+/***************************************************************
+ * 函数名称: lcd_draw_triangle
+ * 说    明: 指定位置画三角形
+ * 参    数:
+ *       @x0,y0：第一个顶点
+ *       @x1,y1：第二个顶点
+ *       @x2,y2：第三个顶点
+ *       @color：指定点的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_triangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+    uint16_t x2, uint16_t y2, uint16_t color);
+
+
+/***************************************************************
+ * 函数名称: lcd_fill_triangle
+ * 说    明: 指定位置画实心三角形，每一行用一段水平线下发
+ * 参    数:
+ *       @x0,y0：第一个顶点
+ *       @x1,y1：第二个顶点
+ *       @x2,y2：第三个顶点
+ *       @color：指定三角形的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_triangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+    uint16_t x2, uint16_t y2, uint16_t color);
+
+
 /***************************************************************
  * 函数名称: lcd_show_chinese
  * 说    明: 显示汉字串
@@ -218,7 +416,8 @@ void lcd_show_float_num1(uint16_t x, uint16_t y, float num, uint8_t len, uint16_
 
 /***************************************************************
  * 函数名称: lcd_show_picture
- * 说    明: 显示图片
+ * 说    明: 显示图片，支持RGB565原始数据、RLE压缩格式和R444打包格式，
+ *           RLE和R444图片以文件头中的尺寸为准
  * 参    数:
  *       @x：指定图片的起始位置X坐标
  *       @y：指定图片的起始位置X坐标
@@ -230,4 +429,371 @@ void lcd_show_float_num1(uint16_t x, uint16_t y, float num, uint8_t len, uint16_
 void lcd_show_picture(uint16_t x, uint16_t y, uint16_t length, uint16_t width, const uint8_t *pic);
 
 
+/***************************************************************
+ * 函数名称: lcd_draw_image
+ * 说    明: 按图片描述显示图片，格式与接口像素格式一致且没有被脏区域裁剪时，
+ *           整块的行数据直接从flash交给SPI下发，下发完成前数据不能修改
+ * 参    数:
+ *       @x：指定图片的起始位置X坐标
+ *       @y：指定图片的起始位置Y坐标
+ *       @img：图片描述
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_image(uint16_t x, uint16_t y, const lcd_image_t *img);
+
+
+/***************************************************************
+ * 函数名称: lcd_image_sub
+ * 说    明: 取RGB565图片中的一块矩形区域，用于图标表等拼在一起的图片
+ * 参    数:
+ *       @img：原图片描述
+ *       @x：区域在原图中的起始X坐标
+ *       @y：区域在原图中的起始Y坐标
+ *       @w：区域宽度
+ *       @h：区域高度
+ *       @sub：输出区域的图片描述
+ * 返 回 值: 成功返回true，区域超出原图或原图不是RGB565返回false
+ ***************************************************************/
+bool lcd_image_sub(const lcd_image_t *img, uint16_t x, uint16_t y, uint16_t w, uint16_t h, lcd_image_t *sub);
+
+
+/***************************************************************
+ * 函数名称: lcd_show_picture_indexed
+ * 说    明: 显示调色板索引格式的图片
+ * 参    数:
+ *       @x：指定图片的起始位置X坐标
+ *       @y：指定图片的起始位置Y坐标
+ *       @length：指定图片的长度
+ *       @width：指定图片的宽度
+ *       @bpp：每个像素的位数，可选：1、2、4
+ *       @palette：RGB565调色板，共1<<bpp个颜色
+ *       @pic：像素索引数据，高位在左，每行按字节对齐
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_show_picture_indexed(uint16_t x, uint16_t y, uint16_t length, uint16_t width,
+    uint8_t bpp, const uint16_t *palette, const uint8_t *pic);
+
+
+/***************************************************************
+ * 函数名称: lcd_invalidate
+ * 说    明: 标记指定区域为脏区域，下一帧只刷新脏区域
+ * 参    数:
+ *       @xsta：指定区域的起始点X坐标
+ *       @ysta：指定区域的起始点Y坐标
+ *       @xend：指定区域的结束点X坐标(不包含)
+ *       @yend：指定区域的结束点Y坐标(不包含)
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_invalidate(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend);
+
+
+/***************************************************************
+ * 函数名称: lcd_invalidate_all
+ * 说    明: 标记整屏为脏区域，下一帧整屏刷新
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_invalidate_all(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_frame_begin
+ * 说    明: 开始一帧绘制，帧内的绘图操作只会刷新脏区域
+ * 参    数: 无
+ * 返 回 值: 有脏区域返回true，没有需要刷新的区域返回false
+ ***************************************************************/
+bool lcd_frame_begin(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_frame_end
+ * 说    明: 结束一帧绘制，清空脏区域
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_frame_end(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_frame_suspend
+ * 说    明: 挂起当前帧，已经写入的条带下发到屏幕，脏区域保留。
+ *           下一次lcd_frame_begin后从lcd_frame_resume_line继续绘制
+ * 参    数:
+ *       @y：还没有绘制的第一条条带的起始行
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_frame_suspend(uint16_t y);
+
+
+/***************************************************************
+ * 函数名称: lcd_frame_resume_line
+ * 说    明: 获取被挂起的帧继续绘制的起始行
+ * 参    数: 无
+ * 返 回 值: 条带的起始行，没有挂起的帧或挂起后上方又有变化时返回0
+ ***************************************************************/
+uint16_t lcd_frame_resume_line(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_frame_is_dirty
+ * 说    明: 判断指定区域在当前帧内是否需要刷新
+ * 参    数:
+ *       @xsta：指定区域的起始点X坐标
+ *       @ysta：指定区域的起始点Y坐标
+ *       @xend：指定区域的结束点X坐标(不包含)
+ *       @yend：指定区域的结束点Y坐标(不包含)
+ * 返 回 值: 需要刷新返回true，帧外调用总是返回true
+ ***************************************************************/
+bool lcd_frame_is_dirty(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend);
+
+
+/***************************************************************
+ * 函数名称: lcd_frame_is_exclusive
+ * 说    明: 判断与指定区域相交的脏矩形是否都在区域内。成立时区域内的
+ *           控件可以在条带之外直接绘制，再用lcd_frame_exclude移除这些脏矩形
+ * 参    数:
+ *       @xsta：指定区域的起始点X坐标
+ *       @ysta：指定区域的起始点Y坐标
+ *       @xend：指定区域的结束点X坐标(不包含)
+ *       @yend：指定区域的结束点Y坐标(不包含)
+ * 返 回 值: 有相交的脏矩形且都在区域内返回true，帧外或条带内返回false
+ ***************************************************************/
+bool lcd_frame_is_exclusive(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend);
+
+
+/***************************************************************
+ * 函数名称: lcd_frame_exclude
+ * 说    明: 从当前帧的脏区域中移除完全在指定区域内的脏矩形
+ * 参    数:
+ *       @xsta：指定区域的起始点X坐标
+ *       @ysta：指定区域的起始点Y坐标
+ *       @xend：指定区域的结束点X坐标(不包含)
+ *       @yend：指定区域的结束点Y坐标(不包含)
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_frame_exclude(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend);
+
+
+/***************************************************************
+ * 函数名称: lcd_render_begin
+ * 说    明: 在帧内开始绘制从第y行开始的LCD_RENDER_BAND_LINES行条带，
+ *           之后的绘图只写入条带缓冲区。条带内需要刷新的区域中每个像素
+ *           都要重新画到，通常由带背景色的根容器保证
+ * 参    数:
+ *       @y：条带的起始行
+ * 返 回 值: 条带内有脏区域返回true，返回false时不需要绘制该条带
+ ***************************************************************/
+bool lcd_render_begin(uint16_t y);
+
+
+/***************************************************************
+ * 函数名称: lcd_render_end
+ * 说    明: 结束当前条带，把条带内需要刷新的区域下发到屏幕
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_render_end(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_render_is_active
+ * 说    明: 判断当前是否在绘制条带
+ * 参    数: 无
+ * 返 回 值: 在lcd_render_begin和lcd_render_end之间返回true
+ ***************************************************************/
+bool lcd_render_is_active(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_frame_is_full
+ * 说    明: 判断当前帧是否由lcd_invalidate_all引起的整屏刷新
+ * 参    数: 无
+ * 返 回 值: 整屏刷新返回true，帧外调用总是返回true
+ ***************************************************************/
+bool lcd_frame_is_full(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_set_window
+ * 说    明: 设置绘图窗口，之后用lcd_write_pixels/lcd_fill_span写入像素
+ * 参    数:
+ *       @x1：窗口的起始点X坐标
+ *       @y1：窗口的起始点Y坐标
+ *       @x2：窗口的结束点X坐标
+ *       @y2：窗口的结束点Y坐标
+ * 返 回 值: 窗口内有像素需要下发返回true，整个窗口被裁剪返回false
+ ***************************************************************/
+bool lcd_set_window(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+
+
+/***************************************************************
+ * 函数名称: lcd_write_pixels
+ * 说    明: 按窗口扫描顺序批量写入像素
+ * 参    数:
+ *       @pixels：RGB565像素数组
+ *       @num：像素个数
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_write_pixels(const uint16_t *pixels, uint32_t num);
+
+
+/***************************************************************
+ * 函数名称: lcd_fill_span
+ * 说    明: 按窗口扫描顺序写入num个相同颜色的像素
+ * 参    数:
+ *       @color：像素颜色
+ *       @num：像素个数
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_span(uint16_t color, uint32_t num);
+
+
+/***************************************************************
+ * 函数名称: lcd_get_stats
+ * 说    明: 获取总线统计，帧统计为上一次lcd_frame_end时的结果
+ * 参    数:
+ *       @stats：输出统计数据
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_get_stats(lcd_stats_t *stats);
+
+
+/***************************************************************
+ * 函数名称: lcd_flush
+ * 说    明: 提交缓冲区中尚未下发的数据，不等待下发完成
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_flush(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_flush_wait
+ * 说    明: 提交缓冲区并等待已提交的数据全部下发到屏幕
+ * 参    数:
+ *       @timeout_ms：等待的超时时间，LOS_WAIT_FOREVER为一直等待
+ * 返 回 值: 全部下发完成返回true，超时返回false
+ ***************************************************************/
+bool lcd_flush_wait(uint32_t timeout_ms);
+
+
+/***************************************************************
+ * 函数名称: lcd_shadow_set
+ * 说    明: 设置影子缓冲区对应的屏幕起始行，原有内容全部作废，
+ *           之后写到该区域的像素会同时保存到影子缓冲区
+ * 参    数:
+ *       @y：影子缓冲区对应的起始行
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_shadow_set(uint16_t y);
+
+
+/***************************************************************
+ * 函数名称: lcd_scroll_define
+ * 说    明: 定义硬件滚动区域(VSCRDEF)，三个区域的行数之和必须为320，
+ *           行号为屏幕原生的行方向，见LCD_SCROLL_VERTICAL
+ * 参    数:
+ *       @tfa：顶部固定区域行数
+ *       @vsa：滚动区域行数
+ *       @bfa：底部固定区域行数
+ * 返 回 值: 参数正确返回true
+ ***************************************************************/
+bool lcd_scroll_define(uint16_t tfa, uint16_t vsa, uint16_t bfa);
+
+
+/***************************************************************
+ * 函数名称: lcd_scroll_start
+ * 说    明: 设置滚动区域第一行显示的显存行(VSCSAD)，进入滚动模式
+ * 参    数:
+ *       @vsp：显存行号，范围为tfa到tfa+vsa-1
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_scroll_start(uint16_t vsp);
+
+
+/***************************************************************
+ * 函数名称: lcd_scroll_stop
+ * 说    明: 退出滚动模式(NORON)，显存按原来的位置显示
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_scroll_stop(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_set_partial_area
+ * 说    明: 设置局部显示区域。局部显示沿屏幕原生的行方向，
+ *           竖屏时是一段行，横屏时是一段列(整个高度)
+ * 参    数:
+ *       @start：起始行(竖屏)或起始列(横屏)
+ *       @end：结束行(竖屏)或结束列(横屏)，包含
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_set_partial_area(uint16_t start, uint16_t end);
+
+
+/***************************************************************
+ * 函数名称: lcd_set_power
+ * 说    明: 切换屏幕电源状态，需要在帧外调用。关显示和睡眠时
+ *           lcd_frame_begin不下发任何数据，局部显示时只刷新局部区域，
+ *           回到正常显示时自动调用lcd_invalidate_all
+ * 参    数:
+ *       @state：电源状态
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_set_power(lcd_power_t state);
+
+
+/***************************************************************
+ * 函数名称: lcd_get_power
+ * 说    明: 获取屏幕电源状态
+ * 参    数: 无
+ * 返 回 值: 当前电源状态
+ ***************************************************************/
+lcd_power_t lcd_get_power(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_set_pixel_format
+ * 说    明: 切换接口像素格式，需要在帧外调用。绘图接口的颜色仍为RGB565，
+ *           RGB444模式下发送时转换，屏幕上的内容不会自动重画
+ * 参    数:
+ *       @format：LCD_FORMAT_RGB565或LCD_FORMAT_RGB444
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_set_pixel_format(lcd_pixel_format_t format);
+
+
+/***************************************************************
+ * 函数名称: lcd_get_pixel_format
+ * 说    明: 获取接口像素格式
+ * 参    数: 无
+ * 返 回 值: 当前像素格式
+ ***************************************************************/
+lcd_pixel_format_t lcd_get_pixel_format(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_benchmark_fill
+ * 说    明: 用指定像素格式整屏填充rounds次并计时，需要在帧外调用，
+ *           结束后恢复原来的像素格式并标记整屏刷新
+ * 参    数:
+ *       @format：测试的像素格式
+ *       @rounds：整屏填充次数
+ * 返 回 值: 总耗时(ms)
+ ***************************************************************/
+uint32_t lcd_benchmark_fill(lcd_pixel_format_t format, uint16_t rounds);
+
+
+/***************************************************************
+ * 函数名称: lcd_font_find
+ * 说    明: 查找汉字字模，字模和索引表由tools/asset_compiler.py生成
+ * 参    数:
+ *       @codepoint：Unicode码点
+ *       @sizey：字号，可选：12、16、24、32
+ * 返 回 值: 字模数据，每行(sizey+7)/8字节，低位在前；未找到返回NULL
+ ***************************************************************/
+const uint8_t *lcd_font_find(uint32_t codepoint, uint8_t sizey);
+
+
 #endif /* _LCD_H_ */
@@ -418,485 +418,6 @@ const unsigned char ascii_3216[][64] =
     {0x00, 0x00, 0x38, 0x00, 0xC4, 0x00, 0x86, 0x40, 0x02, 0x61, 0x00, 0x22, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"~",94*/
 };
 
-
-/* 定义中文字符 12*12 */
-typedef struct
-{
-    unsigned char Index[3];
-    unsigned char Msk[24];
-} typFNT_GB12;
-
-const typFNT_GB12 tfont12[] =
-{
-    "通", 0xF9,0x01,0x22,0x01,0xC0,0x00,0xF8,0x03,0x4B,0x02,0xFA,0x03,0x4A,0x02,0xFA,0x03,
-    0x4A,0x02,0x4A,0x03,0x02,0x00,0xFD,0x07,/*"通",0*/
-    
-    "晓", 0x40,0x00,0xC7,0x07,0x7D,0x02,0x45,0x01,0x85,0x04,0x77,0x07,0x05,0x00,0xFD,0x07,
-    0x25,0x01,0x27,0x01,0x15,0x05,0x08,0x06,/*"晓",1*/
-    
-    "开", 0x00,0x00,0xFE,0x03,0x88,0x00,0x88,0x00,0x88,0x00,0x88,0x00,0xFF,0x07,0x88,0x00,
-    0x88,0x00,0x84,0x00,0x84,0x00,0x82,0x00,/*"开",2*/
-
-    "发", 0x90,0x00,0x11,0x01,0x11,0x00,0xFF,0x07,0x08,0x00,0x08,0x00,0xF8,0x01,0x14,0x01,
-    0xA4,0x00,0x42,0x00,0xB1,0x01,0x0C,0x06,/*"发",3*/   
-    
-    "板", 0x04,0x06,0xE4,0x01,0x24,0x00,0x2F,0x00,0xE4,0x07,0xAE,0x04,0xB6,0x04,0xA5,0x02,
-    0xA4,0x02,0x24,0x01,0x94,0x02,0x4C,0x04,/*"板",4*/
-
-};
-
-/* 定义中文字符 16*16 */
-typedef struct
-{
-    unsigned char Index[3];
-    unsigned char Msk[32];
-} typFNT_GB16;
-
-const typFNT_GB16 tfont16[] =
-{
-    "通", 0x00,0x00,0xE2,0x1F,0x04,0x08,0x84,0x05,0x00,0x02,0xE0,0x3F,0x27,0x22,0x24,0x22,
-    0xE4,0x3F,0x24,0x22,0x24,0x22,0xE4,0x3F,0x24,0x22,0x24,0x2A,0x2A,0x10,0xF1,0x7F,/*"通",0*/
-    
-    "晓", 0x00,0x01,0x00,0x01,0x1E,0x3D,0xD2,0x03,0x12,0x0A,0x12,0x24,0x12,0x2B,0xDE,0x30,
-    0x12,0x00,0xD2,0x7F,0x12,0x09,0x12,0x09,0x9E,0x48,0x92,0x48,0x40,0x70,0x20,0x00,/*"晓",1*/
-    
-    "开", 0x00,0x00,0xFE,0x3F,0x10,0x04,0x10,0x04,0x10,0x04,0x10,0x04,0x10,0x04,0xFF,0x7F,
-    0x10,0x04,0x10,0x04,0x10,0x04,0x10,0x04,0x08,0x04,0x08,0x04,0x04,0x04,0x02,0x04,/*"开",2*/
-
-    "发", 0x80,0x00,0x88,0x08,0x88,0x10,0x44,0x00,0xFC,0x3F,0x40,0x00,0x20,0x00,0xE0,0x1F,
-    0x50,0x10,0x90,0x10,0x88,0x08,0x08,0x05,0x04,0x02,0x02,0x05,0xC0,0x18,0x38,0x60,/*"发",3*/
-    
-    "板", 0x08,0x10,0x08,0x38,0x88,0x07,0x88,0x00,0xBF,0x00,0x88,0x3F,0x8C,0x22,0x9C,0x22,
-    0xAA,0x22,0xAA,0x14,0x89,0x14,0x88,0x08,0x88,0x08,0x48,0x14,0x48,0x22,0x28,0x41,/*"板",4*/
-  
-};
-
-
-/* 定义中文字符 24*24 */
-typedef struct
-{
-    unsigned char Index[3];
-    unsigned char Msk[72];
-} typFNT_GB24;
-
-const typFNT_GB24 tfont24[] =
-{
-
-    "通", 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x07,0x08,0x00,0x0C,0x10,0x10,0x03,0x30,
-    0xE0,0x00,0x30,0xC0,0x00,0x00,0xFE,0x1F,0x00,0x42,0x10,0x00,0x42,0x10,0x3E,0xFE,
-    0x1F,0x20,0x42,0x10,0x20,0x42,0x10,0x20,0x42,0x10,0x20,0xFE,0x1F,0x20,0x42,0x10,
-    0x20,0x42,0x10,0x20,0x42,0x10,0x20,0x42,0x18,0x58,0x42,0x1C,0x8C,0x01,0x08,0x06,
-    0xFF,0x3F,0x00,0xF8,0x1F,0x00,0x00,0x00,/*"通",0*/
-    
-    "晓", 0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x30,0x00,0xFC,0x30,0x1C,0x84,
-    0xFC,0x03,0x84,0x62,0x0C,0x84,0x40,0x0E,0x84,0xC0,0x23,0x84,0x80,0x21,0xFC,0xE0,
-    0x23,0x84,0x18,0x3E,0x84,0x06,0x38,0x84,0x00,0x04,0x84,0xFF,0x0F,0x84,0x90,0x00,
-    0x84,0x90,0x00,0xFC,0x98,0x20,0x84,0x88,0x20,0x04,0x88,0x20,0x00,0x84,0x61,0x00,
-    0x83,0x3F,0xC0,0x00,0x00,0x00,0x00,0x00,/*"晓",1*/
-    
-    "开", 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xFC,0xFF,0x1F,0x00,0x81,0x00,0x00,
-    0x81,0x00,0x00,0x81,0x00,0x00,0x81,0x00,0x00,0x81,0x00,0x00,0x81,0x00,0x00,0x81,
-    0x10,0xFE,0xFF,0x3F,0x00,0x81,0x00,0x00,0x81,0x00,0x00,0x81,0x00,0x80,0x81,0x00,
-    0x80,0x80,0x00,0x80,0x80,0x00,0x40,0x80,0x00,0x60,0x80,0x00,0x30,0x80,0x00,0x08,
-    0x80,0x00,0x04,0x80,0x00,0x00,0x00,0x00,/*"开",2*/
-
-    "发", 0x00,0x00,0x00,0x00,0x44,0x00,0x00,0x84,0x01,0x60,0x06,0x03,0x30,0x06,0x06,0x10,
-    0x02,0x06,0x18,0x02,0x10,0xFC,0xFF,0x3F,0x08,0x02,0x00,0x00,0x03,0x00,0x00,0x03,
-    0x00,0x00,0xFF,0x07,0x00,0x05,0x06,0x80,0x05,0x02,0x80,0x08,0x03,0xC0,0x90,0x01,
-    0x40,0x90,0x00,0x60,0x60,0x00,0x20,0xE0,0x00,0x10,0x98,0x03,0x08,0x0C,0x0F,0x04,
-    0x03,0x7C,0xE2,0x00,0x10,0x00,0x00,0x00,/*"发",3*/
-
-    "板", 0x00,0x00,0x00,0x20,0x00,0x08,0x20,0x00,0x0E,0x20,0xC4,0x03,0x20,0x38,0x00,0x20,
-    0x08,0x00,0xFE,0x09,0x00,0x20,0x08,0x00,0x30,0xF8,0x1F,0x30,0x28,0x08,0xF0,0x28,
-    0x0C,0xB0,0x29,0x04,0x28,0x29,0x04,0x28,0x4D,0x06,0x28,0x4C,0x02,0x24,0xC4,0x03,
-    0x24,0x84,0x01,0x22,0x84,0x01,0x20,0xC4,0x01,0x20,0x42,0x03,0x20,0x32,0x0E,0x20,
-    0x19,0x3C,0xA0,0x06,0x38,0x20,0x01,0x00,/*"板",4*/
-
-    "温",0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x04,0x30,0xFE,0x07,0x20,0x02,0x04,0x00,
-    0x02,0x04,0x80,0xFE,0x07,0x82,0x02,0x04,0x4C,0x02,0x04,0x48,0x02,0x04,0x48,0xFE,
-    0x07,0x20,0x02,0x04,0x20,0x00,0x00,0x20,0xFF,0x1F,0x20,0x91,0x08,0x10,0x91,0x08,
-    0x1E,0x91,0x08,0x18,0x91,0x08,0x18,0x91,0x08,0x18,0x91,0x08,0x18,0x91,0x28,0xF8,
-    0xFF,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,/*"温",5*/
-
-    "湿",0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x08,0x30,0xFE,0x1F,0x30,0x06,0x08,0x20,
-    0x06,0x08,0x80,0xFE,0x0F,0x82,0x06,0x08,0x4C,0x06,0x08,0x58,0x06,0x08,0x48,0xFE,
-    0x0F,0x20,0x16,0x09,0x20,0x10,0x01,0x20,0x10,0x31,0x10,0x11,0x31,0x1A,0x13,0x19,
-    0x1C,0x12,0x0D,0x08,0x16,0x05,0x08,0x12,0x03,0x08,0x10,0x01,0x0C,0x10,0x21,0xC8,
-    0xFF,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,/*"湿",7*/
-
-    "度",0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x30,0x00,0x00,0x30,0x10,0xF0,0xFF,0x3F,0x10,
-    0x02,0x01,0x10,0x04,0x03,0x10,0x04,0x11,0xF0,0xFF,0x3F,0x10,0x04,0x01,0x10,0x04,
-    0x01,0x10,0xFC,0x01,0x10,0x04,0x01,0x10,0x00,0x00,0x98,0xFF,0x07,0x18,0x04,0x02,
-    0x08,0x04,0x01,0x08,0x88,0x00,0x08,0x50,0x00,0x04,0x70,0x00,0x04,0x8C,0x03,0x02,
-    0x03,0x7E,0xE0,0x00,0x10,0x00,0x00,0x00,/*"度",8*/
-
-    "光",0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x20,0x18,0x02,0x40,
-    0x18,0x06,0x80,0x18,0x03,0x80,0x19,0x01,0x00,0x99,0x00,0x00,0x98,0x10,0xFE,0xFF,
-    0x3F,0x00,0x63,0x00,0x00,0x63,0x00,0x00,0x63,0x00,0x00,0x61,0x00,0x00,0x61,0x00,
-    0x00,0x61,0x20,0x80,0x61,0x20,0x80,0x60,0x20,0x40,0x60,0x20,0x20,0x40,0x60,0x18,
-    0xC0,0x3F,0x06,0x00,0x00,0x00,0x00,0x00,/*"光",9*/
-
-    "照",0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF9,0x1F,0xF8,0x43,0x18,0x08,0x41,0x08,0x08,
-    0x61,0x08,0x08,0x21,0x08,0x08,0x11,0x0E,0xF8,0x09,0x04,0x08,0x05,0x00,0x08,0xF1,
-    0x1F,0x08,0x31,0x08,0x08,0x31,0x08,0x08,0x31,0x08,0xF8,0xF1,0x0F,0x08,0x31,0x08,
-    0x88,0x00,0x00,0x10,0x21,0x04,0x10,0x61,0x08,0x18,0xC2,0x18,0x18,0xC2,0x30,0x0C,
-    0xC2,0x30,0x0C,0x02,0x20,0x00,0x00,0x00,/*"照",10*/
-
-    "强",0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x0F,0xFC,0x11,0x08,0x80,0x11,0x08,0x80,
-    0x11,0x08,0x80,0xF1,0x0F,0x80,0x99,0x08,0xF8,0x81,0x01,0x88,0x81,0x01,0x08,0x80,
-    0x01,0x08,0xF8,0x3F,0x0C,0x88,0x11,0xFC,0x89,0x11,0x80,0x88,0x11,0x80,0xF8,0x1F,
-    0x80,0x88,0x11,0x80,0x84,0x09,0x80,0x80,0x11,0xC0,0x80,0x31,0x40,0x80,0x7F,0x78,
-    0x7E,0x60,0x30,0x02,0x00,0x00,0x00,0x00,/*"强",11*/
-
-    "℃",0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x48,0xF8,0x01,0x48,
-    0x0C,0x16,0x48,0x06,0x18,0x30,0x03,0x18,0x00,0x01,0x10,0x80,0x01,0x10,0x80,0x01,
-    0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x00,0x01,0x00,
-    0x00,0x03,0x00,0x00,0x03,0x08,0x00,0x06,0x04,0x00,0x1C,0x03,0x00,0xF0,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*"℃",13*/
-
-    "传",0x00,0x00,0x00,0x80,0x40,0x00,0x80,0xC1,0x00,0xC0,0x40,0x00,0xC0,0x40,0x00,0x40,
-    0x40,0x00,0x60,0xFE,0x1F,0x20,0x60,0x00,0x70,0x20,0x00,0x70,0x20,0x00,0x68,0x20,
-    0x00,0xE8,0xFF,0x3F,0x64,0x30,0x00,0x62,0x30,0x00,0x60,0x10,0x08,0x60,0xF8,0x1F,
-    0x60,0x10,0x0C,0x60,0x00,0x06,0x60,0x00,0x02,0x60,0x10,0x01,0x60,0xE0,0x00,0x60,
-    0x80,0x03,0x60,0x00,0x06,0x20,0x00,0x04,/*"传",14*/
-
-    "感",0x00,0x00,0x00,0x00,0x40,0x02,0x00,0x40,0x04,0x00,0x40,0x04,0xF0,0xFF,0x3F,0x10,
-    0x40,0x00,0x10,0xC0,0x08,0xD0,0xFF,0x18,0x10,0x80,0x0C,0x10,0x80,0x04,0x90,0x9F,
-    0x06,0x90,0x90,0x03,0x88,0x90,0x23,0x88,0xDF,0x26,0x84,0x70,0x2C,0x04,0x10,0x38,
-    0x02,0x08,0x60,0x90,0x18,0x04,0x90,0x30,0x18,0x98,0x00,0x11,0x8C,0x00,0x11,0x84,
-    0x00,0x01,0x80,0xFF,0x01,0x00,0x00,0x00,/*"感",15*/
-
-    "器",0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xE3,0x0F,0x30,0x66,0x0C,0x30,0x66,0x0C,0x30,
-    0x66,0x0C,0x30,0x66,0x0C,0xF0,0xE7,0x0F,0x30,0xFE,0x0D,0x10,0x0C,0x13,0xFC,0xFF,
-    0x3F,0x00,0x42,0x00,0x00,0x81,0x00,0x80,0x00,0x01,0x60,0x00,0x0E,0xF0,0xE7,0x3F,
-    0x2C,0x26,0x0C,0x20,0x26,0x0C,0x20,0x26,0x0C,0x20,0x26,0x0C,0xE0,0xE7,0x0F,0x20,
-    0x26,0x0C,0x10,0x22,0x04,0x00,0x00,0x00,/*"器",16*/
-
-    "数",0x00,0x00,0x00,0x80,0x80,0x00,0x88,0x88,0x01,0x90,0x88,0x00,0xB0,0xC4,0x00,0x90,
-    0x42,0x00,0xFC,0xDF,0x3F,0xC0,0x60,0x08,0xE0,0x63,0x08,0xA0,0x64,0x08,0x90,0x5C,
-    0x0C,0x8C,0x50,0x0C,0x82,0x80,0x0C,0xC0,0x80,0x04,0xFE,0x8F,0x04,0x60,0x84,0x07,
-    0x20,0x04,0x03,0x70,0x02,0x03,0x80,0x87,0x07,0x80,0xCD,0x0C,0x60,0x68,0x38,0x18,
-    0x18,0x30,0x06,0x04,0x00,0x00,0x00,0x00,/*"数",17*/
-
-    "据",0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x60,0xFC,0x1F,0x20,0x0C,0x18,0x20,
-    0x0C,0x18,0x20,0x0D,0x18,0xFE,0xFF,0x1F,0x20,0x0C,0x19,0x20,0x04,0x01,0x20,0x06,
-    0x01,0xA0,0xFD,0x3F,0x60,0x04,0x01,0x30,0x04,0x01,0x2E,0x04,0x01,0x24,0xF6,0x1F,
-    0x20,0x12,0x18,0x20,0x12,0x18,0x20,0x11,0x18,0x20,0x11,0x18,0xA0,0xF0,0x1F,0x7C,
-    0x10,0x18,0x30,0x10,0x08,0x00,0x00,0x00,/*"据",18*/
-
-    "设",0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xF8,0x03,0x20,0x18,0x06,0x60,0x18,0x02,0x60,
-    0x18,0x02,0x00,0x08,0x02,0x00,0x08,0x02,0x00,0x04,0x02,0x7E,0x06,0x7E,0x20,0x01,
-    0x04,0xA0,0xFC,0x0F,0x20,0x08,0x04,0x20,0x10,0x06,0x20,0x10,0x06,0x20,0x20,0x02,
-    0x20,0x22,0x01,0x20,0xC1,0x01,0xA0,0xC0,0x00,0x60,0x60,0x03,0x60,0x18,0x0E,0x00,
-    0x06,0x38,0x80,0x01,0x00,0x00,0x00,0x00,/*"设",19*/
-
-    "备",0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x03,0x00,0x00,0xFF,0x03,0x80,0x01,0x01,0x80,
-    0x82,0x01,0x40,0xC2,0x00,0x60,0x64,0x00,0x30,0x3C,0x00,0x08,0x18,0x00,0x00,0x3C,
-    0x00,0x00,0xC2,0x00,0x80,0x81,0x07,0xE0,0xFF,0x7F,0x5C,0x10,0x12,0x40,0x10,0x02,
-    0x40,0x10,0x02,0xC0,0xFF,0x03,0x40,0x10,0x02,0x40,0x10,0x02,0xC0,0xFF,0x03,0x40,
-    0x00,0x02,0x40,0x00,0x02,0x00,0x00,0x00,/*"备",20*/
-
-    "状",0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x40,0x00,0x80,0x40,0x02,0x80,0x40,0x0C,0x80,
-    0x40,0x18,0x84,0x40,0x18,0x88,0x40,0x10,0x98,0x40,0x10,0x90,0xFF,0x3F,0x80,0xC0,
-    0x00,0x80,0x40,0x01,0xC0,0x60,0x01,0xA0,0x60,0x01,0x90,0x20,0x01,0x8C,0x20,0x02,
-    0x86,0x30,0x02,0x80,0x10,0x06,0x80,0x18,0x0C,0x80,0x08,0x1C,0x80,0x04,0x38,0x80,
-    0x02,0x30,0x40,0x01,0x00,0x00,0x00,0x00,/*"状",21*/
-
-    "态",0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x0C,0x10,0xFC,
-    0xFF,0x3F,0x00,0x14,0x00,0x00,0x24,0x00,0x00,0x26,0x00,0x00,0x42,0x00,0x00,0x83,
-    0x01,0x80,0x0C,0x07,0x60,0x18,0x3E,0x18,0x10,0x18,0x06,0x00,0x00,0x00,0x0C,0x00,
-    0x90,0x19,0x04,0x90,0x10,0x18,0x98,0x10,0x19,0x9C,0x00,0x11,0x8C,0x00,0x11,0x80,
-    0x01,0x01,0x00,0xFF,0x01,0x00,0x00,0x00,/*"态",22*/
-
-    "灯",0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x10,0x60,0xFC,0x3F,0x60,
-    0x80,0x01,0x60,0x82,0x01,0x60,0x83,0x01,0xE4,0x80,0x01,0x64,0x80,0x01,0x66,0x80,
-    0x01,0x62,0x80,0x01,0x60,0x80,0x01,0x20,0x80,0x01,0x20,0x80,0x01,0x60,0x80,0x01,
-    0xA0,0x81,0x01,0x30,0x83,0x01,0x10,0x83,0x01,0x10,0x82,0x01,0x08,0x98,0x01,0x04,
-    0xE0,0x01,0x02,0xC0,0x00,0x00,0x00,0x00,/*"灯",23*/
-
-    "光",0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x20,0x18,0x02,0x40,
-    0x18,0x06,0x80,0x18,0x03,0x80,0x19,0x01,0x00,0x99,0x00,0x00,0x98,0x10,0xFE,0xFF,
-    0x3F,0x00,0x63,0x00,0x00,0x63,0x00,0x00,0x63,0x00,0x00,0x61,0x00,0x00,0x61,0x00,
-    0x00,0x61,0x20,0x80,0x61,0x20,0x80,0x60,0x20,0x40,0x60,0x20,0x20,0x40,0x60,0x18,
-    0xC0,0x3F,0x06,0x00,0x00,0x00,0x00,0x00,/*"光",24*/
-
-    "电",0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,
-    0x08,0x00,0xF0,0xFF,0x0F,0x10,0x08,0x04,0x10,0x08,0x04,0x10,0x08,0x04,0xF0,0xFF,
-    0x07,0x10,0x08,0x04,0x10,0x08,0x04,0x10,0x08,0x04,0x10,0x08,0x04,0xF0,0xFF,0x07,
-    0x10,0x08,0x04,0x10,0x08,0x00,0x00,0x08,0x20,0x00,0x08,0x20,0x00,0x08,0x20,0x00,
-    0x08,0x30,0x00,0xF8,0x3F,0x00,0x00,0x00,/*"电",25*/
-
-    "机",0x00,0x00,0x00,0x20,0x00,0x00,0x60,0x00,0x00,0x20,0xF8,0x07,0x20,0x18,0x02,0x20,
-    0x18,0x02,0x20,0x18,0x02,0xFE,0x1B,0x02,0x20,0x18,0x02,0x20,0x18,0x02,0x70,0x18,
-    0x02,0xB0,0x19,0x02,0x30,0x1B,0x02,0x30,0x1A,0x02,0x28,0x18,0x02,0x28,0x18,0x02,
-    0x24,0x08,0x02,0x24,0x08,0x02,0x22,0x0C,0x22,0x20,0x04,0x22,0x60,0x06,0x22,0x60,
-    0x02,0x66,0x60,0x01,0x3E,0xA0,0x00,0x00,/*"机",26*/
-
-    "启",0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0x00,0x30,0x00,0xE0,0xFF,0x0F,0x20,
-    0x00,0x0C,0x20,0x00,0x0C,0x20,0x00,0x0C,0x20,0x00,0x0C,0xE0,0xFF,0x0F,0x20,0x00,
-    0x0C,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0xFF,0x0F,0x20,0x01,0x0C,0x20,0x01,0x0C,
-    0x30,0x01,0x0C,0x10,0x01,0x0C,0x10,0x01,0x0C,0x18,0x01,0x0C,0x08,0xFF,0x0F,0x04,
-    0x01,0x0C,0x02,0x01,0x04,0x00,0x00,0x00,/*"启",28*/
-
-    "关",0x00,0x00,0x00,0x00,0x80,0x00,0x80,0x81,0x01,0x00,0x83,0x00,0x00,0x42,0x00,0x00,
-    0x42,0x00,0xF8,0xFF,0x1F,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x08,
-    0x00,0x00,0x08,0x10,0xFE,0xFF,0x3F,0x00,0x28,0x00,0x00,0x2C,0x00,0x00,0x44,0x00,
-    0x00,0xC6,0x00,0x00,0x82,0x00,0x00,0x01,0x01,0x80,0x00,0x06,0x60,0x00,0x1C,0x18,
-    0x00,0x78,0x04,0x00,0x10,0x00,0x00,0x00,/*"关",29*/
-
-    "闭",0x00,0x00,0x00,0x20,0x00,0x00,0xC0,0x00,0x10,0x80,0xFC,0x3F,0x88,0x00,0x10,0x18,
-    0x20,0x10,0x18,0x60,0x10,0x18,0x20,0x10,0x18,0x20,0x10,0xD8,0xFF,0x17,0x18,0x30,
-    0x10,0x18,0x38,0x10,0x18,0x28,0x10,0x18,0x24,0x10,0x18,0x22,0x10,0x18,0x21,0x10,
-    0x98,0x20,0x10,0x58,0x20,0x10,0x38,0x20,0x10,0x18,0x38,0x10,0x18,0x10,0x10,0x18,
-    0x00,0x1E,0x08,0x00,0x08,0x00,0x00,0x00,/*"闭",30*/
-
-    "自",0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0xE0,
-    0xFF,0x0F,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0xE0,0xFF,
-    0x07,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0xE0,0xFF,0x07,
-    0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0xE0,0xFF,0x07,0x20,
-    0x00,0x04,0x20,0x00,0x04,0x00,0x00,0x00,/*"自",31*/
-
-    "动",0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0x82,0x00,0xFC,
-    0x87,0x00,0x00,0x80,0x00,0x00,0xF0,0x3F,0x00,0x80,0x30,0xFE,0x8F,0x30,0x40,0x80,
-    0x30,0x60,0x80,0x30,0x20,0x80,0x10,0x30,0x81,0x10,0x10,0xC2,0x10,0x08,0x46,0x10,
-    0x08,0x44,0x10,0xFC,0x2F,0x10,0x0C,0x38,0x10,0x00,0x10,0x10,0x00,0x88,0x19,0x00,
-    0x06,0x0E,0x00,0x01,0x04,0x00,0x00,0x00,/*"动",32*/
-
-"风",0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xF0,0xFF,0x07,0x30,
-0x00,0x02,0x30,0x00,0x02,0x30,0x40,0x02,0x30,0x60,0x02,0x30,0x21,0x02,0x30,0x32,
-0x02,0x30,0x14,0x02,0x30,0x18,0x02,0x30,0x18,0x02,0x30,0x34,0x02,0x10,0x62,0x06,
-0x10,0xC1,0x46,0x90,0xC0,0x44,0x50,0x00,0x4C,0x28,0x00,0x28,0x08,0x00,0x38,0x04,
-0x00,0x70,0x02,0x00,0x40,0x00,0x00,0x00,/*0*/
-
-"扇",0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0xF0,0xFF,0x1F,0x30,
-0x00,0x08,0x30,0x00,0x08,0xF0,0xFF,0x0F,0x30,0x00,0x08,0x30,0x00,0x00,0xF0,0xFF,
-0x1F,0x30,0x18,0x18,0xB0,0x58,0x18,0x30,0x99,0x19,0x10,0x1B,0x19,0x10,0x19,0x19,
-0x10,0x1C,0x1E,0x18,0x9B,0x19,0xC8,0xF8,0x18,0x48,0x58,0x18,0x04,0x18,0x18,0x04,
-0x0E,0x0E,0x02,0x08,0x0C,0x00,0x00,0x00,/*1*/
-
-"当",0x00,0x10,0x00,0x00,0x30,0x00,0x08,0x10,0x08,0x30,0x10,0x1C,0x60,0x10,0x0C,0xC0,
-0x10,0x06,0xC0,0x10,0x01,0x00,0x90,0x00,0x00,0x10,0x20,0xF8,0xFF,0x7F,0x00,0x00,
-0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0xF0,0xFF,0x7F,
-0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0xFC,
-0xFF,0x7F,0x00,0x00,0x60,0x00,0x00,0x20,/*"当",0*/
-
-"前",0x00,0x00,0x00,0x80,0x01,0x07,0x00,0x03,0x01,0x00,0x83,0x00,0x00,0x82,0x40,0xFE,
-0xFF,0xFF,0x00,0x00,0x08,0x00,0x04,0x30,0xF8,0x0F,0x10,0x18,0x84,0x11,0x18,0x84,
-0x10,0x18,0x84,0x10,0xF8,0x87,0x10,0x18,0x84,0x10,0x18,0x84,0x10,0x18,0x84,0x10,
-0xF8,0x87,0x10,0x18,0x84,0x10,0x18,0x84,0x10,0x18,0x84,0x10,0x18,0x04,0x10,0x18,
-0x84,0x1F,0x18,0x07,0x1E,0x18,0x02,0x0C,/*"前",1*/
-
-"应",0x00,0x10,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x40,0x60,0xF8,0xFF,0xFF,0x18,
-0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x10,0x70,0x98,0x10,0x30,0x98,0x20,
-0x30,0x18,0x61,0x10,0x18,0x43,0x18,0x18,0xC2,0x08,0x08,0xC6,0x08,0x08,0xC6,0x0C,
-0x08,0x06,0x04,0x08,0x04,0x04,0x0C,0x00,0x02,0x04,0x00,0x02,0x04,0x00,0x61,0xF2,
-0xFF,0xFF,0x02,0x00,0x00,0x01,0x00,0x00,/*"应",2*/
-
-"服",0x00,0x12,0x20,0xF8,0xE7,0x7F,0x08,0x22,0x30,0x08,0x22,0x30,0x08,0x22,0x30,0x08,
-0x22,0x30,0xF8,0x23,0x30,0x08,0x22,0x1E,0x08,0x22,0x08,0x08,0x22,0x00,0x08,0xE2,
-0x7F,0x08,0xA2,0x20,0xF8,0x23,0x21,0x08,0x22,0x31,0x08,0x22,0x11,0x08,0x22,0x12,
-0x08,0x22,0x1E,0x08,0x22,0x0C,0x0C,0x22,0x0C,0x04,0x22,0x1E,0x04,0x22,0x71,0xC2,
-0xA3,0xE0,0x82,0x63,0x00,0x01,0x10,0x00,/*"服",3*/
-
-"药",0x00,0x81,0x00,0x00,0x83,0x01,0x00,0x81,0x41,0xFE,0xFF,0xFF,0x00,0x81,0x01,0x00,
-0x81,0x01,0xC0,0x40,0x00,0xC0,0x80,0x01,0x60,0xC0,0x00,0x30,0xC2,0x00,0x10,0xC6,
-0x7F,0x08,0x23,0x60,0xFE,0x21,0x60,0x8C,0x10,0x60,0x40,0x28,0x60,0x20,0xC4,0x20,
-0x10,0x80,0x21,0xF8,0x83,0x21,0x3C,0x00,0x21,0x08,0x00,0x20,0x00,0x00,0x20,0x80,
-0x07,0x30,0x7E,0x00,0x37,0x0C,0x00,0x1C,/*"药",4*/
-
-"位",0x40,0x20,0x00,0xC0,0x40,0x00,0x40,0xC0,0x00,0x60,0xC0,0x00,0x20,0x80,0x00,0x20,
-0x80,0x20,0x30,0xFF,0x7F,0x10,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x18,0x3C,0x04,
-0x18,0x34,0x08,0x0C,0x32,0x08,0x0C,0x32,0x18,0x0C,0x31,0x18,0x04,0x30,0x10,0x04,
-0x30,0x30,0x06,0x30,0x30,0x02,0x30,0x10,0x02,0x30,0x00,0x02,0x30,0x00,0x01,0x30,
-0x00,0x41,0xB0,0xFF,0xFF,0x30,0x00,0x00,/*"位",0*/
-
-"置",0x00,0x00,0x20,0xF8,0xFF,0x3F,0x18,0x86,0x30,0x18,0x86,0x30,0x18,0x86,0x30,0xF8,
-0xFF,0x3F,0x18,0x18,0x10,0x00,0x18,0x10,0xFC,0xFF,0x3F,0x00,0x08,0x00,0x00,0x08,
-0x04,0xE0,0xFF,0x0F,0x60,0x00,0x04,0x60,0x00,0x04,0xE0,0xFF,0x07,0x60,0x00,0x04,
-0x60,0x00,0x04,0xE0,0xFF,0x07,0x60,0x00,0x04,0x60,0x00,0x04,0xE0,0xFF,0x07,0x60,
-0x00,0x04,0x60,0x00,0xC4,0xFF,0xFF,0xFF,/*"置",1*/
-
-"：",0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x18,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,
-0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*"：",0*/
-
-
-
-
-
-
-
-    
-};
-
-/* 定义中文字符 32*32 */
-typedef struct
-{
-    unsigned char Index[3];
-    unsigned char Msk[128];
-} typFNT_GB32;
-
-const typFNT_GB32 tfont32[] =
-{
-
-    "通",0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x10,0xF0,0xFF,0x07,
-    0x30,0x00,0x80,0x07,0x60,0x00,0xC1,0x00,0xE0,0x00,0x2E,0x00,0xC0,0x00,0x1C,0x00,
-    0x40,0x08,0x18,0x04,0x00,0xF8,0xFF,0x1F,0x00,0x18,0x08,0x0C,0x00,0x18,0x08,0x0C,
-    0x80,0x18,0x08,0x0C,0xFE,0xF9,0xFF,0x0F,0xC0,0x18,0x08,0x0C,0xC0,0x18,0x08,0x0C,
-    0xC0,0x18,0x08,0x0C,0xC0,0x18,0x08,0x0C,0xC0,0xF8,0xFF,0x0F,0xC0,0x18,0x08,0x0C,
-    0xC0,0x18,0x08,0x0C,0xC0,0x18,0x08,0x0C,0xC0,0x18,0x08,0x0C,0xC0,0x18,0x08,0x0C,
-    0xC0,0x18,0x88,0x0F,0x30,0x09,0x00,0x06,0x1C,0x06,0x00,0x00,0x0E,0x7C,0x00,0x70,
-    0x04,0xF0,0xFF,0x1F,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*"通",0*/
-    
-    "晓",0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x03,0x00,
-    0x00,0x00,0x03,0x00,0x00,0x02,0x03,0x04,0xF8,0x07,0x02,0x0E,0x18,0x06,0xFE,0x01,
-    0x18,0xFE,0x07,0x02,0x18,0x06,0x04,0x07,0x18,0x06,0x8C,0x07,0x18,0x06,0xC8,0x01,
-    0x18,0x06,0xF8,0x10,0x18,0x06,0x30,0x10,0xF8,0x07,0x7C,0x10,0x18,0x06,0xC7,0x11,
-    0x18,0xE6,0x80,0x1F,0x18,0x16,0x00,0x3C,0x18,0x06,0x00,0x03,0x18,0xFE,0xFF,0x07,
-    0x18,0x06,0x31,0x00,0x18,0x06,0x31,0x00,0x18,0x86,0x31,0x00,0xF8,0x87,0x31,0x10,
-    0x18,0x86,0x31,0x10,0x18,0xC2,0x30,0x10,0x18,0xC0,0x30,0x10,0x00,0x60,0x30,0x30,
-    0x00,0x30,0xF0,0x3F,0x00,0x0C,0xE0,0x1F,0x80,0x03,0x00,0x00,0x00,0x00,0x00,0x00,/*"晓",1*/
-    
-    "开",0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
-    0x00,0x00,0x00,0x0E,0xF8,0xFF,0xFF,0x1F,0x00,0x0C,0x30,0x00,0x00,0x0C,0x30,0x00,
-    0x00,0x0C,0x30,0x00,0x00,0x0C,0x30,0x00,0x00,0x0C,0x30,0x00,0x00,0x0C,0x30,0x00,
-    0x00,0x0C,0x30,0x00,0x00,0x0C,0x30,0x00,0x00,0x0C,0x30,0x18,0xFC,0xFF,0xFF,0x3F,
-    0x00,0x0C,0x30,0x00,0x00,0x0C,0x30,0x00,0x00,0x0C,0x30,0x00,0x00,0x0C,0x30,0x00,
-    0x00,0x0C,0x30,0x00,0x00,0x04,0x30,0x00,0x00,0x06,0x30,0x00,0x00,0x06,0x30,0x00,
-    0x00,0x03,0x30,0x00,0x00,0x01,0x30,0x00,0x80,0x00,0x30,0x00,0x40,0x00,0x30,0x00,
-    0x20,0x00,0x30,0x00,0x18,0x00,0x30,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x00,0x00,/*"开",2*/
-    
-    "发",0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x60,0x10,0x00,
-    0xC0,0x60,0x60,0x00,0xC0,0x20,0xC0,0x00,0xC0,0x30,0xC0,0x01,0x60,0x30,0x80,0x01,
-    0x60,0x30,0x00,0x01,0x30,0x30,0x00,0x18,0xF8,0xFF,0xFF,0x3F,0x10,0x10,0x00,0x00,
-    0x00,0x18,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x18,0x00,0x01,0x00,0xFC,0xFF,0x03,
-    0x00,0x2C,0x80,0x01,0x00,0x4C,0xC0,0x01,0x00,0x46,0xC0,0x00,0x00,0x86,0x60,0x00,
-    0x00,0x82,0x61,0x00,0x00,0x03,0x33,0x00,0x00,0x01,0x1A,0x00,0x80,0x01,0x0E,0x00,
-    0xC0,0x00,0x1E,0x00,0x40,0x00,0x3F,0x00,0x20,0x80,0xF1,0x00,0x10,0xE0,0xC0,0x03,
-    0x08,0x30,0x80,0x3F,0x04,0x0E,0x00,0x1E,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,/*"发",3*/
-
-    "板",0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0xC0,0x01,0x00,0x07,
-    0xC0,0x00,0xC0,0x0F,0xC0,0x40,0x7C,0x00,0xC0,0xC0,0x03,0x00,0xC0,0xC0,0x00,0x00,
-    0xC0,0xCC,0x00,0x00,0xFC,0xDF,0x00,0x00,0xC0,0xC0,0x00,0x04,0xC0,0xC0,0xFF,0x0F,
-    0xC0,0xC0,0x02,0x06,0xE0,0xC1,0x02,0x02,0xE0,0xC2,0x04,0x03,0xE0,0xCE,0x04,0x03,
-    0xE0,0xCC,0x04,0x01,0xF0,0xC8,0x84,0x01,0xD0,0xC8,0x88,0x01,0xD8,0x40,0xC8,0x00,
-    0xC8,0x40,0xD8,0x00,0xC8,0x60,0x70,0x00,0xC4,0x60,0x30,0x00,0xC2,0x20,0x70,0x00,
-    0xC0,0x20,0xD8,0x00,0xC0,0x30,0xCC,0x01,0xC0,0x10,0x82,0x03,0xC0,0x88,0x01,0x0F,
-    0xC0,0x64,0x00,0x7E,0xC0,0x12,0x00,0x0C,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*"板",4*/
-
-    "智",0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x80,0x00,0x00,0x00,
-    0xC0,0xC0,0x00,0x08,0xC0,0xFF,0xF9,0x1F,0x60,0x0C,0x18,0x0C,0x20,0x0C,0x18,0x0C,
-    0x10,0x0C,0x18,0x0C,0x00,0x0C,0x18,0x0C,0x00,0x84,0x19,0x0C,0xFC,0xFF,0x1B,0x0C,
-    0x00,0x06,0x18,0x0C,0x00,0x0E,0x18,0x0C,0x00,0x32,0xF8,0x0F,0x00,0xE3,0x18,0x0C,
-    0x80,0xC1,0x19,0x0C,0xC0,0x80,0x01,0x00,0x60,0x00,0x01,0x00,0x18,0xFE,0xFF,0x03,
-    0x04,0x06,0x80,0x01,0x00,0x06,0x80,0x01,0x00,0x06,0x80,0x01,0x00,0xFE,0xFF,0x01,
-    0x00,0x06,0x80,0x01,0x00,0x06,0x80,0x01,0x00,0x06,0x80,0x01,0x00,0x06,0x80,0x01,
-    0x00,0xFE,0xFF,0x01,0x00,0x06,0x80,0x01,0x00,0x02,0x80,0x00,0x00,0x00,0x00,0x00,/*"智",5*/
-
-    "慧",0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x20,0x00,0x00,0x0E,0x60,0x00,
-    0x00,0x46,0x20,0x08,0xF8,0xFF,0xFF,0x1F,0x00,0x06,0x20,0x00,0x00,0x26,0x20,0x04,
-    0xF0,0x7F,0xFE,0x0F,0x00,0x06,0x20,0x00,0x00,0x46,0x20,0x10,0xF8,0xFF,0xFE,0x3F,
-    0x00,0x06,0x20,0x00,0x00,0x06,0x20,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x07,
-    0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x80,0xFF,0xFF,0x03,0x00,0x00,0x00,0x03,
-    0x00,0x00,0x00,0x03,0xC0,0xFF,0xFF,0x03,0x00,0x40,0x00,0x03,0x00,0x84,0x00,0x00,
-    0x40,0x8C,0x01,0x02,0x20,0x0C,0x43,0x0C,0x20,0x0C,0x41,0x18,0x30,0x0C,0x60,0x18,
-    0x18,0x0C,0xE0,0x10,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*"慧",6*/
-
-    "家",0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0xC0,0x01,0x00,
-    0x00,0x80,0x01,0x00,0x20,0x00,0x01,0x08,0xE0,0xFF,0xFF,0x1F,0x20,0x00,0x00,0x1C,
-    0x30,0x00,0x00,0x04,0x18,0x00,0xC0,0x02,0x80,0xFF,0xFF,0x01,0x00,0x60,0x00,0x00,
-    0x00,0x30,0x00,0x00,0x00,0x58,0x80,0x01,0x00,0xCC,0xC0,0x03,0x00,0x83,0x61,0x00,
-    0xC0,0xC0,0x19,0x00,0x30,0x60,0x17,0x00,0x08,0x30,0x22,0x00,0x00,0x0C,0x27,0x00,
-    0x00,0x86,0x67,0x00,0x80,0xC1,0x47,0x00,0x60,0xE0,0xC4,0x00,0x18,0x30,0x84,0x01,
-    0x00,0x18,0x04,0x07,0x00,0x06,0x04,0x1E,0x00,0x03,0x06,0x1C,0xE0,0x00,0x06,0x08,
-    0x18,0xF0,0x07,0x00,0x04,0xC0,0x03,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x00,/*"家",7*/
-
-    "居",0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x04,
-    0xC0,0xFF,0xFF,0x0F,0xC0,0x00,0x00,0x06,0xC0,0x00,0x00,0x06,0xC0,0x00,0x00,0x06,
-    0xC0,0x00,0x00,0x06,0xC0,0xFF,0xFF,0x07,0xC0,0x00,0x02,0x06,0xC0,0x00,0x06,0x00,
-    0xC0,0x00,0x06,0x00,0xC0,0x00,0x06,0x00,0xC0,0x00,0x06,0x18,0xC0,0xFF,0xFF,0x3F,
-    0xC0,0x00,0x06,0x00,0x40,0x00,0x06,0x00,0x40,0x00,0x06,0x00,0x40,0x00,0x06,0x00,
-    0x60,0x04,0x06,0x03,0x60,0xFC,0xFF,0x07,0x60,0x0C,0x00,0x03,0x20,0x0C,0x00,0x03,
-    0x30,0x0C,0x00,0x03,0x10,0x0C,0x00,0x03,0x10,0x0C,0x00,0x03,0x08,0x0C,0x00,0x03,
-    0x08,0xFC,0xFF,0x03,0x04,0x0C,0x00,0x03,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,/*"居",8*/
-
-"灯",0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x80,0x01,0x00,0x00,
-0x80,0x01,0x00,0x18,0x80,0xE1,0xFF,0x3F,0x80,0x01,0x60,0x00,0x80,0x01,0x60,0x00,
-0x80,0x19,0x60,0x00,0x90,0x19,0x60,0x00,0x90,0x0D,0x60,0x00,0x88,0x07,0x60,0x00,
-0x88,0x01,0x60,0x00,0x8C,0x01,0x60,0x00,0x8C,0x01,0x60,0x00,0x84,0x01,0x60,0x00,
-0x80,0x01,0x60,0x00,0x80,0x01,0x60,0x00,0x80,0x01,0x60,0x00,0x80,0x00,0x60,0x00,
-0x80,0x01,0x60,0x00,0xC0,0x06,0x60,0x00,0xC0,0x0C,0x60,0x00,0x40,0x18,0x60,0x00,
-0x40,0x18,0x60,0x00,0x20,0x10,0x60,0x00,0x30,0x00,0x60,0x00,0x10,0x80,0x30,0x00,
-0x08,0x00,0x3F,0x00,0x04,0x00,0x3C,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,/*0*/
-
-"光",0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x80,0x03,0x00,
-0x00,0x80,0x01,0x00,0x40,0x80,0x01,0x00,0x80,0x81,0x81,0x01,0x00,0x83,0xC1,0x01,
-0x00,0x86,0xC1,0x00,0x00,0x8E,0x61,0x00,0x00,0x8C,0x61,0x00,0x00,0x8C,0x21,0x00,
-0x00,0x80,0x11,0x08,0x00,0x80,0x09,0x0C,0xFC,0xFF,0xFF,0x1F,0x00,0x18,0x0C,0x00,
-0x00,0x18,0x0C,0x00,0x00,0x18,0x0C,0x00,0x00,0x18,0x0C,0x00,0x00,0x18,0x0C,0x00,
-0x00,0x08,0x0C,0x00,0x00,0x0C,0x0C,0x00,0x00,0x0C,0x0C,0x10,0x00,0x04,0x0C,0x10,
-0x00,0x06,0x0C,0x10,0x00,0x02,0x0C,0x10,0x00,0x03,0x0C,0x10,0x80,0x00,0x0C,0x30,
-0x60,0x00,0xFC,0x3F,0x18,0x00,0xF8,0x1F,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*1*/
-
-"关",0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x06,0x70,0x00,
-0x00,0x0C,0x70,0x00,0x00,0x18,0x30,0x00,0x00,0x38,0x18,0x00,0x00,0x30,0x08,0x00,
-0x00,0x30,0x0C,0x00,0x00,0x00,0x04,0x0C,0xF0,0xFF,0xFF,0x1F,0x00,0x80,0x01,0x00,
-0x00,0x80,0x01,0x00,0x00,0x80,0x01,0x00,0x00,0x80,0x01,0x00,0x00,0x80,0x01,0x00,
-0x00,0x80,0x01,0x18,0xFC,0xFF,0xFF,0x3F,0x00,0xC0,0x02,0x00,0x00,0xC0,0x04,0x00,
-0x00,0xC0,0x04,0x00,0x00,0x60,0x08,0x00,0x00,0x30,0x18,0x00,0x00,0x30,0x10,0x00,
-0x00,0x18,0x30,0x00,0x00,0x0C,0xE0,0x00,0x00,0x06,0xC0,0x01,0x80,0x01,0x80,0x07,
-0xC0,0x00,0x00,0x3F,0x30,0x00,0x00,0x1C,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*2*/
-
-"风",0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x40,0x00,0x80,0x00,0xC0,0xFF,0xFF,0x01,0xC0,0x00,0x80,0x00,0xC0,0x00,0x80,0x00,
-0xC0,0x00,0x80,0x00,0xC0,0x00,0x8C,0x00,0xC0,0x00,0x9C,0x00,0xC0,0x04,0x8E,0x00,
-0xC0,0x08,0x86,0x00,0xC0,0x10,0x82,0x00,0xC0,0x20,0x83,0x00,0xC0,0x40,0x81,0x00,
-0xC0,0x80,0x81,0x00,0xC0,0xC0,0x81,0x00,0xC0,0x40,0x83,0x00,0x40,0x60,0x86,0x01,
-0x40,0x30,0x8E,0x01,0x40,0x10,0x9C,0x01,0x60,0x08,0x98,0x21,0x60,0x04,0x18,0x21,
-0x20,0x02,0x10,0x23,0x20,0x01,0x00,0x27,0x90,0x00,0x00,0x26,0x10,0x00,0x00,0x3C,
-0x08,0x00,0x00,0x38,0x04,0x00,0x00,0x30,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*3*/
-
-"扇",0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x80,0x01,0x00,
-0x00,0x00,0x03,0x00,0x40,0x00,0x01,0x02,0xC0,0xFF,0xFF,0x0F,0xC0,0x00,0x00,0x06,
-0xC0,0x00,0x00,0x06,0xC0,0x00,0x00,0x06,0xC0,0xFF,0xFF,0x07,0xC0,0x00,0x00,0x06,
-0xC0,0x00,0x00,0x00,0xC0,0x80,0x00,0x04,0xC0,0xFF,0xFF,0x0F,0xC0,0x80,0x01,0x04,
-0xC0,0x80,0x01,0x04,0x40,0x84,0x11,0x04,0x40,0x8C,0x71,0x04,0x60,0x98,0x61,0x04,
-0x60,0x88,0x61,0x04,0x60,0x80,0x01,0x06,0x20,0xE0,0x81,0x05,0x20,0x98,0x61,0x04,
-0x30,0x8E,0x3F,0x04,0x90,0x83,0x0D,0x04,0x18,0x81,0x01,0x04,0x08,0x80,0x01,0x04,
-0x08,0xF8,0xC1,0x07,0x04,0xE0,0x00,0x07,0x02,0x40,0x00,0x02,0x00,0x00,0x00,0x00,/*4*/
-
-
-
-"能",0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x0C,0x00,0x00,0x03,0x1C,0x00,
-0x80,0x01,0x0C,0x02,0xC0,0x10,0x0C,0x07,0x60,0x60,0x8C,0x03,0x30,0xE0,0xEC,0x00,
-0x1C,0xF8,0x1C,0x00,0xF8,0xC7,0x0C,0x10,0x08,0x80,0x0C,0x10,0x10,0x20,0x0C,0x10,
-0xF0,0x7F,0x18,0x38,0x30,0x20,0xF8,0x1F,0x30,0x20,0x00,0x00,0x30,0x20,0x00,0x00,
-0xF0,0x3F,0x0C,0x00,0x30,0x20,0x0C,0x06,0x30,0x20,0x0C,0x0F,0x30,0x20,0x8C,0x03,
-0x30,0x20,0xCC,0x00,0xF0,0x3F,0x3C,0x00,0x30,0x20,0x0C,0x10,0x30,0x20,0x0C,0x10,
-0x30,0x20,0x0C,0x10,0x30,0x20,0x0C,0x10,0x30,0x20,0x0C,0x10,0x30,0x3F,0xFC,0x3F,
-0x30,0x38,0xF8,0x1F,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*"能",1*/
-
-"药",0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x08,0x00,0x00,0x1C,0x38,0x00,
-0x00,0x0C,0x18,0x00,0x00,0x0C,0x18,0x1C,0xFC,0xFF,0xFF,0x3F,0x00,0x0C,0x18,0x00,
-0x00,0x0C,0x18,0x00,0x00,0x06,0x08,0x00,0x00,0x07,0x08,0x00,0x00,0x03,0x1C,0x00,
-0x80,0x01,0x0C,0x00,0xC0,0x30,0x0C,0x08,0x60,0x30,0xFE,0x1F,0x30,0x18,0x02,0x0C,
-0xF8,0x0F,0x03,0x0C,0x38,0x06,0x01,0x0C,0x00,0x82,0x00,0x0C,0x00,0x41,0x04,0x0C,
-0x80,0x20,0x0C,0x0C,0x40,0x70,0x18,0x0C,0xF0,0x0F,0x30,0x0C,0xF0,0x00,0x10,0x0C,
-0x20,0x00,0x00,0x0C,0x00,0x00,0x00,0x04,0x00,0x40,0x00,0x06,0x00,0x3E,0x00,0x06,
-0xF8,0x01,0xE0,0x07,0x18,0x00,0x80,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,/*"药",2*/
-
-"盒",0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0xC0,0x03,0x00,
-0x00,0xC0,0x01,0x00,0x00,0x60,0x02,0x00,0x00,0x30,0x04,0x00,0x00,0x18,0x08,0x00,
-0x00,0x0C,0x30,0x00,0x00,0x06,0xE8,0x00,0x00,0xFB,0xDF,0x07,0xC0,0x00,0x00,0x7F,
-0x60,0x00,0x00,0x1C,0x18,0x02,0x40,0x00,0x04,0xFE,0xFF,0x00,0x00,0x06,0x40,0x00,
-0x00,0x06,0x40,0x00,0x00,0x06,0x40,0x00,0x00,0xFE,0x7F,0x00,0x00,0x06,0x40,0x00,
-0x00,0x02,0x00,0x00,0x40,0x00,0x00,0x02,0xC0,0xFF,0xFF,0x07,0xC0,0x30,0x0C,0x03,
-0xC0,0x30,0x0C,0x03,0xC0,0x30,0x0C,0x03,0xC0,0x30,0x0C,0x03,0xC0,0x30,0x0C,0x03,
-0xC0,0x30,0x0C,0x03,0xC0,0x30,0x0C,0x13,0xFC,0xFF,0xFF,0x3F,0x00,0x00,0x00,0x00,/*"盒",3*/
-
-
-};
+/* 汉字字模由tools/asset_compiler.py生成，见lcd_font_cjk.h */
 
 #endif
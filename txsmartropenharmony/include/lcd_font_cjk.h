@@ -0,0 +1,599 @@
+/*
+ * Copyright (c) 2024 iSoftStone Education Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 本文件由 tools/asset_compiler.py 根据 assets/assets.json 生成，请勿手工修改 */
+#ifndef _LCD_FONT_CJK_H_
+#define _LCD_FONT_CJK_H_
+
+/* 汉字字模索引，key为(Unicode码点 << 8 | 字号)，按key升序排列 */
+typedef struct
+{
+    unsigned int key;
+    const unsigned char *msk;
+} lcd_font_index_t;
+
+/* 12x12 */
+static const unsigned char g_font_cjk12[5][24] =
+{
+    { /* "通" */
+    0xF9, 0x01, 0x22, 0x01, 0xC0, 0x00, 0xF8, 0x03, 0x4B, 0x02, 0xFA, 0x03, 0x4A, 0x02, 0xFA, 0x03,
+    0x4A, 0x02, 0x4A, 0x03, 0x02, 0x00, 0xFD, 0x07,
+    },
+    { /* "晓" */
+    0x40, 0x00, 0xC7, 0x07, 0x7D, 0x02, 0x45, 0x01, 0x85, 0x04, 0x77, 0x07, 0x05, 0x00, 0xFD, 0x07,
+    0x25, 0x01, 0x27, 0x01, 0x15, 0x05, 0x08, 0x06,
+    },
+    { /* "开" */
+    0x00, 0x00, 0xFE, 0x03, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0xFF, 0x07, 0x88, 0x00,
+    0x88, 0x00, 0x84, 0x00, 0x84, 0x00, 0x82, 0x00,
+    },
+    { /* "发" */
+    0x90, 0x00, 0x11, 0x01, 0x11, 0x00, 0xFF, 0x07, 0x08, 0x00, 0x08, 0x00, 0xF8, 0x01, 0x14, 0x01,
+    0xA4, 0x00, 0x42, 0x00, 0xB1, 0x01, 0x0C, 0x06,
+    },
+    { /* "板" */
+    0x04, 0x06, 0xE4, 0x01, 0x24, 0x00, 0x2F, 0x00, 0xE4, 0x07, 0xAE, 0x04, 0xB6, 0x04, 0xA5, 0x02,
+    0xA4, 0x02, 0x24, 0x01, 0x94, 0x02, 0x4C, 0x04,
+    },
+};
+
+/* 16x16 */
+static const unsigned char g_font_cjk16[5][32] =
+{
+    { /* "通" */
+    0x00, 0x00, 0xE2, 0x1F, 0x04, 0x08, 0x84, 0x05, 0x00, 0x02, 0xE0, 0x3F, 0x27, 0x22, 0x24, 0x22,
+    0xE4, 0x3F, 0x24, 0x22, 0x24, 0x22, 0xE4, 0x3F, 0x24, 0x22, 0x24, 0x2A, 0x2A, 0x10, 0xF1, 0x7F,
+    },
+    { /* "晓" */
+    0x00, 0x01, 0x00, 0x01, 0x1E, 0x3D, 0xD2, 0x03, 0x12, 0x0A, 0x12, 0x24, 0x12, 0x2B, 0xDE, 0x30,
+    0x12, 0x00, 0xD2, 0x7F, 0x12, 0x09, 0x12, 0x09, 0x9E, 0x48, 0x92, 0x48, 0x40, 0x70, 0x20, 0x00,
+    },
+    { /* "开" */
+    0x00, 0x00, 0xFE, 0x3F, 0x10, 0x04, 0x10, 0x04, 0x10, 0x04, 0x10, 0x04, 0x10, 0x04, 0xFF, 0x7F,
+    0x10, 0x04, 0x10, 0x04, 0x10, 0x04, 0x10, 0x04, 0x08, 0x04, 0x08, 0x04, 0x04, 0x04, 0x02, 0x04,
+    },
+    { /* "发" */
+    0x80, 0x00, 0x88, 0x08, 0x88, 0x10, 0x44, 0x00, 0xFC, 0x3F, 0x40, 0x00, 0x20, 0x00, 0xE0, 0x1F,
+    0x50, 0x10, 0x90, 0x10, 0x88, 0x08, 0x08, 0x05, 0x04, 0x02, 0x02, 0x05, 0xC0, 0x18, 0x38, 0x60,
+    },
+    { /* "板" */
+    0x08, 0x10, 0x08, 0x38, 0x88, 0x07, 0x88, 0x00, 0xBF, 0x00, 0x88, 0x3F, 0x8C, 0x22, 0x9C, 0x22,
+    0xAA, 0x22, 0xAA, 0x14, 0x89, 0x14, 0x88, 0x08, 0x88, 0x08, 0x48, 0x14, 0x48, 0x22, 0x28, 0x41,
+    },
+};
+
+/* 24x24 */
+static const unsigned char g_font_cjk24[39][72] =
+{
+    { /* "通" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x08, 0x00, 0x0C, 0x10, 0x10, 0x03, 0x30,
+    0xE0, 0x00, 0x30, 0xC0, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x42, 0x10, 0x00, 0x42, 0x10, 0x3E, 0xFE,
+    0x1F, 0x20, 0x42, 0x10, 0x20, 0x42, 0x10, 0x20, 0x42, 0x10, 0x20, 0xFE, 0x1F, 0x20, 0x42, 0x10,
+    0x20, 0x42, 0x10, 0x20, 0x42, 0x10, 0x20, 0x42, 0x18, 0x58, 0x42, 0x1C, 0x8C, 0x01, 0x08, 0x06,
+    0xFF, 0x3F, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00,
+    },
+    { /* "晓" */
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x30, 0x00, 0xFC, 0x30, 0x1C, 0x84,
+    0xFC, 0x03, 0x84, 0x62, 0x0C, 0x84, 0x40, 0x0E, 0x84, 0xC0, 0x23, 0x84, 0x80, 0x21, 0xFC, 0xE0,
+    0x23, 0x84, 0x18, 0x3E, 0x84, 0x06, 0x38, 0x84, 0x00, 0x04, 0x84, 0xFF, 0x0F, 0x84, 0x90, 0x00,
+    0x84, 0x90, 0x00, 0xFC, 0x98, 0x20, 0x84, 0x88, 0x20, 0x04, 0x88, 0x20, 0x00, 0x84, 0x61, 0x00,
+    0x83, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "开" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFC, 0xFF, 0x1F, 0x00, 0x81, 0x00, 0x00,
+    0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x81,
+    0x10, 0xFE, 0xFF, 0x3F, 0x00, 0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x81, 0x00, 0x80, 0x81, 0x00,
+    0x80, 0x80, 0x00, 0x80, 0x80, 0x00, 0x40, 0x80, 0x00, 0x60, 0x80, 0x00, 0x30, 0x80, 0x00, 0x08,
+    0x80, 0x00, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "发" */
+    0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x84, 0x01, 0x60, 0x06, 0x03, 0x30, 0x06, 0x06, 0x10,
+    0x02, 0x06, 0x18, 0x02, 0x10, 0xFC, 0xFF, 0x3F, 0x08, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0xFF, 0x07, 0x00, 0x05, 0x06, 0x80, 0x05, 0x02, 0x80, 0x08, 0x03, 0xC0, 0x90, 0x01,
+    0x40, 0x90, 0x00, 0x60, 0x60, 0x00, 0x20, 0xE0, 0x00, 0x10, 0x98, 0x03, 0x08, 0x0C, 0x0F, 0x04,
+    0x03, 0x7C, 0xE2, 0x00, 0x10, 0x00, 0x00, 0x00,
+    },
+    { /* "板" */
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x08, 0x20, 0x00, 0x0E, 0x20, 0xC4, 0x03, 0x20, 0x38, 0x00, 0x20,
+    0x08, 0x00, 0xFE, 0x09, 0x00, 0x20, 0x08, 0x00, 0x30, 0xF8, 0x1F, 0x30, 0x28, 0x08, 0xF0, 0x28,
+    0x0C, 0xB0, 0x29, 0x04, 0x28, 0x29, 0x04, 0x28, 0x4D, 0x06, 0x28, 0x4C, 0x02, 0x24, 0xC4, 0x03,
+    0x24, 0x84, 0x01, 0x22, 0x84, 0x01, 0x20, 0xC4, 0x01, 0x20, 0x42, 0x03, 0x20, 0x32, 0x0E, 0x20,
+    0x19, 0x3C, 0xA0, 0x06, 0x38, 0x20, 0x01, 0x00,
+    },
+    { /* "温" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x30, 0xFE, 0x07, 0x20, 0x02, 0x04, 0x00,
+    0x02, 0x04, 0x80, 0xFE, 0x07, 0x82, 0x02, 0x04, 0x4C, 0x02, 0x04, 0x48, 0x02, 0x04, 0x48, 0xFE,
+    0x07, 0x20, 0x02, 0x04, 0x20, 0x00, 0x00, 0x20, 0xFF, 0x1F, 0x20, 0x91, 0x08, 0x10, 0x91, 0x08,
+    0x1E, 0x91, 0x08, 0x18, 0x91, 0x08, 0x18, 0x91, 0x08, 0x18, 0x91, 0x08, 0x18, 0x91, 0x28, 0xF8,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "湿" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x30, 0xFE, 0x1F, 0x30, 0x06, 0x08, 0x20,
+    0x06, 0x08, 0x80, 0xFE, 0x0F, 0x82, 0x06, 0x08, 0x4C, 0x06, 0x08, 0x58, 0x06, 0x08, 0x48, 0xFE,
+    0x0F, 0x20, 0x16, 0x09, 0x20, 0x10, 0x01, 0x20, 0x10, 0x31, 0x10, 0x11, 0x31, 0x1A, 0x13, 0x19,
+    0x1C, 0x12, 0x0D, 0x08, 0x16, 0x05, 0x08, 0x12, 0x03, 0x08, 0x10, 0x01, 0x0C, 0x10, 0x21, 0xC8,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "度" */
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x10, 0xF0, 0xFF, 0x3F, 0x10,
+    0x02, 0x01, 0x10, 0x04, 0x03, 0x10, 0x04, 0x11, 0xF0, 0xFF, 0x3F, 0x10, 0x04, 0x01, 0x10, 0x04,
+    0x01, 0x10, 0xFC, 0x01, 0x10, 0x04, 0x01, 0x10, 0x00, 0x00, 0x98, 0xFF, 0x07, 0x18, 0x04, 0x02,
+    0x08, 0x04, 0x01, 0x08, 0x88, 0x00, 0x08, 0x50, 0x00, 0x04, 0x70, 0x00, 0x04, 0x8C, 0x03, 0x02,
+    0x03, 0x7E, 0xE0, 0x00, 0x10, 0x00, 0x00, 0x00,
+    },
+    { /* "光" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x20, 0x18, 0x02, 0x40,
+    0x18, 0x06, 0x80, 0x18, 0x03, 0x80, 0x19, 0x01, 0x00, 0x99, 0x00, 0x00, 0x98, 0x10, 0xFE, 0xFF,
+    0x3F, 0x00, 0x63, 0x00, 0x00, 0x63, 0x00, 0x00, 0x63, 0x00, 0x00, 0x61, 0x00, 0x00, 0x61, 0x00,
+    0x00, 0x61, 0x20, 0x80, 0x61, 0x20, 0x80, 0x60, 0x20, 0x40, 0x60, 0x20, 0x20, 0x40, 0x60, 0x18,
+    0xC0, 0x3F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "照" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x1F, 0xF8, 0x43, 0x18, 0x08, 0x41, 0x08, 0x08,
+    0x61, 0x08, 0x08, 0x21, 0x08, 0x08, 0x11, 0x0E, 0xF8, 0x09, 0x04, 0x08, 0x05, 0x00, 0x08, 0xF1,
+    0x1F, 0x08, 0x31, 0x08, 0x08, 0x31, 0x08, 0x08, 0x31, 0x08, 0xF8, 0xF1, 0x0F, 0x08, 0x31, 0x08,
+    0x88, 0x00, 0x00, 0x10, 0x21, 0x04, 0x10, 0x61, 0x08, 0x18, 0xC2, 0x18, 0x18, 0xC2, 0x30, 0x0C,
+    0xC2, 0x30, 0x0C, 0x02, 0x20, 0x00, 0x00, 0x00,
+    },
+    { /* "强" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0xFC, 0x11, 0x08, 0x80, 0x11, 0x08, 0x80,
+    0x11, 0x08, 0x80, 0xF1, 0x0F, 0x80, 0x99, 0x08, 0xF8, 0x81, 0x01, 0x88, 0x81, 0x01, 0x08, 0x80,
+    0x01, 0x08, 0xF8, 0x3F, 0x0C, 0x88, 0x11, 0xFC, 0x89, 0x11, 0x80, 0x88, 0x11, 0x80, 0xF8, 0x1F,
+    0x80, 0x88, 0x11, 0x80, 0x84, 0x09, 0x80, 0x80, 0x11, 0xC0, 0x80, 0x31, 0x40, 0x80, 0x7F, 0x78,
+    0x7E, 0x60, 0x30, 0x02, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "℃" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x48, 0xF8, 0x01, 0x48,
+    0x0C, 0x16, 0x48, 0x06, 0x18, 0x30, 0x03, 0x18, 0x00, 0x01, 0x10, 0x80, 0x01, 0x10, 0x80, 0x01,
+    0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x03, 0x08, 0x00, 0x06, 0x04, 0x00, 0x1C, 0x03, 0x00, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "传" */
+    0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x80, 0xC1, 0x00, 0xC0, 0x40, 0x00, 0xC0, 0x40, 0x00, 0x40,
+    0x40, 0x00, 0x60, 0xFE, 0x1F, 0x20, 0x60, 0x00, 0x70, 0x20, 0x00, 0x70, 0x20, 0x00, 0x68, 0x20,
+    0x00, 0xE8, 0xFF, 0x3F, 0x64, 0x30, 0x00, 0x62, 0x30, 0x00, 0x60, 0x10, 0x08, 0x60, 0xF8, 0x1F,
+    0x60, 0x10, 0x0C, 0x60, 0x00, 0x06, 0x60, 0x00, 0x02, 0x60, 0x10, 0x01, 0x60, 0xE0, 0x00, 0x60,
+    0x80, 0x03, 0x60, 0x00, 0x06, 0x20, 0x00, 0x04,
+    },
+    { /* "感" */
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0xF0, 0xFF, 0x3F, 0x10,
+    0x40, 0x00, 0x10, 0xC0, 0x08, 0xD0, 0xFF, 0x18, 0x10, 0x80, 0x0C, 0x10, 0x80, 0x04, 0x90, 0x9F,
+    0x06, 0x90, 0x90, 0x03, 0x88, 0x90, 0x23, 0x88, 0xDF, 0x26, 0x84, 0x70, 0x2C, 0x04, 0x10, 0x38,
+    0x02, 0x08, 0x60, 0x90, 0x18, 0x04, 0x90, 0x30, 0x18, 0x98, 0x00, 0x11, 0x8C, 0x00, 0x11, 0x84,
+    0x00, 0x01, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    },
+    { /* "器" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xE3, 0x0F, 0x30, 0x66, 0x0C, 0x30, 0x66, 0x0C, 0x30,
+    0x66, 0x0C, 0x30, 0x66, 0x0C, 0xF0, 0xE7, 0x0F, 0x30, 0xFE, 0x0D, 0x10, 0x0C, 0x13, 0xFC, 0xFF,
+    0x3F, 0x00, 0x42, 0x00, 0x00, 0x81, 0x00, 0x80, 0x00, 0x01, 0x60, 0x00, 0x0E, 0xF0, 0xE7, 0x3F,
+    0x2C, 0x26, 0x0C, 0x20, 0x26, 0x0C, 0x20, 0x26, 0x0C, 0x20, 0x26, 0x0C, 0xE0, 0xE7, 0x0F, 0x20,
+    0x26, 0x0C, 0x10, 0x22, 0x04, 0x00, 0x00, 0x00,
+    },
+    { /* "数" */
+    0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x88, 0x88, 0x01, 0x90, 0x88, 0x00, 0xB0, 0xC4, 0x00, 0x90,
+    0x42, 0x00, 0xFC, 0xDF, 0x3F, 0xC0, 0x60, 0x08, 0xE0, 0x63, 0x08, 0xA0, 0x64, 0x08, 0x90, 0x5C,
+    0x0C, 0x8C, 0x50, 0x0C, 0x82, 0x80, 0x0C, 0xC0, 0x80, 0x04, 0xFE, 0x8F, 0x04, 0x60, 0x84, 0x07,
+    0x20, 0x04, 0x03, 0x70, 0x02, 0x03, 0x80, 0x87, 0x07, 0x80, 0xCD, 0x0C, 0x60, 0x68, 0x38, 0x18,
+    0x18, 0x30, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "据" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x60, 0xFC, 0x1F, 0x20, 0x0C, 0x18, 0x20,
+    0x0C, 0x18, 0x20, 0x0D, 0x18, 0xFE, 0xFF, 0x1F, 0x20, 0x0C, 0x19, 0x20, 0x04, 0x01, 0x20, 0x06,
+    0x01, 0xA0, 0xFD, 0x3F, 0x60, 0x04, 0x01, 0x30, 0x04, 0x01, 0x2E, 0x04, 0x01, 0x24, 0xF6, 0x1F,
+    0x20, 0x12, 0x18, 0x20, 0x12, 0x18, 0x20, 0x11, 0x18, 0x20, 0x11, 0x18, 0xA0, 0xF0, 0x1F, 0x7C,
+    0x10, 0x18, 0x30, 0x10, 0x08, 0x00, 0x00, 0x00,
+    },
+    { /* "设" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0x03, 0x20, 0x18, 0x06, 0x60, 0x18, 0x02, 0x60,
+    0x18, 0x02, 0x00, 0x08, 0x02, 0x00, 0x08, 0x02, 0x00, 0x04, 0x02, 0x7E, 0x06, 0x7E, 0x20, 0x01,
+    0x04, 0xA0, 0xFC, 0x0F, 0x20, 0x08, 0x04, 0x20, 0x10, 0x06, 0x20, 0x10, 0x06, 0x20, 0x20, 0x02,
+    0x20, 0x22, 0x01, 0x20, 0xC1, 0x01, 0xA0, 0xC0, 0x00, 0x60, 0x60, 0x03, 0x60, 0x18, 0x0E, 0x00,
+    0x06, 0x38, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "备" */
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0xFF, 0x03, 0x80, 0x01, 0x01, 0x80,
+    0x82, 0x01, 0x40, 0xC2, 0x00, 0x60, 0x64, 0x00, 0x30, 0x3C, 0x00, 0x08, 0x18, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0xC2, 0x00, 0x80, 0x81, 0x07, 0xE0, 0xFF, 0x7F, 0x5C, 0x10, 0x12, 0x40, 0x10, 0x02,
+    0x40, 0x10, 0x02, 0xC0, 0xFF, 0x03, 0x40, 0x10, 0x02, 0x40, 0x10, 0x02, 0xC0, 0xFF, 0x03, 0x40,
+    0x00, 0x02, 0x40, 0x00, 0x02, 0x00, 0x00, 0x00,
+    },
+    { /* "状" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x40, 0x00, 0x80, 0x40, 0x02, 0x80, 0x40, 0x0C, 0x80,
+    0x40, 0x18, 0x84, 0x40, 0x18, 0x88, 0x40, 0x10, 0x98, 0x40, 0x10, 0x90, 0xFF, 0x3F, 0x80, 0xC0,
+    0x00, 0x80, 0x40, 0x01, 0xC0, 0x60, 0x01, 0xA0, 0x60, 0x01, 0x90, 0x20, 0x01, 0x8C, 0x20, 0x02,
+    0x86, 0x30, 0x02, 0x80, 0x10, 0x06, 0x80, 0x18, 0x0C, 0x80, 0x08, 0x1C, 0x80, 0x04, 0x38, 0x80,
+    0x02, 0x30, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "态" */
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0C, 0x10, 0xFC,
+    0xFF, 0x3F, 0x00, 0x14, 0x00, 0x00, 0x24, 0x00, 0x00, 0x26, 0x00, 0x00, 0x42, 0x00, 0x00, 0x83,
+    0x01, 0x80, 0x0C, 0x07, 0x60, 0x18, 0x3E, 0x18, 0x10, 0x18, 0x06, 0x00, 0x00, 0x00, 0x0C, 0x00,
+    0x90, 0x19, 0x04, 0x90, 0x10, 0x18, 0x98, 0x10, 0x19, 0x9C, 0x00, 0x11, 0x8C, 0x00, 0x11, 0x80,
+    0x01, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    },
+    { /* "灯" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x10, 0x60, 0xFC, 0x3F, 0x60,
+    0x80, 0x01, 0x60, 0x82, 0x01, 0x60, 0x83, 0x01, 0xE4, 0x80, 0x01, 0x64, 0x80, 0x01, 0x66, 0x80,
+    0x01, 0x62, 0x80, 0x01, 0x60, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x60, 0x80, 0x01,
+    0xA0, 0x81, 0x01, 0x30, 0x83, 0x01, 0x10, 0x83, 0x01, 0x10, 0x82, 0x01, 0x08, 0x98, 0x01, 0x04,
+    0xE0, 0x01, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "电" */
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x08, 0x00, 0xF0, 0xFF, 0x0F, 0x10, 0x08, 0x04, 0x10, 0x08, 0x04, 0x10, 0x08, 0x04, 0xF0, 0xFF,
+    0x07, 0x10, 0x08, 0x04, 0x10, 0x08, 0x04, 0x10, 0x08, 0x04, 0x10, 0x08, 0x04, 0xF0, 0xFF, 0x07,
+    0x10, 0x08, 0x04, 0x10, 0x08, 0x00, 0x00, 0x08, 0x20, 0x00, 0x08, 0x20, 0x00, 0x08, 0x20, 0x00,
+    0x08, 0x30, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00,
+    },
+    { /* "机" */
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x60, 0x00, 0x00, 0x20, 0xF8, 0x07, 0x20, 0x18, 0x02, 0x20,
+    0x18, 0x02, 0x20, 0x18, 0x02, 0xFE, 0x1B, 0x02, 0x20, 0x18, 0x02, 0x20, 0x18, 0x02, 0x70, 0x18,
+    0x02, 0xB0, 0x19, 0x02, 0x30, 0x1B, 0x02, 0x30, 0x1A, 0x02, 0x28, 0x18, 0x02, 0x28, 0x18, 0x02,
+    0x24, 0x08, 0x02, 0x24, 0x08, 0x02, 0x22, 0x0C, 0x22, 0x20, 0x04, 0x22, 0x60, 0x06, 0x22, 0x60,
+    0x02, 0x66, 0x60, 0x01, 0x3E, 0xA0, 0x00, 0x00,
+    },
+    { /* "启" */
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00, 0x30, 0x00, 0xE0, 0xFF, 0x0F, 0x20,
+    0x00, 0x0C, 0x20, 0x00, 0x0C, 0x20, 0x00, 0x0C, 0x20, 0x00, 0x0C, 0xE0, 0xFF, 0x0F, 0x20, 0x00,
+    0x0C, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0xFF, 0x0F, 0x20, 0x01, 0x0C, 0x20, 0x01, 0x0C,
+    0x30, 0x01, 0x0C, 0x10, 0x01, 0x0C, 0x10, 0x01, 0x0C, 0x18, 0x01, 0x0C, 0x08, 0xFF, 0x0F, 0x04,
+    0x01, 0x0C, 0x02, 0x01, 0x04, 0x00, 0x00, 0x00,
+    },
+    { /* "关" */
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x81, 0x01, 0x00, 0x83, 0x00, 0x00, 0x42, 0x00, 0x00,
+    0x42, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x08, 0x10, 0xFE, 0xFF, 0x3F, 0x00, 0x28, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x44, 0x00,
+    0x00, 0xC6, 0x00, 0x00, 0x82, 0x00, 0x00, 0x01, 0x01, 0x80, 0x00, 0x06, 0x60, 0x00, 0x1C, 0x18,
+    0x00, 0x78, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00,
+    },
+    { /* "闭" */
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0xC0, 0x00, 0x10, 0x80, 0xFC, 0x3F, 0x88, 0x00, 0x10, 0x18,
+    0x20, 0x10, 0x18, 0x60, 0x10, 0x18, 0x20, 0x10, 0x18, 0x20, 0x10, 0xD8, 0xFF, 0x17, 0x18, 0x30,
+    0x10, 0x18, 0x38, 0x10, 0x18, 0x28, 0x10, 0x18, 0x24, 0x10, 0x18, 0x22, 0x10, 0x18, 0x21, 0x10,
+    0x98, 0x20, 0x10, 0x58, 0x20, 0x10, 0x38, 0x20, 0x10, 0x18, 0x38, 0x10, 0x18, 0x10, 0x10, 0x18,
+    0x00, 0x1E, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00,
+    },
+    { /* "自" */
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0xE0,
+    0xFF, 0x0F, 0x20, 0x00, 0x04, 0x20, 0x00, 0x04, 0x20, 0x00, 0x04, 0x20, 0x00, 0x04, 0xE0, 0xFF,
+    0x07, 0x20, 0x00, 0x04, 0x20, 0x00, 0x04, 0x20, 0x00, 0x04, 0x20, 0x00, 0x04, 0xE0, 0xFF, 0x07,
+    0x20, 0x00, 0x04, 0x20, 0x00, 0x04, 0x20, 0x00, 0x04, 0x20, 0x00, 0x04, 0xE0, 0xFF, 0x07, 0x20,
+    0x00, 0x04, 0x20, 0x00, 0x04, 0x00, 0x00, 0x00,
+    },
+    { /* "动" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x82, 0x00, 0xFC,
+    0x87, 0x00, 0x00, 0x80, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x80, 0x30, 0xFE, 0x8F, 0x30, 0x40, 0x80,
+    0x30, 0x60, 0x80, 0x30, 0x20, 0x80, 0x10, 0x30, 0x81, 0x10, 0x10, 0xC2, 0x10, 0x08, 0x46, 0x10,
+    0x08, 0x44, 0x10, 0xFC, 0x2F, 0x10, 0x0C, 0x38, 0x10, 0x00, 0x10, 0x10, 0x00, 0x88, 0x19, 0x00,
+    0x06, 0x0E, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00,
+    },
+    { /* "风" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xFF, 0x07, 0x30,
+    0x00, 0x02, 0x30, 0x00, 0x02, 0x30, 0x40, 0x02, 0x30, 0x60, 0x02, 0x30, 0x21, 0x02, 0x30, 0x32,
+    0x02, 0x30, 0x14, 0x02, 0x30, 0x18, 0x02, 0x30, 0x18, 0x02, 0x30, 0x34, 0x02, 0x10, 0x62, 0x06,
+    0x10, 0xC1, 0x46, 0x90, 0xC0, 0x44, 0x50, 0x00, 0x4C, 0x28, 0x00, 0x28, 0x08, 0x00, 0x38, 0x04,
+    0x00, 0x70, 0x02, 0x00, 0x40, 0x00, 0x00, 0x00,
+    },
+    { /* "扇" */
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0xF0, 0xFF, 0x1F, 0x30,
+    0x00, 0x08, 0x30, 0x00, 0x08, 0xF0, 0xFF, 0x0F, 0x30, 0x00, 0x08, 0x30, 0x00, 0x00, 0xF0, 0xFF,
+    0x1F, 0x30, 0x18, 0x18, 0xB0, 0x58, 0x18, 0x30, 0x99, 0x19, 0x10, 0x1B, 0x19, 0x10, 0x19, 0x19,
+    0x10, 0x1C, 0x1E, 0x18, 0x9B, 0x19, 0xC8, 0xF8, 0x18, 0x48, 0x58, 0x18, 0x04, 0x18, 0x18, 0x04,
+    0x0E, 0x0E, 0x02, 0x08, 0x0C, 0x00, 0x00, 0x00,
+    },
+    { /* "当" */
+    0x00, 0x10, 0x00, 0x00, 0x30, 0x00, 0x08, 0x10, 0x08, 0x30, 0x10, 0x1C, 0x60, 0x10, 0x0C, 0xC0,
+    0x10, 0x06, 0xC0, 0x10, 0x01, 0x00, 0x90, 0x00, 0x00, 0x10, 0x20, 0xF8, 0xFF, 0x7F, 0x00, 0x00,
+    0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0xF0, 0xFF, 0x7F,
+    0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0xFC,
+    0xFF, 0x7F, 0x00, 0x00, 0x60, 0x00, 0x00, 0x20,
+    },
+    { /* "前" */
+    0x00, 0x00, 0x00, 0x80, 0x01, 0x07, 0x00, 0x03, 0x01, 0x00, 0x83, 0x00, 0x00, 0x82, 0x40, 0xFE,
+    0xFF, 0xFF, 0x00, 0x00, 0x08, 0x00, 0x04, 0x30, 0xF8, 0x0F, 0x10, 0x18, 0x84, 0x11, 0x18, 0x84,
+    0x10, 0x18, 0x84, 0x10, 0xF8, 0x87, 0x10, 0x18, 0x84, 0x10, 0x18, 0x84, 0x10, 0x18, 0x84, 0x10,
+    0xF8, 0x87, 0x10, 0x18, 0x84, 0x10, 0x18, 0x84, 0x10, 0x18, 0x84, 0x10, 0x18, 0x04, 0x10, 0x18,
+    0x84, 0x1F, 0x18, 0x07, 0x1E, 0x18, 0x02, 0x0C,
+    },
+    { /* "应" */
+    0x00, 0x10, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x40, 0x60, 0xF8, 0xFF, 0xFF, 0x18,
+    0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x10, 0x70, 0x98, 0x10, 0x30, 0x98, 0x20,
+    0x30, 0x18, 0x61, 0x10, 0x18, 0x43, 0x18, 0x18, 0xC2, 0x08, 0x08, 0xC6, 0x08, 0x08, 0xC6, 0x0C,
+    0x08, 0x06, 0x04, 0x08, 0x04, 0x04, 0x0C, 0x00, 0x02, 0x04, 0x00, 0x02, 0x04, 0x00, 0x61, 0xF2,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00,
+    },
+    { /* "服" */
+    0x00, 0x12, 0x20, 0xF8, 0xE7, 0x7F, 0x08, 0x22, 0x30, 0x08, 0x22, 0x30, 0x08, 0x22, 0x30, 0x08,
+    0x22, 0x30, 0xF8, 0x23, 0x30, 0x08, 0x22, 0x1E, 0x08, 0x22, 0x08, 0x08, 0x22, 0x00, 0x08, 0xE2,
+    0x7F, 0x08, 0xA2, 0x20, 0xF8, 0x23, 0x21, 0x08, 0x22, 0x31, 0x08, 0x22, 0x11, 0x08, 0x22, 0x12,
+    0x08, 0x22, 0x1E, 0x08, 0x22, 0x0C, 0x0C, 0x22, 0x0C, 0x04, 0x22, 0x1E, 0x04, 0x22, 0x71, 0xC2,
+    0xA3, 0xE0, 0x82, 0x63, 0x00, 0x01, 0x10, 0x00,
+    },
+    { /* "药" */
+    0x00, 0x81, 0x00, 0x00, 0x83, 0x01, 0x00, 0x81, 0x41, 0xFE, 0xFF, 0xFF, 0x00, 0x81, 0x01, 0x00,
+    0x81, 0x01, 0xC0, 0x40, 0x00, 0xC0, 0x80, 0x01, 0x60, 0xC0, 0x00, 0x30, 0xC2, 0x00, 0x10, 0xC6,
+    0x7F, 0x08, 0x23, 0x60, 0xFE, 0x21, 0x60, 0x8C, 0x10, 0x60, 0x40, 0x28, 0x60, 0x20, 0xC4, 0x20,
+    0x10, 0x80, 0x21, 0xF8, 0x83, 0x21, 0x3C, 0x00, 0x21, 0x08, 0x00, 0x20, 0x00, 0x00, 0x20, 0x80,
+    0x07, 0x30, 0x7E, 0x00, 0x37, 0x0C, 0x00, 0x1C,
+    },
+    { /* "位" */
+    0x40, 0x20, 0x00, 0xC0, 0x40, 0x00, 0x40, 0xC0, 0x00, 0x60, 0xC0, 0x00, 0x20, 0x80, 0x00, 0x20,
+    0x80, 0x20, 0x30, 0xFF, 0x7F, 0x10, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x18, 0x3C, 0x04,
+    0x18, 0x34, 0x08, 0x0C, 0x32, 0x08, 0x0C, 0x32, 0x18, 0x0C, 0x31, 0x18, 0x04, 0x30, 0x10, 0x04,
+    0x30, 0x30, 0x06, 0x30, 0x30, 0x02, 0x30, 0x10, 0x02, 0x30, 0x00, 0x02, 0x30, 0x00, 0x01, 0x30,
+    0x00, 0x41, 0xB0, 0xFF, 0xFF, 0x30, 0x00, 0x00,
+    },
+    { /* "置" */
+    0x00, 0x00, 0x20, 0xF8, 0xFF, 0x3F, 0x18, 0x86, 0x30, 0x18, 0x86, 0x30, 0x18, 0x86, 0x30, 0xF8,
+    0xFF, 0x3F, 0x18, 0x18, 0x10, 0x00, 0x18, 0x10, 0xFC, 0xFF, 0x3F, 0x00, 0x08, 0x00, 0x00, 0x08,
+    0x04, 0xE0, 0xFF, 0x0F, 0x60, 0x00, 0x04, 0x60, 0x00, 0x04, 0xE0, 0xFF, 0x07, 0x60, 0x00, 0x04,
+    0x60, 0x00, 0x04, 0xE0, 0xFF, 0x07, 0x60, 0x00, 0x04, 0x60, 0x00, 0x04, 0xE0, 0xFF, 0x07, 0x60,
+    0x00, 0x04, 0x60, 0x00, 0xC4, 0xFF, 0xFF, 0xFF,
+    },
+    { /* "：" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x18,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00,
+    0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+};
+
+/* 32x32 */
+static const unsigned char g_font_cjk32[17][128] =
+{
+    { /* "通" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0xF0, 0xFF, 0x07,
+    0x30, 0x00, 0x80, 0x07, 0x60, 0x00, 0xC1, 0x00, 0xE0, 0x00, 0x2E, 0x00, 0xC0, 0x00, 0x1C, 0x00,
+    0x40, 0x08, 0x18, 0x04, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x18, 0x08, 0x0C, 0x00, 0x18, 0x08, 0x0C,
+    0x80, 0x18, 0x08, 0x0C, 0xFE, 0xF9, 0xFF, 0x0F, 0xC0, 0x18, 0x08, 0x0C, 0xC0, 0x18, 0x08, 0x0C,
+    0xC0, 0x18, 0x08, 0x0C, 0xC0, 0x18, 0x08, 0x0C, 0xC0, 0xF8, 0xFF, 0x0F, 0xC0, 0x18, 0x08, 0x0C,
+    0xC0, 0x18, 0x08, 0x0C, 0xC0, 0x18, 0x08, 0x0C, 0xC0, 0x18, 0x08, 0x0C, 0xC0, 0x18, 0x08, 0x0C,
+    0xC0, 0x18, 0x88, 0x0F, 0x30, 0x09, 0x00, 0x06, 0x1C, 0x06, 0x00, 0x00, 0x0E, 0x7C, 0x00, 0x70,
+    0x04, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "晓" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x03, 0x04, 0xF8, 0x07, 0x02, 0x0E, 0x18, 0x06, 0xFE, 0x01,
+    0x18, 0xFE, 0x07, 0x02, 0x18, 0x06, 0x04, 0x07, 0x18, 0x06, 0x8C, 0x07, 0x18, 0x06, 0xC8, 0x01,
+    0x18, 0x06, 0xF8, 0x10, 0x18, 0x06, 0x30, 0x10, 0xF8, 0x07, 0x7C, 0x10, 0x18, 0x06, 0xC7, 0x11,
+    0x18, 0xE6, 0x80, 0x1F, 0x18, 0x16, 0x00, 0x3C, 0x18, 0x06, 0x00, 0x03, 0x18, 0xFE, 0xFF, 0x07,
+    0x18, 0x06, 0x31, 0x00, 0x18, 0x06, 0x31, 0x00, 0x18, 0x86, 0x31, 0x00, 0xF8, 0x87, 0x31, 0x10,
+    0x18, 0x86, 0x31, 0x10, 0x18, 0xC2, 0x30, 0x10, 0x18, 0xC0, 0x30, 0x10, 0x00, 0x60, 0x30, 0x30,
+    0x00, 0x30, 0xF0, 0x3F, 0x00, 0x0C, 0xE0, 0x1F, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "开" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x0E, 0xF8, 0xFF, 0xFF, 0x1F, 0x00, 0x0C, 0x30, 0x00, 0x00, 0x0C, 0x30, 0x00,
+    0x00, 0x0C, 0x30, 0x00, 0x00, 0x0C, 0x30, 0x00, 0x00, 0x0C, 0x30, 0x00, 0x00, 0x0C, 0x30, 0x00,
+    0x00, 0x0C, 0x30, 0x00, 0x00, 0x0C, 0x30, 0x00, 0x00, 0x0C, 0x30, 0x18, 0xFC, 0xFF, 0xFF, 0x3F,
+    0x00, 0x0C, 0x30, 0x00, 0x00, 0x0C, 0x30, 0x00, 0x00, 0x0C, 0x30, 0x00, 0x00, 0x0C, 0x30, 0x00,
+    0x00, 0x0C, 0x30, 0x00, 0x00, 0x04, 0x30, 0x00, 0x00, 0x06, 0x30, 0x00, 0x00, 0x06, 0x30, 0x00,
+    0x00, 0x03, 0x30, 0x00, 0x00, 0x01, 0x30, 0x00, 0x80, 0x00, 0x30, 0x00, 0x40, 0x00, 0x30, 0x00,
+    0x20, 0x00, 0x30, 0x00, 0x18, 0x00, 0x30, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "发" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x60, 0x10, 0x00,
+    0xC0, 0x60, 0x60, 0x00, 0xC0, 0x20, 0xC0, 0x00, 0xC0, 0x30, 0xC0, 0x01, 0x60, 0x30, 0x80, 0x01,
+    0x60, 0x30, 0x00, 0x01, 0x30, 0x30, 0x00, 0x18, 0xF8, 0xFF, 0xFF, 0x3F, 0x10, 0x10, 0x00, 0x00,
+    0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x01, 0x00, 0xFC, 0xFF, 0x03,
+    0x00, 0x2C, 0x80, 0x01, 0x00, 0x4C, 0xC0, 0x01, 0x00, 0x46, 0xC0, 0x00, 0x00, 0x86, 0x60, 0x00,
+    0x00, 0x82, 0x61, 0x00, 0x00, 0x03, 0x33, 0x00, 0x00, 0x01, 0x1A, 0x00, 0x80, 0x01, 0x0E, 0x00,
+    0xC0, 0x00, 0x1E, 0x00, 0x40, 0x00, 0x3F, 0x00, 0x20, 0x80, 0xF1, 0x00, 0x10, 0xE0, 0xC0, 0x03,
+    0x08, 0x30, 0x80, 0x3F, 0x04, 0x0E, 0x00, 0x1E, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "板" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x07,
+    0xC0, 0x00, 0xC0, 0x0F, 0xC0, 0x40, 0x7C, 0x00, 0xC0, 0xC0, 0x03, 0x00, 0xC0, 0xC0, 0x00, 0x00,
+    0xC0, 0xCC, 0x00, 0x00, 0xFC, 0xDF, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x04, 0xC0, 0xC0, 0xFF, 0x0F,
+    0xC0, 0xC0, 0x02, 0x06, 0xE0, 0xC1, 0x02, 0x02, 0xE0, 0xC2, 0x04, 0x03, 0xE0, 0xCE, 0x04, 0x03,
+    0xE0, 0xCC, 0x04, 0x01, 0xF0, 0xC8, 0x84, 0x01, 0xD0, 0xC8, 0x88, 0x01, 0xD8, 0x40, 0xC8, 0x00,
+    0xC8, 0x40, 0xD8, 0x00, 0xC8, 0x60, 0x70, 0x00, 0xC4, 0x60, 0x30, 0x00, 0xC2, 0x20, 0x70, 0x00,
+    0xC0, 0x20, 0xD8, 0x00, 0xC0, 0x30, 0xCC, 0x01, 0xC0, 0x10, 0x82, 0x03, 0xC0, 0x88, 0x01, 0x0F,
+    0xC0, 0x64, 0x00, 0x7E, 0xC0, 0x12, 0x00, 0x0C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "智" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+    0xC0, 0xC0, 0x00, 0x08, 0xC0, 0xFF, 0xF9, 0x1F, 0x60, 0x0C, 0x18, 0x0C, 0x20, 0x0C, 0x18, 0x0C,
+    0x10, 0x0C, 0x18, 0x0C, 0x00, 0x0C, 0x18, 0x0C, 0x00, 0x84, 0x19, 0x0C, 0xFC, 0xFF, 0x1B, 0x0C,
+    0x00, 0x06, 0x18, 0x0C, 0x00, 0x0E, 0x18, 0x0C, 0x00, 0x32, 0xF8, 0x0F, 0x00, 0xE3, 0x18, 0x0C,
+    0x80, 0xC1, 0x19, 0x0C, 0xC0, 0x80, 0x01, 0x00, 0x60, 0x00, 0x01, 0x00, 0x18, 0xFE, 0xFF, 0x03,
+    0x04, 0x06, 0x80, 0x01, 0x00, 0x06, 0x80, 0x01, 0x00, 0x06, 0x80, 0x01, 0x00, 0xFE, 0xFF, 0x01,
+    0x00, 0x06, 0x80, 0x01, 0x00, 0x06, 0x80, 0x01, 0x00, 0x06, 0x80, 0x01, 0x00, 0x06, 0x80, 0x01,
+    0x00, 0xFE, 0xFF, 0x01, 0x00, 0x06, 0x80, 0x01, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "慧" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x0E, 0x60, 0x00,
+    0x00, 0x46, 0x20, 0x08, 0xF8, 0xFF, 0xFF, 0x1F, 0x00, 0x06, 0x20, 0x00, 0x00, 0x26, 0x20, 0x04,
+    0xF0, 0x7F, 0xFE, 0x0F, 0x00, 0x06, 0x20, 0x00, 0x00, 0x46, 0x20, 0x10, 0xF8, 0xFF, 0xFE, 0x3F,
+    0x00, 0x06, 0x20, 0x00, 0x00, 0x06, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x07,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x40, 0x00, 0x03, 0x00, 0x84, 0x00, 0x00,
+    0x40, 0x8C, 0x01, 0x02, 0x20, 0x0C, 0x43, 0x0C, 0x20, 0x0C, 0x41, 0x18, 0x30, 0x0C, 0x60, 0x18,
+    0x18, 0x0C, 0xE0, 0x10, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "家" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00,
+    0x00, 0x80, 0x01, 0x00, 0x20, 0x00, 0x01, 0x08, 0xE0, 0xFF, 0xFF, 0x1F, 0x20, 0x00, 0x00, 0x1C,
+    0x30, 0x00, 0x00, 0x04, 0x18, 0x00, 0xC0, 0x02, 0x80, 0xFF, 0xFF, 0x01, 0x00, 0x60, 0x00, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x58, 0x80, 0x01, 0x00, 0xCC, 0xC0, 0x03, 0x00, 0x83, 0x61, 0x00,
+    0xC0, 0xC0, 0x19, 0x00, 0x30, 0x60, 0x17, 0x00, 0x08, 0x30, 0x22, 0x00, 0x00, 0x0C, 0x27, 0x00,
+    0x00, 0x86, 0x67, 0x00, 0x80, 0xC1, 0x47, 0x00, 0x60, 0xE0, 0xC4, 0x00, 0x18, 0x30, 0x84, 0x01,
+    0x00, 0x18, 0x04, 0x07, 0x00, 0x06, 0x04, 0x1E, 0x00, 0x03, 0x06, 0x1C, 0xE0, 0x00, 0x06, 0x08,
+    0x18, 0xF0, 0x07, 0x00, 0x04, 0xC0, 0x03, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "居" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x04,
+    0xC0, 0xFF, 0xFF, 0x0F, 0xC0, 0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x06,
+    0xC0, 0x00, 0x00, 0x06, 0xC0, 0xFF, 0xFF, 0x07, 0xC0, 0x00, 0x02, 0x06, 0xC0, 0x00, 0x06, 0x00,
+    0xC0, 0x00, 0x06, 0x00, 0xC0, 0x00, 0x06, 0x00, 0xC0, 0x00, 0x06, 0x18, 0xC0, 0xFF, 0xFF, 0x3F,
+    0xC0, 0x00, 0x06, 0x00, 0x40, 0x00, 0x06, 0x00, 0x40, 0x00, 0x06, 0x00, 0x40, 0x00, 0x06, 0x00,
+    0x60, 0x04, 0x06, 0x03, 0x60, 0xFC, 0xFF, 0x07, 0x60, 0x0C, 0x00, 0x03, 0x20, 0x0C, 0x00, 0x03,
+    0x30, 0x0C, 0x00, 0x03, 0x10, 0x0C, 0x00, 0x03, 0x10, 0x0C, 0x00, 0x03, 0x08, 0x0C, 0x00, 0x03,
+    0x08, 0xFC, 0xFF, 0x03, 0x04, 0x0C, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "灯" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
+    0x80, 0x01, 0x00, 0x18, 0x80, 0xE1, 0xFF, 0x3F, 0x80, 0x01, 0x60, 0x00, 0x80, 0x01, 0x60, 0x00,
+    0x80, 0x19, 0x60, 0x00, 0x90, 0x19, 0x60, 0x00, 0x90, 0x0D, 0x60, 0x00, 0x88, 0x07, 0x60, 0x00,
+    0x88, 0x01, 0x60, 0x00, 0x8C, 0x01, 0x60, 0x00, 0x8C, 0x01, 0x60, 0x00, 0x84, 0x01, 0x60, 0x00,
+    0x80, 0x01, 0x60, 0x00, 0x80, 0x01, 0x60, 0x00, 0x80, 0x01, 0x60, 0x00, 0x80, 0x00, 0x60, 0x00,
+    0x80, 0x01, 0x60, 0x00, 0xC0, 0x06, 0x60, 0x00, 0xC0, 0x0C, 0x60, 0x00, 0x40, 0x18, 0x60, 0x00,
+    0x40, 0x18, 0x60, 0x00, 0x20, 0x10, 0x60, 0x00, 0x30, 0x00, 0x60, 0x00, 0x10, 0x80, 0x30, 0x00,
+    0x08, 0x00, 0x3F, 0x00, 0x04, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "光" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00,
+    0x00, 0x80, 0x01, 0x00, 0x40, 0x80, 0x01, 0x00, 0x80, 0x81, 0x81, 0x01, 0x00, 0x83, 0xC1, 0x01,
+    0x00, 0x86, 0xC1, 0x00, 0x00, 0x8E, 0x61, 0x00, 0x00, 0x8C, 0x61, 0x00, 0x00, 0x8C, 0x21, 0x00,
+    0x00, 0x80, 0x11, 0x08, 0x00, 0x80, 0x09, 0x0C, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x18, 0x0C, 0x00,
+    0x00, 0x18, 0x0C, 0x00, 0x00, 0x18, 0x0C, 0x00, 0x00, 0x18, 0x0C, 0x00, 0x00, 0x18, 0x0C, 0x00,
+    0x00, 0x08, 0x0C, 0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x0C, 0x0C, 0x10, 0x00, 0x04, 0x0C, 0x10,
+    0x00, 0x06, 0x0C, 0x10, 0x00, 0x02, 0x0C, 0x10, 0x00, 0x03, 0x0C, 0x10, 0x80, 0x00, 0x0C, 0x30,
+    0x60, 0x00, 0xFC, 0x3F, 0x18, 0x00, 0xF8, 0x1F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "关" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x06, 0x70, 0x00,
+    0x00, 0x0C, 0x70, 0x00, 0x00, 0x18, 0x30, 0x00, 0x00, 0x38, 0x18, 0x00, 0x00, 0x30, 0x08, 0x00,
+    0x00, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x04, 0x0C, 0xF0, 0xFF, 0xFF, 0x1F, 0x00, 0x80, 0x01, 0x00,
+    0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00,
+    0x00, 0x80, 0x01, 0x18, 0xFC, 0xFF, 0xFF, 0x3F, 0x00, 0xC0, 0x02, 0x00, 0x00, 0xC0, 0x04, 0x00,
+    0x00, 0xC0, 0x04, 0x00, 0x00, 0x60, 0x08, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00, 0x30, 0x10, 0x00,
+    0x00, 0x18, 0x30, 0x00, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x06, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x07,
+    0xC0, 0x00, 0x00, 0x3F, 0x30, 0x00, 0x00, 0x1C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "风" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x80, 0x00, 0xC0, 0xFF, 0xFF, 0x01, 0xC0, 0x00, 0x80, 0x00, 0xC0, 0x00, 0x80, 0x00,
+    0xC0, 0x00, 0x80, 0x00, 0xC0, 0x00, 0x8C, 0x00, 0xC0, 0x00, 0x9C, 0x00, 0xC0, 0x04, 0x8E, 0x00,
+    0xC0, 0x08, 0x86, 0x00, 0xC0, 0x10, 0x82, 0x00, 0xC0, 0x20, 0x83, 0x00, 0xC0, 0x40, 0x81, 0x00,
+    0xC0, 0x80, 0x81, 0x00, 0xC0, 0xC0, 0x81, 0x00, 0xC0, 0x40, 0x83, 0x00, 0x40, 0x60, 0x86, 0x01,
+    0x40, 0x30, 0x8E, 0x01, 0x40, 0x10, 0x9C, 0x01, 0x60, 0x08, 0x98, 0x21, 0x60, 0x04, 0x18, 0x21,
+    0x20, 0x02, 0x10, 0x23, 0x20, 0x01, 0x00, 0x27, 0x90, 0x00, 0x00, 0x26, 0x10, 0x00, 0x00, 0x3C,
+    0x08, 0x00, 0x00, 0x38, 0x04, 0x00, 0x00, 0x30, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "扇" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x40, 0x00, 0x01, 0x02, 0xC0, 0xFF, 0xFF, 0x0F, 0xC0, 0x00, 0x00, 0x06,
+    0xC0, 0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x06, 0xC0, 0xFF, 0xFF, 0x07, 0xC0, 0x00, 0x00, 0x06,
+    0xC0, 0x00, 0x00, 0x00, 0xC0, 0x80, 0x00, 0x04, 0xC0, 0xFF, 0xFF, 0x0F, 0xC0, 0x80, 0x01, 0x04,
+    0xC0, 0x80, 0x01, 0x04, 0x40, 0x84, 0x11, 0x04, 0x40, 0x8C, 0x71, 0x04, 0x60, 0x98, 0x61, 0x04,
+    0x60, 0x88, 0x61, 0x04, 0x60, 0x80, 0x01, 0x06, 0x20, 0xE0, 0x81, 0x05, 0x20, 0x98, 0x61, 0x04,
+    0x30, 0x8E, 0x3F, 0x04, 0x90, 0x83, 0x0D, 0x04, 0x18, 0x81, 0x01, 0x04, 0x08, 0x80, 0x01, 0x04,
+    0x08, 0xF8, 0xC1, 0x07, 0x04, 0xE0, 0x00, 0x07, 0x02, 0x40, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "能" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0C, 0x00, 0x00, 0x03, 0x1C, 0x00,
+    0x80, 0x01, 0x0C, 0x02, 0xC0, 0x10, 0x0C, 0x07, 0x60, 0x60, 0x8C, 0x03, 0x30, 0xE0, 0xEC, 0x00,
+    0x1C, 0xF8, 0x1C, 0x00, 0xF8, 0xC7, 0x0C, 0x10, 0x08, 0x80, 0x0C, 0x10, 0x10, 0x20, 0x0C, 0x10,
+    0xF0, 0x7F, 0x18, 0x38, 0x30, 0x20, 0xF8, 0x1F, 0x30, 0x20, 0x00, 0x00, 0x30, 0x20, 0x00, 0x00,
+    0xF0, 0x3F, 0x0C, 0x00, 0x30, 0x20, 0x0C, 0x06, 0x30, 0x20, 0x0C, 0x0F, 0x30, 0x20, 0x8C, 0x03,
+    0x30, 0x20, 0xCC, 0x00, 0xF0, 0x3F, 0x3C, 0x00, 0x30, 0x20, 0x0C, 0x10, 0x30, 0x20, 0x0C, 0x10,
+    0x30, 0x20, 0x0C, 0x10, 0x30, 0x20, 0x0C, 0x10, 0x30, 0x20, 0x0C, 0x10, 0x30, 0x3F, 0xFC, 0x3F,
+    0x30, 0x38, 0xF8, 0x1F, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "药" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x1C, 0x38, 0x00,
+    0x00, 0x0C, 0x18, 0x00, 0x00, 0x0C, 0x18, 0x1C, 0xFC, 0xFF, 0xFF, 0x3F, 0x00, 0x0C, 0x18, 0x00,
+    0x00, 0x0C, 0x18, 0x00, 0x00, 0x06, 0x08, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x03, 0x1C, 0x00,
+    0x80, 0x01, 0x0C, 0x00, 0xC0, 0x30, 0x0C, 0x08, 0x60, 0x30, 0xFE, 0x1F, 0x30, 0x18, 0x02, 0x0C,
+    0xF8, 0x0F, 0x03, 0x0C, 0x38, 0x06, 0x01, 0x0C, 0x00, 0x82, 0x00, 0x0C, 0x00, 0x41, 0x04, 0x0C,
+    0x80, 0x20, 0x0C, 0x0C, 0x40, 0x70, 0x18, 0x0C, 0xF0, 0x0F, 0x30, 0x0C, 0xF0, 0x00, 0x10, 0x0C,
+    0x20, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x06, 0x00, 0x3E, 0x00, 0x06,
+    0xF8, 0x01, 0xE0, 0x07, 0x18, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    },
+    { /* "盒" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00,
+    0x00, 0xC0, 0x01, 0x00, 0x00, 0x60, 0x02, 0x00, 0x00, 0x30, 0x04, 0x00, 0x00, 0x18, 0x08, 0x00,
+    0x00, 0x0C, 0x30, 0x00, 0x00, 0x06, 0xE8, 0x00, 0x00, 0xFB, 0xDF, 0x07, 0xC0, 0x00, 0x00, 0x7F,
+    0x60, 0x00, 0x00, 0x1C, 0x18, 0x02, 0x40, 0x00, 0x04, 0xFE, 0xFF, 0x00, 0x00, 0x06, 0x40, 0x00,
+    0x00, 0x06, 0x40, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x06, 0x40, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x02, 0xC0, 0xFF, 0xFF, 0x07, 0xC0, 0x30, 0x0C, 0x03,
+    0xC0, 0x30, 0x0C, 0x03, 0xC0, 0x30, 0x0C, 0x03, 0xC0, 0x30, 0x0C, 0x03, 0xC0, 0x30, 0x0C, 0x03,
+    0xC0, 0x30, 0x0C, 0x03, 0xC0, 0x30, 0x0C, 0x13, 0xFC, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00,
+    },
+};
+
+static const lcd_font_index_t g_font_index[] =
+{
+    {0x00210318, g_font_cjk24[11]}, /* "℃" */
+    {0x004F2018, g_font_cjk24[12]}, /* "传" */
+    {0x004F4D18, g_font_cjk24[36]}, /* "位" */
+    {0x00514918, g_font_cjk24[8]}, /* "光" */
+    {0x00514920, g_font_cjk32[10]}, /* "光" */
+    {0x00517318, g_font_cjk24[25]}, /* "关" */
+    {0x00517320, g_font_cjk32[11]}, /* "关" */
+    {0x00524D18, g_font_cjk24[32]}, /* "前" */
+    {0x0052A818, g_font_cjk24[28]}, /* "动" */
+    {0x0053D10C, g_font_cjk12[3]}, /* "发" */
+    {0x0053D110, g_font_cjk16[3]}, /* "发" */
+    {0x0053D118, g_font_cjk24[3]}, /* "发" */
+    {0x0053D120, g_font_cjk32[3]}, /* "发" */
+    {0x00542F18, g_font_cjk24[24]}, /* "启" */
+    {0x00566818, g_font_cjk24[14]}, /* "器" */
+    {0x00590718, g_font_cjk24[18]}, /* "备" */
+    {0x005BB620, g_font_cjk32[7]}, /* "家" */
+    {0x005C4520, g_font_cjk32[8]}, /* "居" */
+    {0x005E9418, g_font_cjk24[33]}, /* "应" */
+    {0x005EA618, g_font_cjk24[7]}, /* "度" */
+    {0x005F000C, g_font_cjk12[2]}, /* "开" */
+    {0x005F0010, g_font_cjk16[2]}, /* "开" */
+    {0x005F0018, g_font_cjk24[2]}, /* "开" */
+    {0x005F0020, g_font_cjk32[2]}, /* "开" */
+    {0x005F3A18, g_font_cjk24[10]}, /* "强" */
+    {0x005F5318, g_font_cjk24[31]}, /* "当" */
+    {0x00600118, g_font_cjk24[20]}, /* "态" */
+    {0x00611F18, g_font_cjk24[13]}, /* "感" */
+    {0x00616720, g_font_cjk32[6]}, /* "慧" */
+    {0x00624718, g_font_cjk24[30]}, /* "扇" */
+    {0x00624720, g_font_cjk32[13]}, /* "扇" */
+    {0x00636E18, g_font_cjk24[16]}, /* "据" */
+    {0x00657018, g_font_cjk24[15]}, /* "数" */
+    {0x0066530C, g_font_cjk12[1]}, /* "晓" */
+    {0x00665310, g_font_cjk16[1]}, /* "晓" */
+    {0x00665318, g_font_cjk24[1]}, /* "晓" */
+    {0x00665320, g_font_cjk32[1]}, /* "晓" */
+    {0x00667A20, g_font_cjk32[5]}, /* "智" */
+    {0x00670D18, g_font_cjk24[34]}, /* "服" */
+    {0x00673A18, g_font_cjk24[23]}, /* "机" */
+    {0x00677F0C, g_font_cjk12[4]}, /* "板" */
+    {0x00677F10, g_font_cjk16[4]}, /* "板" */
+    {0x00677F18, g_font_cjk24[4]}, /* "板" */
+    {0x00677F20, g_font_cjk32[4]}, /* "板" */
+    {0x006E2918, g_font_cjk24[5]}, /* "温" */
+    {0x006E7F18, g_font_cjk24[6]}, /* "湿" */
+    {0x00706F18, g_font_cjk24[21]}, /* "灯" */
+    {0x00706F20, g_font_cjk32[9]}, /* "灯" */
+    {0x00716718, g_font_cjk24[9]}, /* "照" */
+    {0x0072B618, g_font_cjk24[19]}, /* "状" */
+    {0x00753518, g_font_cjk24[22]}, /* "电" */
+    {0x0076D220, g_font_cjk32[16]}, /* "盒" */
+    {0x007F6E18, g_font_cjk24[37]}, /* "置" */
+    {0x0080FD20, g_font_cjk32[14]}, /* "能" */
+    {0x0081EA18, g_font_cjk24[27]}, /* "自" */
+    {0x00836F18, g_font_cjk24[35]}, /* "药" */
+    {0x00836F20, g_font_cjk32[15]}, /* "药" */
+    {0x008BBE18, g_font_cjk24[17]}, /* "设" */
+    {0x00901A0C, g_font_cjk12[0]}, /* "通" */
+    {0x00901A10, g_font_cjk16[0]}, /* "通" */
+    {0x00901A18, g_font_cjk24[0]}, /* "通" */
+    {0x00901A20, g_font_cjk32[0]}, /* "通" */
+    {0x0095ED18, g_font_cjk24[26]}, /* "闭" */
+    {0x0098CE18, g_font_cjk24[29]}, /* "风" */
+    {0x0098CE20, g_font_cjk32[12]}, /* "风" */
+    {0x00FF1A18, g_font_cjk24[38]}, /* "：" */
+};
+
+#endif /* _LCD_FONT_CJK_H_ */
@@ -12,34 +12,91 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+/* 本文件由 tools/asset_compiler.py 根据 assets/assets.json 生成，请勿手工修改 */
 #ifndef _PICTURE_H_
 #define _PICTURE_H_
 
-#define IMAGE_MAXSIZE_ISOFTSTONE         20540
-extern const unsigned char img_logo[IMAGE_MAXSIZE_ISOFTSTONE];
-extern const unsigned char gImage_QC[5008];
-extern const unsigned char gImage_HAAVK[5008];
+#define GIMAGE_HAAVK_WIDTH 50
+#define GIMAGE_HAAVK_HEIGHT 50
+#define GIMAGE_HAAVK_IMAGE IMAGE_RGB565(gImage_HAAVK, 50, 50)
+extern const unsigned char gImage_HAAVK[3600];
+#define GIMAGE_QC_WIDTH 50
+#define GIMAGE_QC_HEIGHT 50
+#define GIMAGE_QC_IMAGE IMAGE_RGB565(gImage_QC, 50, 50)
+extern const unsigned char gImage_QC[3982];
+#define IMG_LOGO_WIDTH 177
+#define IMG_LOGO_HEIGHT 58
+#define IMG_LOGO_IMAGE IMAGE_RGB565(img_logo, 177, 58)
+extern const unsigned char img_logo[9850];
 
 //device
-extern const unsigned char img_light_on[8192];
-extern const unsigned char img_light_off[8192];
-extern const unsigned char img_fan_on[8192];
-extern const unsigned char img_fan_off[8192];
-extern const unsigned char img_temp_normal[4608];
-extern const unsigned char img_temp_high[4608];
-extern const unsigned char img_humi[4608];
-extern const unsigned char img_lum[4608];
+#define IMG_LIGHT_ON_WIDTH 64
+#define IMG_LIGHT_ON_HEIGHT 64
+#define IMG_LIGHT_ON_IMAGE IMAGE_RGB565(img_light_on, 64, 64)
+extern const unsigned char img_light_on[611];
+#define IMG_LIGHT_OFF_WIDTH 64
+#define IMG_LIGHT_OFF_HEIGHT 64
+#define IMG_LIGHT_OFF_IMAGE IMAGE_RGB565(img_light_off, 64, 64)
+extern const unsigned char img_light_off[484];
+#define IMG_FAN_ON_WIDTH 64
+#define IMG_FAN_ON_HEIGHT 64
+#define IMG_FAN_ON_IMAGE IMAGE_RGB565(img_fan_on, 64, 64)
+extern const unsigned char img_fan_on[1085];
+#define IMG_FAN_OFF_WIDTH 64
+#define IMG_FAN_OFF_HEIGHT 64
+#define IMG_FAN_OFF_IMAGE IMAGE_RGB565(img_fan_off, 64, 64)
+extern const unsigned char img_fan_off[938];
+#define IMG_TEMP_NORMAL_WIDTH 48
+#define IMG_TEMP_NORMAL_HEIGHT 48
+#define IMG_TEMP_NORMAL_BPP 2
+#define IMG_TEMP_NORMAL_IMAGE IMAGE_INDEXED(img_temp_normal, 48, 48, 2, img_temp_normal_palette)
+extern const unsigned char img_temp_normal[576];
+extern const unsigned short img_temp_normal_palette[4];
+#define IMG_TEMP_HIGH_WIDTH 48
+#define IMG_TEMP_HIGH_HEIGHT 48
+#define IMG_TEMP_HIGH_BPP 2
+#define IMG_TEMP_HIGH_IMAGE IMAGE_INDEXED(img_temp_high, 48, 48, 2, img_temp_high_palette)
+extern const unsigned char img_temp_high[576];
+extern const unsigned short img_temp_high_palette[4];
+#define IMG_HUMI_WIDTH 48
+#define IMG_HUMI_HEIGHT 48
+#define IMG_HUMI_IMAGE IMAGE_RGB565(img_humi, 48, 48)
+extern const unsigned char img_humi[1191];
+#define IMG_LUM_WIDTH 48
+#define IMG_LUM_HEIGHT 48
+#define IMG_LUM_BPP 2
+#define IMG_LUM_IMAGE IMAGE_INDEXED(img_lum, 48, 48, 2, img_lum_palette)
+extern const unsigned char img_lum[576];
+extern const unsigned short img_lum_palette[4];
+
 //weather
-extern const unsigned char img_thunder[4608];
-extern const unsigned char img_sunny[4608];
-extern const unsigned char img_cloudy[4608];
-extern const unsigned char img_raining[4608];
+#define IMG_THUNDER_WIDTH 48
+#define IMG_THUNDER_HEIGHT 48
+#define IMG_THUNDER_IMAGE IMAGE_RGB565(img_thunder, 48, 48)
+extern const unsigned char img_thunder[559];
+#define IMG_SUNNY_WIDTH 48
+#define IMG_SUNNY_HEIGHT 48
+#define IMG_SUNNY_IMAGE IMAGE_RGB565(img_sunny, 48, 48)
+extern const unsigned char img_sunny[401];
+#define IMG_CLOUDY_WIDTH 48
+#define IMG_CLOUDY_HEIGHT 48
+#define IMG_CLOUDY_IMAGE IMAGE_RGB565(img_cloudy, 48, 48)
+extern const unsigned char img_cloudy[272];
+#define IMG_RAINING_WIDTH 48
+#define IMG_RAINING_HEIGHT 48
+#define IMG_RAINING_IMAGE IMAGE_RGB565(img_raining, 48, 48)
+extern const unsigned char img_raining[1275];
+
 //wifi
+#define IMG_WIFI_ON_WIDTH 32
+#define IMG_WIFI_ON_HEIGHT 32
+#define IMG_WIFI_ON_IMAGE IMAGE_RGB565(img_wifi_on, 32, 32)
+#define IMG_WIFI_ON_DESC LCD_IMAGE_RGB565(img_wifi_on, 32, 32)
 extern const unsigned char img_wifi_on[2048];
+#define IMG_WIFI_OFF_WIDTH 32
+#define IMG_WIFI_OFF_HEIGHT 32
+#define IMG_WIFI_OFF_IMAGE IMAGE_RGB565(img_wifi_off, 32, 32)
+#define IMG_WIFI_OFF_DESC LCD_IMAGE_RGB565(img_wifi_off, 32, 32)
 extern const unsigned char img_wifi_off[2048];
 
-
-
-
-
-#endif
\ No newline at end of file
+#endif /* _PICTURE_H_ */
@@ -36,7 +36,12 @@ void lcd_dev_init(void);
 void lcd_show_ui(void);
 void lcd_set_temperature(double temperature);
 void lcd_set_humidity(double humidity);
-void lcd_set_illumination(double illumination);
+bool lcd_set_illumination(double illumination);
+void lcd_add_history(double temperature, double humidity);
+void lcd_add_log(const char *text);
+void lcd_set_idle_timeout(uint32_t partial_ms, uint32_t sleep_ms);
+void lcd_wake(void);
+void lcd_power_update(void);
 void lcd_set_light_state(bool state);
 void lcd_set_motor_state(bool state);
 void lcd_set_auto_state(bool state);
@@ -44,5 +49,7 @@ void lcd_set_auto_state(bool state);
 void smart_home_su03t_cmd_process(int su03t_cmd);
 void smart_home_iot_cmd_process(int iot_cmd);
 void smart_home_key_press_process(uint8_t key_no);
+void smart_home_mqtt_control_process(const char *value);
+const char* get_mqtt_test_value(void);
 
 #endif
@@ -11,24 +11,98 @@ typedef enum event_type{
     event_key_press = 1,
     event_iot_cmd,
     event_su03t,
+    event_gas_alarm,
+    event_mqtt_control,     /* 云端下发的服药位置,payload为字符串 */
 
 }event_type_t;
 
+/* 事件优先级,数值越小越先处理,同一优先级内先进先出 */
+typedef enum event_class{
+    EVENT_CLASS_SAFETY = 0,     /* 安全告警:气体超标 */
+    EVENT_CLASS_INPUT,          /* 用户输入:按键,语音 */
+    EVENT_CLASS_BACKGROUND,     /* 后台:云端命令 */
+    EVENT_CLASS_NUM,
+}event_class_t;
+
+/* 每个优先级的队列深度 */
+#define EVENT_SAFETY_DEPTH      4
+#define EVENT_INPUT_DEPTH       8
+#define EVENT_BACKGROUND_DEPTH  8
+
+
+/* 事件附带的数据,从固定大小的块池中分配,不在每个事件上使用堆.
+ * 字符串和结构体(药格编号,服药计划,服药记录)都拷贝到data中.
+ * 引用计数为0时回到块池 */
+#define EVENT_PAYLOAD_SIZE      64
+#define EVENT_PAYLOAD_NUM       8
+
+typedef struct event_payload
+{
+    struct event_payload *next;     /* 空闲链表 */
+    uint8_t refs;
+    uint16_t len;
+    uint8_t data[EVENT_PAYLOAD_SIZE];
+} event_payload_t;
+
+/* 块池统计 */
+typedef struct event_pool_stats
+{
+    uint16_t num;               /* 块数 */
+    uint16_t free;              /* 当前空闲的块数 */
+    uint16_t low_water;         /* 空闲块数的最小值 */
+    uint32_t alloc_failed;      /* 块池用完分配失败的次数 */
+} event_pool_stats_t;
 
 typedef struct event_info
 {
     event_type_t event;
+    event_payload_t *payload;   /* 没有附带数据时为NULL */
+    uint16_t trace_id;          /* 发送时分配,跟踪记录中的事件序号 */
 
     union {
         uint8_t key_no;
         int iot_data;
         int su03t_data;
+        int gas_ppm;
 
     } data;
 } event_info_t;
 
+/* 队列满时的处理策略 */
+typedef enum event_policy{
+    EVENT_POLICY_REJECT = 0,    /* 拒绝新事件,返回EVENT_ERR_FULL */
+    EVENT_POLICY_DROP_OLDEST,   /* 丢弃同一优先级中最早的事件 */
+    EVENT_POLICY_COALESCE,      /* 替换排队中同一对象的事件,新状态覆盖旧状态;没有可替换的事件且队列满时拒绝 */
+}event_policy_t;
+
+/* smart_home_event_send的返回值 */
+#define EVENT_OK            0
+#define EVENT_ERR_FULL      (-1)    /* 队列满,事件被拒绝 */
+
+/* 每个优先级的统计 */
+typedef struct event_class_stats
+{
+    uint16_t depth;             /* 队列深度 */
+    uint16_t count;             /* 当前排队的事件数 */
+    uint16_t high_water;        /* 排队事件数的最大值 */
+    uint32_t posted;            /* 入队的事件数 */
+    uint32_t coalesced;         /* 替换了排队中事件的次数 */
+    uint32_t dropped;           /* 队列满时丢弃的最早事件数 */
+    uint32_t rejected;          /* 队列满时拒绝的新事件数 */
+} event_class_stats_t;
+
+event_payload_t *event_payload_alloc(const void *data, uint16_t len);
+event_payload_t *event_payload_alloc_text(const char *text);
+void event_payload_ref(event_payload_t *payload);
+void event_payload_unref(event_payload_t *payload);
+void event_pool_get_stats(event_pool_stats_t *stats);
+
 void smart_home_event_init();
-void smart_home_event_send(event_info_t *event);
+int smart_home_event_send(event_info_t *event);
 int smart_home_event_wait(event_info_t *event,int timeoutMs);
+void smart_home_event_release(event_info_t *event);
+bool smart_home_event_urgent(void);
+event_class_t smart_home_event_class(event_type_t type);
+void smart_home_event_get_stats(event_class_t cls, event_class_stats_t *stats);
 
-#endif
\ No newline at end of file
+#endif
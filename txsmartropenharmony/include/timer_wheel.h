@@ -0,0 +1,47 @@
+#ifndef __TIMER_WHEEL_H__
+#define __TIMER_WHEEL_H__
+
+#include "stdint.h"
+#include "stdbool.h"
+
+/* 时间轮精度和槽数,一圈TIMER_WHEEL_RES_MS*TIMER_WHEEL_SLOTS毫秒,
+ * 超过一圈的定时器留在槽里,转到到期的那一圈才触发 */
+#define TIMER_WHEEL_RES_MS      10
+#define TIMER_WHEEL_SLOTS       64      /* 必须是2的幂 */
+
+typedef void (*timer_wheel_cb_t)(void *arg);
+
+/* 定时器由使用者静态分配,时间轮只把它挂到槽的链表上 */
+typedef struct timer_wheel_timer
+{
+    const char *name;
+    timer_wheel_cb_t cb;
+    void *arg;
+    uint32_t period_ms;         /* 0为单次定时器 */
+
+    /* 以下由时间轮维护 */
+    struct timer_wheel_timer *next;         /* 同一个槽中的下一个 */
+    struct timer_wheel_timer *all_next;     /* 所有启动过的定时器,用于统计 */
+    uint32_t due_ms;            /* 应该触发的时刻 */
+    uint32_t slot_ms;           /* due_ms按精度向上取整,所在槽的时刻 */
+    bool active;
+    bool registered;
+
+    /* 触发抖动统计,抖动为实际触发时刻减去应该触发的时刻 */
+    uint32_t fired;
+    uint32_t jitter_max_ms;
+    uint32_t jitter_total_ms;
+    uint32_t missed;            /* 周期定时器来不及处理而跳过的周期数 */
+} timer_wheel_timer_t;
+
+#define TIMER_WHEEL_TIMER(n, callback, a) {.name = (n), .cb = (callback), .arg = (a)}
+
+void timer_wheel_init(void);
+void timer_wheel_start(timer_wheel_timer_t *timer, uint32_t delay_ms, uint32_t period_ms);
+void timer_wheel_stop(timer_wheel_timer_t *timer);
+bool timer_wheel_is_active(const timer_wheel_timer_t *timer);
+uint32_t timer_wheel_next_ms(void);
+void timer_wheel_run(void);
+void timer_wheel_dump(void);
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef __TRACE_H__
+#define __TRACE_H__
+
+#include "stdint.h"
+#include "stdbool.h"
+
+/* 事件跟踪: 环形记录(时刻, 任务, 事件类型, 事件序号, 阶段),
+ * 通过串口shell命令trace或云端命令trace_dump导出,
+ * 由tools/trace_decode.py统计每类事件各阶段的延时 */
+#define TRACE_ENABLE            1
+#define TRACE_RING_SIZE         256     /* 必须是2的幂 */
+
+typedef enum trace_phase{
+    TRACE_PHASE_ENQUEUE = 0,    /* 生产者发送事件 */
+    TRACE_PHASE_DEQUEUE,        /* smart_home_thread取出事件 */
+    TRACE_PHASE_HANDLER_START,  /* 开始处理 */
+    TRACE_PHASE_HANDLER_END,    /* 处理完,GPIO/PWM已经改变 */
+    TRACE_PHASE_FLUSH,          /* 一帧全部下发到屏幕,事件类型和序号为0 */
+    TRACE_PHASE_DROP,           /* 事件被合并,丢弃或拒绝 */
+}trace_phase_t;
+
+/* 导出的位置,每次导出前用trace_dump_begin初始化 */
+typedef struct trace_cursor
+{
+    uint32_t pos;
+    uint32_t end;
+    bool header;
+} trace_cursor_t;
+
+#if TRACE_ENABLE
+void trace_init(void);
+uint16_t trace_new_id(void);
+void trace_record(uint8_t event, uint16_t id, trace_phase_t phase);
+void trace_clear(void);
+void trace_dump_begin(trace_cursor_t *cursor);
+int trace_dump_read(trace_cursor_t *cursor, char *buf, int size);
+#else
+#define trace_init()
+#define trace_new_id()                      0
+#define trace_record(event, id, phase)
+#define trace_clear()
+#define trace_dump_begin(cursor)
+#define trace_dump_read(cursor, buf, size)  0
+#endif
+
+#endif
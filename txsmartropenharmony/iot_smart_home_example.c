@@ -27,6 +27,8 @@
 #include "lcd.h"
 #include "picture.h"
 #include "adc_key.h"
+#include "timer_wheel.h"
+#include "trace.h"
 
 // 添加MQ2气体传感器和蜂鸣器相关头文件
 #include "iot_errno.h"
@@ -49,6 +51,15 @@
 // 蜂鸣器相关定义
 #define BEEP_PORT EPWMDEV_PWM5_M0
 
+// 周期任务,单位毫秒
+#define SHT30_PERIOD_MS         2000
+#define BH1750_PERIOD_MS        1000
+#define MQ2_PERIOD_MS           250
+#define PUBLISH_PERIOD_MS       10000
+#define TIMER_STATS_PERIOD_MS   60000
+#define POWER_PERIOD_MS         1000    // 检查无操作时间,切换屏幕电源状态
+#define UI_DELAY_MS             20      // 显示有变化后延时重画,合并同一时间的多个变化
+
 // 气体传感器全局变量
 static float m_r0; // 元件在干净空气中的阻值
 static bool gas_alarm_active = false; // 气体报警状态
@@ -172,6 +183,129 @@ void beep_play_music()
     }
 }
 
+/***************************************************************
+* 函数名称: gas_alarm_process
+* 说    明: 处理气体超标告警
+* 参    数: int ppm 气体浓度
+* 返 回 值: 无
+***************************************************************/
+static void gas_alarm_process(int ppm)
+{
+    char log_text[32];
+
+    printf("Gas concentration exceeded threshold! PPM: %d\r\n", ppm);
+    snprintf(log_text, sizeof(log_text), "gas alarm %dppm", ppm);
+    lcd_add_log(log_text);
+    lcd_wake();
+    beep_play_music();
+}
+
+/* 传感器最新的数据,由各自的周期任务更新 */
+static double sensor_temp, sensor_humi, sensor_lum;
+static float sensor_gas_ppm;
+
+static void sht30_job(void *arg);
+static void bh1750_job(void *arg);
+static void mq2_job(void *arg);
+static void publish_job(void *arg);
+static void ui_job(void *arg);
+static void timer_stats_job(void *arg);
+static void power_job(void *arg);
+
+static timer_wheel_timer_t sht30_timer = TIMER_WHEEL_TIMER("sht30", sht30_job, NULL);
+static timer_wheel_timer_t bh1750_timer = TIMER_WHEEL_TIMER("bh1750", bh1750_job, NULL);
+static timer_wheel_timer_t mq2_timer = TIMER_WHEEL_TIMER("mq2", mq2_job, NULL);
+static timer_wheel_timer_t publish_timer = TIMER_WHEEL_TIMER("publish", publish_job, NULL);
+static timer_wheel_timer_t ui_timer = TIMER_WHEEL_TIMER("ui", ui_job, NULL);
+static timer_wheel_timer_t timer_stats_timer = TIMER_WHEEL_TIMER("stats", timer_stats_job, NULL);
+static timer_wheel_timer_t power_timer = TIMER_WHEEL_TIMER("power", power_job, NULL);
+
+/* 显示内容有变化,稍后重画屏幕 */
+static void ui_request(void)
+{
+    if (!timer_wheel_is_active(&ui_timer)) {
+        timer_wheel_start(&ui_timer, UI_DELAY_MS, 0);
+    }
+}
+
+static void sht30_job(void *arg)
+{
+    sht30_read_data(&sensor_temp, &sensor_humi);
+    lcd_set_temperature(sensor_temp);
+    lcd_set_humidity(sensor_humi);
+    lcd_add_history(sensor_temp, sensor_humi);
+    ui_request();
+}
+
+static void bh1750_job(void *arg)
+{
+    bh1750_read_data(&sensor_lum);
+    /* 显示的数值没有变化时不重画 */
+    if (lcd_set_illumination(sensor_lum)) {
+        ui_request();
+    }
+}
+
+static void mq2_job(void *arg)
+{
+    event_info_t alarm_event = {0};
+
+    // 读取气体传感器数据
+    sensor_gas_ppm = get_mq2_ppm();
+
+    // 检查气体浓度是否超过阈值 - 修改阈值从1500.0改为100.0
+    if (sensor_gas_ppm > 100.0) {
+        if (!gas_alarm_active) {
+            /* 告警走最高优先级,排在已经到达的按键和云端命令前面处理;
+             * 告警队列满被拒绝时下一轮重发 */
+            alarm_event.event = event_gas_alarm;
+            alarm_event.data.gas_ppm = (int)sensor_gas_ppm;
+            gas_alarm_active = (smart_home_event_send(&alarm_event) == EVENT_OK);
+        }
+    } else {
+        gas_alarm_active = false;
+    }
+}
+
+static void publish_job(void *arg)
+{
+    e_iot_data iot_data = {0};
+
+    if (mqtt_is_connected())
+    {
+        // 发送iot数据
+        iot_data.illumination = sensor_lum;
+        iot_data.temperature = sensor_temp;
+        iot_data.humidity = sensor_humi;
+        iot_data.gas_ppm = sensor_gas_ppm;    // 添加气体浓度数据
+        iot_data.light_state = get_light_state();
+        iot_data.motor_state = get_motor_state();
+        // iot_data.auto_state = auto_state;
+        iot_data.mqtt_test = get_mqtt_test_value();
+        send_msg_to_mqtt(&iot_data);
+
+        lcd_set_network_state(true);
+    }else{
+        lcd_set_network_state(false);
+    }
+    ui_request();
+}
+
+static void ui_job(void *arg)
+{
+    lcd_show_ui();
+}
+
+static void timer_stats_job(void *arg)
+{
+    timer_wheel_dump();
+}
+
+static void power_job(void *arg)
+{
+    lcd_power_update();
+}
+
 /***************************************************************
  * 函数名称: iot_thread
  * 说    明: iot线程
@@ -225,8 +359,6 @@ void smart_home_thread(void *arg)
     double temperature_range = 35.0;
     double humidity_range = 80.0;
 
-    e_iot_data iot_data = {0};
-
     i2c_dev_init();
     lcd_dev_init();
     motor_dev_init();
@@ -246,14 +378,24 @@ void smart_home_thread(void *arg)
     // lcd_load_ui();
     lcd_show_ui();
 
+    /* 各个任务按自己的周期运行,不受事件到达的影响 */
+    timer_wheel_init();
+    timer_wheel_start(&sht30_timer, 0, SHT30_PERIOD_MS);
+    timer_wheel_start(&bh1750_timer, 0, BH1750_PERIOD_MS);
+    timer_wheel_start(&mq2_timer, 0, MQ2_PERIOD_MS);
+    timer_wheel_start(&publish_timer, 0, PUBLISH_PERIOD_MS);
+    timer_wheel_start(&timer_stats_timer, TIMER_STATS_PERIOD_MS, TIMER_STATS_PERIOD_MS);
+    timer_wheel_start(&power_timer, POWER_PERIOD_MS, POWER_PERIOD_MS);
+
     while(1)
     {
         event_info_t event_info = {0};
-        //等待事件触发,如有触发,则立即处理对应事件,如未等到,则执行默认的代码逻辑,更新屏幕
-        int ret = smart_home_event_wait(&event_info,3000);
+        //等待事件触发,最多等到下一个定时器到期
+        int ret = smart_home_event_wait(&event_info,timer_wheel_next_ms());
         if(ret == LOS_OK){
             //收到指令
             printf("event recv %d ,%d\n",event_info.event,event_info.data.iot_data);
+            trace_record(event_info.event, event_info.trace_id, TRACE_PHASE_HANDLER_START);
             switch (event_info.event)
             {
                 case event_key_press:
@@ -266,53 +408,20 @@ void smart_home_thread(void *arg)
                 case event_su03t:
                     smart_home_su03t_cmd_process(event_info.data.su03t_data);
                     break;
+                case event_gas_alarm:
+                    gas_alarm_process(event_info.data.gas_ppm);
+                    break;
+                case event_mqtt_control:
+                    smart_home_mqtt_control_process((const char *)event_info.payload->data);
+                    break;
                default:break;
             }
-
-        }
-
-        double temp,humi,lum;
-        float gas_ppm;
-
-        sht30_read_data(&temp,&humi);
-        bh1750_read_data(&lum);
-        
-        // 读取气体传感器数据
-        gas_ppm = get_mq2_ppm();
-        // printf("Gas PPM: %.3f\r\n", gas_ppm);
-        
-        // 检查气体浓度是否超过阈值 - 修改阈值从1500.0改为100.0
-        if (gas_ppm > 100.0) {
-            if (!gas_alarm_active) {
-                gas_alarm_active = true;
-                printf("Gas concentration exceeded threshold! PPM: %.3f\r\n", gas_ppm);
-                beep_play_music();
-            }
-        } else {
-            gas_alarm_active = false;
-        }
-
-        lcd_set_illumination(lum);
-        lcd_set_temperature(temp);
-        lcd_set_humidity(humi);
-        if (mqtt_is_connected()) 
-        {
-            // 发送iot数据
-            iot_data.illumination = lum;
-            iot_data.temperature = temp;
-            iot_data.humidity = humi;
-            iot_data.gas_ppm = gas_ppm;           // 添加气体浓度数据
-            iot_data.light_state = get_light_state();
-            iot_data.motor_state = get_motor_state();
-            // iot_data.auto_state = auto_state;
-            send_msg_to_mqtt(&iot_data);
-
-            lcd_set_network_state(true);
-        }else{  
-            lcd_set_network_state(false);
+            trace_record(event_info.event, event_info.trace_id, TRACE_PHASE_HANDLER_END);
+            smart_home_event_release(&event_info);
+            ui_request();
         }
 
-        lcd_show_ui();
+        timer_wheel_run();
     }
 }
 
@@ -355,6 +464,7 @@ void iot_smart_home_example()
     unsigned int ret = LOS_OK;
     
     smart_home_event_init();
+    trace_init();
     
     // ret = LOS_QueueCreate("su03_queue", MSG_QUEUE_LENGTH, &m_su03_msg_queue, 0, BUFFER_LEN);
     // if (ret != LOS_OK)
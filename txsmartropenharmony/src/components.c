@@ -1,5 +1,20 @@
 #include "components.h"
 #include "lcd.h"
+#include "string.h"
+
+
+/* 条带之间调用,返回true时挂起当前帧让出绘图线程 */
+static bool (*ui_yield)(void) = NULL;
+
+/* 按图片格式选择显示方式 */
+static void lcd_image_draw(int x, int y, const image_t *img)
+{
+    if ((img->bpp == 1) || (img->bpp == 2) || (img->bpp == 4)) {
+        lcd_show_picture_indexed(x, y, img->width, img->height, img->bpp, img->palette, img->img);
+    } else {
+        lcd_show_picture(x, y, img->width, img->height, img->img);
+    }
+}
 
 
 int lcd_menu_init(void)
@@ -16,7 +31,7 @@ int lcd_menu_draw(lcd_menu_t *menu)
     }
 
     /*先显示图片*/
-    lcd_show_picture(menu->base_x, menu->base_y, menu->img.width, menu->img.height, menu->img.img);
+    lcd_image_draw(menu->base_x, menu->base_y, &menu->img);
     
     /* LCD中英文混合显示*/
     lcd_show_text(menu->base_x,menu->base_y+menu->img.height+3  , menu->text.name, menu->text.fc,
@@ -72,7 +87,7 @@ int lcd_db_draw(lcd_display_board_t *db){
     }
 
     /*先显示图片*/
-    lcd_show_picture(db->base_x, db->base_y, db->img.width, db->img.height, db->img.img);
+    lcd_image_draw(db->base_x, db->base_y, &db->img);
 
     /* LCD中英文混合显示*/
     lcd_show_text(db->base_x+db->img.width+3,db->base_y+8  , db->text.name, db->text.fc,
@@ -81,14 +96,879 @@ int lcd_db_draw(lcd_display_board_t *db){
     return 0;
 }
 
+/* 面板画完后记录显示的文字,lcd_db_set_text与它比较 */
+static void lcd_db_commit(lcd_display_board_t *db)
+{
+    if (db != NULL) {
+        strcpy(db->drawn, db->text.name);
+    }
+}
+
 int lcd_db_show(lcd_display_board_t *lcd_dbs[] , int db_num){
     
       for(int i = 0;i<db_num;i++){
         lcd_display_board_t *db = lcd_dbs[i];
         lcd_db_draw(db);
+        lcd_db_commit(db);
+
+    }
+}
+
+/* 字符占用的字节数,与lcd_show_text的规则一致:英文1字节,中文3字节 */
+static int lcd_char_len(const char *str)
+{
+    if (*str == '\0') {
+        return 0;
+    }
+    return (str[0] > 0) ? 1 : 3;
+}
+
+/* 字符的显示宽度,英文宽度只有字号一半 */
+static int lcd_char_width(const char *str, int font_size)
+{
+    if (*str == '\0') {
+        return 0;
+    }
+    return (str[0] > 0) ? font_size / 2 : font_size;
+}
+
+/* 计算中英文混合字符串的显示宽度,与lcd_show_text的排版规则一致 */
+static int lcd_text_width(const char *str, int font_size)
+{
+    int width = 0;
+
+    while (*str != '\0')
+    {
+        width += lcd_char_width(str, font_size);
+        str += lcd_char_len(str);
+    }
+    return width;
+}
+
+/* 面板文字区域失效 */
+static void lcd_db_invalidate_text(lcd_display_board_t *db, int width)
+{
+    int x = db->base_x + db->img.width + 3;
+    int y = db->base_y + 8;
+
+    lcd_invalidate(x, y, x + width, y + db->text.font_size);
+}
+
+/* 与上一次显示的文字逐个字符比较,只标记变化的字符格 */
+static void lcd_text_invalidate_diff(int x, int y, int fs, const char *old, const char *new)
+{
+    int old_len, new_len, old_w, new_w;
+
+    while ((*old != '\0') || (*new != '\0')) {
+        old_len = lcd_char_len(old);
+        new_len = lcd_char_len(new);
+        old_w = lcd_char_width(old, fs);
+        new_w = lcd_char_width(new, fs);
+
+        if (old_w != new_w) {
+            /* 宽度不同,后面的字符位置全部错开,从这里到末尾都要重画 */
+            old_w = lcd_text_width(old, fs);
+            new_w = lcd_text_width(new, fs);
+            lcd_invalidate(x, y, x + (old_w > new_w ? old_w : new_w), y + fs);
+            return;
+        }
+
+        if ((old_len != new_len) || (memcmp(old, new, old_len) != 0)) {
+            lcd_invalidate(x, y, x + new_w, y + fs);
+        }
+        x += new_w;
+        old += old_len;
+        new += new_len;
+    }
+}
+
+/**
+ * @brief 设置面板文字,只标记与上一次显示内容不同的字符格
+ *
+ * @param db 面板
+ * @param name 新的文字
+ */
+void lcd_db_set_text(lcd_display_board_t *db, const char *name)
+{
+    if (strcmp(db->text.name, name) == 0) {
+        return;
+    }
+
+    strncpy(db->text.name, name, sizeof(db->text.name) - 1);
+    db->text.name[sizeof(db->text.name) - 1] = '\0';
+    lcd_text_invalidate_diff(db->base_x + db->img.width + 3, db->base_y + 8, db->text.font_size,
+        db->drawn, db->text.name);
+}
+
+/**
+ * @brief 设置面板文字颜色,颜色变化时才标记刷新区域
+ *
+ * @param db 面板
+ * @param fc 文字颜色
+ */
+void lcd_db_set_color(lcd_display_board_t *db, int fc)
+{
+    if (db->text.fc == fc) {
+        return;
+    }
+
+    db->text.fc = fc;
+    lcd_db_invalidate_text(db, lcd_text_width(db->text.name, db->text.font_size));
+}
+
+/**
+ * @brief 设置面板图片,图片变化时才标记刷新区域
+ *
+ * @param db 面板
+ * @param img 图片,尺寸应与面板原有图片一致
+ */
+void lcd_db_set_image(lcd_display_board_t *db, const image_t *img)
+{
+    if ((db->img.img == img->img) && (db->img.palette == img->palette)) {
+        return;
+    }
+
+    db->img = *img;
+    lcd_invalidate(db->base_x, db->base_y, db->base_x + db->img.width, db->base_y + db->img.height);
+}
+
+/* 按整个字符拷贝文字,避免截断时留下半个中文字符 */
+static void lcd_text_copy(char *dst, const char *src, int size)
+{
+    int len = 0;
+    int char_len;
+
+    while (*src != '\0') {
+        char_len = lcd_char_len(src);
+        if (len + char_len > size - 1) {
+            break;
+        }
+        memcpy(dst + len, src, char_len);
+        len += char_len;
+        src += char_len;
+    }
+    dst[len] = '\0';
+}
+
+/* 样本值对应的行,超出范围时画在边上 */
+static int lcd_chart_row(const lcd_chart_t *chart, int series, int value)
+{
+    int min = chart->min[series];
+    int max = chart->max[series];
+    int row;
+
+    if (max <= min) {
+        return chart->height - 1;
+    }
+    value = (value < min) ? min : ((value > max) ? max : value);
+    row = (value - min) * (chart->height - 1) / (max - min);
+    return chart->height - 1 - row;
+}
+
+/* 画第n个样本所在的一列,与前一个样本连成竖线,只用一个窗口下发 */
+static void lcd_chart_draw_column(lcd_chart_t *chart, uint32_t n)
+{
+    uint16_t col[LCD_CHART_HEIGHT_MAX];
+    int x = chart->base_x + n % LCD_CHART_POINTS;
+    int s, y, y1, y2;
 
+    for (y = 0; y < chart->height; y++) {
+        col[y] = chart->bc;
     }
+
+    for (s = 0; s < chart->series_num; s++) {
+        y1 = lcd_chart_row(chart, s, chart->samples[s][n % LCD_CHART_POINTS]);
+        y2 = y1;
+        if (n > 0) {
+            y2 = lcd_chart_row(chart, s, chart->samples[s][(n - 1) % LCD_CHART_POINTS]);
+        }
+        if (y1 > y2) {
+            y = y1;
+            y1 = y2;
+            y2 = y;
+        }
+        for (y = y1; y <= y2; y++) {
+            col[y] = chart->fc[s];
+        }
+    }
+
+    if (lcd_set_window(x, chart->base_y, x, chart->base_y + chart->height - 1)) {
+        lcd_write_pixels(col, chart->height);
+    }
+}
+
+/* 画一列背景色 */
+static void lcd_chart_clear_column(lcd_chart_t *chart, uint32_t n)
+{
+    int x = chart->base_x + n % LCD_CHART_POINTS;
+
+    lcd_fill(x, chart->base_y, x + 1, chart->base_y + chart->height, chart->bc);
+}
+
+/* 样本n和它后面的光标列失效 */
+static void lcd_chart_invalidate(lcd_chart_t *chart, uint32_t n)
+{
+    int x = chart->base_x + n % LCD_CHART_POINTS;
+    int gap = chart->base_x + (n + 1) % LCD_CHART_POINTS;
+
+    if (gap == x + 1) {
+        lcd_invalidate(x, chart->base_y, x + 2, chart->base_y + chart->height);
+    } else {
+        lcd_invalidate(x, chart->base_y, x + 1, chart->base_y + chart->height);
+        lcd_invalidate(gap, chart->base_y, gap + 1, chart->base_y + chart->height);
+    }
+}
+
+/**
+ * @brief 趋势图添加一组样本,每条曲线一个值,只标记新的一列和光标列
+ *
+ * @param chart 趋势图
+ * @param values 各条曲线的样本值,个数为series_num
+ */
+void lcd_chart_push(lcd_chart_t *chart, const int *values)
+{
+    uint32_t n = chart->count;
+
+    for (int s = 0; s < chart->series_num; s++) {
+        chart->samples[s][n % LCD_CHART_POINTS] = values[s];
+    }
+    chart->count++;
+    lcd_chart_invalidate(chart, n);
 }
 
+/**
+ * @brief 绘制趋势图,非整图重画时只画上次绘制之后新增的样本.
+ *        不修改趋势图状态,画完后调用lcd_chart_commit
+ *
+ * @param chart 趋势图
+ * @param full 是否整图重画
+ * @return 0成功,-1参数错误
+ */
+int lcd_chart_draw(lcd_chart_t *chart, bool full)
+{
+    uint32_t first, n;
+
+    if ((chart == NULL) || (chart->height <= 0) || (chart->height > LCD_CHART_HEIGHT_MAX)) {
+        return -1;
+    }
+
+    /* 最老的样本所在列已经被光标列占用 */
+    first = (chart->count >= LCD_CHART_POINTS) ? (chart->count - LCD_CHART_POINTS + 1) : 0;
 
+    if (full || (chart->drawn < first)) {
+        for (n = first; n < first + LCD_CHART_POINTS; n++) {
+            if (n < chart->count) {
+                lcd_chart_draw_column(chart, n);
+            } else {
+                lcd_chart_clear_column(chart, n);
+            }
+        }
+    } else {
+        for (n = chart->drawn; n < chart->count; n++) {
+            lcd_chart_draw_column(chart, n);
+            lcd_chart_clear_column(chart, n + 1);
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief 趋势图画完后记录已绘制的样本数
+ *
+ * @param chart 趋势图
+ */
+void lcd_chart_commit(lcd_chart_t *chart)
+{
+    if (chart != NULL) {
+        chart->drawn = chart->count;
+    }
+}
+
+/* 控制台文字区域的起点,行槽模式前面留一个字符宽度显示标记 */
+static int lcd_console_text_x(const lcd_console_t *con)
+{
+    return con->hw_scroll ? con->base_x : (con->base_x + con->font_size / 2);
+}
+
+/* 行槽对应的显存行 */
+static int lcd_console_slot_y(const lcd_console_t *con, uint32_t n)
+{
+    return con->base_y + (n % con->lines) * con->font_size;
+}
+
+/* 画行槽的标记,最新一行显示'>' */
+static void lcd_console_draw_marker(lcd_console_t *con, uint32_t n)
+{
+    if (!con->hw_scroll) {
+        lcd_show_text(con->base_x, lcd_console_slot_y(con, n), (n + 1 == con->count) ? ">" : " ",
+            con->fc, con->bc, con->font_size, 0);
+    }
+}
+
+/* 画第n行,文字后面的部分用背景色填满 */
+static void lcd_console_draw_line(lcd_console_t *con, uint32_t n)
+{
+    int x = lcd_console_text_x(con);
+    int y = lcd_console_slot_y(con, n);
+    char *text = con->text[n % con->lines];
+
+    lcd_console_draw_marker(con, n);
+    lcd_show_text(x, y, text, con->fc, con->bc, con->font_size, 0);
+    x += lcd_text_width(text, con->font_size);
+    if (x < con->base_x + con->width) {
+        lcd_fill(x, y, con->base_x + con->width, y + con->font_size, con->bc);
+    }
+}
+
+/* 清空一个行槽 */
+static void lcd_console_clear_line(lcd_console_t *con, uint32_t n)
+{
+    int y = lcd_console_slot_y(con, n);
+
+    lcd_fill(con->base_x, y, con->base_x + con->width, y + con->font_size, con->bc);
+}
+
+/* 硬件滚动时让最老的一行显示在最上面 */
+static void lcd_console_scroll(lcd_console_t *con)
+{
+    if (con->hw_scroll) {
+        lcd_scroll_start((con->count >= con->lines) ? lcd_console_slot_y(con, con->count) : con->base_y);
+    }
+}
+
+/**
+ * @brief 初始化控制台,需要在lcd_init之后调用
+ *
+ * 竖屏(LCD_SCROLL_VERTICAL)且控制台占满整行宽度时使用硬件滚动.
+ *
+ * @param con 控制台
+ * @return 0成功,-1参数错误
+ */
+int lcd_console_init(lcd_console_t *con)
+{
+    int height = con->lines * con->font_size;
+
+    if ((con->lines <= 0) || (con->lines > LCD_CONSOLE_LINES_MAX) ||
+        (con->base_y + height > LCD_H)) {
+        return -1;
+    }
+
+    con->count = 0;
+    con->drawn = 0;
+    con->hw_scroll = false;
+#if LCD_SCROLL_VERTICAL
+    if ((con->base_x == 0) && (con->width == LCD_W)) {
+        con->hw_scroll = lcd_scroll_define(con->base_y, height, LCD_H - con->base_y - height);
+    }
+#endif
+    return 0;
+}
 
+/**
+ * @brief 控制台追加一行,超出宽度的部分被截掉,只标记这一行需要刷新
+ *
+ * @param con 控制台
+ * @param text 文字
+ */
+void lcd_console_append(lcd_console_t *con, const char *text)
+{
+    char *line = con->text[con->count % con->lines];
+    int avail = con->base_x + con->width - lcd_console_text_x(con);
+    int width = 0;
+    int len = 0;
+    int y;
+
+    /* 按整个字符截断到一行能显示的宽度 */
+    while ((text[len] != '\0') && (len + lcd_char_len(text + len) < sizeof(con->text[0]))) {
+        width += lcd_char_width(text + len, con->font_size);
+        if (width > avail) {
+            break;
+        }
+        len += lcd_char_len(text + len);
+    }
+    memcpy(line, text, len);
+    line[len] = '\0';
+
+    /* 上一个最新行的标记要清掉 */
+    if (!con->hw_scroll && (con->count > 0)) {
+        y = lcd_console_slot_y(con, con->count - 1);
+        lcd_invalidate(con->base_x, y, lcd_console_text_x(con), y + con->font_size);
+    }
+    con->count++;
+    y = lcd_console_slot_y(con, con->count - 1);
+    lcd_invalidate(con->base_x, y, con->base_x + con->width, y + con->font_size);
+}
+
+/**
+ * @brief 绘制控制台,非整体重画时只画上次绘制之后追加的行.
+ *        不修改控制台状态,条带渲染时每条条带都会调用一次,
+ *        画完后调用lcd_console_commit
+ *
+ * @param con 控制台
+ * @param full 是否整体重画
+ * @return 0成功,-1参数错误
+ */
+int lcd_console_draw(lcd_console_t *con, bool full)
+{
+    uint32_t first, n;
+
+    if ((con == NULL) || (con->lines <= 0)) {
+        return -1;
+    }
+
+    first = (con->count > con->lines) ? (con->count - con->lines) : 0;
+
+    if (full || (con->drawn < first)) {
+        for (n = first; n < first + con->lines; n++) {
+            if (n < con->count) {
+                lcd_console_draw_line(con, n);
+            } else {
+                lcd_console_clear_line(con, n);
+            }
+        }
+    } else if (con->drawn < con->count) {
+        if (con->drawn > 0) {
+            lcd_console_draw_marker(con, con->drawn - 1);
+        }
+        for (n = con->drawn; n < con->count; n++) {
+            lcd_console_draw_line(con, n);
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief 控制台画完后记录已绘制的行数,硬件滚动时更新滚动起始行.
+ *        滚动命令在所有条带之后下发,每帧只下发一次
+ *
+ * @param con 控制台
+ * @param full 与lcd_console_draw的参数一致
+ */
+void lcd_console_commit(lcd_console_t *con, bool full)
+{
+    if ((con == NULL) || (con->lines <= 0)) {
+        return;
+    }
+    if (!full && (con->drawn >= con->count)) {
+        return;
+    }
+
+    con->drawn = con->count;
+    lcd_console_scroll(con);
+}
+
+/* 控件区域失效,与lcd_invalidate一样使用不包含的结束坐标 */
+static void ui_invalidate_rect(int x, int y, int width, int height)
+{
+    if ((width > 0) && (height > 0)) {
+        lcd_invalidate(x, y, x + width, y + height);
+    }
+}
+
+static void ui_widget_init(ui_widget_t *w, ui_type_t type, int x, int y, int width, int height)
+{
+    memset(w, 0, sizeof(ui_widget_t));
+    w->type = type;
+    w->x = x;
+    w->y = y;
+    w->width = width;
+    w->height = height;
+    w->bc = UI_COLOR_NONE;
+    w->dirty = true;
+}
+
+/**
+ * @brief 初始化容器
+ *
+ * @param w 控件
+ * @param x,y,width,height 容器区域
+ * @param bc 背景色,UI_COLOR_NONE表示不绘制背景
+ */
+void ui_container_init(ui_widget_t *w, int x, int y, int width, int height, int bc)
+{
+    ui_widget_init(w, UI_CONTAINER, x, y, width, height);
+    w->bc = bc;
+}
+
+/**
+ * @brief 初始化文字标签,标签区域随文字宽度变化
+ *
+ * @param w 控件
+ * @param x,y 文字位置
+ * @param str 文字
+ * @param fc 文字颜色
+ * @param bc 背景色
+ * @param font_size 字号
+ */
+void ui_label_init(ui_widget_t *w, int x, int y, const char *str, int fc, int bc, int font_size)
+{
+    ui_widget_init(w, UI_LABEL, x, y, 0, font_size);
+    lcd_text_copy(w->text.name, str, sizeof(w->text.name));
+    w->width = lcd_text_width(w->text.name, font_size);
+    w->text.fc = fc;
+    w->text.bc = bc;
+    w->text.font_size = font_size;
+}
+
+/**
+ * @brief 初始化图片控件
+ *
+ * @param w 控件
+ * @param x,y 图片位置
+ * @param img 图片
+ */
+void ui_image_init(ui_widget_t *w, int x, int y, const image_t *img)
+{
+    ui_widget_init(w, UI_IMAGE, x, y, img->width, img->height);
+    w->img = *img;
+}
+
+/**
+ * @brief 初始化菜单项控件,区域包括图片和下方的文字
+ *
+ * @param w 控件
+ * @param menu 菜单
+ */
+void ui_menu_init(ui_widget_t *w, lcd_menu_t *menu)
+{
+    int text_width = lcd_text_width(menu->text.name, menu->text.font_size);
+
+    ui_widget_init(w, UI_MENU, menu->base_x, menu->base_y,
+        menu->img.width > text_width ? menu->img.width : text_width,
+        menu->img.height + 3 + menu->text.font_size);
+    w->menu = menu;
+}
+
+/**
+ * @brief 初始化显示面板控件,区域从图片一直到屏幕右边
+ *
+ * @param w 控件
+ * @param db 显示面板
+ */
+void ui_board_init(ui_widget_t *w, lcd_display_board_t *db)
+{
+    int text_bottom = 8 + db->text.font_size;
+
+    ui_widget_init(w, UI_BOARD, db->base_x, db->base_y, LCD_W - db->base_x,
+        db->img.height > text_bottom ? db->img.height : text_bottom);
+    w->db = db;
+}
+
+/**
+ * @brief 初始化趋势图控件
+ *
+ * @param w 控件
+ * @param chart 趋势图
+ */
+void ui_chart_init(ui_widget_t *w, lcd_chart_t *chart)
+{
+    ui_widget_init(w, UI_CHART, chart->base_x, chart->base_y, LCD_CHART_POINTS, chart->height);
+    w->chart = chart;
+}
+
+/**
+ * @brief 初始化控制台控件
+ *
+ * @param w 控件
+ * @param con 控制台,需要先调用lcd_console_init
+ */
+void ui_console_init(ui_widget_t *w, lcd_console_t *con)
+{
+    ui_widget_init(w, UI_CONSOLE, con->base_x, con->base_y, con->width, con->lines * con->font_size);
+    w->console = con;
+}
+
+/**
+ * @brief 把控件添加到父控件的子控件末尾,后添加的控件后绘制
+ *
+ * @param parent 父控件
+ * @param child 子控件
+ */
+void ui_add(ui_widget_t *parent, ui_widget_t *child)
+{
+    ui_widget_t **tail = &parent->child;
+
+    while (*tail != NULL) {
+        tail = &(*tail)->next;
+    }
+    child->parent = parent;
+    child->next = NULL;
+    *tail = child;
+}
+
+/**
+ * @brief 把控件及其子控件设为静态层,上电后只绘制一次
+ *
+ * 静态控件即使与其他控件的脏区域相交也不会重画,只有自身失效、
+ * 父容器失效或lcd_invalidate_all整屏刷新时才重画.
+ * 静态控件不能与动态控件重叠.
+ *
+ * @param w 控件
+ * @param is_static 是否为静态控件
+ */
+void ui_set_static(ui_widget_t *w, bool is_static)
+{
+    w->is_static = is_static;
+}
+
+/**
+ * @brief 标记控件整体需要重画,对根控件调用即整屏重画
+ *
+ * @param w 控件
+ */
+void ui_invalidate(ui_widget_t *w)
+{
+    w->dirty = true;
+    ui_invalidate_rect(w->x, w->y, w->width, w->height);
+}
+
+/**
+ * @brief 设置标签文字,只标记变化的字符格
+ *
+ * @param w 标签控件
+ * @param str 新的文字
+ */
+void ui_label_set_text(ui_widget_t *w, const char *str)
+{
+    char name[sizeof(w->text.name)];
+    int fs = w->text.font_size;
+    int width;
+
+    lcd_text_copy(name, str, sizeof(name));
+    if (strcmp(w->text.name, name) == 0) {
+        return;
+    }
+
+    strcpy(w->text.name, name);
+    w->dirty = true;
+    lcd_text_invalidate_diff(w->x, w->y, fs, w->drawn, w->text.name);
+
+    /* 文字变短时,区域保留到下次绘制时清除多出的部分 */
+    width = lcd_text_width(w->text.name, fs);
+    if (width > w->width) {
+        w->width = width;
+    }
+}
+
+/**
+ * @brief 设置标签颜色,颜色变化时整个标签重画
+ *
+ * @param w 标签控件
+ * @param fc 文字颜色
+ * @param bc 背景色
+ */
+void ui_label_set_color(ui_widget_t *w, int fc, int bc)
+{
+    if ((w->text.fc == fc) && (w->text.bc == bc)) {
+        return;
+    }
+
+    w->text.fc = fc;
+    w->text.bc = bc;
+    ui_invalidate(w);
+}
+
+/**
+ * @brief 设置图片,图片变化时才重画
+ *
+ * @param w 图片控件
+ * @param img 图片,尺寸应与原有图片一致
+ */
+void ui_image_set(ui_widget_t *w, const image_t *img)
+{
+    if ((w->img.img == img->img) && (w->img.palette == img->palette)) {
+        return;
+    }
+
+    w->img = *img;
+    ui_invalidate(w);
+}
+
+/* 控件下面的背景色,即最近一个设置了背景色的父容器的颜色 */
+static int ui_background(ui_widget_t *w, int def)
+{
+    for (w = w->parent; w != NULL; w = w->parent) {
+        if ((w->type == UI_CONTAINER) && (w->bc != UI_COLOR_NONE)) {
+            return w->bc;
+        }
+    }
+    return def;
+}
+
+/* 绘制控件树,不修改控件状态.条带渲染时每条条带都会调用一次 */
+static void ui_draw(ui_widget_t *w, bool force)
+{
+    ui_widget_t *child;
+    int text_width;
+    /* 条带缓冲区会整块覆盖屏幕上的原有内容,静态层和容器背景也要画进去 */
+    bool band = lcd_render_is_active();
+
+    /* 父容器失效时背景已经重画,子控件都要重画 */
+    force = force || w->dirty;
+
+    /* 静态层的内容还在屏幕上,只是被别的脏区域碰到时不用重发 */
+    if (w->is_static && !force && !band) {
+        return;
+    }
+
+    /* 与脏区域不相交的子树整体跳过 */
+    if (!lcd_frame_is_dirty(w->x, w->y, w->x + w->width, w->y + w->height)) {
+        return;
+    }
+
+    switch (w->type) {
+        case UI_CONTAINER:
+            /* 只有容器自身失效时才绘制背景,子控件的变化由子控件自己覆盖 */
+            if ((force || band) && (w->bc != UI_COLOR_NONE)) {
+                lcd_fill(w->x, w->y, w->x + w->width, w->y + w->height, w->bc);
+            }
+            break;
+        case UI_LABEL:
+            lcd_show_text(w->x, w->y, w->text.name, w->text.fc, w->text.bc, w->text.font_size, 0);
+            /* 文字变短后多出的部分恢复成父容器的背景 */
+            text_width = lcd_text_width(w->text.name, w->text.font_size);
+            if (text_width < w->width) {
+                lcd_fill(w->x + text_width, w->y, w->x + w->width, w->y + w->height,
+                    ui_background(w, w->text.bc));
+            }
+            break;
+        case UI_IMAGE:
+            lcd_image_draw(w->x, w->y, &w->img);
+            break;
+        case UI_MENU:
+            lcd_menu_draw(w->menu);
+            break;
+        case UI_BOARD:
+            lcd_db_draw(w->db);
+            break;
+        case UI_CHART:
+            lcd_chart_draw(w->chart, force);
+            break;
+        case UI_CONSOLE:
+            lcd_console_draw(w->console, force);
+            break;
+        default:
+            break;
+    }
+
+    for (child = w->child; child != NULL; child = child->next) {
+        ui_draw(child, force);
+    }
+}
+
+/* 条带之前直接绘制图片控件:控件区域包含了与它相交的全部脏矩形时,
+ * 图片不经过条带缓冲区,整块从flash下发,这些脏矩形不再参与条带绘制.
+ * 图片控件上不能叠放其他控件 */
+static void ui_draw_direct(ui_widget_t *w)
+{
+    ui_widget_t *child;
+
+    if (!lcd_frame_is_dirty(w->x, w->y, w->x + w->width, w->y + w->height)) {
+        return;
+    }
+
+    if ((w->type == UI_IMAGE) &&
+        lcd_frame_is_exclusive(w->x, w->y, w->x + w->width, w->y + w->height)) {
+        lcd_image_draw(w->x, w->y, &w->img);
+        lcd_frame_exclude(w->x, w->y, w->x + w->width, w->y + w->height);
+        return;
+    }
+
+    for (child = w->child; child != NULL; child = child->next) {
+        ui_draw_direct(child);
+    }
+}
+
+/* 所有条带画完后更新控件状态,跳过规则与ui_draw一致 */
+static void ui_commit(ui_widget_t *w, bool force)
+{
+    ui_widget_t *child;
+    int text_width;
+
+    force = force || w->dirty;
+    if (w->is_static && !force) {
+        return;
+    }
+    if (!lcd_frame_is_dirty(w->x, w->y, w->x + w->width, w->y + w->height)) {
+        w->dirty = false;
+        return;
+    }
+
+    switch (w->type) {
+        case UI_LABEL:
+            strcpy(w->drawn, w->text.name);
+            text_width = lcd_text_width(w->text.name, w->text.font_size);
+            if (text_width < w->width) {
+                w->width = text_width;
+            }
+            break;
+        case UI_BOARD:
+            lcd_db_commit(w->db);
+            break;
+        case UI_CHART:
+            lcd_chart_commit(w->chart);
+            break;
+        case UI_CONSOLE:
+            lcd_console_commit(w->console, force);
+            break;
+        default:
+            break;
+    }
+    w->dirty = false;
+
+    for (child = w->child; child != NULL; child = child->next) {
+        ui_commit(child, force);
+    }
+}
+
+/**
+ * @brief 设置条带之间的让出检查
+ *
+ * @param yield 返回true时ui_render挂起当前帧并返回,为NULL时每帧一次画完
+ */
+void ui_set_yield(bool (*yield)(void))
+{
+    ui_yield = yield;
+}
+
+/**
+ * @brief 绘制控件树中需要刷新的部分,没有失效区域时直接返回
+ *
+ * LCD_RENDER_BAND_LINES不为0时逐条带绘制,每条带内与脏区域相交的控件
+ * 先画到条带缓冲区再整条下发,根控件需要设置背景色.
+ * 只有图片控件自身失效的区域不走条带,由ui_draw_direct直接下发.
+ * 每画完一条带检查ui_set_yield设置的函数,需要让出时挂起帧并返回false,
+ * 控件状态和脏区域保持不变,下一次调用从挂起的条带继续.
+ *
+ * @param root 根控件
+ * @return 帧已画完或没有需要刷新的区域返回true,帧被挂起返回false
+ */
+bool ui_render(ui_widget_t *root)
+{
+    bool full;
+
+    if (!lcd_frame_begin()) {
+        return true;
+    }
+
+    full = lcd_frame_is_full();
+#if LCD_RENDER_BAND_LINES > 0
+    ui_draw_direct(root);
+    for (int y = lcd_frame_resume_line(), first = y; y < LCD_H; y += LCD_RENDER_BAND_LINES) {
+        /* 每次调用至少画一条带,事件不断到达时帧也能画完 */
+        if ((y != first) && (ui_yield != NULL) && ui_yield()) {
+            lcd_frame_suspend(y);
+            return false;
+        }
+        if (lcd_render_begin(y)) {
+            ui_draw(root, full);
+            lcd_render_end();
+        }
+    }
+#else
+    ui_draw(root, full);
+#endif
+    ui_commit(root, full);
+    lcd_frame_end();
+    return true;
+}
@@ -24,6 +24,7 @@
 #include "los_task.h"
 #include "ohos_init.h"
 #include "smart_home_event.h"
+#include "trace.h"
 
 #define MQTT_DEVICES_PWD "f7970363b1119b6a02f7cca20fce14a7b75e9d3f05c770629035442b0c7fb957"
 
@@ -36,9 +37,12 @@
   "$oc/devices/" USERNAME "/sys/commands/#" /// request_id={request_id}"
 #define RESPONSE_TOPIC                                                         \
   "$oc/devices/" USERNAME "/sys/commands/response" /// request_id={request_id}"
+#define TRACE_TOPIC "$oc/devices/" USERNAME "/user/trace"
 
 #define MAX_BUFFER_LENGTH 512
 #define MAX_STRING_LENGTH 64
+/* trace分片大小,加上主题和publish报文头(不超过8字节)后放得进sendBuf */
+#define TRACE_CHUNK_LENGTH (MAX_BUFFER_LENGTH - (sizeof(TRACE_TOPIC) - 1) - 8)
 
 static unsigned char sendBuf[MAX_BUFFER_LENGTH];
 static unsigned char readBuf[MAX_BUFFER_LENGTH];
@@ -57,9 +61,6 @@ static char response_topic[128] = RESPONSE_TOPIC;
 
 static unsigned int mqttConnectFlag = 0;
 
-// 添加MqttTest变量
-static char MqttTest[64] = {0};
-
 extern bool motor_state;
 extern bool light_state;
 extern bool auto_state;
@@ -128,9 +129,9 @@ void send_msg_to_mqtt(e_iot_data *iot_data) {
     }
     
     // 添加MqttTest数据上传
-    if (strlen(MqttTest) > 0) {
-      printf("准备上传MqttTest数据: %s\n", MqttTest);
-      cJSON_AddStringToObject(pro_obj, "MqttTest", MqttTest);
+    if (iot_data->mqtt_test != NULL && strlen(iot_data->mqtt_test) > 0) {
+      printf("准备上传MqttTest数据: %s\n", iot_data->mqtt_test);
+      cJSON_AddStringToObject(pro_obj, "MqttTest", iot_data->mqtt_test);
     } else {
       printf("MqttTest为空，不上传\n");
     }
@@ -162,14 +163,15 @@ void send_msg_to_mqtt(e_iot_data *iot_data) {
 * 函数名称: set_light_state
 * 说    明: 设置灯状态
 * 参    数: cJSON *root
-* 返 回 值: 无
+* 返 回 值: EVENT_OK 命令已入队,EVENT_ERR_FULL 事件队列满
 ***************************************************************/
-void set_light_state(cJSON *root) {
+int set_light_state(cJSON *root) {
   cJSON *para_obj = NULL;
   cJSON *status_obj = NULL;
   char *value = NULL;
 
   event_info_t event={0};
+  int ret = EVENT_OK;
   event.event=event_iot_cmd;
 
   para_obj = cJSON_GetObjectItem(root, "paras");
@@ -183,22 +185,24 @@ void set_light_state(cJSON *root) {
       event.data.iot_data = IOT_CMD_LIGHT_OFF;
       // light_state = false;
     }
-    smart_home_event_send(&event);
+    ret = smart_home_event_send(&event);
   }
+  return ret;
 }
 
 /***************************************************************
 * 函数名称: set_motor_state
 * 说    明: 设置电机状态
 * 参    数: cJSON *root
-* 返 回 值: 无
+* 返 回 值: EVENT_OK 命令已入队,EVENT_ERR_FULL 事件队列满
 ***************************************************************/
-void set_motor_state(cJSON *root) {
+int set_motor_state(cJSON *root) {
   cJSON *para_obj = NULL;
   cJSON *status_obj = NULL;
   char *value = NULL;
 
   event_info_t event={0};
+  int ret = EVENT_OK;
   event.event=event_iot_cmd;
 
   para_obj = cJSON_GetObjectItem(root, "paras");
@@ -212,41 +216,49 @@ void set_motor_state(cJSON *root) {
       // motor_state = false;
       event.data.iot_data = IOT_CMD_MOTOR_OFF;
     }
-    smart_home_event_send(&event);
+    ret = smart_home_event_send(&event);
   }
+  return ret;
 }
 
 /***************************************************************
-* 函数名称: set_light_state
+* 函数名称: set_auto_state
 * 说    明: 设置自动模式状态
 * 参    数: cJSON *root
-* 返 回 值: 无
+* 返 回 值: EVENT_OK 命令已入队,EVENT_ERR_FULL 事件队列满
 ***************************************************************/
-void set_auto_state(cJSON *root) {
+int set_auto_state(cJSON *root) {
   cJSON *para_obj = NULL;
   cJSON *status_obj = NULL;
   char *value = NULL;
 
+  event_info_t event={0};
+  int ret = EVENT_OK;
+  event.event=event_iot_cmd;
+
   para_obj = cJSON_GetObjectItem(root, "paras");
   status_obj = cJSON_GetObjectItem(para_obj, "onoff");
   if (status_obj != NULL) {
     value = cJSON_GetStringValue(status_obj);
     if (!strcmp(value, "ON")) {
-      // auto_state = true;
+      event.data.iot_data = IOT_CMD_AUTO_ON;
     } else if (!strcmp(value, "OFF")) {
-      // auto_state = false;
+      event.data.iot_data = IOT_CMD_AUTO_OFF;
     }
+    ret = smart_home_event_send(&event);
   }
+  return ret;
 }
 
 /***************************************************************
 * 函数名称: set_light_state_new
 * 说    明: 设置灯状态（新格式）
 * 参    数: char *value - 灯光状态值
-* 返 回 值: 无
+* 返 回 值: EVENT_OK 命令已入队,EVENT_ERR_FULL 事件队列满
 ***************************************************************/
-void set_light_state_new(char *value) {
+int set_light_state_new(char *value) {
   event_info_t event={0};
+  int ret = EVENT_OK;
   event.event=event_iot_cmd;
 
   if (value != NULL) {
@@ -255,49 +267,47 @@ void set_light_state_new(char *value) {
     } else if (!strcmp(value, "OFF")) {
       event.data.iot_data = IOT_CMD_LIGHT_OFF;
     }
-    smart_home_event_send(&event);
+    ret = smart_home_event_send(&event);
   }
+  return ret;
 }
 
 /***************************************************************
 * 函数名称: handle_mqtt_control
-* 说    明: 处理mqtt_control命令
+* 说    明: 处理mqtt_control命令,参数通过事件交给smart_home_thread
 * 参    数: char *value - 控制参数值
-* 返 回 值: 无
+* 返 回 值: EVENT_OK 命令已入队,EVENT_ERR_FULL 事件队列或块池满
 ***************************************************************/
-void handle_mqtt_control(char *value) {
-  if (value != NULL) {
-    printf("接收到mqtt_control命令，参数: %s\n", value);
-    
-    // 打印更新前的MqttTest值
-    printf("更新前MqttTest值: %s\n", MqttTest);
-    
-    // 将接收到的数据赋值给MqttTest
-    strncpy(MqttTest, value, sizeof(MqttTest) - 1);
-    MqttTest[sizeof(MqttTest) - 1] = '\0';  // 确保字符串结束
-    
-    // 打印更新后的MqttTest值
-    printf("更新后MqttTest值: %s\n", MqttTest);
-    
-    // 这里可以根据不同的参数值执行不同的操作
-    if (strncmp(value, "A", 1) == 0) {
-      printf("执行A类操作: %s\n", value);
-      // 可以在这里添加A1, A2, A3的具体处理逻辑
-    } else if (strncmp(value, "B", 1) == 0) {
-      printf("执行B类操作: %s\n", value);
-      // 可以在这里添加B1, B2, B3的具体处理逻辑
-    }
+int handle_mqtt_control(char *value) {
+  event_info_t event = {0};
+  char text[EVENT_PAYLOAD_SIZE];
+
+  if (value == NULL) {
+    return EVENT_OK;
+  }
+  printf("接收到mqtt_control命令，参数: %s\n", value);
+
+  strncpy(text, value, sizeof(text) - 1);
+  text[sizeof(text) - 1] = '\0';  // 确保字符串结束
+
+  event.event = event_mqtt_control;
+  event.payload = event_payload_alloc_text(text);
+  if (event.payload == NULL) {
+    printf("事件块池已满\n");
+    return EVENT_ERR_FULL;
   }
+  return smart_home_event_send(&event);
 }
 
 /***************************************************************
 * 函数名称: set_motor_state_new
 * 说    明: 设置电机状态（新格式）
 * 参    数: char *value - 电机状态值
-* 返 回 值: 无
+* 返 回 值: EVENT_OK 命令已入队,EVENT_ERR_FULL 事件队列满
 ***************************************************************/
-void set_motor_state_new(char *value) {
+int set_motor_state_new(char *value) {
   event_info_t event={0};
+  int ret = EVENT_OK;
   event.event=event_iot_cmd;
 
   if (value != NULL) {
@@ -306,11 +316,78 @@ void set_motor_state_new(char *value) {
     } else if (!strcmp(value, "OFF")) {
       event.data.iot_data = IOT_CMD_MOTOR_OFF;
     }
-    smart_home_event_send(&event);
+    ret = smart_home_event_send(&event);
   }
+  return ret;
 }
 
 
+/***************************************************************
+* 函数名称: mqtt_publish_trace
+* 说    明: 把事件跟踪记录分成多条消息发布到TRACE_TOPIC,
+*           保存消息内容后用tools/trace_decode.py统计延时.
+*           每条消息不超过TRACE_CHUNK_LENGTH,保证能在sendBuf里序列化,
+*           发布失败只能是网络断开
+* 参    数: 无
+* 返 回 值: 无
+***************************************************************/
+static void mqtt_publish_trace(void) {
+  int rc;
+  int len;
+  MQTTMessage message;
+  char payload[TRACE_CHUNK_LENGTH];
+  trace_cursor_t cursor;
+
+  message.qos = 0;
+  message.retained = 0;
+  message.payload = payload;
+
+  trace_dump_begin(&cursor);
+  while ((len = trace_dump_read(&cursor, payload, sizeof(payload))) > 0) {
+    message.payloadlen = len;
+    if ((rc = MQTTPublish(&client, TRACE_TOPIC, &message)) != 0) {
+      printf("trace发布失败，错误码: %d\n", rc);
+      mqttConnectFlag = 0;
+      return;
+    }
+  }
+}
+
+/***************************************************************
+* 函数名称: mqtt_send_command_response
+* 说    明: 回应云端命令
+* 参    数: char *rsptopic 回应的topic
+*           int result 命令的处理结果,EVENT_OK为成功
+* 返 回 值: 无
+***************************************************************/
+static void mqtt_send_command_response(char *rsptopic, int result) {
+  int rc;
+  MQTTMessage message;
+  char payload[MAX_BUFFER_LENGTH];
+
+  // response message
+  message.qos = 0;
+  message.retained = 0;
+  message.payload = payload;
+  sprintf(payload, "{ \\
+      \"result_code\": %d, \\
+      \"response_name\": \"COMMAND_RESPONSE\", \\
+      \"paras\": { \\
+          \"result\": \"%s\", \\
+          \"error\": %d \\
+      } \\
+      }", (result == EVENT_OK) ? 0 : 1, (result == EVENT_OK) ? "success" : "busy", result);
+  message.payloadlen = strlen(payload);
+
+  // publish the msg to response topic
+  if ((rc = MQTTPublish(&client, rsptopic, &message)) != 0) {
+    printf("MQTT响应发布失败，错误码: %d\n", rc);
+    mqttConnectFlag = 0;
+  } else {
+    printf("MQTT响应发布成功\n");
+  }
+}
+
 /***************************************************************
 * 函数名称: mqtt_message_arrived
 * 说    明: 接收mqtt数据
@@ -318,19 +395,16 @@ void set_motor_state_new(char *value) {
 * 返 回 值: 无
 ***************************************************************/
 void mqtt_message_arrived(MessageData *data) {
-  int rc;
   cJSON *root = NULL;
   char *request_id_idx = NULL;
   char request_id[40] = {0};
-  MQTTMessage message;
-  char payload[MAX_BUFFER_LENGTH];
   char rsptopic[128] = {0};
+  int result = EVENT_OK;
 
   printf("=== MQTT消息接收调试 ===\n");
   printf("Topic: %.*s\n", data->topicName->lenstring.len, data->topicName->lenstring.data);
   printf("Payload长度: %d\n", data->message->payloadlen);
   printf("Payload内容: %.*s\n", data->message->payloadlen, (char*)data->message->payload);
-  printf("当前MqttTest值: %s\n", MqttTest);
   printf("========================\n");
 
   // get request id
@@ -342,27 +416,6 @@ void mqtt_message_arrived(MessageData *data) {
     // create response topic
     sprintf(rsptopic, "%s/request_id=%s", response_topic, request_id);
     printf("响应Topic: %s\n", rsptopic);
-
-    // response message
-    message.qos = 0;
-    message.retained = 0;
-    message.payload = payload;
-    sprintf(payload, "{ \\
-      \"result_code\": 0, \\
-      \"response_name\": \"COMMAND_RESPONSE\", \\
-      \"paras\": { \\
-          \"result\": \"success\" \\
-      } \\
-      }");
-    message.payloadlen = strlen(payload);
-
-    // publish the msg to response topic
-    if ((rc = MQTTPublish(&client, rsptopic, &message)) != 0) {
-      printf("MQTT响应发布失败，错误码: %d\n", rc);
-      mqttConnectFlag = 0;
-    } else {
-      printf("MQTT响应发布成功\n");
-    }
   } else {
     printf("未找到request_id，可能是属性上报或其他类型消息\n");
   }
@@ -388,13 +441,13 @@ void mqtt_message_arrived(MessageData *data) {
       
       if (!strcmp(cmd_name_str, "light_control")) {
         printf("处理灯光控制命令\n");
-        set_light_state(root);
+        result = set_light_state(root);
       } else if (!strcmp(cmd_name_str, "motor_control")) {
         printf("处理电机控制命令\n");
-        set_motor_state(root);
+        result = set_motor_state(root);
       } else if (!strcmp(cmd_name_str, "auto_control")) {
         printf("处理自动控制命令\n");
-        set_auto_state(root);
+        result = set_auto_state(root);
       } else if (!strcmp(cmd_name_str, "mqtt_control")) {
         printf("处理mqtt_control命令\n");
         // 解析mqtt_control的参数
@@ -405,10 +458,7 @@ void mqtt_message_arrived(MessageData *data) {
             char *mqtt_control_value = cJSON_GetStringValue(value_obj);
             if (mqtt_control_value != NULL) {
               printf("mqtt_control参数: %s\n", mqtt_control_value);
-              printf("调用handle_mqtt_control函数...\n");
-              handle_mqtt_control(mqtt_control_value);
-              printf("handle_mqtt_control函数调用完成\n");
-              printf("处理后MqttTest值: %s\n", MqttTest);
+              result = handle_mqtt_control(mqtt_control_value);
             } else {
               printf("mqtt_control的value值为空\n");
             }
@@ -418,6 +468,9 @@ void mqtt_message_arrived(MessageData *data) {
         } else {
           printf("未找到mqtt_control的paras对象\n");
         }
+      } else if (!strcmp(cmd_name_str, "trace_dump")) {
+        printf("处理trace_dump命令\n");
+        mqtt_publish_trace();
       } else if (!strcmp(cmd_name_str, "beep_control")) {
         printf("处理蜂鸣器控制命令\n");
         // 解析beep_control的参数
@@ -455,8 +508,13 @@ void mqtt_message_arrived(MessageData *data) {
     printf("JSON解析失败！\n");
   }
 
-  printf("=== MQTT消息处理完成 ===\n\n");
   cJSON_Delete(root);
+
+  /* 命令已经分发,回应中带上结果,事件队列满时云端可以重发 */
+  if (rsptopic[0] != '\0') {
+    mqtt_send_command_response(rsptopic, result);
+  }
+  printf("=== MQTT消息处理完成 ===\n\n");
 }
 
 /***************************************************************
@@ -546,14 +604,3 @@ begin:
 * 返 回 值: unsigned int 状态
 ***************************************************************/
 unsigned int mqtt_is_connected() { return mqttConnectFlag; }
-
-/***************************************************************
-* 函数名称: get_mqtt_test_value
-* 说    明: 获取MqttTest变量的值
-* 参    数: 无
-* 返 回 值: MqttTest变量的值
-***************************************************************/
-const char* get_mqtt_test_value(void)
-{
-    return MqttTest;
-}
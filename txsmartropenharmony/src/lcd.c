@@ -12,11 +12,20 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <stdio.h>
+#include <string.h>
+
 #include "iot_errno.h"
 #include "iot_gpio.h"
 #include "iot_spi.h"
+#include "los_task.h"
+#include "los_queue.h"
+#include "los_sem.h"
+#include "los_tick.h"
 #include "lcd.h"
 #include "lcd_font.h"
+#include "lcd_font_cjk.h"
+#include "trace.h"
 
 /* 是否启用SPI通信
  * 0 => 禁用SPI，使用gpio模拟SPI通信
@@ -25,6 +34,31 @@
 #define LCD_ENABLE_SPI      1
 #define LCD_SPI_BUS         ESPI0_M1
 
+/* 是否启用异步刷新任务
+ * 0 => 绘图线程直接下发缓冲区
+ * 1 => 绘图线程只负责填充缓冲区，由刷新任务下发
+ * IoTSpiWrite是同步接口，下发期间一直占用CPU，单核上刷新任务不能让下发和
+ * 绘图重叠，只多出任务切换，默认关闭。SPI改为DMA或阻塞等待后再打开
+ */
+#define LCD_ENABLE_ASYNC_FLUSH  0
+#define LCD_FLUSH_TASK_STACK    2048
+/* 刷新任务优先级高于smart_home_thread(24)，SPI等待完成时绘图线程继续填充 */
+#define LCD_FLUSH_TASK_PRIO     23
+
+#if LCD_ENABLE_ASYNC_FLUSH
+#define LCD_BAND_NUM            2
+#else
+#define LCD_BAND_NUM            1
+#endif
+/* 每个缓冲区最多记录的命令个数 */
+#define LCD_BAND_CMD_MAX        24
+/* 每个缓冲区最多挂接的外部数据段个数 */
+#define LCD_BAND_EXT_MAX        8
+/* 图片数据连续超过该字节数时直接把flash地址交给SPI，不拷贝到缓冲区，
+ * 太短的数据段多一次HAL调用反而比拷贝慢
+ */
+#define LCD_ZERO_COPY_MIN       512
+
 #define LCD_PIN_CS          GPIO0_PC0
 #define LCD_PIN_CLK         GPIO0_PC1
 #define LCD_PIN_MOSI        GPIO0_PC2
@@ -60,465 +94,1339 @@ IoT_SPI_InitTypeDef iot_spi = {
 
 /////////////////////////////////////////////////////////////////
 
-static void lcd_write_bus(uint8_t dat)
+/* 发送缓冲区: 数据字节和命令先攒到缓冲区里，满了或者一帧结束时整块下发
+ * 命令只记录在数据中的位置，下发时在对应位置切换DC
+ * 外部数据段(flash中的图片)同样只记录位置，下发时直接把原地址交给SPI，
+ * ext_cmd为该数据段之前的命令个数，用于和同一位置的命令排序
+ */
+typedef struct lcd_band
+{
+    uint8_t buf[LCD_BAND_BYTES];
+    uint32_t len;
+    uint32_t cmd_pos[LCD_BAND_CMD_MAX];
+    uint8_t cmd[LCD_BAND_CMD_MAX];
+    uint8_t cmd_num;
+    const uint8_t *ext_buf[LCD_BAND_EXT_MAX];
+    uint32_t ext_len[LCD_BAND_EXT_MAX];
+    uint32_t ext_pos[LCD_BAND_EXT_MAX];
+    uint8_t ext_cmd[LCD_BAND_EXT_MAX];
+    uint8_t ext_num;
+    bool frame_end;             /* 一帧的最后一个缓冲区，下发后记录跟踪 */
+} lcd_band_t;
+
+static lcd_band_t g_bands[LCD_BAND_NUM];
+static uint8_t g_band_index = 0;
+static lcd_band_t *g_band = &g_bands[0];
+
+#if LCD_ENABLE_ASYNC_FLUSH
+static unsigned int g_flush_queue;
+static unsigned int g_flush_free_sem;
+static bool g_flush_task_ready = false;
+#endif
+
+/* 像素格式，RGB444时两个像素打包成3个字节，奇数个像素时
+ * 多出的半个字节留到下一个像素，窗口结束(下一条命令)时补齐
+ */
+static lcd_pixel_format_t g_format = LCD_FORMAT_RGB565;
+static bool g_pack_carry = false;
+static uint8_t g_pack_nibble = 0;
+
+/* 总线统计 */
+static lcd_stats_t g_stats = {0};
+static uint32_t g_frame_calls_start = 0;
+static uint32_t g_frame_bytes_start = 0;
+
+static void lcd_bus_transfer(uint8_t *buf, uint32_t len)
 {
 #if LCD_ENABLE_SPI
-    IoTSpiWrite(LCD_SPI_BUS, &dat, 1);
+    IoTSpiWrite(LCD_SPI_BUS, buf, len);
 #else
-    uint8_t i;
+    uint8_t i, dat;
 	
     LCD_CS_Clr();
-    for (i=0; i<8; i++)
+    for (uint32_t k = 0; k < len; k++)
     {
-        LCD_CLK_Clr();
-        if (dat & 0x80)
+        dat = buf[k];
+        for (i=0; i<8; i++)
         {
-            LCD_MOSI_Set();
-        }
-        else
-        {
-            LCD_MOSI_Clr();
+            LCD_CLK_Clr();
+            if (dat & 0x80)
+            {
+                LCD_MOSI_Set();
+            }
+            else
+            {
+                LCD_MOSI_Clr();
+            }
+            LCD_CLK_Set();
+            dat<<=1;
         }
-        LCD_CLK_Set();
-        dat<<=1;
-    }	
+    }
     LCD_CS_Set();
 #endif
 }
 
-static void lcd_wr_data8(uint8_t dat)
+/***************************************************************
+ * 函数名称: lcd_band_walk
+ * 说    明: 按顺序遍历缓冲区中的数据、命令和外部数据段
+ * 参    数:
+ *       @band：缓冲区
+ *       @send：true为下发，false只统计
+ * 返 回 值: 需要的HAL调用次数
+ ***************************************************************/
+static uint32_t lcd_band_walk(lcd_band_t *band, bool send)
 {
-    lcd_write_bus(dat);
+    uint32_t pos = 0;
+    uint32_t calls = 0;
+    uint32_t next;
+    uint8_t c = 0;
+    uint8_t e = 0;
+    bool is_ext;
+
+    while ((c < band->cmd_num) || (e < band->ext_num))
+    {
+        /* 同一位置上，数据段排在记录它之后的命令前面 */
+        is_ext = (e < band->ext_num) && ((c >= band->cmd_num) || (band->ext_cmd[e] <= c));
+        next = is_ext ? band->ext_pos[e] : band->cmd_pos[c];
+        if (next > pos)
+        {
+            if (send)
+            {
+                lcd_bus_transfer(&band->buf[pos], next - pos);
+            }
+            calls++;
+            pos = next;
+        }
+        if (is_ext)
+        {
+            if (send)
+            {
+                lcd_bus_transfer((uint8_t *)band->ext_buf[e], band->ext_len[e]);
+            }
+            e++;
+        }
+        else
+        {
+            if (send)
+            {
+                LCD_DC_Clr();
+                lcd_bus_transfer(&band->cmd[c], 1);
+                LCD_DC_Set();
+            }
+            c++;
+        }
+        calls++;
+    }
+    if (band->len > pos)
+    {
+        if (send)
+        {
+            lcd_bus_transfer(&band->buf[pos], band->len - pos);
+        }
+        calls++;
+    }
+    return calls;
 }
 
-static void lcd_wr_data(uint16_t dat)
+/* 下发一个缓冲区，在记录的位置插入命令和外部数据段 */
+static void lcd_band_transfer(lcd_band_t *band)
 {
-    lcd_write_bus(dat >> 8);
-    lcd_write_bus(dat);
-}
+    lcd_band_walk(band, true);
 
-static void lcd_wr_reg(uint8_t dat)
-{
-    LCD_DC_Clr();
-    lcd_write_bus(dat);
-    LCD_DC_Set();
+    band->len = 0;
+    band->cmd_num = 0;
+    band->ext_num = 0;
+    if (band->frame_end)
+    {
+        /* 之前提交的缓冲区按顺序下发，到这里整帧已经在屏幕上 */
+        band->frame_end = false;
+        trace_record(0, 0, TRACE_PHASE_FLUSH);
+    }
 }
 
-static void lcd_address_set(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+/* 统计一个缓冲区下发时需要的HAL调用次数和字节数 */
+static void lcd_band_account(lcd_band_t *band)
 {
-    /* 列地址设置 */
-    lcd_wr_reg(0x2a);
-    lcd_wr_data(x1);
-    lcd_wr_data(x2);
-    /* 行地址设置 */
-    lcd_wr_reg(0x2b);
-    lcd_wr_data(y1);
-    lcd_wr_data(y2);
-    /* 储存器写 */
-    lcd_wr_reg(0x2c);
-}
+    uint32_t bytes = band->len + band->cmd_num;
 
-static uint32_t mypow(uint8_t m, uint8_t n)
-{
-    uint32_t result = 1;
-    
-    while (n--)
+    for (uint8_t i = 0; i < band->ext_num; i++)
     {
-        result *= m;
+        bytes += band->ext_len[i];
     }
-    
-    return result;
-}
 
+#if LCD_ENABLE_SPI
+    g_stats.total_hal_calls += lcd_band_walk(band, false);
+#else
+    g_stats.total_hal_calls += bytes;
+#endif
+    g_stats.total_bytes += bytes;
+}
 
+#if LCD_ENABLE_ASYNC_FLUSH
 /***************************************************************
- * 函数名称: lcd_show_chinese_12x12
- * 说    明: 显示单个12x12汉字
- * 参    数:
- *       @x：指定汉字串的起始位置X坐标
- *       @y：指定汉字串的起始位置X坐标
- *       @s：指定汉字串（该汉字串为ascii）
- *       @fc: 字的颜色
- *       @bc: 字的背景色
- *       @sizey: 字号，可选：12
- *       @mode: 0为非叠加模式；1为叠加模式
+ * 函数名称: lcd_flush_thread
+ * 说    明: 刷新任务，依次下发绘图线程提交的缓冲区
+ * 参    数: 无
  * 返 回 值: 无
  ***************************************************************/
-static void lcd_show_chinese_12x12(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
+static void lcd_flush_thread(void *arg)
 {
-    uint8_t i, j, m=0;
-    uint16_t k;
-    uint16_t HZnum;//汉字数目
-    uint16_t TypefaceNum;//一个字符所占字节大小
-    uint16_t x0 = x;
-    
-    TypefaceNum = (sizey/8+((sizey%8)?1:0)) * sizey;
-
-    /* 统计汉字数目 */
-    HZnum = sizeof(tfont12) / sizeof(typFNT_GB12);
+    uint32_t index;
+    uint32_t size;
 
-    for (k = 0; k < HZnum; k++) 
+    while (1)
     {
-        if ((tfont12[k].Index[0] == *(s)) && (tfont12[k].Index[1] == *(s+1))
-            && (tfont12[k].Index[2] == *(s+2)))
+        size = sizeof(index);
+        if (LOS_QueueReadCopy(g_flush_queue, &index, &size, LOS_WAIT_FOREVER) != LOS_OK)
         {
-            lcd_address_set(x, y, x+sizey-1, y+sizey-1);
-            for (i = 0; i < TypefaceNum; i++)
-            {
-                for (j = 0; j < 8; j++)
-                {
-                    if (!mode)
-                    {/* 非叠加方式 */
-                        if (tfont12[k].Msk[i] & (0x01<<j))
-                        {
-                            lcd_wr_data(fc);
-                        }
-                        else
-                        {
-                            lcd_wr_data(bc);
-                        }
-                        
-                        m++;
-                        if ((m % sizey) == 0)
-                        {
-                            m = 0;
-                            break;
-                        }
-                    }
-                    else
-                    {/* 叠加方式 */
-                        if (tfont12[k].Msk[i] & (0x01<<j))
-                        {
-                            /* 画一个点 */
-                            lcd_draw_point(x,y,fc);
-                        }
-                        
-                        x++;
-                        if ((x - x0) == sizey)
-                        {
-                            x = x0;
-                            y++;
-                            break;
-                        }
-                    }
-                }
-            }
-
-            break; //查找到对应点阵字库立即退出，防止多个汉字重复取模带来影响
+            continue;
         }
+
+        lcd_band_transfer(&g_bands[index]);
+        LOS_SemPost(g_flush_free_sem);
     }
-} 
+}
 
-/***************************************************************
- * 函数名称: lcd_show_chinese_16x16
- * 说    明: 显示单个16x16汉字
- * 参    数:
- *       @x：指定汉字串的起始位置X坐标
- *       @y：指定汉字串的起始位置X坐标
- *       @s：指定汉字串（该汉字串为ascii）
- *       @fc: 字的颜色
- *       @bc: 字的背景色
- *       @sizey: 字号，可选：16
- *       @mode: 0为非叠加模式；1为叠加模式
- * 返 回 值: 无
- ***************************************************************/
-static void lcd_show_chinese_16x16(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
+static unsigned int lcd_flush_task_init(void)
 {
-    uint8_t i, j, m = 0;
-    uint16_t k;
-    uint16_t HZnum;//汉字数目
-    uint16_t TypefaceNum;//一个字符所占字节大小
-    uint16_t x0 = x;
-    
-    TypefaceNum = (sizey/8 + ((sizey%8)?1:0)) * sizey;
-    /* 统计汉字数目 */
-    HZnum=sizeof(tfont16) / sizeof(typFNT_GB16);
-    
-    for (k = 0; k < HZnum; k++) 
+    unsigned int thread_id;
+    TSK_INIT_PARAM_S task = {0};
+    unsigned int ret = LOS_OK;
+
+    ret = LOS_QueueCreate("lcdFlushQ", LCD_BAND_NUM, &g_flush_queue, 0, sizeof(uint32_t));
+    if (ret != LOS_OK)
     {
-        if ((tfont16[k].Index[0] == *(s)) && (tfont16[k].Index[1] == *(s+1))
-            && (tfont16[k].Index[2] == *(s+2)))
-        {
-            lcd_address_set(x, y, x+sizey-1, y+sizey-1);
-            for (i = 0; i < TypefaceNum; i++)
-            {
-                for (j = 0; j < 8; j++)
-                {
-                    if (!mode)
-                    {/* 非叠加方式 */
-                        if (tfont16[k].Msk[i] & (0x01 << j))
-                        {
-                            lcd_wr_data(fc);
-                        }
-                        else
-                        {
-                            lcd_wr_data(bc);
-                        }
-                        
-                        m++;
-                        if (m%sizey == 0)
-                        {
-                            m = 0;
-                            break;
-                        }
-                    }
-                    else
-                    {/* 叠加方式 */
-                        if (tfont16[k].Msk[i] & (0x01<<j))
-                        {
-                            /* 画一个点 */
-                            lcd_draw_point(x,y,fc);
-                        }
-                        
-                        x++;
-                        if ((x - x0) == sizey)
-                        {
-                            x = x0;
-                            y++;
-                            break;
-                        }
-                    }
-                }
-            }
+        printf("Falied to create Message Queue ret:0x%x\n", ret);
+        return ret;
+    }
 
-            break; //查找到对应点阵字库立即退出，防止多个汉字重复取模带来影响
-        }
+    /* 当前缓冲区归绘图线程所有，其余缓冲区空闲 */
+    ret = LOS_SemCreate(LCD_BAND_NUM - 1, &g_flush_free_sem);
+    if (ret != LOS_OK)
+    {
+        printf("Falied to create Semaphore ret:0x%x\n", ret);
+        return ret;
     }
-} 
 
+    task.pfnTaskEntry = (TSK_ENTRY_FUNC)lcd_flush_thread;
+    task.uwStackSize = LCD_FLUSH_TASK_STACK;
+    task.pcName = "lcd flush thread";
+    task.usTaskPrio = LCD_FLUSH_TASK_PRIO;
+    ret = LOS_TaskCreate(&thread_id, &task);
+    if (ret != LOS_OK)
+    {
+        printf("Falied to create task ret:0x%x\n", ret);
+        return ret;
+    }
 
-/***************************************************************
- * 函数名称: lcd_show_chinese_24x24
- * 说    明: 显示单个24x24汉字
- * 参    数:
- *       @x：指定汉字串的起始位置X坐标
- *       @y：指定汉字串的起始位置X坐标
- *       @s：指定汉字串（该汉字串为ascii）
- *       @fc: 字的颜色
- *       @bc: 字的背景色
- *       @sizey: 字号，可选：24
- *       @mode: 0为非叠加模式；1为叠加模式
- * 返 回 值: 无
- ***************************************************************/
-static void lcd_show_chinese_24x24(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
+    g_flush_task_ready = true;
+    return LOS_OK;
+}
+#endif
+
+/* 提交当前缓冲区，异步模式下切换到下一个空闲缓冲区 */
+static void lcd_bus_flush(void)
 {
-    uint8_t i,j,m = 0;
-    uint16_t k;
-    uint16_t HZnum;//汉字数目
-    uint16_t TypefaceNum;//一个字符所占字节大小
-    uint16_t x0 = x;
-    
-    TypefaceNum = (sizey/8 + ((sizey%8)?1:0)) * sizey;
-    /* 统计汉字数目 */
-    HZnum = sizeof(tfont24) / sizeof(typFNT_GB24);
-    
-    for (k = 0; k < HZnum; k++) 
+    if ((g_band->len == 0) && (g_band->cmd_num == 0) && (g_band->ext_num == 0) && !g_band->frame_end)
     {
-        if ((tfont24[k].Index[0] == *(s)) && (tfont24[k].Index[1] == *(s+1))
-            && (tfont24[k].Index[2] == *(s+2)))
-        {
-            lcd_address_set(x, y, x+sizey-1, y+sizey-1);
-            for (i = 0; i < TypefaceNum; i++)
-            {
-                for (j = 0; j < 8; j++)
-                {
-                    if (!mode)
-                    {/* 非叠加方式 */
-                        if (tfont24[k].Msk[i] & (0x01<<j))
-                        {
-                            lcd_wr_data(fc);
-                        }
-                        else
-                        {
-                            lcd_wr_data(bc);
-                        }
-                        
-                        m++;
-                        if (m%sizey == 0)
-                        {
-                            m = 0;
-                            break;
-                        }
-                    }
-                    else
-                    {/* 叠加方式 */
-                        if (tfont24[k].Msk[i] & (0x01 << j))
-                        {
-                            /* 画一个点 */
-                            lcd_draw_point(x, y, fc);
-                        }
-                        
-                        x++;
-                        if ((x - x0) == sizey)
-                        {
-                            x = x0;
-                            y++;
-                            break;
-                        }
-                    }
-                }
-            }
+        return;
+    }
 
-            break; //查找到对应点阵字库立即退出，防止多个汉字重复取模带来影响
-        }
+    lcd_band_account(g_band);
+#if LCD_ENABLE_ASYNC_FLUSH
+    if (g_flush_task_ready)
+    {
+        uint32_t index = g_band_index;
+
+        LOS_QueueWriteCopy(g_flush_queue, &index, sizeof(index), LOS_WAIT_FOREVER);
+        /* 等待刷新任务释放出一个缓冲区，缓冲区按提交顺序释放 */
+        LOS_SemPend(g_flush_free_sem, LOS_WAIT_FOREVER);
+        g_band_index = (g_band_index + 1) % LCD_BAND_NUM;
+        g_band = &g_bands[g_band_index];
+        return;
     }
-} 
+#endif
+    lcd_band_transfer(g_band);
+}
 
+static void lcd_write_bus(uint8_t dat)
+{
+    if (g_band->len >= sizeof(g_band->buf))
+    {
+        lcd_bus_flush();
+    }
+    g_band->buf[g_band->len++] = dat;
+}
 
-/***************************************************************
- * 函数名称: lcd_show_chinese_32x32
- * 说    明: 显示单个32x32汉字
- * 参    数:
- *       @x：指定汉字串的起始位置X坐标
- *       @y：指定汉字串的起始位置X坐标
- *       @s：指定汉字串（该汉字串为ascii）
- *       @fc: 字的颜色
- *       @bc: 字的背景色
- *       @sizey: 字号，可选：32
- *       @mode: 0为非叠加模式；1为叠加模式
- * 返 回 值: 无
- ***************************************************************/
-static void lcd_show_chinese_32x32(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
+/* 原样拷贝字节到发送缓冲区 */
+static void lcd_bus_copy(const uint8_t *buf, uint32_t len)
 {
-    uint8_t i,j,m = 0;
-    uint16_t k;
-    uint16_t HZnum;//汉字数目
-    uint16_t TypefaceNum;//一个字符所占字节大小
-    uint16_t x0 = x;
-    
-    TypefaceNum = (sizey/8 + ((sizey%8)?1:0)) * sizey;
-    /* 统计汉字数目 */
-    HZnum = sizeof(tfont32) / sizeof(typFNT_GB32);
-    
-    for (k = 0; k < HZnum; k++)
+    uint32_t num;
+
+    while (len > 0)
     {
-        if ((tfont32[k].Index[0] == *(s)) && (tfont32[k].Index[1] == *(s+1))
-            && (tfont32[k].Index[2] == *(s+2)))
+        if (g_band->len >= sizeof(g_band->buf))
         {
-            lcd_address_set(x, y, x+sizey-1, y+sizey-1);
-            for (i = 0; i < TypefaceNum; i++)
-            {
-                for (j = 0; j < 8; j++)
-                {
-                    if (!mode)
-                    {/* 非叠加方式 */
-                        if (tfont32[k].Msk[i] & (0x01 << j))
-                        {
-                            lcd_wr_data(fc);
-                        }
-                        else
-                        {
-                            lcd_wr_data(bc);
-                        }
-                        
-                        m++;
-                        if (m%sizey == 0)
-                        {
-                            m = 0;
-                            break;
-                        }
-                    }
-                    else
-                    {/* 叠加方式 */
-                        if (tfont32[k].Msk[i] & (0x01 << j))
-                        {
-                            lcd_draw_point(x, y, fc);//画一个点
-                        }
-                        
-                        x++;
-                        if ((x-x0) == sizey)
-                        {
-                            x = x0;
-                            y++;
-                            break;
-                        }
-                    }
-                }
-            }
-
-            break; //查找到对应点阵字库立即退出，防止多个汉字重复取模带来影响
+            lcd_bus_flush();
+        }
+        num = sizeof(g_band->buf) - g_band->len;
+        if (num > len)
+        {
+            num = len;
         }
+        memcpy(&g_band->buf[g_band->len], buf, num);
+        g_band->len += num;
+        buf += num;
+        len -= num;
     }
 }
 
-
-/////////////////////////////////////////////////////////////////
-
-/***************************************************************
- * 函数名称: lcd_init
- * 说    明: Lcd初始化
- * 参    数: 无
- * 返 回 值: 返回0为成功，反之为失败
- ***************************************************************/
-unsigned int lcd_init()
+/* 按顺序下发一段常驻内存(flash)的数据，足够长时直接挂到缓冲区上，
+ * 下发完成前数据不能被修改
+ */
+static void lcd_bus_attach(const uint8_t *data, uint32_t len)
 {
-    unsigned int ret = 0;
+    uint8_t i;
 
-#if LCD_ENABLE_SPI
-    ret = IoTSpiInit(LCD_SPI_BUS, &iot_spi);
-    if (ret != IOT_SUCCESS)
+    if (len < LCD_ZERO_COPY_MIN)
     {
-        printf("%s, %s, %d: Spi init failed!\n",
-         __FILE__, __func__, __LINE__);
-        return IOT_FAILURE;
+        lcd_bus_copy(data, len);
+        return;
     }
-#else
-    /* 初始化GPIO0_C0 */
-    IoTGpioInit(LCD_PIN_CS);
-    IoTGpioSetDir(LCD_PIN_CS, IOT_GPIO_DIR_OUT);
-    IoTGpioSetOutputVal(LCD_PIN_CS, IOT_GPIO_VALUE1);
-    /* 初始化GPIO0_C1 */
-    IoTGpioInit(LCD_PIN_CLK);
-    IoTGpioSetDir(LCD_PIN_CLK, IOT_GPIO_DIR_OUT);
-    IoTGpioSetOutputVal(LCD_PIN_CLK, IOT_GPIO_VALUE0);
-    /* 初始化GPIO0_C2 */
-    IoTGpioInit(LCD_PIN_MOSI);
-    IoTGpioSetDir(LCD_PIN_MOSI, IOT_GPIO_DIR_OUT);
-    IoTGpioSetOutputVal(LCD_PIN_MOSI, IOT_GPIO_VALUE0);
-#endif
-    /* 初始化GPIO0_C3 */
-    IoTGpioInit(LCD_PIN_RES);
-    IoTGpioSetDir(LCD_PIN_RES, IOT_GPIO_DIR_OUT);
-    IoTGpioSetOutputVal(LCD_PIN_RES, IOT_GPIO_VALUE1);
+    if (g_band->ext_num >= LCD_BAND_EXT_MAX)
+    {
+        lcd_bus_flush();
+    }
+    i = g_band->ext_num++;
+    g_band->ext_buf[i] = data;
+    g_band->ext_len[i] = len;
+    g_band->ext_pos[i] = g_band->len;
+    g_band->ext_cmd[i] = g_band->cmd_num;
+}
 
-    /* 初始化GPIO0_C6 */
-    IoTGpioInit(LCD_PIN_DC);
-    IoTGpioSetDir(LCD_PIN_DC, IOT_GPIO_DIR_OUT);
-    IoTGpioSetOutputVal(LCD_PIN_DC, IOT_GPIO_VALUE0);
+/* RGB565转RGB444，各分量取高4位 */
+static uint16_t lcd_rgb565_to_444(uint16_t color)
+{
+    return ((color >> 4) & 0x0F00) | ((color >> 3) & 0x00F0) | ((color >> 1) & 0x000F);
+}
 
-    /* 重启lcd */
-    LCD_RES_Clr();
-    LOS_Msleep(100);
-    LCD_RES_Set();
-    LOS_Msleep(100);
-    LOS_Msleep(500);
-    lcd_wr_reg(0x11);
-    /* 等待LCD 100ms */
-    LOS_Msleep(100);
-    /* 启动LCD配置，设置显示和颜色配置 */
-    lcd_wr_reg(0X36);
-    if (USE_HORIZONTAL == 0)
+/* RGB444转RGB565，低位用高位补齐 */
+static uint16_t lcd_rgb444_to_565(uint16_t c)
+{
+    uint16_t r = (c >> 8) & 0x0F;
+    uint16_t g = (c >> 4) & 0x0F;
+    uint16_t b = c & 0x0F;
+
+    return (((r << 1) | (r >> 3)) << 11) | (((g << 2) | (g >> 2)) << 5) | ((b << 1) | (b >> 3));
+}
+
+/* 写入一个RGB444像素 */
+static void lcd_bus_put444(uint16_t c)
+{
+    if (g_pack_carry)
     {
-        lcd_wr_data8(0x00);
+        lcd_write_bus((g_pack_nibble << 4) | (c >> 8));
+        lcd_write_bus(c & 0xFF);
+        g_pack_carry = false;
     }
-    else if (USE_HORIZONTAL == 1)
+    else
     {
-        lcd_wr_data8(0xC0);
+        lcd_write_bus(c >> 4);
+        g_pack_nibble = c & 0x0F;
+        g_pack_carry = true;
     }
-    else if (USE_HORIZONTAL == 2)
+}
+
+/* 窗口结束，补齐最后一个像素的半个字节 */
+static void lcd_pack_end(void)
+{
+    if (g_pack_carry)
     {
-        lcd_wr_data8(0x70);
+        g_pack_carry = false;
+        lcd_write_bus(g_pack_nibble << 4);
     }
-    else
+}
+
+/* 写入连续的屏幕字节序(高字节在前)RGB565像素数据，按当前像素格式下发 */
+static void lcd_bus_write(const uint8_t *buf, uint32_t len)
+{
+    if (g_format == LCD_FORMAT_RGB444)
     {
-        lcd_wr_data8(0xA0);
+        for (; len >= 2; len -= 2, buf += 2)
+        {
+            lcd_bus_put444(lcd_rgb565_to_444((buf[0] << 8) | buf[1]));
+        }
+        return;
     }
-    lcd_wr_reg(0X3A);
-    lcd_wr_data8(0X05);
-    /* ST7789S帧刷屏率设置 */
-    lcd_wr_reg(0xb2);
-    lcd_wr_data8(0x0c);
-    lcd_wr_data8(0x0c);
+    lcd_bus_copy(buf, len);
+}
+
+/* RGB444模式下写入num个相同颜色的像素，两个像素一组3个字节 */
+static void lcd_bus_fill444(uint16_t color, uint32_t num)
+{
+    uint16_t c = lcd_rgb565_to_444(color);
+    uint8_t b0 = c >> 4;
+    uint8_t b1 = ((c & 0x0F) << 4) | (c >> 8);
+    uint8_t b2 = c & 0xFF;
+    uint8_t *buf;
+    uint32_t len;
+
+    if (g_pack_carry && (num > 0))
+    {
+        lcd_bus_put444(c);
+        num--;
+    }
+    while (num >= 2)
+    {
+        if (g_band->len + 3 > sizeof(g_band->buf))
+        {
+            lcd_bus_flush();
+        }
+        buf = g_band->buf;
+        len = g_band->len;
+        while ((num >= 2) && (len + 3 <= sizeof(g_band->buf)))
+        {
+            buf[len++] = b0;
+            buf[len++] = b1;
+            buf[len++] = b2;
+            num -= 2;
+        }
+        g_band->len = len;
+    }
+    if (num > 0)
+    {
+        lcd_bus_put444(c);
+    }
+}
+
+/* 写入num个相同颜色的像素 */
+static void lcd_bus_fill(uint16_t color, uint32_t num)
+{
+    uint8_t hi = color >> 8;
+    uint8_t lo = color & 0xFF;
+    uint8_t *buf;
+    uint32_t len;
+
+    if (g_format == LCD_FORMAT_RGB444)
+    {
+        lcd_bus_fill444(color, num);
+        return;
+    }
+
+    while (num > 0)
+    {
+        if (g_band->len + 2 > sizeof(g_band->buf))
+        {
+            lcd_bus_flush();
+        }
+        buf = g_band->buf;
+        len = g_band->len;
+        while ((num > 0) && (len + 2 <= sizeof(g_band->buf)))
+        {
+            buf[len++] = hi;
+            buf[len++] = lo;
+            num--;
+        }
+        g_band->len = len;
+    }
+}
+
+static void lcd_wr_data8(uint8_t dat)
+{
+    lcd_write_bus(dat);
+}
+
+static void lcd_wr_data(uint16_t dat)
+{
+    lcd_write_bus(dat >> 8);
+    lcd_write_bus(dat);
+}
+
+static void lcd_wr_reg(uint8_t dat)
+{
+    /* 命令会结束当前的像素写入 */
+    lcd_pack_end();
+    /* 命令只记录位置，下发时再切换DC */
+    if (g_band->cmd_num >= LCD_BAND_CMD_MAX)
+    {
+        lcd_bus_flush();
+    }
+    g_band->cmd_pos[g_band->cmd_num] = g_band->len;
+    g_band->cmd[g_band->cmd_num] = dat;
+    g_band->cmd_num++;
+}
+
+static void lcd_address_set(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+    /* 列地址设置 */
+    lcd_wr_reg(0x2a);
+    lcd_wr_data(x1);
+    lcd_wr_data(x2);
+    /* 行地址设置 */
+    lcd_wr_reg(0x2b);
+    lcd_wr_data(y1);
+    lcd_wr_data(y2);
+    /* 储存器写 */
+    lcd_wr_reg(0x2c);
+}
+
+/////////////////////////////////////////////////////////////////
+/* 脏矩形合成器
+ * 帧外: 所有绘图直接下发到屏幕
+ * 帧内: 绘图窗口先与脏矩形求交，只下发交集的外接矩形内的像素
+ */
+static lcd_rect_t g_dirty_rects[LCD_DIRTY_RECT_MAX];
+static uint8_t g_dirty_num = 0;
+static bool g_frame_active = false;
+/* 整屏失效(上电、唤醒后屏幕内容不可信)，静态内容需要重画 */
+static bool g_frame_full = false;
+/* 被挂起的帧下一次从这一行的条带继续，0表示从头绘制 */
+static uint16_t g_frame_resume_y = 0;
+
+/* 电源状态，局部显示时帧内只刷新局部显示区域 */
+static lcd_power_t g_power = LCD_POWER_ON;
+static lcd_rect_t g_partial = {0, 0, LCD_W - 1, LCD_H - 1};
+static UINT64 g_sleep_in_tick = 0;
+
+/* 当前绘图窗口、实际下发的窗口以及像素游标 */
+static lcd_rect_t g_win;
+static lcd_rect_t g_hw_win;
+static uint16_t g_cur_x;
+static uint16_t g_cur_y;
+static bool g_win_clipped = false;
+
+static uint32_t lcd_rect_area(const lcd_rect_t *r)
+{
+    return (uint32_t)(r->x2 - r->x1 + 1) * (r->y2 - r->y1 + 1);
+}
+
+static bool lcd_rect_intersect(const lcd_rect_t *a, const lcd_rect_t *b, lcd_rect_t *out)
+{
+    lcd_rect_t r;
+
+    r.x1 = (a->x1 > b->x1) ? a->x1 : b->x1;
+    r.y1 = (a->y1 > b->y1) ? a->y1 : b->y1;
+    r.x2 = (a->x2 < b->x2) ? a->x2 : b->x2;
+    r.y2 = (a->y2 < b->y2) ? a->y2 : b->y2;
+    if ((r.x1 > r.x2) || (r.y1 > r.y2))
+    {
+        return false;
+    }
+
+    if (out != NULL)
+    {
+        *out = r;
+    }
+    return true;
+}
+
+static void lcd_rect_union(const lcd_rect_t *a, const lcd_rect_t *b, lcd_rect_t *out)
+{
+    lcd_rect_t r;
+
+    r.x1 = (a->x1 < b->x1) ? a->x1 : b->x1;
+    r.y1 = (a->y1 < b->y1) ? a->y1 : b->y1;
+    r.x2 = (a->x2 > b->x2) ? a->x2 : b->x2;
+    r.y2 = (a->y2 > b->y2) ? a->y2 : b->y2;
+    *out = r;
+}
+
+/* 相交或者合并后不增加面积(相邻且对齐)时才合并 */
+static bool lcd_rect_should_merge(const lcd_rect_t *a, const lcd_rect_t *b)
+{
+    lcd_rect_t u;
+
+    if (lcd_rect_intersect(a, b, NULL))
+    {
+        return true;
+    }
+    lcd_rect_union(a, b, &u);
+    return lcd_rect_area(&u) <= (lcd_rect_area(a) + lcd_rect_area(b));
+}
+
+/////////////////////////////////////////////////////////////////
+/* 条带渲染
+ * 帧内把屏幕分成LCD_RENDER_BAND_LINES行一条的条带，依次把与条带内脏区域
+ * 相交的所有内容画到条带缓冲区，后画的覆盖先画的，画完后整条一次下发。
+ * 重叠绘制只消耗CPU，不增加传输量，也不会出现先擦后画的闪烁。
+ */
+#if LCD_RENDER_BAND_LINES > 0
+static uint8_t g_render_buf[LCD_RENDER_BAND_LINES][LCD_W * 2];
+#endif
+static bool g_render_active = false;
+static uint16_t g_render_y = 0;
+/* 当前条带内需要刷新的区域，即各脏矩形与条带交集的外接矩形 */
+static lcd_rect_t g_render_rect;
+
+/* 把第y行[sx, ex]的像素写入条带缓冲区 */
+static void lcd_render_store(uint16_t y, uint16_t sx, uint16_t ex, const uint8_t *raw, uint16_t color)
+{
+#if LCD_RENDER_BAND_LINES > 0
+    uint8_t *dst = &g_render_buf[y - g_render_y][sx * 2];
+
+    if (raw != NULL)
+    {
+        memcpy(dst, raw, (ex - sx + 1) * 2);
+        return;
+    }
+    for (uint16_t i = sx; i <= ex; i++)
+    {
+        *dst++ = color >> 8;
+        *dst++ = color & 0xFF;
+    }
+#endif
+}
+
+/////////////////////////////////////////////////////////////////
+/* 影子缓冲区
+ * 屏幕只能写不能读，叠加模式需要知道字形下面原有的像素。影子缓冲区
+ * 保存从g_shadow_y开始LCD_SHADOW_LINES行已经下发到屏幕的像素(屏幕字节序)，
+ * 按LCD_SHADOW_BLOCK列为一块记录哪些块已经被完整写过，只有完整写过的
+ * 区域才能用来做叠加混合。
+ */
+#define LCD_SHADOW_BLOCK        8
+#define LCD_SHADOW_BLOCK_BYTES  ((LCD_W / LCD_SHADOW_BLOCK + 7) / 8)
+
+#if LCD_SHADOW_LINES > 0
+static uint8_t g_shadow[LCD_SHADOW_LINES][LCD_W * 2];
+static uint8_t g_shadow_valid[LCD_SHADOW_LINES][LCD_SHADOW_BLOCK_BYTES];
+#endif
+static uint16_t g_shadow_y = 0;
+static bool g_win_shadowed = false;
+
+static bool lcd_shadow_rows_hit(uint16_t y1, uint16_t y2)
+{
+#if LCD_SHADOW_LINES > 0
+    return (y2 >= g_shadow_y) && (y1 < g_shadow_y + LCD_SHADOW_LINES);
+#else
+    return false;
+#endif
+}
+
+/* 记录已经下发到第y行[sx, ex]的像素 */
+static void lcd_shadow_store(uint16_t y, uint16_t sx, uint16_t ex, const uint8_t *raw, uint16_t color)
+{
+#if LCD_SHADOW_LINES > 0
+    uint8_t *dst;
+    uint16_t b, b0, b1;
+
+    if ((y < g_shadow_y) || (y >= g_shadow_y + LCD_SHADOW_LINES))
+    {
+        return;
+    }
+
+    y -= g_shadow_y;
+    dst = &g_shadow[y][sx * 2];
+    if (raw != NULL)
+    {
+        memcpy(dst, raw, (ex - sx + 1) * 2);
+    }
+    else
+    {
+        for (uint16_t i = sx; i <= ex; i++)
+        {
+            *dst++ = color >> 8;
+            *dst++ = color & 0xFF;
+        }
+    }
+
+    /* 只有完整覆盖的块才标记为有效 */
+    b0 = (sx + LCD_SHADOW_BLOCK - 1) / LCD_SHADOW_BLOCK;
+    b1 = (ex + 1) / LCD_SHADOW_BLOCK;
+    for (b = b0; b < b1; b++)
+    {
+        g_shadow_valid[y][b / 8] |= (uint8_t)(1 << (b % 8));
+    }
+#endif
+}
+
+/* 判断指定区域是否完全在影子缓冲区的有效范围内，
+ * 条带渲染时底下的像素在条带缓冲区里，不使用影子缓冲区
+ */
+static bool lcd_shadow_covers(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+#if LCD_SHADOW_LINES > 0
+    uint16_t b, b0, b1;
+
+    if (g_render_active || (y < g_shadow_y) || (y + h > g_shadow_y + LCD_SHADOW_LINES) || (x + w > LCD_W))
+    {
+        return false;
+    }
+
+    b0 = x / LCD_SHADOW_BLOCK;
+    b1 = (x + w - 1) / LCD_SHADOW_BLOCK;
+    for (uint16_t r = y - g_shadow_y; r < y - g_shadow_y + h; r++)
+    {
+        for (b = b0; b <= b1; b++)
+        {
+            if (!(g_shadow_valid[r][b / 8] & (1 << (b % 8))))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+/***************************************************************
+ * 函数名称: lcd_window_begin
+ * 说    明: 设置绘图窗口，帧内会裁剪到脏区域
+ * 参    数:
+ *       @x1：窗口的起始点X坐标
+ *       @y1：窗口的起始点Y坐标
+ *       @x2：窗口的结束点X坐标
+ *       @y2：窗口的结束点Y坐标
+ * 返 回 值: 窗口内有像素需要下发返回true，整个窗口被裁剪返回false
+ ***************************************************************/
+static bool lcd_window_begin(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+    lcd_rect_t part;
+    bool found = false;
+
+    g_win.x1 = x1;
+    g_win.y1 = y1;
+    g_win.x2 = x2;
+    g_win.y2 = y2;
+    g_cur_x = x1;
+    g_cur_y = y1;
+
+    if (g_render_active)
+    {
+        found = lcd_rect_intersect(&g_win, &g_render_rect, &g_hw_win);
+    }
+    else if (!g_frame_active)
+    {
+        g_hw_win = g_win;
+        found = true;
+    }
+    else
+    {
+        for (uint8_t i = 0; i < g_dirty_num; i++)
+        {
+            if (!lcd_rect_intersect(&g_win, &g_dirty_rects[i], &part))
+            {
+                continue;
+            }
+            if (!found)
+            {
+                g_hw_win = part;
+                found = true;
+            }
+            else
+            {
+                lcd_rect_union(&g_hw_win, &part, &g_hw_win);
+            }
+        }
+    }
+
+    if (!found)
+    {
+        /* 空窗口，后续写入的像素全部丢弃 */
+        g_hw_win.x1 = 1;
+        g_hw_win.x2 = 0;
+        g_win_clipped = true;
+        g_win_shadowed = false;
+        return false;
+    }
+
+    if (g_render_active)
+    {
+        /* 条带渲染时像素只写入条带缓冲区，总是逐行裁剪 */
+        g_win_clipped = true;
+        g_win_shadowed = false;
+        return true;
+    }
+
+    g_win_clipped = (g_hw_win.x1 != x1) || (g_hw_win.y1 != y1) || (g_hw_win.x2 != x2) || (g_hw_win.y2 != y2);
+    g_win_shadowed = lcd_shadow_rows_hit(g_hw_win.y1, g_hw_win.y2);
+    lcd_address_set(g_hw_win.x1, g_hw_win.y1, g_hw_win.x2, g_hw_win.y2);
+    return true;
+}
+
+/***************************************************************
+ * 函数名称: lcd_stream
+ * 说    明: 按窗口扫描顺序写入像素，帧内被裁剪的像素只移动游标，
+ *           落在影子缓冲区内的像素同时写入影子缓冲区
+ * 参    数:
+ *       @raw：屏幕字节序的像素数据，为NULL时写入color
+ *       @color：raw为NULL时填充的颜色
+ *       @num：像素个数
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_stream(const uint8_t *raw, uint16_t color, uint32_t num)
+{
+    uint32_t run;
+    uint16_t sx, ex;
+
+    if (!g_win_clipped && !g_win_shadowed && !g_render_active)
+    {
+        if (raw != NULL)
+        {
+            lcd_bus_write(raw, num * 2);
+        }
+        else
+        {
+            lcd_bus_fill(color, num);
+        }
+        return;
+    }
+
+    while (num > 0)
+    {
+        /* 每次最多处理到当前行的末尾 */
+        run = g_win.x2 - g_cur_x + 1;
+        if (run > num)
+        {
+            run = num;
+        }
+
+        if ((g_cur_y >= g_hw_win.y1) && (g_cur_y <= g_hw_win.y2))
+        {
+            sx = (g_cur_x > g_hw_win.x1) ? g_cur_x : g_hw_win.x1;
+            ex = g_cur_x + run - 1;
+            if (ex > g_hw_win.x2)
+            {
+                ex = g_hw_win.x2;
+            }
+            if (sx <= ex)
+            {
+                if (g_render_active)
+                {
+                    lcd_render_store(g_cur_y, sx, ex, (raw != NULL) ? (raw + (sx - g_cur_x) * 2) : NULL, color);
+                }
+                else if (raw != NULL)
+                {
+                    lcd_bus_write(raw + (sx - g_cur_x) * 2, (ex - sx + 1) * 2);
+                    lcd_shadow_store(g_cur_y, sx, ex, raw + (sx - g_cur_x) * 2, color);
+                }
+                else
+                {
+                    lcd_bus_fill(color, ex - sx + 1);
+                    lcd_shadow_store(g_cur_y, sx, ex, NULL, color);
+                }
+            }
+        }
+
+        g_cur_x += run;
+        if (g_cur_x > g_win.x2)
+        {
+            g_cur_x = g_win.x1;
+            g_cur_y++;
+        }
+        if (raw != NULL)
+        {
+            raw += run * 2;
+        }
+        num -= run;
+    }
+}
+
+/* 帧外的绘图函数结束时立即提交缓冲的数据，帧内由lcd_frame_end统一提交 */
+static void lcd_draw_done(void)
+{
+    if (!g_frame_active)
+    {
+        lcd_pack_end();
+        lcd_bus_flush();
+    }
+}
+
+/* 按窗口扫描顺序写入一个像素 */
+static void lcd_wr_pixel(uint16_t color)
+{
+    lcd_stream(NULL, color, 1);
+}
+
+/***************************************************************
+ * 函数名称: lcd_utf8_decode
+ * 说    明: 取出UTF-8字符串中第一个字符的Unicode码点
+ * 参    数:
+ *       @s：UTF-8字符串
+ *       @len：返回该字符占用的字节数，可为NULL
+ * 返 回 值: Unicode码点，编码错误返回0
+ ***************************************************************/
+static uint32_t lcd_utf8_decode(const uint8_t *s, uint8_t *len)
+{
+    uint32_t cp;
+    uint8_t n, i;
+
+    if (s[0] < 0x80)
+    {
+        cp = s[0];
+        n = 1;
+    }
+    else if ((s[0] & 0xE0) == 0xC0)
+    {
+        cp = s[0] & 0x1F;
+        n = 2;
+    }
+    else if ((s[0] & 0xF0) == 0xE0)
+    {
+        cp = s[0] & 0x0F;
+        n = 3;
+    }
+    else if ((s[0] & 0xF8) == 0xF0)
+    {
+        cp = s[0] & 0x07;
+        n = 4;
+    }
+    else
+    {
+        cp = 0;
+        n = 1;
+    }
+
+    for (i = 1; i < n; i++)
+    {
+        if ((s[i] & 0xC0) != 0x80)
+        {
+            /* 编码不完整，只跳过已检查的字节 */
+            cp = 0;
+            n = i;
+            break;
+        }
+        cp = (cp << 6) | (s[i] & 0x3F);
+    }
+
+    if (len != NULL)
+    {
+        *len = n;
+    }
+    return cp;
+}
+
+/***************************************************************
+ * 函数名称: lcd_show_glyph_overlay
+ * 说    明: 叠加模式显示一个点阵字形
+ *           字形区域在影子缓冲区内时，读出原有像素混合后整字一个窗口下发；
+ *           否则每行连续的前景像素合并成一个窗口下发
+ * 参    数:
+ *       @x：字形的起始位置X坐标
+ *       @y：字形的起始位置Y坐标
+ *       @sizex：字形宽度
+ *       @sizey：字形高度
+ *       @msk：点阵数据，每行(sizex+7)/8字节，低位在前
+ *       @fc: 字的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_show_glyph_overlay(uint16_t x, uint16_t y, uint8_t sizex, uint8_t sizey,
+    const uint8_t *msk, uint16_t fc)
+{
+    uint8_t bytes = (sizex + 7) / 8;
+#if LCD_SHADOW_LINES > 0
+    uint8_t row[32 * 2];
+#endif
+    uint8_t r, c, start;
+
+    if (!lcd_frame_is_dirty(x, y, x + sizex, y + sizey))
+    {
+        return;
+    }
+
+#if LCD_SHADOW_LINES > 0
+    if (lcd_shadow_covers(x, y, sizex, sizey))
+    {
+        if (!lcd_window_begin(x, y, x+sizex-1, y+sizey-1))
+        {
+            return;
+        }
+        for (r = 0; r < sizey; r++, msk += bytes)
+        {
+            memcpy(row, &g_shadow[y + r - g_shadow_y][x * 2], sizex * 2);
+            for (c = 0; c < sizex; c++)
+            {
+                if (msk[c / 8] & (0x01 << (c % 8)))
+                {
+                    row[c * 2] = fc >> 8;
+                    row[c * 2 + 1] = fc & 0xFF;
+                }
+            }
+            lcd_stream(row, 0, sizex);
+        }
+        return;
+    }
+#endif
+
+    for (r = 0; r < sizey; r++, msk += bytes)
+    {
+        c = 0;
+        while (c < sizex)
+        {
+            if (!(msk[c / 8] & (0x01 << (c % 8))))
+            {
+                c++;
+                continue;
+            }
+            start = c;
+            while ((c < sizex) && (msk[c / 8] & (0x01 << (c % 8))))
+            {
+                c++;
+            }
+            if (lcd_window_begin(x + start, y + r, x + c - 1, y + r))
+            {
+                lcd_stream(NULL, fc, c - start);
+            }
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////
+/* 字形光栅化
+ * 点阵字模每字节对应8个像素(低位在左)，预先把0x00~0xFF展开成8个像素的
+ * 屏幕字节序数据，光栅化时每个字模字节只需要一次16字节拷贝。展开表与
+ * 前景色/背景色绑定，颜色变化时才重新生成。
+ */
+static uint8_t g_glyph_expand[256][16];
+static uint16_t g_glyph_fc;
+static uint16_t g_glyph_bc;
+static bool g_glyph_expand_valid = false;
+
+static void lcd_glyph_expand_prepare(uint16_t fc, uint16_t bc)
+{
+    uint8_t nibble[16][8];
+    uint16_t v;
+    uint8_t j;
+
+    if (g_glyph_expand_valid && (g_glyph_fc == fc) && (g_glyph_bc == bc))
+    {
+        return;
+    }
+
+    /* 先生成4位的展开表，再拼出8位的展开表 */
+    for (v = 0; v < 16; v++)
+    {
+        for (j = 0; j < 4; j++)
+        {
+            nibble[v][j * 2] = ((v >> j) & 0x01) ? (fc >> 8) : (bc >> 8);
+            nibble[v][j * 2 + 1] = ((v >> j) & 0x01) ? (fc & 0xFF) : (bc & 0xFF);
+        }
+    }
+    for (v = 0; v < 256; v++)
+    {
+        memcpy(&g_glyph_expand[v][0], nibble[v & 0x0F], 8);
+        memcpy(&g_glyph_expand[v][8], nibble[v >> 4], 8);
+    }
+
+    g_glyph_fc = fc;
+    g_glyph_bc = bc;
+    g_glyph_expand_valid = true;
+}
+
+/* 按每行字节数展开的光栅化函数，编译器可以把内层循环完全展开，
+ * 输出为sizex*sizey个像素的连续数据
+ */
+#define LCD_GLYPH_RASTER_DEFINE(BYTES)                                          \
+static void lcd_glyph_raster_##BYTES(uint8_t *dst, const uint8_t *msk,         \
+    uint8_t sizex, uint8_t sizey)                                               \
+{                                                                               \
+    uint8_t tail = (sizex - ((BYTES) - 1) * 8) * 2;                             \
+    for (uint8_t r = 0; r < sizey; r++, msk += (BYTES))                         \
+    {                                                                           \
+        for (uint8_t b = 0; b < (BYTES) - 1; b++, dst += 16)                    \
+        {                                                                       \
+            memcpy(dst, g_glyph_expand[msk[b]], 16);                            \
+        }                                                                       \
+        memcpy(dst, g_glyph_expand[msk[(BYTES) - 1]], tail);                    \
+        dst += tail;                                                            \
+    }                                                                           \
+}
+
+LCD_GLYPH_RASTER_DEFINE(1)  /* 6x12、8x16 */
+LCD_GLYPH_RASTER_DEFINE(2)  /* 12x24、16x32、12x12、16x16 */
+LCD_GLYPH_RASTER_DEFINE(3)  /* 24x24 */
+LCD_GLYPH_RASTER_DEFINE(4)  /* 32x32 */
+
+static void lcd_glyph_raster(uint8_t *dst, const uint8_t *msk, uint8_t sizex, uint8_t sizey)
+{
+    switch ((sizex + 7) / 8)
+    {
+        case 1:
+            lcd_glyph_raster_1(dst, msk, sizex, sizey);
+            break;
+        case 2:
+            lcd_glyph_raster_2(dst, msk, sizex, sizey);
+            break;
+        case 3:
+            lcd_glyph_raster_3(dst, msk, sizex, sizey);
+            break;
+        case 4:
+            lcd_glyph_raster_4(dst, msk, sizex, sizey);
+            break;
+        default:
+            break;
+    }
+}
+
+/* 缓存未启用或放不下时使用的光栅化缓冲区，最大32x32 */
+static uint8_t g_glyph_buf[32 * 32 * 2];
+
+/////////////////////////////////////////////////////////////////
+/* 字形缓存
+ * 按(码点, 字号, 前景色, 背景色)缓存已经光栅化好的RGB565字形，命中时
+ * 直接整块下发。数据保存在LCD_GLYPH_CACHE_BYTES字节的缓存区中，按使用
+ * 时间淘汰最久未使用的字形，淘汰后把后面的数据前移，保证空闲空间连续。
+ */
+#if LCD_GLYPH_CACHE_BYTES > 0
+/* 按平均每个字形192字节估算可缓存的字形个数 */
+#define LCD_GLYPH_CACHE_SLOTS   (LCD_GLYPH_CACHE_BYTES / 192)
+
+typedef struct lcd_glyph_slot
+{
+    uint32_t codepoint;
+    uint16_t fc;
+    uint16_t bc;
+    uint8_t sizey;
+    bool used;
+    uint32_t offset;        /* 在缓存区中的偏移 */
+    uint32_t len;           /* 数据长度 */
+    uint32_t stamp;         /* 最近一次使用的时间戳 */
+} lcd_glyph_slot_t;
+
+static uint8_t g_glyph_cache[LCD_GLYPH_CACHE_BYTES];
+static lcd_glyph_slot_t g_glyph_slots[LCD_GLYPH_CACHE_SLOTS];
+static uint32_t g_glyph_cache_used = 0;
+static uint32_t g_glyph_stamp = 0;
+
+static uint8_t *lcd_glyph_cache_lookup(uint32_t cp, uint8_t sizey, uint16_t fc, uint16_t bc)
+{
+    lcd_glyph_slot_t *slot;
+
+    for (uint16_t i = 0; i < LCD_GLYPH_CACHE_SLOTS; i++)
+    {
+        slot = &g_glyph_slots[i];
+        if (slot->used && (slot->codepoint == cp) && (slot->sizey == sizey)
+            && (slot->fc == fc) && (slot->bc == bc))
+        {
+            slot->stamp = ++g_glyph_stamp;
+            g_stats.glyph_cache_hits++;
+            return &g_glyph_cache[slot->offset];
+        }
+    }
+    g_stats.glyph_cache_misses++;
+    return NULL;
+}
+
+/* 淘汰最久未使用的字形并压缩缓存区，没有可淘汰的字形返回false */
+static bool lcd_glyph_cache_evict(void)
+{
+    lcd_glyph_slot_t *victim = NULL;
+    uint32_t offset, len;
+
+    for (uint16_t i = 0; i < LCD_GLYPH_CACHE_SLOTS; i++)
+    {
+        if (g_glyph_slots[i].used && ((victim == NULL) || (g_glyph_slots[i].stamp < victim->stamp)))
+        {
+            victim = &g_glyph_slots[i];
+        }
+    }
+    if (victim == NULL)
+    {
+        return false;
+    }
+
+    offset = victim->offset;
+    len = victim->len;
+    memmove(&g_glyph_cache[offset], &g_glyph_cache[offset + len], g_glyph_cache_used - offset - len);
+    g_glyph_cache_used -= len;
+    victim->used = false;
+    for (uint16_t i = 0; i < LCD_GLYPH_CACHE_SLOTS; i++)
+    {
+        if (g_glyph_slots[i].used && (g_glyph_slots[i].offset > offset))
+        {
+            g_glyph_slots[i].offset -= len;
+        }
+    }
+    g_stats.glyph_cache_evictions++;
+    return true;
+}
+
+static uint8_t *lcd_glyph_cache_alloc(uint32_t cp, uint8_t sizey, uint16_t fc, uint16_t bc, uint32_t len)
+{
+    lcd_glyph_slot_t *slot = NULL;
+
+    if (len > LCD_GLYPH_CACHE_BYTES)
+    {
+        return NULL;
+    }
+
+    while (1)
+    {
+        for (uint16_t i = 0; (i < LCD_GLYPH_CACHE_SLOTS) && (slot == NULL); i++)
+        {
+            if (!g_glyph_slots[i].used)
+            {
+                slot = &g_glyph_slots[i];
+            }
+        }
+        if ((slot != NULL) && (g_glyph_cache_used + len <= LCD_GLYPH_CACHE_BYTES))
+        {
+            break;
+        }
+        slot = NULL;
+        if (!lcd_glyph_cache_evict())
+        {
+            return NULL;
+        }
+    }
+
+    slot->codepoint = cp;
+    slot->sizey = sizey;
+    slot->fc = fc;
+    slot->bc = bc;
+    slot->offset = g_glyph_cache_used;
+    slot->len = len;
+    slot->stamp = ++g_glyph_stamp;
+    slot->used = true;
+    g_glyph_cache_used += len;
+    return &g_glyph_cache[slot->offset];
+}
+#endif
+
+/***************************************************************
+ * 函数名称: lcd_show_glyph
+ * 说    明: 显示一个点阵字形，非叠加模式优先使用字形缓存
+ * 参    数:
+ *       @x：字形的起始位置X坐标
+ *       @y：字形的起始位置Y坐标
+ *       @cp：字形的码点，用作缓存的key
+ *       @sizex：字形宽度，最大32
+ *       @sizey：字形高度
+ *       @msk：点阵数据，每行(sizex+7)/8字节，低位在前
+ *       @fc: 字的颜色
+ *       @bc: 字的背景色
+ *       @mode: 0为非叠加模式；1为叠加模式
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_show_glyph(uint16_t x, uint16_t y, uint32_t cp, uint8_t sizex, uint8_t sizey,
+    const uint8_t *msk, uint16_t fc, uint16_t bc, uint8_t mode)
+{
+    uint8_t *data = NULL;
+    uint32_t num = (uint32_t)sizex * sizey;
+
+    if (mode)
+    {/* 叠加模式 */
+        lcd_show_glyph_overlay(x, y, sizex, sizey, msk, fc);
+        return;
+    }
+
+    if (!lcd_window_begin(x, y, x+sizex-1, y+sizey-1))
+    {
+        return;
+    }
+
+#if LCD_GLYPH_CACHE_BYTES > 0
+    data = lcd_glyph_cache_lookup(cp, sizey, fc, bc);
+    if (data != NULL)
+    {
+        lcd_stream(data, 0, num);
+        return;
+    }
+    data = lcd_glyph_cache_alloc(cp, sizey, fc, bc, num * 2);
+#endif
+    if (data == NULL)
+    {
+        data = g_glyph_buf;
+    }
+
+    lcd_glyph_expand_prepare(fc, bc);
+    lcd_glyph_raster(data, msk, sizex, sizey);
+    lcd_stream(data, 0, num);
+}
+
+static uint32_t mypow(uint8_t m, uint8_t n)
+{
+    uint32_t result = 1;
+    
+    while (n--)
+    {
+        result *= m;
+    }
+    
+    return result;
+}
+
+
+/////////////////////////////////////////////////////////////////
+
+/***************************************************************
+ * 函数名称: lcd_init
+ * 说    明: Lcd初始化
+ * 参    数: 无
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_init()
+{
+    unsigned int ret = 0;
+
+#if LCD_ENABLE_SPI
+    ret = IoTSpiInit(LCD_SPI_BUS, &iot_spi);
+    if (ret != IOT_SUCCESS)
+    {
+        printf("%s, %s, %d: Spi init failed!\n",
+         __FILE__, __func__, __LINE__);
+        return IOT_FAILURE;
+    }
+#else
+    /* 初始化GPIO0_C0 */
+    IoTGpioInit(LCD_PIN_CS);
+    IoTGpioSetDir(LCD_PIN_CS, IOT_GPIO_DIR_OUT);
+    IoTGpioSetOutputVal(LCD_PIN_CS, IOT_GPIO_VALUE1);
+    /* 初始化GPIO0_C1 */
+    IoTGpioInit(LCD_PIN_CLK);
+    IoTGpioSetDir(LCD_PIN_CLK, IOT_GPIO_DIR_OUT);
+    IoTGpioSetOutputVal(LCD_PIN_CLK, IOT_GPIO_VALUE0);
+    /* 初始化GPIO0_C2 */
+    IoTGpioInit(LCD_PIN_MOSI);
+    IoTGpioSetDir(LCD_PIN_MOSI, IOT_GPIO_DIR_OUT);
+    IoTGpioSetOutputVal(LCD_PIN_MOSI, IOT_GPIO_VALUE0);
+#endif
+    /* 初始化GPIO0_C3 */
+    IoTGpioInit(LCD_PIN_RES);
+    IoTGpioSetDir(LCD_PIN_RES, IOT_GPIO_DIR_OUT);
+    IoTGpioSetOutputVal(LCD_PIN_RES, IOT_GPIO_VALUE1);
+
+    /* 初始化GPIO0_C6 */
+    IoTGpioInit(LCD_PIN_DC);
+    IoTGpioSetDir(LCD_PIN_DC, IOT_GPIO_DIR_OUT);
+    IoTGpioSetOutputVal(LCD_PIN_DC, IOT_GPIO_VALUE0);
+
+    /* 重启lcd */
+    LCD_RES_Clr();
+    LOS_Msleep(100);
+    LCD_RES_Set();
+    LOS_Msleep(100);
+    LOS_Msleep(500);
+    lcd_wr_reg(0x11);
+    lcd_bus_flush();
+    /* 等待LCD 100ms */
+    LOS_Msleep(100);
+    /* 启动LCD配置，设置显示和颜色配置 */
+    lcd_wr_reg(0X36);
+    if (USE_HORIZONTAL == 0)
+    {
+        lcd_wr_data8(0x00);
+    }
+    else if (USE_HORIZONTAL == 1)
+    {
+        lcd_wr_data8(0xC0);
+    }
+    else if (USE_HORIZONTAL == 2)
+    {
+        lcd_wr_data8(0x70);
+    }
+    else
+    {
+        lcd_wr_data8(0xA0);
+    }
+    lcd_wr_reg(0X3A);
+    lcd_wr_data8(g_format);
+    /* ST7789S帧刷屏率设置 */
+    lcd_wr_reg(0xb2);
+    lcd_wr_data8(0x0c);
+    lcd_wr_data8(0x0c);
     lcd_wr_data8(0x00);
     lcd_wr_data8(0x33);
     lcd_wr_data8(0x33);
@@ -578,524 +1486,1879 @@ unsigned int lcd_init()
     lcd_wr_data8(0x21);
     lcd_wr_data8(0x20);
     lcd_wr_reg(0x29);
+    lcd_bus_flush();
+
+#if LCD_ENABLE_ASYNC_FLUSH
+    if (!g_flush_task_ready && (lcd_flush_task_init() != LOS_OK))
+    {
+        /* 刷新任务创建失败时退回同步下发 */
+        printf("%s, %s, %d: lcd flush task init failed!\n",
+         __FILE__, __func__, __LINE__);
+    }
+#endif
+
+    return 0;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_deinit
+ * 说    明: Lcd注销
+ * 参    数: 无
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_deinit()
+{
+    lcd_flush_wait(LOS_WAIT_FOREVER);
+#if LCD_ENABLE_SPI
+    IoTSpiDeinit(LCD_SPI_BUS);
+#else
+    IoTGpioDeinit(LCD_PIN_CS);
+    IoTGpioDeinit(LCD_PIN_CLK);
+    IoTGpioDeinit(LCD_PIN_MOSI);
+#endif
+    IoTGpioDeinit(LCD_PIN_RES);
+    IoTGpioDeinit(LCD_PIN_DC);
+    
+    return 0;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_fill
+ * 说    明: 指定区域填充颜色
+ * 参    数:
+ *       @xsta：指定区域的起始点X坐标
+ *       @ysta：指定区域的起始点Y坐标
+ *       @xend：指定区域的结束点X坐标
+ *       @yend：指定区域的结束点Y坐标
+ *       @color：指定区域的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend, uint16_t color)
+{
+    uint32_t num;
+
+    /* 设置显示范围 */
+    if (!lcd_window_begin(xsta, ysta, xend-1, yend-1))
+    {
+        return;
+    }
+    /* 纯色填充不需要逐像素裁剪，直接填满实际下发的窗口 */
+    if (g_win_clipped)
+    {
+        g_win = g_hw_win;
+        g_cur_x = g_win.x1;
+        g_cur_y = g_win.y1;
+        g_win_clipped = false;
+    }
+    num = lcd_rect_area(&g_win);
+    /* 填充颜色 */
+    lcd_stream(NULL, color, num);
+    lcd_draw_done();
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_draw_point
+ * 说    明: 指定位置画一个点
+ * 参    数:
+ *       @x：指定点的X坐标
+ *       @y：指定点的Y坐标
+ *       @color：指定点的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_point(uint16_t x, uint16_t y, uint16_t color)
+{
+    /* 设置光标位置 */
+    if (!lcd_window_begin(x, y, x, y))
+    {
+        return;
+    }
+    lcd_wr_pixel(color);
+    lcd_draw_done();
+}
+
+
+/* 画一段实心矩形(包含两端)，坐标可以越界，先裁剪到屏幕内再用一个窗口下发 */
+static void lcd_span(int x1, int y1, int x2, int y2, uint16_t color)
+{
+    int t;
+
+    if (x1 > x2)
+    {
+        t = x1; x1 = x2; x2 = t;
+    }
+    if (y1 > y2)
+    {
+        t = y1; y1 = y2; y2 = t;
+    }
+    if ((x2 < 0) || (y2 < 0) || (x1 >= LCD_W) || (y1 >= LCD_H))
+    {
+        return;
+    }
+    x1 = (x1 < 0) ? 0 : x1;
+    y1 = (y1 < 0) ? 0 : y1;
+    x2 = (x2 >= LCD_W) ? (LCD_W - 1) : x2;
+    y2 = (y2 >= LCD_H) ? (LCD_H - 1) : y2;
+
+    lcd_fill(x1, y1, x2 + 1, y2 + 1, color);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_draw_hline
+ * 说    明: 画水平线，整条线只设置一次窗口
+ * 参    数:
+ *       @x：线的起始点X坐标
+ *       @y：线的Y坐标
+ *       @len：线的长度
+ *       @color：线的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_hline(uint16_t x, uint16_t y, uint16_t len, uint16_t color)
+{
+    if (len > 0)
+    {
+        lcd_span(x, y, x + len - 1, y, color);
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_draw_vline
+ * 说    明: 画垂直线，整条线只设置一次窗口
+ * 参    数:
+ *       @x：线的X坐标
+ *       @y：线的起始点Y坐标
+ *       @len：线的长度
+ *       @color：线的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_vline(uint16_t x, uint16_t y, uint16_t len, uint16_t color)
+{
+    if (len > 0)
+    {
+        lcd_span(x, y, x, y + len - 1, color);
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_draw_line
+ * 说    明: 指定位置画一条线，同一行或同一列上连续的点合并成一段下发
+ * 参    数:
+ *       @x1：指定线的起始点X坐标
+ *       @y1：指定线的起始点Y坐标
+ *       @x2：指定线的结束点X坐标
+ *       @y2：指定线的结束点Y坐标
+ *       @color：指定点的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color)
+{
+    uint16_t t; 
+    int xerr=0, yerr=0, delta_x, delta_y, distance;
+    int incx, incy, uRow, uCol;
+    int run_x, run_y, run_len;
+
+    /* 计算坐标增量 */
+    delta_x = x2 - x1;
+    delta_y = y2 - y1;
+    /* 画线起点坐标 */
+    uRow = x1;
+    uCol = y1;
+    
+    if (delta_x > 0)
+    {
+        /* 设置单步方向 */
+        incx = 1;
+    }
+    else if (delta_x == 0)
+    {
+        /* 垂直线 */
+        incx = 0;
+    }
+    else
+    {
+        incx = -1;
+        delta_x = -delta_x;
+    }
+    
+    if (delta_y > 0)
+    {
+        incy = 1;
+    }
+    else if (delta_y == 0)
+    {
+        /* 水平线 */
+        incy = 0;
+    }
+    else 
+    {
+        incy = -1;
+        delta_y = -delta_y;
+    }
+    
+    if (delta_x > delta_y)
+    {
+        /* 选取基本增量坐标轴 */
+        distance = delta_x;
+    }
+    else
+    {
+        distance = delta_y;
+    }
+
+    /* 当前段的起点和点数，段沿主轴方向延伸 */
+    run_x = uRow;
+    run_y = uCol;
+    run_len = 0;
+    
+    for (t = 0; t < distance+1; t++)
+    {
+        /* 点不在当前段的延长线上时先下发当前段 */
+        if ((run_len > 0) &&
+            !((delta_x > delta_y) ? ((uCol == run_y) && (uRow == run_x + incx * run_len))
+                                  : ((uRow == run_x) && (uCol == run_y + incy * run_len))))
+        {
+            lcd_span(run_x, run_y, run_x + ((delta_x > delta_y) ? incx * (run_len - 1) : 0),
+                run_y + ((delta_x > delta_y) ? 0 : incy * (run_len - 1)), color);
+            run_x = uRow;
+            run_y = uCol;
+            run_len = 0;
+        }
+        run_len++;
+
+        xerr += delta_x;
+        yerr += delta_y;
+        if (xerr > distance)
+        {
+            xerr -= distance;
+            uRow += incx;
+        }
+        if (yerr > distance)
+        {
+            yerr -= distance;
+            uCol += incy;
+        }
+    }
+
+    lcd_span(run_x, run_y, run_x + ((delta_x > delta_y) ? incx * (run_len - 1) : 0),
+        run_y + ((delta_x > delta_y) ? 0 : incy * (run_len - 1)), color);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_draw_rectangle
+ * 说    明: 指定位置画矩形，四条边各用一个窗口下发
+ * 参    数:
+ *       @x1：指定矩形的起始点X坐标
+ *       @y1：指定矩形的起始点Y坐标
+ *       @x2：指定矩形的结束点X坐标
+ *       @y2：指定矩形的结束点Y坐标
+ *       @color：指定点的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,uint16_t color)
+{
+    lcd_span(x1, y1, x2, y1, color);
+    lcd_span(x1, y1, x1, y2, color);
+    lcd_span(x1, y2, x2, y2, color);
+    lcd_span(x2, y1, x2, y2, color);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_fill_rectangle
+ * 说    明: 指定位置画实心矩形，与lcd_draw_rectangle一样包含结束点
+ * 参    数:
+ *       @x1：指定矩形的起始点X坐标
+ *       @y1：指定矩形的起始点Y坐标
+ *       @x2：指定矩形的结束点X坐标
+ *       @y2：指定矩形的结束点Y坐标
+ *       @color：指定矩形的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color)
+{
+    lcd_span(x1, y1, x2, y2, color);
+}
+
+
+/* 下发圆上b相同的一组点，a从a1到a2，8个对称位置各是一段水平或垂直线 */
+static void lcd_circle_spans(int x0, int y0, int a1, int a2, int b, uint16_t color)
+{
+    lcd_span(x0 - a2, y0 - b, x0 - a1, y0 - b, color);
+    lcd_span(x0 + a1, y0 - b, x0 + a2, y0 - b, color);
+    lcd_span(x0 - a2, y0 + b, x0 - a1, y0 + b, color);
+    lcd_span(x0 + a1, y0 + b, x0 + a2, y0 + b, color);
+    lcd_span(x0 - b, y0 - a2, x0 - b, y0 - a1, color);
+    lcd_span(x0 + b, y0 - a2, x0 + b, y0 - a1, color);
+    lcd_span(x0 - b, y0 + a1, x0 - b, y0 + a2, color);
+    lcd_span(x0 + b, y0 + a1, x0 + b, y0 + a2, color);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_draw_circle
+ * 说    明: 指定位置画圆，b不变的连续点合并成一段下发
+ * 参    数:
+ *       @x0：指定圆的中心点X坐标
+ *       @y0：指定圆的中心点Y坐标
+ *       @r：指定圆的半径
+ *       @color：指定点的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color)
+{
+    int a, b, a_start;
+    
+    a = 0;
+    b = r;
+    a_start = 0;
+    
+    while (a <= b)
+    {
+        a++;
+        /* 判断要画的点是否过远 */
+        if ((a*a+b*b) > (r*r))
+        {
+            lcd_circle_spans(x0, y0, a_start, a - 1, b, color);
+            a_start = a;
+            b--;
+        }
+    }
+    if (a_start < a)
+    {
+        lcd_circle_spans(x0, y0, a_start, a - 1, b, color);
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_fill_circle
+ * 说    明: 指定位置画实心圆，每一行用一段水平线下发，
+ *           边缘与lcd_draw_circle画出的圆一致
+ * 参    数:
+ *       @x0：指定圆的中心点X坐标
+ *       @y0：指定圆的中心点Y坐标
+ *       @r：指定圆的半径
+ *       @color：指定圆的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color)
+{
+    int a, b;
+    
+    a = 0;
+    b = r;
+    
+    while (a <= b)
+    {
+        /* 第a行的半宽为b */
+        lcd_span(x0 - b, y0 - a, x0 + b, y0 - a, color);
+        if (a > 0)
+        {
+            lcd_span(x0 - b, y0 + a, x0 + b, y0 + a, color);
+        }
+        a++;
+        if ((a*a+b*b) > (r*r))
+        {
+            /* b行的点画完了，半宽为a-1，b<a-1时这一行已经作为a行画过 */
+            if (b > a - 1)
+            {
+                lcd_span(x0 - (a - 1), y0 - b, x0 + (a - 1), y0 - b, color);
+                lcd_span(x0 - (a - 1), y0 + b, x0 + (a - 1), y0 + b, color);
+            }
+            b--;
+        }
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_draw_triangle
+ * 说    明: 指定位置画三角形
+ * 参    数:
+ *       @x0,y0：第一个顶点
+ *       @x1,y1：第二个顶点
+ *       @x2,y2：第三个顶点
+ *       @color：指定点的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_triangle(uint16_t x0, uint16_t y0,uint16_t x1, uint16_t y1,uint16_t x2, uint16_t y2,  uint16_t color){
+
+    lcd_draw_line(x0, y0, x1, y1, color);
+    lcd_draw_line(x1, y1, x2, y2, color);
+    lcd_draw_line(x2, y2, x0, y0, color);
+
+
+}
+
+
+/* 边(xa,ya)-(xb,yb)在第y行上覆盖的X范围，取y-0.5到y+0.5之间的线段，
+ * 与画线函数在这一行上画出的一段点基本一致 */
+static void lcd_edge_span(int xa, int ya, int xb, int yb, int y, int *xl, int *xr)
+{
+    int dy2, t, d, i, x[2];
+
+    if ((y < ya) || (y > yb))
+    {
+        return;
+    }
+    if (ya == yb)
+    {
+        x[0] = xa;
+        x[1] = xb;
+    }
+    else
+    {
+        /* 用两倍坐标计算半行位置，四舍五入到最近的像素 */
+        dy2 = (yb - ya) * 2;
+        for (i = 0; i < 2; i++)
+        {
+            t = (y - ya) * 2 + (i ? 1 : -1);
+            t = (t < 0) ? 0 : ((t > dy2) ? dy2 : t);
+            d = (xb - xa) * t;
+            x[i] = (d >= 0) ? (xa + (d * 2 + dy2) / (dy2 * 2)) : (xa - (-d * 2 + dy2) / (dy2 * 2));
+        }
+    }
+    for (i = 0; i < 2; i++)
+    {
+        *xl = (x[i] < *xl) ? x[i] : *xl;
+        *xr = (x[i] > *xr) ? x[i] : *xr;
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_fill_triangle
+ * 说    明: 指定位置画实心三角形，逐行计算左右边界后用水平线下发
+ * 参    数:
+ *       @x0,y0：第一个顶点
+ *       @x1,y1：第二个顶点
+ *       @x2,y2：第三个顶点
+ *       @color：指定三角形的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_triangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+    uint16_t x2, uint16_t y2, uint16_t color)
+{
+    int xa[3] = {x0, x1, x2};
+    int ya[3] = {y0, y1, y2};
+    int i, j, y, ymin, ymax, xl, xr;
+
+    ymin = ya[0];
+    ymax = ya[0];
+    for (i = 1; i < 3; i++)
+    {
+        ymin = (ya[i] < ymin) ? ya[i] : ymin;
+        ymax = (ya[i] > ymax) ? ya[i] : ymax;
+    }
+
+    /* 三角形是凸的，每一行的填充范围就是三条边在这一行上覆盖范围的并集 */
+    for (y = ymin; y <= ymax; y++)
+    {
+        xl = LCD_W * 2;
+        xr = -1;
+        for (i = 0; i < 3; i++)
+        {
+            j = (i + 1) % 3;
+            if (ya[i] <= ya[j])
+            {
+                lcd_edge_span(xa[i], ya[i], xa[j], ya[j], y, &xl, &xr);
+            }
+            else
+            {
+                lcd_edge_span(xa[j], ya[j], xa[i], ya[i], y, &xl, &xr);
+            }
+        }
+        if (xl <= xr)
+        {
+            lcd_span(xl, y, xr, y, color);
+        }
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_show_chinese
+ * 说    明: 显示汉字串
+ * 参    数:
+ *       @x：指定汉字串的起始位置X坐标
+ *       @y：指定汉字串的起始位置X坐标
+ *       @s：指定汉字串（该汉字串为utf-8）
+ *       @fc: 字的颜色
+ *       @bc: 字的背景色
+ *       @sizey: 字号，可选：12、16、24、32
+ *       @mode: 0为非叠加模式；1为叠加模式
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_show_chinese(uint16_t x, uint16_t y, uint8_t *s, 
+    uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
+{
+    const uint8_t *msk;
+    uint32_t cp;
+    uint8_t len;
+
+    if ((sizey != 12) && (sizey != 16) && (sizey != 24) && (sizey != 32))
+    {
+        return;
+    }
+
+    while (*s != '\0')
+    {
+        cp = lcd_utf8_decode(s, &len);
+        /* 字库中没有的字留空 */
+        msk = lcd_font_find(cp, sizey);
+        if (msk != NULL)
+        {
+            lcd_show_glyph(x, y, cp, sizey, sizey, msk, fc, bc, mode);
+        }
+        s += len;
+        x += sizey;
+    }
+    lcd_draw_done();
+}
+
+
+
+/***************************************************************
+ * 函数名称: lcd_show_char
+ * 说    明: 显示一个字符
+ * 参    数:
+ *       @x：指定字符的起始位置X坐标
+ *       @y：指定字串的起始位置X坐标
+ *       @s：指定字串
+ *       @fc: 字的颜色
+ *       @bc: 字的背景色
+ *       @sizey: 字号，可选：16、24、32
+ *       @mode: 0为非叠加模式；1为叠加模式
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_show_char(uint16_t x, uint16_t y, uint8_t num, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
+{
+    const uint8_t *msk;
+
+    /* 得到偏移后的值 */
+    num = num-' ';
+    if (sizey == 12)
+    {
+        /* 调用6x12字体 */
+        msk = ascii_1206[num];
+    }
+    else if (sizey == 16)
+    {
+        /* 调用8x16字体 */
+        msk = ascii_1608[num];
+    }
+    else if (sizey == 24)
+    {
+        /* 调用12x24字体 */
+        msk = ascii_2412[num];
+    }
+    else if (sizey == 32)
+    {
+        /* 调用16x32字体 */
+        msk = ascii_3216[num];
+    }
+    else
+    {
+        return;
+    }
+
+    lcd_show_glyph(x, y, num + ' ', sizey/2, sizey, msk, fc, bc, mode);
+    lcd_draw_done();
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_show_string
+ * 说    明: 显示字符串
+ * 参    数:
+ *       @x：指定字符的起始位置X坐标
+ *       @y：指定字串的起始位置X坐标
+ *       @s：指定字串
+ *       @fc: 字的颜色
+ *       @bc: 字的背景色
+ *       @sizey: 字号，可选：16、24、32
+ *       @mode: 0为非叠加模式；1为叠加模式
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_show_string(uint16_t x, uint16_t y, const uint8_t *p, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
+{         
+    while (*p != '\0')
+    {       
+        lcd_show_char(x, y, *p, fc, bc, sizey, mode);
+        x += (sizey / 2);
+        p++;
+    }  
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_show_int_num
+ * 说    明: 显示整数变量
+ * 参    数:
+ *       @x：指定整数变量的起始位置X坐标
+ *       @y：指定整数变量的起始位置X坐标
+ *       @num：指定整数变量
+ *       @fc: 整数变量的颜色
+ *       @bc: 整数变量的背景色
+ *       @sizey: 字号，可选：16、24、32
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_show_int_num(uint16_t x, uint16_t y, uint16_t num, uint8_t len, uint16_t fc, uint16_t bc, uint8_t sizey)
+{
+    uint8_t t,temp;
+    uint8_t enshow=0;
+    uint8_t sizex = sizey / 2;
+    
+    for (t=0; t<len; t++)
+    {
+        temp = (num/mypow(10,len-t-1)) % 10;
+        if (enshow==0 && t<(len-1))
+        {
+            if (temp == 0)
+            {
+                lcd_show_char(x+t*sizex, y, ' ', fc, bc, sizey, 0);
+                continue;
+            }
+            else
+            {
+                enshow = 1;
+            }
+        }
+        lcd_show_char(x+t*sizex, y, temp+48, fc, bc, sizey, 0);
+    }
+} 
+
+
+/***************************************************************
+ * 函数名称: lcd_show_float_num1
+ * 说    明: 显示两位小数变量
+ * 参    数:
+ *       @x：指定浮点变量的起始位置X坐标
+ *       @y：指定浮点变量的起始位置X坐标
+ *       @num：指定浮点变量
+ *       @fc: 浮点变量的颜色
+ *       @bc: 浮点变量的背景色
+ *       @sizey: 字号，可选：16、24、32
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_show_float_num1(uint16_t x, uint16_t y,float num,uint8_t len,uint16_t fc,uint16_t bc,uint8_t sizey)
+{
+    uint8_t t,temp, sizex;
+    uint16_t num1;
+    
+    sizex = sizey / 2;
+    num1 = num * 100;
+    for (t=0; t<len; t++)
+    {
+        temp = (num1/mypow(10,len-t-1)) % 10;
+        if (t == (len-2))
+        {
+            lcd_show_char(x+(len-2)*sizex, y, '.', fc, bc, sizey, 0);
+            t++;
+            len += 1;
+        }
+        lcd_show_char(x+t*sizex, y, temp+48, fc, bc, sizey, 0);
+    }
+}
+
+static bool lcd_picture_is_rle(const uint8_t *pic)
+{
+    return (pic[0] == 'R') && (pic[1] == 'L') && (pic[2] == 'E') && (pic[3] == '1');
+}
+
+/***************************************************************
+ * 函数名称: lcd_show_picture_rle
+ * 说    明: 显示RLE压缩的图片，重复包直接按纯色填充下发，
+ *           原始包直接从flash拷贝到发送缓冲区，不需要整图解压
+ * 参    数:
+ *       @x：指定图片的起始位置X坐标
+ *       @y：指定图片的起始位置Y坐标
+ *       @pic：RLE格式的图片数据
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_show_picture_rle(uint16_t x, uint16_t y, const uint8_t *pic)
+{
+    uint16_t w = (pic[4] << 8) | pic[5];
+    uint16_t h = (pic[6] << 8) | pic[7];
+    uint32_t remain = (uint32_t)w * h;
+    uint32_t n;
+    const uint8_t *p = pic + LCD_RLE_HEADER_SIZE;
+
+    if (!lcd_window_begin(x, y, x+w-1, y+h-1))
+    {
+        return;
+    }
+
+    while (remain > 0)
+    {
+        n = (*p & 0x7F) + 1;
+        if (n > remain)
+        {
+            /* 数据损坏，不写出窗口以外的像素 */
+            n = remain;
+        }
+        if (*p & 0x80)
+        {/* 重复包 */
+            lcd_stream(NULL, (p[1] << 8) | p[2], n);
+            p += 3;
+        }
+        else
+        {/* 原始包 */
+            lcd_stream(p + 1, 0, n);
+            p += 1 + n * 2;
+        }
+        remain -= n;
+    }
+}
+
+static bool lcd_picture_is_r444(const uint8_t *pic)
+{
+    return (pic[0] == 'R') && (pic[1] == '4') && (pic[2] == '4') && (pic[3] == '4');
+}
+
+/* 把连续打包的RGB444像素分段展开成RGB565下发 */
+static void lcd_stream_r444(const uint8_t *p, uint32_t remain)
+{
+    uint8_t row[LCD_R444_CHUNK * 2];
+    uint16_t c;
+    uint32_t n, i;
+
+    while (remain > 0)
+    {
+        n = (remain > LCD_R444_CHUNK) ? LCD_R444_CHUNK : remain;
+        for (i = 0; i < n; i++)
+        {
+            /* 两个像素3个字节，偶数像素在前12位 */
+            if ((i & 1) == 0)
+            {
+                c = (p[0] << 4) | (p[1] >> 4);
+            }
+            else
+            {
+                c = ((p[1] & 0x0F) << 8) | p[2];
+                p += 3;
+            }
+            c = lcd_rgb444_to_565(c);
+            row[i * 2] = c >> 8;
+            row[i * 2 + 1] = c & 0xFF;
+        }
+        lcd_stream(row, 0, n);
+        remain -= n;
+    }
+}
+
+/***************************************************************
+ * 函数名称: lcd_draw_image
+ * 说    明: 按图片描述显示图片。图片格式与接口像素格式一致、窗口没有被
+ *           裁剪时，连续的行直接从flash交给SPI，不逐像素拷贝；
+ *           否则按行经过裁剪和格式转换下发
+ * 参    数:
+ *       @x：指定图片的起始位置X坐标
+ *       @y：指定图片的起始位置Y坐标
+ *       @img：图片描述
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_image(uint16_t x, uint16_t y, const lcd_image_t *img)
+{
+    uint32_t stride = (img->stride != 0) ? img->stride : (uint32_t)img->w * 2;
+    uint32_t num = (uint32_t)img->w * img->h;
+    const uint8_t *row = img->data;
+    bool direct;
+
+    if ((img->w == 0) || (img->h == 0) || !lcd_window_begin(x, y, x+img->w-1, y+img->h-1))
+    {
+        return;
+    }
+    direct = (img->format == g_format) && !g_win_clipped && !g_win_shadowed && !g_pack_carry;
+
+    if (img->format == LCD_FORMAT_RGB444)
+    {
+        if (direct)
+        {
+            /* 奇数个像素时最后半个字节补0，与lcd_pack_end一致 */
+            lcd_bus_attach(img->data, num / 2 * 3 + (num & 1) * 2);
+        }
+        else
+        {
+            lcd_stream_r444(img->data, num);
+        }
+    }
+    else if (direct && (stride == (uint32_t)img->w * 2))
+    {
+        lcd_bus_attach(img->data, num * 2);
+    }
+    else
+    {
+        for (uint16_t r = 0; r < img->h; r++, row += stride)
+        {
+            if (direct)
+            {
+                lcd_bus_attach(row, img->w * 2);
+            }
+            else
+            {
+                lcd_stream(row, 0, img->w);
+            }
+        }
+    }
+    lcd_draw_done();
+}
+
+/***************************************************************
+ * 函数名称: lcd_image_sub
+ * 说    明: 取RGB565图片中的一块矩形区域，数据不拷贝，通过行间距访问
+ * 参    数:
+ *       @img：原图片描述
+ *       @x：区域在原图中的起始X坐标
+ *       @y：区域在原图中的起始Y坐标
+ *       @w：区域宽度
+ *       @h：区域高度
+ *       @sub：输出区域的图片描述
+ * 返 回 值: 成功返回true，区域超出原图或原图不是RGB565返回false
+ ***************************************************************/
+bool lcd_image_sub(const lcd_image_t *img, uint16_t x, uint16_t y, uint16_t w, uint16_t h, lcd_image_t *sub)
+{
+    uint32_t stride = (img->stride != 0) ? img->stride : (uint32_t)img->w * 2;
+
+    if ((img->format != LCD_FORMAT_RGB565) || (x + w > img->w) || (y + h > img->h))
+    {
+        return false;
+    }
+    sub->data = img->data + y * stride + x * 2;
+    sub->w = w;
+    sub->h = h;
+    sub->stride = stride;
+    sub->format = LCD_FORMAT_RGB565;
+    return true;
+}
+
+/***************************************************************
+ * 函数名称: lcd_show_picture
+ * 说    明: 显示图片，RGB565原始数据和R444图片经过lcd_draw_image下发
+ * 参    数:
+ *       @x：指定图片的起始位置X坐标
+ *       @y：指定图片的起始位置X坐标
+ *       @length：指定图片的长度
+ *       @width：指定图片的宽度
+ *       @pic：指定图片的内容
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_show_picture(uint16_t x, uint16_t y, uint16_t length, uint16_t width, const uint8_t *pic)
+{
+    lcd_image_t img = {pic, length, width, 0, LCD_FORMAT_RGB565};
+
+    if (lcd_picture_is_rle(pic))
+    {
+        lcd_show_picture_rle(x, y, pic);
+        lcd_draw_done();
+        return;
+    }
+    if (lcd_picture_is_r444(pic))
+    {
+        img.data = pic + LCD_R444_HEADER_SIZE;
+        img.w = (pic[4] << 8) | pic[5];
+        img.h = (pic[6] << 8) | pic[7];
+        img.format = LCD_FORMAT_RGB444;
+    }
+    lcd_draw_image(x, y, &img);
+}
+
+/***************************************************************
+ * 函数名称: lcd_show_picture_indexed
+ * 说    明: 显示调色板索引格式的图片，逐行通过调色板展开后下发
+ * 参    数:
+ *       @x：指定图片的起始位置X坐标
+ *       @y：指定图片的起始位置Y坐标
+ *       @length：指定图片的长度
+ *       @width：指定图片的宽度
+ *       @bpp：每个像素的位数，可选：1、2、4
+ *       @palette：RGB565调色板，共1<<bpp个颜色
+ *       @pic：像素索引数据，高位在左，每行按字节对齐
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_show_picture_indexed(uint16_t x, uint16_t y, uint16_t length, uint16_t width,
+    uint8_t bpp, const uint16_t *palette, const uint8_t *pic)
+{
+    static uint8_t row[LCD_W * 2];
+    uint8_t pal[16][2];
+    uint16_t stride, r, c;
+    uint8_t mask, shift, idx;
+    uint8_t *dst;
+    const uint8_t *src;
+
+    if (((bpp != 1) && (bpp != 2) && (bpp != 4)) || (length > LCD_W))
+    {
+        return;
+    }
+
+    if (!lcd_window_begin(x, y, x+length-1, y+width-1))
+    {
+        return;
+    }
+
+    /* 调色板转换为屏幕字节序 */
+    mask = (1 << bpp) - 1;
+    for (idx = 0; idx <= mask; idx++)
+    {
+        pal[idx][0] = palette[idx] >> 8;
+        pal[idx][1] = palette[idx] & 0xFF;
+    }
+
+    stride = (length * bpp + 7) / 8;
+    for (r = 0; r < width; r++)
+    {
+        src = pic + (uint32_t)r * stride;
+        dst = row;
+        shift = 8;
+        for (c = 0; c < length; c++)
+        {
+            shift -= bpp;
+            idx = (*src >> shift) & mask;
+            *dst++ = pal[idx][0];
+            *dst++ = pal[idx][1];
+            if (shift == 0)
+            {
+                shift = 8;
+                src++;
+            }
+        }
+        lcd_stream(row, 0, length);
+    }
+    lcd_draw_done();
+}
+
+void lcd_show_text(int x, int y, char *str, int fc, int bc, int font_size, int mode)
+{
+    char *tmp_str = str;
+    int cur_x=x;
+    int cur_y=y;
+
+    while(*tmp_str != '\0')
+    {
+        if(tmp_str[0] > 0){
+            //英文或数字,只占一字节,直接传入对应字符
+            lcd_show_char(cur_x,cur_y,tmp_str[0], fc,bc,font_size, mode);
+            tmp_str++;
+            cur_x += font_size/2;//英文字宽度只有字号一半
+        }else{ 
+            //中文
+            uint8_t cn_str[4]={tmp_str[0],tmp_str[1],tmp_str[2],0};
+            lcd_show_chinese(cur_x,cur_y,cn_str, fc,bc,font_size, mode);
+            tmp_str +=3;
+            cur_x += font_size;
+        }
+        
+        if(cur_x > LCD_W-font_size)
+		{
+			cur_x=0;
+			cur_y+=font_size;
+		}
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_invalidate
+ * 说    明: 标记指定区域为脏区域，下一帧只刷新脏区域
+ * 参    数:
+ *       @xsta：指定区域的起始点X坐标
+ *       @ysta：指定区域的起始点Y坐标
+ *       @xend：指定区域的结束点X坐标(不包含)
+ *       @yend：指定区域的结束点Y坐标(不包含)
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_invalidate(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend)
+{
+    lcd_rect_t r, u;
+    uint8_t i, best;
+    uint32_t cost, best_cost;
+
+    if (xend > LCD_W)
+    {
+        xend = LCD_W;
+    }
+    if (yend > LCD_H)
+    {
+        yend = LCD_H;
+    }
+    if ((xsta >= xend) || (ysta >= yend))
+    {
+        return;
+    }
+
+    r.x1 = xsta;
+    r.y1 = ysta;
+    r.x2 = xend - 1;
+    r.y2 = yend - 1;
+
+    /* 挂起的帧已经画过的条带又有变化，继续时要从头绘制 */
+    if (ysta < g_frame_resume_y)
+    {
+        g_frame_resume_y = 0;
+    }
+
+merge:
+    /* 与已有的脏矩形合并，合并后的矩形可能又与其他矩形相交，需要重新检查 */
+    for (i = 0; i < g_dirty_num; i++)
+    {
+        if (lcd_rect_should_merge(&r, &g_dirty_rects[i]))
+        {
+            lcd_rect_union(&r, &g_dirty_rects[i], &r);
+            g_dirty_rects[i] = g_dirty_rects[--g_dirty_num];
+            goto merge;
+        }
+    }
+
+    if (g_dirty_num >= LCD_DIRTY_RECT_MAX)
+    {
+        /* 列表已满，合并到面积增长最小的矩形 */
+        best = 0;
+        best_cost = 0xFFFFFFFF;
+        for (i = 0; i < g_dirty_num; i++)
+        {
+            lcd_rect_union(&r, &g_dirty_rects[i], &u);
+            cost = lcd_rect_area(&u) - lcd_rect_area(&g_dirty_rects[i]);
+            if (cost < best_cost)
+            {
+                best_cost = cost;
+                best = i;
+            }
+        }
+        lcd_rect_union(&r, &g_dirty_rects[best], &r);
+        g_dirty_rects[best] = g_dirty_rects[--g_dirty_num];
+        goto merge;
+    }
+
+    g_dirty_rects[g_dirty_num++] = r;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_invalidate_all
+ * 说    明: 标记整屏为脏区域，下一帧整屏刷新
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_invalidate_all(void)
+{
+    g_dirty_rects[0].x1 = 0;
+    g_dirty_rects[0].y1 = 0;
+    g_dirty_rects[0].x2 = LCD_W - 1;
+    g_dirty_rects[0].y2 = LCD_H - 1;
+    g_dirty_num = 1;
+    g_frame_full = true;
+    g_frame_resume_y = 0;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_frame_begin
+ * 说    明: 开始一帧绘制，帧内的绘图操作只会刷新脏区域
+ * 参    数: 无
+ * 返 回 值: 有脏区域返回true，没有需要刷新的区域返回false
+ ***************************************************************/
+bool lcd_frame_begin(void)
+{
+    uint8_t i, n;
+
+    /* 关显示或睡眠时不下发，脏区域保留到唤醒后整屏重画 */
+    if ((g_power == LCD_POWER_OFF) || (g_power == LCD_POWER_SLEEP))
+    {
+        return false;
+    }
+
+    /* 局部显示时区域外的像素看不到，唤醒时会整屏重画 */
+    if (g_power == LCD_POWER_PARTIAL)
+    {
+        for (i = 0, n = 0; i < g_dirty_num; i++)
+        {
+            if (lcd_rect_intersect(&g_dirty_rects[i], &g_partial, &g_dirty_rects[n]))
+            {
+                n++;
+            }
+        }
+        g_dirty_num = n;
+    }
+
+    if (g_dirty_num == 0)
+    {
+        return false;
+    }
+
+    g_frame_active = true;
+    g_frame_calls_start = g_stats.total_hal_calls;
+    g_frame_bytes_start = g_stats.total_bytes;
+    return true;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_frame_end
+ * 说    明: 结束一帧绘制，清空脏区域
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_frame_end(void)
+{
+    lcd_pack_end();
+    g_band->frame_end = true;
+    lcd_bus_flush();
+    g_stats.frame_hal_calls = g_stats.total_hal_calls - g_frame_calls_start;
+    g_stats.frame_bytes = g_stats.total_bytes - g_frame_bytes_start;
+    g_frame_active = false;
+    g_render_active = false;
+    g_win_clipped = false;
+    g_dirty_num = 0;
+    g_frame_full = false;
+    g_frame_resume_y = 0;
+}
 
-    return 0;
+
+/***************************************************************
+ * 函数名称: lcd_frame_suspend
+ * 说    明: 挂起当前帧，已经写入的条带下发到屏幕，脏区域保留。
+ *           下一次lcd_frame_begin后从lcd_frame_resume_line继续绘制
+ * 参    数:
+ *       @y：还没有绘制的第一条条带的起始行
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_frame_suspend(uint16_t y)
+{
+    lcd_pack_end();
+    lcd_bus_flush();
+    g_frame_active = false;
+    g_render_active = false;
+    g_win_clipped = false;
+    g_frame_resume_y = y;
 }
 
 
 /***************************************************************
- * 函数名称: lcd_deinit
- * 说    明: Lcd注销
+ * 函数名称: lcd_frame_resume_line
+ * 说    明: 获取被挂起的帧继续绘制的起始行
  * 参    数: 无
- * 返 回 值: 返回0为成功，反之为失败
+ * 返 回 值: 条带的起始行，没有挂起的帧或挂起后上方又有变化时返回0
  ***************************************************************/
-unsigned int lcd_deinit()
+uint16_t lcd_frame_resume_line(void)
 {
-#if LCD_ENABLE_SPI
-    IoTSpiDeinit(LCD_SPI_BUS);
+    return g_frame_resume_y;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_render_begin
+ * 说    明: 开始绘制从第y行开始的一条条带，需要在帧内调用。之后的绘图
+ *           只写入条带缓冲区，范围是条带内各脏矩形的外接矩形
+ * 参    数:
+ *       @y：条带的起始行
+ * 返 回 值: 条带内有脏区域返回true，否则返回false且不需要调用lcd_render_end
+ ***************************************************************/
+bool lcd_render_begin(uint16_t y)
+{
+#if LCD_RENDER_BAND_LINES > 0
+    lcd_rect_t band;
+    lcd_rect_t part;
+    bool found = false;
+
+    if (!g_frame_active || (y >= LCD_H))
+    {
+        return false;
+    }
+
+    band.x1 = 0;
+    band.y1 = y;
+    band.x2 = LCD_W - 1;
+    band.y2 = (y + LCD_RENDER_BAND_LINES > LCD_H) ? (LCD_H - 1) : (y + LCD_RENDER_BAND_LINES - 1);
+    for (uint8_t i = 0; i < g_dirty_num; i++)
+    {
+        if (!lcd_rect_intersect(&g_dirty_rects[i], &band, &part))
+        {
+            continue;
+        }
+        if (!found)
+        {
+            g_render_rect = part;
+            found = true;
+        }
+        else
+        {
+            lcd_rect_union(&g_render_rect, &part, &g_render_rect);
+        }
+    }
+    if (!found)
+    {
+        return false;
+    }
+
+    g_render_y = y;
+    g_render_active = true;
+    return true;
 #else
-    IoTGpioDeinit(LCD_PIN_CS);
-    IoTGpioDeinit(LCD_PIN_CLK);
-    IoTGpioDeinit(LCD_PIN_MOSI);
+    return false;
+#endif
+}
+
+
+/* 把条带缓冲区中的一块区域下发到屏幕 */
+static void lcd_render_send(const lcd_rect_t *r)
+{
+#if LCD_RENDER_BAND_LINES > 0
+    if (!lcd_window_begin(r->x1, r->y1, r->x2, r->y2))
+    {
+        return;
+    }
+    for (uint16_t y = r->y1; y <= r->y2; y++)
+    {
+        lcd_stream(&g_render_buf[y - g_render_y][r->x1 * 2], 0, r->x2 - r->x1 + 1);
+    }
 #endif
-    IoTGpioDeinit(LCD_PIN_RES);
-    IoTGpioDeinit(LCD_PIN_DC);
-    
-    return 0;
 }
 
 
 /***************************************************************
- * 函数名称: lcd_fill
- * 说    明: 指定区域填充颜色
- * 参    数:
- *       @xsta：指定区域的起始点X坐标
- *       @ysta：指定区域的起始点Y坐标
- *       @xend：指定区域的结束点X坐标
- *       @yend：指定区域的结束点Y坐标
- *       @color：指定区域的颜色
+ * 函数名称: lcd_render_end
+ * 说    明: 结束当前条带，把条带内的脏区域下发到屏幕。外接矩形的传输量
+ *           不超过逐个脏矩形下发时整条只设置一次窗口
+ * 参    数: 无
  * 返 回 值: 无
  ***************************************************************/
-void lcd_fill(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend, uint16_t color)
+void lcd_render_end(void)
 {
-    uint16_t i, j;
+    lcd_rect_t band = g_render_rect;
+    lcd_rect_t part;
+    uint32_t parts_bytes = 0;
 
-    /* 设置显示范围 */
-    lcd_address_set(xsta, ysta, xend-1, yend-1);
-    /* 填充颜色 */
-    for (i = ysta; i < yend; i++)
+    if (!g_render_active)
+    {
+        return;
+    }
+    g_render_active = false;
+
+    /* 每个窗口的命令和地址共11个字节 */
+    band.y1 = g_render_y;
+    band.y2 = g_render_y + LCD_RENDER_BAND_LINES - 1;
+    for (uint8_t i = 0; i < g_dirty_num; i++)
+    {
+        if (lcd_rect_intersect(&g_dirty_rects[i], &band, &part))
+        {
+            parts_bytes += lcd_rect_area(&part) * 2 + 11;
+        }
+    }
+    if (lcd_rect_area(&g_render_rect) * 2 + 11 <= parts_bytes)
+    {
+        lcd_render_send(&g_render_rect);
+        return;
+    }
+    for (uint8_t i = 0; i < g_dirty_num; i++)
     {
-        for (j = xsta; j < xend; j++)
+        if (lcd_rect_intersect(&g_dirty_rects[i], &band, &part))
         {
-            lcd_wr_data(color);
+            lcd_render_send(&part);
         }
     }
 }
 
 
 /***************************************************************
- * 函数名称: lcd_draw_point
- * 说    明: 指定位置画一个点
- * 参    数:
- *       @x：指定点的X坐标
- *       @y：指定点的Y坐标
- *       @color：指定点的颜色
- * 返 回 值: 无
+ * 函数名称: lcd_render_is_active
+ * 说    明: 判断当前是否在绘制条带
+ * 参    数: 无
+ * 返 回 值: 在lcd_render_begin和lcd_render_end之间返回true
  ***************************************************************/
-void lcd_draw_point(uint16_t x, uint16_t y, uint16_t color)
+bool lcd_render_is_active(void)
 {
-    /* 设置光标位置 */
-    lcd_address_set(x, y, x, y);
-    lcd_wr_data(color);
+    return g_render_active;
 }
 
 
 /***************************************************************
- * 函数名称: lcd_draw_line
- * 说    明: 指定位置画一条线
+ * 函数名称: lcd_frame_is_full
+ * 说    明: 判断当前帧是否由lcd_invalidate_all引起的整屏刷新，
+ *           整屏刷新时屏幕原有内容不可信，静态内容也需要重画
+ * 参    数: 无
+ * 返 回 值: 整屏刷新返回true，帧外调用总是返回true
+ ***************************************************************/
+bool lcd_frame_is_full(void)
+{
+    return !g_frame_active || g_frame_full;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_frame_is_dirty
+ * 说    明: 判断指定区域在当前帧内是否需要刷新
  * 参    数:
- *       @x1：指定线的起始点X坐标
- *       @y1：指定线的起始点Y坐标
- *       @x2：指定线的结束点X坐标
- *       @y2：指定线的结束点Y坐标
- *       @color：指定点的颜色
- * 返 回 值: 无
+ *       @xsta：指定区域的起始点X坐标
+ *       @ysta：指定区域的起始点Y坐标
+ *       @xend：指定区域的结束点X坐标(不包含)
+ *       @yend：指定区域的结束点Y坐标(不包含)
+ * 返 回 值: 需要刷新返回true，帧外调用总是返回true
  ***************************************************************/
-void lcd_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color)
+bool lcd_frame_is_dirty(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend)
 {
-    uint16_t t; 
-    int xerr=0, yerr=0, delta_x, delta_y, distance;
-    int incx, incy, uRow, uCol;
+    lcd_rect_t r;
 
-    /* 计算坐标增量 */
-    delta_x = x2 - x1;
-    delta_y = y2 - y1;
-    /* 画线起点坐标 */
-    uRow = x1;
-    uCol = y1;
-    
-    if (delta_x > 0)
+    if (!g_frame_active)
     {
-        /* 设置单步方向 */
-        incx = 1;
+        return true;
     }
-    else if (delta_x == 0)
+    if ((xsta >= xend) || (ysta >= yend))
     {
-        /* 垂直线 */
-        incx = 0;
+        return false;
     }
-    else
+
+    r.x1 = xsta;
+    r.y1 = ysta;
+    r.x2 = xend - 1;
+    r.y2 = yend - 1;
+    if (g_render_active)
     {
-        incx = -1;
-        delta_x = -delta_x;
+        return lcd_rect_intersect(&r, &g_render_rect, NULL);
     }
-    
-    if (delta_y > 0)
+    for (uint8_t i = 0; i < g_dirty_num; i++)
     {
-        incy = 1;
+        if (lcd_rect_intersect(&r, &g_dirty_rects[i], NULL))
+        {
+            return true;
+        }
     }
-    else if (delta_y == 0)
+    return false;
+}
+
+
+/* 判断矩形a是否完全在矩形b内 */
+static bool lcd_rect_contains(const lcd_rect_t *b, const lcd_rect_t *a)
+{
+    return (a->x1 >= b->x1) && (a->x2 <= b->x2) && (a->y1 >= b->y1) && (a->y2 <= b->y2);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_frame_is_exclusive
+ * 说    明: 判断与指定区域相交的脏矩形是否都在区域内。成立时区域内的
+ *           控件可以在条带之外直接绘制，再用lcd_frame_exclude移除这些脏矩形
+ * 参    数:
+ *       @xsta：指定区域的起始点X坐标
+ *       @ysta：指定区域的起始点Y坐标
+ *       @xend：指定区域的结束点X坐标(不包含)
+ *       @yend：指定区域的结束点Y坐标(不包含)
+ * 返 回 值: 有相交的脏矩形且都在区域内返回true，帧外或条带内返回false
+ ***************************************************************/
+bool lcd_frame_is_exclusive(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend)
+{
+    lcd_rect_t r;
+    bool found = false;
+
+    if (!g_frame_active || g_render_active || (xsta >= xend) || (ysta >= yend))
     {
-        /* 水平线 */
-        incy = 0;
+        return false;
     }
-    else 
+
+    r.x1 = xsta;
+    r.y1 = ysta;
+    r.x2 = xend - 1;
+    r.y2 = yend - 1;
+    for (uint8_t i = 0; i < g_dirty_num; i++)
     {
-        incy = -1;
-        delta_y = -delta_y;
+        if (!lcd_rect_intersect(&r, &g_dirty_rects[i], NULL))
+        {
+            continue;
+        }
+        /* 伸出区域的脏矩形还要由条带绘制，区域内的像素会重复下发 */
+        if (!lcd_rect_contains(&r, &g_dirty_rects[i]))
+        {
+            return false;
+        }
+        found = true;
     }
-    
-    if (delta_x > delta_y)
+    return found;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_frame_exclude
+ * 说    明: 从当前帧的脏区域中移除完全在指定区域内的脏矩形
+ * 参    数:
+ *       @xsta：指定区域的起始点X坐标
+ *       @ysta：指定区域的起始点Y坐标
+ *       @xend：指定区域的结束点X坐标(不包含)
+ *       @yend：指定区域的结束点Y坐标(不包含)
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_frame_exclude(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend)
+{
+    lcd_rect_t r;
+    uint8_t i = 0;
+
+    if (!g_frame_active || (xsta >= xend) || (ysta >= yend))
     {
-        /* 选取基本增量坐标轴 */
-        distance = delta_x;
+        return;
     }
-    else
+
+    r.x1 = xsta;
+    r.y1 = ysta;
+    r.x2 = xend - 1;
+    r.y2 = yend - 1;
+    while (i < g_dirty_num)
     {
-        distance = delta_y;
+        if (lcd_rect_contains(&r, &g_dirty_rects[i]))
+        {
+            g_dirty_rects[i] = g_dirty_rects[--g_dirty_num];
+        }
+        else
+        {
+            i++;
+        }
     }
-    
-    for (t = 0; t < distance+1; t++)
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_set_window
+ * 说    明: 设置绘图窗口，之后用lcd_write_pixels/lcd_fill_span写入像素
+ * 参    数:
+ *       @x1：窗口的起始点X坐标
+ *       @y1：窗口的起始点Y坐标
+ *       @x2：窗口的结束点X坐标
+ *       @y2：窗口的结束点Y坐标
+ * 返 回 值: 窗口内有像素需要下发返回true，整个窗口被裁剪返回false
+ ***************************************************************/
+bool lcd_set_window(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+    return lcd_window_begin(x1, y1, x2, y2);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_write_pixels
+ * 说    明: 按窗口扫描顺序批量写入像素
+ * 参    数:
+ *       @pixels：RGB565像素数组
+ *       @num：像素个数
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_write_pixels(const uint16_t *pixels, uint32_t num)
+{
+    uint8_t buf[64 * 2];
+    uint32_t i, run;
+
+    while (num > 0)
     {
-        /* 画点 */
-        lcd_draw_point(uRow, uCol, color);
-        xerr += delta_x;
-        yerr += delta_y;
-        if (xerr > distance)
+        run = (num > 64) ? 64 : num;
+        for (i = 0; i < run; i++)
         {
-            xerr -= distance;
-            uRow += incx;
+            buf[i * 2] = pixels[i] >> 8;
+            buf[i * 2 + 1] = pixels[i] & 0xFF;
         }
-        if (yerr > distance)
+        lcd_stream(buf, 0, run);
+        pixels += run;
+        num -= run;
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_fill_span
+ * 说    明: 按窗口扫描顺序写入num个相同颜色的像素
+ * 参    数:
+ *       @color：像素颜色
+ *       @num：像素个数
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_span(uint16_t color, uint32_t num)
+{
+    lcd_stream(NULL, color, num);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_get_stats
+ * 说    明: 获取总线统计，帧统计为上一次lcd_frame_end时的结果
+ * 参    数:
+ *       @stats：输出统计数据
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_get_stats(lcd_stats_t *stats)
+{
+    *stats = g_stats;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_flush
+ * 说    明: 提交缓冲区中尚未下发的数据，不等待下发完成
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_flush(void)
+{
+    lcd_bus_flush();
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_flush_wait
+ * 说    明: 提交缓冲区并等待已提交的数据全部下发到屏幕
+ * 参    数:
+ *       @timeout_ms：等待的超时时间，LOS_WAIT_FOREVER为一直等待
+ * 返 回 值: 全部下发完成返回true，超时返回false
+ ***************************************************************/
+bool lcd_flush_wait(uint32_t timeout_ms)
+{
+    lcd_bus_flush();
+
+#if LCD_ENABLE_ASYNC_FLUSH
+    uint32_t timeout;
+    uint8_t taken = 0;
+    bool done = true;
+
+    if (!g_flush_task_ready)
+    {
+        return true;
+    }
+
+    timeout = (timeout_ms == LOS_WAIT_FOREVER) ? LOS_WAIT_FOREVER : LOS_MS2Tick(timeout_ms);
+    /* 拿到全部空闲缓冲区说明刷新任务已经处理完所有提交 */
+    while (taken < (LCD_BAND_NUM - 1))
+    {
+        if (LOS_SemPend(g_flush_free_sem, timeout) != LOS_OK)
         {
-            yerr -= distance;
-            uCol += incy;
+            done = false;
+            break;
         }
+        taken++;
+    }
+    while (taken > 0)
+    {
+        LOS_SemPost(g_flush_free_sem);
+        taken--;
+    }
+    return done;
+#else
+    return true;
+#endif
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_shadow_set
+ * 说    明: 设置影子缓冲区对应的屏幕起始行
+ * 参    数:
+ *       @y：影子缓冲区对应的起始行
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_shadow_set(uint16_t y)
+{
+#if LCD_SHADOW_LINES > 0
+    if (y + LCD_SHADOW_LINES > LCD_H)
+    {
+        y = LCD_H - LCD_SHADOW_LINES;
     }
+    g_shadow_y = y;
+    memset(g_shadow_valid, 0, sizeof(g_shadow_valid));
+#else
+    (void)y;
+#endif
 }
 
 
 /***************************************************************
- * 函数名称: lcd_draw_rectangle
- * 说    明: 指定位置画矩形
+ * 函数名称: lcd_scroll_define
+ * 说    明: 定义硬件滚动区域(VSCRDEF)
  * 参    数:
- *       @x1：指定矩形的起始点X坐标
- *       @y1：指定矩形的起始点Y坐标
- *       @x2：指定矩形的结束点X坐标
- *       @y2：指定矩形的结束点Y坐标
- *       @color：指定点的颜色
- * 返 回 值: 无
+ *       @tfa：顶部固定区域行数
+ *       @vsa：滚动区域行数
+ *       @bfa：底部固定区域行数
+ * 返 回 值: 参数正确返回true
  ***************************************************************/
-void lcd_draw_rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,uint16_t color)
+bool lcd_scroll_define(uint16_t tfa, uint16_t vsa, uint16_t bfa)
 {
-    lcd_draw_line(x1, y1, x2, y1, color);
-    lcd_draw_line(x1, y1, x1, y2, color);
-    lcd_draw_line(x1, y2, x2, y2, color);
-    lcd_draw_line(x2, y1, x2, y2, color);
+    /* ST7789的显存固定为320行 */
+    if ((uint32_t)tfa + vsa + bfa != 320)
+    {
+        return false;
+    }
+
+    lcd_wr_reg(0x33);
+    lcd_wr_data(tfa);
+    lcd_wr_data(vsa);
+    lcd_wr_data(bfa);
+    lcd_draw_done();
+    return true;
 }
 
 
 /***************************************************************
- * 函数名称: lcd_draw_circle
- * 说    明: 指定位置画圆
+ * 函数名称: lcd_scroll_start
+ * 说    明: 设置滚动区域第一行显示的显存行(VSCSAD)
  * 参    数:
- *       @x0：指定圆的中心点X坐标
- *       @y0：指定圆的中心点Y坐标
- *       @r：指定圆的半径
- *       @color：指定点的颜色
+ *       @vsp：显存行号
  * 返 回 值: 无
  ***************************************************************/
-void lcd_draw_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color)
+void lcd_scroll_start(uint16_t vsp)
 {
-    int a, b;
-    
-    a = 0;
-    b = r;
-    
-    while (a <= b)
-    {
-        lcd_draw_point(x0-b, y0-a, color);
-        lcd_draw_point(x0+b, y0-a, color);
-        lcd_draw_point(x0-a, y0+b, color);
-        lcd_draw_point(x0-a, y0-b, color);
-        lcd_draw_point(x0+b, y0+a, color);
-        lcd_draw_point(x0+a, y0-b, color);
-        lcd_draw_point(x0+a, y0+b, color);
-        lcd_draw_point(x0-b, y0+a, color);
-        a++;
-        /* 判断要画的点是否过远 */
-        if ((a*a+b*b) > (r*r))
-        {
-            b--;
-        }
-    }
+    lcd_wr_reg(0x37);
+    lcd_wr_data(vsp);
+    lcd_draw_done();
 }
-/* 三角形*/
-void lcd_draw_triangle(uint16_t x0, uint16_t y0,uint16_t x1, uint16_t y1,uint16_t x2, uint16_t y2,  uint16_t color){
-
-    lcd_draw_line(x0, y0, x1, y1, color);
-    lcd_draw_line(x1, y1, x2, y2, color);
-    lcd_draw_line(x2, y2, x0, y0, color);
 
 
+/***************************************************************
+ * 函数名称: lcd_scroll_stop
+ * 说    明: 退出滚动模式(NORON)
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_scroll_stop(void)
+{
+    lcd_wr_reg(0x13);
+    lcd_draw_done();
 }
 
 
 /***************************************************************
- * 函数名称: lcd_show_chinese
- * 说    明: 显示汉字串
+ * 函数名称: lcd_set_partial_area
+ * 说    明: 设置局部显示区域，沿屏幕原生的行方向，横屏时是一段列
  * 参    数:
- *       @x：指定汉字串的起始位置X坐标
- *       @y：指定汉字串的起始位置X坐标
- *       @s：指定汉字串（该汉字串为utf-8）
- *       @fc: 字的颜色
- *       @bc: 字的背景色
- *       @sizey: 字号，可选：12、16、24、32
- *       @mode: 0为非叠加模式；1为叠加模式
+ *       @start：起始行(竖屏)或起始列(横屏)
+ *       @end：结束行(竖屏)或结束列(横屏)，包含
  * 返 回 值: 无
  ***************************************************************/
-void lcd_show_chinese(uint16_t x, uint16_t y, uint8_t *s, 
-    uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
+void lcd_set_partial_area(uint16_t start, uint16_t end)
 {
-    // uint8_t buffer[128];
-    // uint32_t buffer_len = 0;
-    // uint32_t len = strlen(s);
-
-    // memset(buffer, 0, sizeof(buffer));
-    // /* utf8格式汉字转化为ascii格式 */
-    // chinese_utf8_to_ascii(s, strlen(s), buffer, &buffer_len);
+    uint16_t t;
 
-    for (uint32_t i = 0; i < strlen(s); i += 3, x += sizey)
+    if (start > end)
     {
-        if (sizey == 12)
-        {
-            lcd_show_chinese_12x12(x, y, &s[i], fc, bc, sizey, mode);
-        }
-        else if (sizey == 16)
-        {
-            lcd_show_chinese_16x16(x, y, &s[i], fc, bc, sizey, mode);
-        }
-        else if (sizey == 24)
-        {
-            lcd_show_chinese_24x24(x, y, &s[i], fc, bc, sizey, mode);
-        }
-        else if (sizey == 32)
-        {
-            lcd_show_chinese_32x32(x, y, &s[i], fc, bc, sizey, mode);
-        }
-        else
-        {
-            return;
-        }
+        t = start;
+        start = end;
+        end = t;
     }
-
+#if ((USE_HORIZONTAL == 0) || (USE_HORIZONTAL == 1))
+    end = (end >= LCD_H) ? (LCD_H - 1) : end;
+    g_partial.x1 = 0;
+    g_partial.y1 = start;
+    g_partial.x2 = LCD_W - 1;
+    g_partial.y2 = end;
+#else
+    end = (end >= LCD_W) ? (LCD_W - 1) : end;
+    g_partial.x1 = start;
+    g_partial.y1 = 0;
+    g_partial.x2 = end;
+    g_partial.y2 = LCD_H - 1;
+#endif
 }
 
 
+/* 局部显示区域换算成屏幕原生的行地址并下发PTLAR，MY置位(USE_HORIZONTAL为1或3)时行地址反向 */
+static void lcd_partial_area_send(void)
+{
+    uint16_t start, end, t;
+
+#if ((USE_HORIZONTAL == 0) || (USE_HORIZONTAL == 1))
+    start = g_partial.y1;
+    end = g_partial.y2;
+#else
+    start = g_partial.x1;
+    end = g_partial.x2;
+#endif
+#if (USE_HORIZONTAL == 1) || (USE_HORIZONTAL == 3)
+    t = start;
+    start = 319 - end;
+    end = 319 - t;
+#endif
+    lcd_wr_reg(0x30);
+    lcd_wr_data(start);
+    lcd_wr_data(end);
+}
+
 
 /***************************************************************
- * 函数名称: lcd_show_char
- * 说    明: 显示一个字符
+ * 函数名称: lcd_set_power
+ * 说    明: 切换屏幕电源状态，需要在帧外调用。
+ *           从关显示、睡眠或局部显示回到正常显示时整屏重画
  * 参    数:
- *       @x：指定字符的起始位置X坐标
- *       @y：指定字串的起始位置X坐标
- *       @s：指定字串
- *       @fc: 字的颜色
- *       @bc: 字的背景色
- *       @sizey: 字号，可选：16、24、32
- *       @mode: 0为非叠加模式；1为叠加模式
+ *       @state：LCD_POWER_ON正常显示，LCD_POWER_PARTIAL只显示局部区域，
+ *               LCD_POWER_OFF关显示(DISPOFF)，LCD_POWER_SLEEP睡眠(SLPIN)
  * 返 回 值: 无
  ***************************************************************/
-void lcd_show_char(uint16_t x, uint16_t y, uint8_t num, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
+void lcd_set_power(lcd_power_t state)
 {
-    uint8_t temp,sizex,t,m = 0;
-    uint16_t i;
-    uint16_t TypefaceNum;//一个字符所占字节大小
-    uint16_t x0 = x;
-    
-    sizex = sizey/2;
-    TypefaceNum = (sizex/8 + ((sizex%8)?1:0)) * sizey;
+    lcd_power_t prev = g_power;
+    UINT64 elapsed;
 
-    /* 得到偏移后的值 */
-    num = num-' ';
-    /* 设置光标位置 */
-    lcd_address_set(x, y, x+sizex-1, y+sizey-1);
-    
-    for (i = 0; i < TypefaceNum; i++)
-    { 
-        if (sizey == 12)
-        {
-            /* 调用6x12字体 */
-            temp = ascii_1206[num][i];
-        }
-        else if (sizey == 16)
-        {
-            /* 调用8x16字体 */
-            temp = ascii_1608[num][i];
-        }
-        else if (sizey == 24)
-        {
-            /* 调用12x24字体 */
-            temp = ascii_2412[num][i];
-        }
-        else if (sizey == 32)
+    if (state == prev)
+    {
+        return;
+    }
+
+    if (prev == LCD_POWER_SLEEP)
+    {
+        /* SLPIN之后120ms内不能SLPOUT，SLPOUT之后5ms才能发下一条命令 */
+        elapsed = LOS_TickCountGet() - g_sleep_in_tick;
+        if (elapsed < LOS_MS2Tick(120))
         {
-            /* 调用16x32字体 */
-            temp = ascii_3216[num][i];
+            LOS_Msleep(120 - elapsed * 1000 / LOSCFG_BASE_CORE_TICK_PER_SECOND);
         }
-        else
-        {
+        lcd_wr_reg(0x11);
+        lcd_bus_flush();
+        lcd_flush_wait(LOS_WAIT_FOREVER);
+        LOS_Msleep(5);
+    }
+
+    switch (state)
+    {
+        case LCD_POWER_ON:
+            /* NORON同时退出局部显示 */
+            lcd_wr_reg(0x13);
+            lcd_wr_reg(0x29);
+            break;
+        case LCD_POWER_PARTIAL:
+            lcd_partial_area_send();
+            lcd_wr_reg(0x12);
+            lcd_wr_reg(0x29);
+            break;
+        case LCD_POWER_OFF:
+            lcd_wr_reg(0x28);
+            break;
+        case LCD_POWER_SLEEP:
+            lcd_wr_reg(0x28);
+            lcd_wr_reg(0x10);
+            break;
+        default:
             return;
-        }
-        
-        for (t = 0; t < 8; t++)
-        {
-            if (!mode)
-            {/* 非叠加模式 */
-                if (temp & (0x01 << t))
-                {
-                    lcd_wr_data(fc);
-                }
-                else
-                {
-                    lcd_wr_data(bc);
-                }
-                
-                m++;
-                if (m%sizex == 0)
-                {
-                    m = 0;
-                    break;
-                }
-            }
-            else
-            {/* 叠加模式 */
-                if (temp & (0x01 << t))
-                {
-                    /* 画一个点 */
-                    lcd_draw_point(x, y, fc);
-                }
-                
-                x++;
-                if ((x - x0) == sizex)
-                {
-                    x = x0;
-                    y++;
-                    break;
-                }
-            }
-        }
-    }   	 	  
+    }
+    lcd_bus_flush();
+    if (state == LCD_POWER_SLEEP)
+    {
+        /* 刷新任务真正发出SLPIN后再记时间，唤醒时按这个时间等满120ms */
+        lcd_flush_wait(LOS_WAIT_FOREVER);
+        g_sleep_in_tick = LOS_TickCountGet();
+    }
+    g_power = state;
+
+    /* 关显示和睡眠期间没有下发，局部显示期间区域外没有下发 */
+    if ((prev == LCD_POWER_OFF) || (prev == LCD_POWER_SLEEP) ||
+        ((prev == LCD_POWER_PARTIAL) && (state == LCD_POWER_ON)))
+    {
+        lcd_invalidate_all();
+    }
 }
 
 
 /***************************************************************
- * 函数名称: lcd_show_string
- * 说    明: 显示字符串
- * 参    数:
- *       @x：指定字符的起始位置X坐标
- *       @y：指定字串的起始位置X坐标
- *       @s：指定字串
- *       @fc: 字的颜色
- *       @bc: 字的背景色
- *       @sizey: 字号，可选：16、24、32
- *       @mode: 0为非叠加模式；1为叠加模式
- * 返 回 值: 无
+ * 函数名称: lcd_get_power
+ * 说    明: 获取屏幕电源状态
+ * 参    数: 无
+ * 返 回 值: 当前电源状态
  ***************************************************************/
-void lcd_show_string(uint16_t x, uint16_t y, const uint8_t *p, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
-{         
-    while (*p != '\0')
-    {       
-        lcd_show_char(x, y, *p, fc, bc, sizey, mode);
-        x += (sizey / 2);
-        p++;
-    }  
+lcd_power_t lcd_get_power(void)
+{
+    return g_power;
 }
 
 
 /***************************************************************
- * 函数名称: lcd_show_int_num
- * 说    明: 显示整数变量
+ * 函数名称: lcd_set_pixel_format
+ * 说    明: 切换接口像素格式(COLMOD)，需要在帧外调用。绘图接口的颜色
+ *           仍然是RGB565，RGB444模式下发送时只保留各分量的高4位
  * 参    数:
- *       @x：指定整数变量的起始位置X坐标
- *       @y：指定整数变量的起始位置X坐标
- *       @num：指定整数变量
- *       @fc: 整数变量的颜色
- *       @bc: 整数变量的背景色
- *       @sizey: 字号，可选：16、24、32
+ *       @format：LCD_FORMAT_RGB565或LCD_FORMAT_RGB444
  * 返 回 值: 无
  ***************************************************************/
-void lcd_show_int_num(uint16_t x, uint16_t y, uint16_t num, uint8_t len, uint16_t fc, uint16_t bc, uint8_t sizey)
+void lcd_set_pixel_format(lcd_pixel_format_t format)
 {
-    uint8_t t,temp;
-    uint8_t enshow=0;
-    uint8_t sizex = sizey / 2;
-    
-    for (t=0; t<len; t++)
+    if ((format != LCD_FORMAT_RGB565) && (format != LCD_FORMAT_RGB444))
     {
-        temp = (num/mypow(10,len-t-1)) % 10;
-        if (enshow==0 && t<(len-1))
-        {
-            if (temp == 0)
-            {
-                lcd_show_char(x+t*sizex, y, ' ', fc, bc, sizey, 0);
-                continue;
-            }
-            else
-            {
-                enshow = 1;
-            }
-        }
-        lcd_show_char(x+t*sizex, y, temp+48, fc, bc, sizey, 0);
+        return;
     }
-} 
+    lcd_wr_reg(0x3A);
+    lcd_wr_data8(format);
+    g_format = format;
+    lcd_draw_done();
+}
 
 
 /***************************************************************
- * 函数名称: lcd_show_float_num1
- * 说    明: 显示两位小数变量
- * 参    数:
- *       @x：指定浮点变量的起始位置X坐标
- *       @y：指定浮点变量的起始位置X坐标
- *       @num：指定浮点变量
- *       @fc: 浮点变量的颜色
- *       @bc: 浮点变量的背景色
- *       @sizey: 字号，可选：16、24、32
- * 返 回 值: 无
+ * 函数名称: lcd_get_pixel_format
+ * 说    明: 获取接口像素格式
+ * 参    数: 无
+ * 返 回 值: 当前像素格式
  ***************************************************************/
-void lcd_show_float_num1(uint16_t x, uint16_t y,float num,uint8_t len,uint16_t fc,uint16_t bc,uint8_t sizey)
+lcd_pixel_format_t lcd_get_pixel_format(void)
 {
-    uint8_t t,temp, sizex;
-    uint16_t num1;
-    
-    sizex = sizey / 2;
-    num1 = num * 100;
-    for (t=0; t<len; t++)
-    {
-        temp = (num1/mypow(10,len-t-1)) % 10;
-        if (t == (len-2))
-        {
-            lcd_show_char(x+(len-2)*sizex, y, '.', fc, bc, sizey, 0);
-            t++;
-            len += 1;
-        }
-        lcd_show_char(x+t*sizex, y, temp+48, fc, bc, sizey, 0);
-    }
+    return g_format;
 }
 
+
 /***************************************************************
- * 函数名称: lcd_show_picture
- * 说    明: 显示图片
+ * 函数名称: lcd_benchmark_fill
+ * 说    明: 用指定像素格式整屏填充若干次并计时，需要在帧外调用，
+ *           结束后恢复原来的像素格式并标记整屏刷新
  * 参    数:
- *       @x：指定图片的起始位置X坐标
- *       @y：指定图片的起始位置X坐标
- *       @length：指定图片的长度
- *       @width：指定图片的宽度
- *       @pic：指定图片的内容
- * 返 回 值: 无
+ *       @format：测试的像素格式
+ *       @rounds：整屏填充次数
+ * 返 回 值: 总耗时(ms)，包括等待最后一次下发完成
  ***************************************************************/
-void lcd_show_picture(uint16_t x, uint16_t y, uint16_t length, uint16_t width, const uint8_t *pic)
+uint32_t lcd_benchmark_fill(lcd_pixel_format_t format, uint16_t rounds)
 {
-    uint16_t i,j;
-    uint32_t k = 0;
-    
-    lcd_address_set(x, y, x+length-1, y+width-1);
-    for (i=0; i<length; i++)
+    lcd_pixel_format_t prev = g_format;
+    UINT64 start;
+    UINT64 elapsed;
+
+    lcd_set_pixel_format(format);
+    lcd_flush_wait(LOS_WAIT_FOREVER);
+
+    start = LOS_TickCountGet();
+    for (uint16_t i = 0; i < rounds; i++)
     {
-        for (j=0; j<width; j++)
-        {
-            lcd_wr_data8(pic[k*2]);
-            lcd_wr_data8(pic[k*2+1]);
-            k++;
-        }
+        lcd_fill(0, 0, LCD_W, LCD_H, (i & 1) ? LCD_WHITE : LCD_BLACK);
     }
+    lcd_flush_wait(LOS_WAIT_FOREVER);
+    elapsed = LOS_TickCountGet() - start;
+
+    lcd_set_pixel_format(prev);
+    lcd_invalidate_all();
+    return (uint32_t)(elapsed * 1000 / LOSCFG_BASE_CORE_TICK_PER_SECOND);
 }
 
-void lcd_show_text(int x, int y, char *str, int fc, int bc, int font_size, int mode)
+
+/***************************************************************
+ * 函数名称: lcd_font_find
+ * 说    明: 在汉字字模索引表中二分查找指定码点和字号的字模
+ * 参    数:
+ *       @codepoint：Unicode码点
+ *       @sizey：字号，可选：12、16、24、32
+ * 返 回 值: 字模数据，未找到返回NULL
+ ***************************************************************/
+const uint8_t *lcd_font_find(uint32_t codepoint, uint8_t sizey)
 {
-    char *tmp_str = str;
-    int cur_x=x;
-    int cur_y=y;
+    uint32_t key = (codepoint << 8) | sizey;
+    uint32_t lo = 0;
+    uint32_t hi = sizeof(g_font_index) / sizeof(g_font_index[0]);
+    uint32_t mid;
 
-    while(*tmp_str != '\0')
+    while (lo < hi)
     {
-        if(tmp_str[0] > 0){
-            //英文或数字,只占一字节,直接传入对应字符
-            lcd_show_char(cur_x,cur_y,tmp_str[0], fc,bc,font_size, mode);
-            tmp_str++;
-            cur_x += font_size/2;//英文字宽度只有字号一半
-        }else{ 
-            //中文
-            uint8_t cn_str[4]={tmp_str[0],tmp_str[1],tmp_str[2],0};
-            lcd_show_chinese(cur_x,cur_y,cn_str, fc,bc,font_size, mode);
-            tmp_str +=3;
-            cur_x += font_size;
+        mid = (lo + hi) / 2;
+        if (g_font_index[mid].key == key)
+        {
+            return g_font_index[mid].msk;
+        }
+        if (g_font_index[mid].key < key)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
         }
-        
-        if(cur_x > LCD_W-font_size)
-		{
-			cur_x=0;
-			cur_y+=font_size;
-		}
     }
+    return NULL;
 }
@@ -12,6451 +12,1840 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+/* 本文件由 tools/asset_compiler.py 根据 assets/assets.json 生成，请勿手工修改 */
 #include "picture.h"
-const unsigned char gImage_HAAVK[5008] = { 0X10,0X10,0X00,0X32,0X00,0X32,0X01,0X1B,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X00,0X08,0X61,0X6B,0X6D,0X29,0X65,0X00,0X00,0X08,0X41,0X00,0X00,0X00,0X00,
-0X08,0X61,0X00,0X00,0X00,0X00,0X08,0X61,0X00,0X00,0X00,0X00,0X08,0X41,0X00,0X00,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X08,0X41,0X00,0X00,0X84,0X10,0XC6,0X18,0X29,0X65,0X00,0X20,
-0X00,0X00,0X10,0X82,0X00,0X00,0X08,0X61,0X08,0X61,0X00,0X00,0X00,0X00,0X08,0X41,
-0X08,0X41,0X08,0X41,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X08,0X61,0X00,0X00,0X8C,0X71,0XE7,0X3C,
-0XBD,0XF7,0X31,0XA6,0X08,0X41,0X00,0X00,0X00,0X20,0X08,0X61,0X00,0X00,0X00,0X00,
-0X10,0X82,0X08,0X41,0X00,0X00,0X08,0X41,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X00,0X10,0XA2,
-0X6B,0X6D,0XE7,0X3C,0XEF,0X7D,0XB5,0XB6,0X52,0X8A,0X00,0X00,0X00,0X00,0X00,0X20,
-0X00,0X00,0X00,0X00,0X08,0X61,0X00,0X20,0X00,0X00,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X00,0X10,0X82,0X7B,0XEF,0XEF,0X7D,0XE7,0X1C,0XEF,0X7D,0XCE,0X59,0X42,0X28,
-0X00,0X00,0X00,0X00,0X10,0X82,0X08,0X41,0X00,0X00,0X00,0X00,0X08,0X61,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X00,0X00,0X20,0X84,0X30,0XE7,0X1C,0XFF,0XDF,0XE7,0X3C,
-0XFF,0XDF,0XBD,0XD7,0X4A,0X69,0X00,0X20,0X00,0X00,0X08,0X41,0X00,0X20,0X00,0X00,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X00,0X10,0XA2,0X6B,0X4D,0XF7,0X9E,
-0XF7,0X9E,0XF7,0XBE,0XE7,0X1C,0XF7,0XBE,0XC6,0X38,0X4A,0X69,0X00,0X00,0X00,0X20,
-0X10,0XA2,0X00,0X00,0X00,0X00,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X08,0X41,0X00,0X00,
-0X8C,0X71,0XF7,0X9E,0XEF,0X7D,0XE7,0X1C,0XFF,0XDF,0XEF,0X5D,0XFF,0XDF,0XC6,0X18,
-0X52,0X8A,0X00,0X00,0X00,0X00,0X08,0X41,0X00,0X20,0X08,0X41,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X00,0X10,0XA2,0X00,0X00,0X08,0X41,0X08,0X61,0X00,0X00,0X10,0XA2,0X00,0X00,
-0X08,0X41,0X00,0X20,0X7B,0XCF,0XF7,0XBE,0XEF,0X7D,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,
-0XFF,0XDF,0XEF,0X7D,0XA5,0X14,0X00,0X00,0X08,0X61,0X00,0X00,0X00,0X20,0X00,0X00,
-0X10,0X82,0X00,0X00,0X00,0X00,0X00,0X20,0X00,0X20,0X00,0X00,0X00,0X20,0X08,0X41,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X10,0X82,0X00,0X00,0X08,0X41,0X08,0X41,0X00,0X20,0X00,0X00,
-0X00,0X00,0X10,0X82,0X00,0X20,0X00,0X20,0X7B,0XCF,0XF7,0XBE,0XEF,0X7D,0XF7,0X9E,
-0XF7,0X9E,0XF7,0X9E,0XEF,0X7D,0XF7,0X9E,0XB5,0XB6,0X00,0X20,0X00,0X20,0X00,0X00,
-0X08,0X61,0X08,0X41,0X00,0X00,0X08,0X41,0X08,0X61,0X00,0X20,0X08,0X41,0X08,0X41,
-0X00,0X00,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X08,0X61,0X00,0X00,0X00,0X20,0X00,0X20,
-0X00,0X00,0X10,0X82,0X00,0X00,0X08,0X41,0X00,0X20,0X00,0X20,0X7B,0XCF,0XF7,0XBE,
-0XEF,0X7D,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XEF,0X5D,0XF7,0XBE,0XC6,0X38,0X08,0X41,
-0X00,0X00,0X00,0X20,0X08,0X41,0X00,0X00,0X08,0X41,0X08,0X61,0X00,0X00,0X00,0X00,
-0X10,0X82,0X00,0X20,0X00,0X00,0X08,0X61,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X00,0X08,0X41,
-0X00,0X00,0X08,0X61,0X00,0X00,0X00,0X20,0X00,0X20,0X00,0X00,0X00,0X20,0X00,0X20,
-0X7B,0XCF,0XF7,0XBE,0XEF,0X7D,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0XBE,0XEF,0X7D,
-0XC6,0X38,0X08,0X41,0X08,0X41,0X08,0X61,0X00,0X00,0X00,0X00,0X08,0X61,0X00,0X20,
-0X00,0X00,0X00,0X20,0X00,0X20,0X00,0X00,0X00,0X20,0X08,0X41,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X08,0X61,0X08,0X41,0X08,0X61,0X00,0X00,0X08,0X41,0X00,0X00,0X08,0X41,
-0X00,0X20,0X00,0X20,0X7B,0XCF,0XF7,0XBE,0XEF,0X7D,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,
-0XFF,0XFF,0XEF,0X5D,0XC6,0X38,0X08,0X41,0X08,0X41,0X08,0X41,0X00,0X00,0X39,0XC7,
-0X08,0X41,0X00,0X00,0X10,0X82,0X08,0X61,0X00,0X00,0X00,0X20,0X10,0XA2,0X00,0X00,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X08,0X41,0X00,0X20,0X08,0X61,0X00,0X00,0X18,0XE3,0X7B,0XEF,
-0X10,0X82,0X08,0X41,0X00,0X20,0X00,0X20,0X7B,0XCF,0XF7,0XBE,0XEF,0X7D,0XF7,0XBE,
-0XF7,0XBE,0XF7,0X9E,0XFF,0XDF,0XEF,0X7D,0XD6,0X9A,0X08,0X41,0X08,0X41,0X00,0X00,
-0X08,0X41,0X8C,0X51,0X63,0X0C,0X08,0X61,0X00,0X00,0X08,0X41,0X00,0X20,0X00,0X20,
-0X08,0X61,0X00,0X00,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X00,0X08,0X41,0X10,0XA2,
-0X84,0X30,0XE7,0X3C,0X29,0X65,0X00,0X00,0X00,0X20,0X00,0X00,0X7B,0XCF,0XF7,0XBE,
-0XEF,0X7D,0XF7,0XBE,0XF7,0XBE,0XF7,0XBE,0XF7,0X9E,0XF7,0XBE,0XDE,0XDB,0X00,0X20,
-0X08,0X41,0X00,0X00,0X00,0X20,0XB5,0X96,0XDE,0XDB,0X63,0X2C,0X08,0X41,0X00,0X00,
-0X10,0X82,0X00,0X20,0X00,0X00,0X10,0X82,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X08,0X41,0X00,0X00,
-0X08,0X41,0X84,0X10,0XFF,0XDF,0XE7,0X3C,0X18,0XE3,0X00,0X20,0X00,0X20,0X00,0X00,
-0X7B,0XCF,0XF7,0XBE,0XEF,0X7D,0XF7,0XBE,0XF7,0XBE,0XF7,0XBE,0XEF,0X7D,0XFF,0XDF,
-0XDE,0XFB,0X00,0X00,0X08,0X61,0X00,0X20,0X00,0X00,0XA5,0X34,0XFF,0XDF,0XDE,0XDB,
-0X63,0X2C,0X00,0X20,0X00,0X20,0X08,0X41,0X00,0X00,0X08,0X41,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X08,0X41,0X00,0X00,0X00,0X00,0X08,0X41,0X08,0X41,0X00,0X00,0X08,0X41,
-0X00,0X00,0X08,0X41,0X7B,0XCF,0XF7,0X9E,0XF7,0XBE,0XE7,0X3C,0X29,0X65,0X08,0X41,
-0X00,0X00,0X08,0X41,0X73,0X8E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0XBE,0XF7,0X9E,
-0XF7,0X9E,0XF7,0XBE,0XDE,0XDB,0X10,0X82,0X00,0X20,0X08,0X41,0X00,0X00,0X9C,0XF3,
-0XEF,0X7D,0XFF,0XDF,0XE7,0X3C,0X63,0X2C,0X00,0X00,0X00,0X20,0X08,0X41,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X00,0X00,0X20,0X08,0X41,0X00,0X20,
-0X00,0X20,0X00,0X20,0X08,0X41,0X00,0X00,0X00,0X20,0X08,0X61,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X08,0X41,0X7B,0XCF,0XE7,0X1C,0XFF,0XDF,0XEF,0X5D,0XF7,0X9E,
-0X31,0XA6,0X00,0X00,0X00,0X00,0X08,0X41,0X73,0X8E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,
-0XF7,0XBE,0XF7,0X9E,0XF7,0X9E,0XF7,0XBE,0XDE,0XFB,0X10,0X82,0X00,0X20,0X08,0X41,
-0X00,0X00,0X9C,0XD3,0XEF,0X7D,0XFF,0XDF,0XF7,0X9E,0XE7,0X1C,0X63,0X2C,0X00,0X00,
-0X10,0X82,0X00,0X00,0X00,0X00,0X10,0X82,0X10,0X82,0X00,0X00,0X00,0X00,0X00,0X20,
-0X00,0X00,0X00,0X20,0X00,0X20,0X00,0X20,0X08,0X41,0X08,0X41,0X00,0X00,0X00,0X00,
-0X08,0X41,0X08,0X41,0X00,0X20,0X10,0X82,0X73,0XAE,0XDE,0XFB,0XFF,0XFF,0XEF,0X7D,
-0XEF,0X7D,0XF7,0XBE,0X29,0X45,0X08,0X41,0X00,0X00,0X08,0X41,0X6B,0X6D,0XF7,0X9E,
-0XF7,0X9E,0XF7,0X9E,0XF7,0XBE,0XF7,0X9E,0XF7,0X9E,0XF7,0XBE,0XE7,0X1C,0X18,0XC3,
-0X00,0X20,0X08,0X41,0X00,0X00,0X94,0X92,0XF7,0X9E,0XF7,0X9E,0XF7,0XBE,0XFF,0XFF,
-0XDE,0XFB,0X6B,0X4D,0X00,0X00,0X00,0X00,0X08,0X41,0X08,0X61,0X00,0X00,0X00,0X00,
-0X08,0X61,0X00,0X20,0X00,0X00,0X08,0X61,0X00,0X20,0X00,0X20,0X00,0X20,0X10,0X82,
-0X00,0X00,0X00,0X00,0X10,0X82,0X00,0X00,0X08,0X61,0X73,0X8E,0XE7,0X3C,0XFF,0XDF,
-0XF7,0X9E,0XE7,0X3C,0XF7,0XBE,0XF7,0X9E,0X21,0X04,0X10,0X82,0X00,0X00,0X00,0X20,
-0X6B,0X6D,0XEF,0X7D,0XF7,0X9E,0XF7,0X9E,0XF7,0XBE,0XF7,0X9E,0XF7,0X9E,0XF7,0XBE,
-0XE7,0X3C,0X18,0XE3,0X00,0X20,0X08,0X41,0X00,0X00,0X8C,0X51,0XF7,0XBE,0XF7,0X9E,
-0XEF,0X7D,0XE7,0X1C,0XFF,0XFF,0XE7,0X3C,0X52,0XAA,0X10,0X82,0X08,0X61,0X00,0X00,
-0X00,0X00,0X00,0X20,0X08,0X41,0X00,0X20,0X00,0X20,0X08,0X41,0X00,0X20,0X00,0X20,
-0X08,0X41,0X00,0X20,0X08,0X41,0X08,0X61,0X00,0X00,0X00,0X00,0X5A,0XEB,0XEF,0X5D,
-0XF7,0X9E,0XF7,0XBE,0XFF,0XDF,0XF7,0X9E,0XEF,0X7D,0XF7,0X9E,0X29,0X65,0X00,0X00,
-0X00,0X20,0X00,0X20,0X6B,0X4D,0XEF,0X7D,0XF7,0XBE,0XF7,0X9E,0XF7,0XBE,0XF7,0XBE,
-0XF7,0X9E,0XF7,0X9E,0XEF,0X5D,0X21,0X04,0X00,0X20,0X08,0X41,0X00,0X00,0X84,0X10,
-0XF7,0X9E,0XF7,0XBE,0XEF,0X7D,0XFF,0XDF,0XEF,0X5D,0XF7,0X9E,0XEF,0X5D,0X63,0X2C,
-0X08,0X41,0X00,0X00,0X08,0X61,0X10,0X82,0X00,0X00,0X00,0X20,0X10,0X82,0X00,0X00,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X00,0X08,0X61,0X00,0X00,0X00,0X00,0X63,0X2C,
-0XDE,0XFB,0XFF,0XDF,0XF7,0X9E,0XEF,0X5D,0XF7,0XBE,0XFF,0XFF,0XEF,0X7D,0XF7,0XBE,
-0X39,0XC7,0X00,0X20,0X00,0X20,0X00,0X00,0X63,0X2C,0XEF,0X7D,0XF7,0XBE,0XF7,0X9E,
-0XF7,0XBE,0XF7,0XBE,0XF7,0XBE,0XF7,0X9E,0XEF,0X5D,0X21,0X24,0X00,0X00,0X08,0X41,
-0X00,0X00,0X7B,0XEF,0XF7,0XBE,0XEF,0X5D,0XFF,0XDF,0XFF,0XFF,0XE7,0X3C,0XEF,0X7D,
-0XFF,0XFF,0XDE,0XDB,0X6B,0X4D,0X10,0XA2,0X00,0X00,0X08,0X41,0X00,0X00,0X00,0X00,
-0X08,0X41,0X00,0X00,0X00,0X20,0X00,0X20,0X00,0X00,0X00,0X20,0X00,0X20,0X08,0X61,
-0X5A,0XCB,0XDE,0XDB,0XFF,0XFF,0XDE,0XFB,0XFF,0XFF,0XEF,0X5D,0XEF,0X5D,0XF7,0XBE,
-0XF7,0X9E,0XF7,0XBE,0X31,0XA6,0X08,0X61,0X00,0X20,0X00,0X00,0X63,0X2C,0XEF,0X7D,
-0XF7,0XBE,0XF7,0X9E,0XF7,0XBE,0XF7,0XBE,0XF7,0XBE,0XF7,0X9E,0XEF,0X7D,0X21,0X24,
-0X00,0X00,0X08,0X41,0X00,0X20,0X7B,0XCF,0XFF,0XDF,0XEF,0X5D,0XFF,0XDF,0XEF,0X5D,
-0XF7,0XBE,0XFF,0XFF,0XDE,0XFB,0XFF,0XFF,0XDE,0XFB,0X73,0X8E,0X10,0X82,0X00,0X00,
-0X08,0X41,0X00,0X00,0X00,0X00,0X08,0X61,0X00,0X20,0X00,0X20,0X00,0X20,0X08,0X41,
-0X00,0X00,0X4A,0X49,0XD6,0XBA,0XFF,0XFF,0XE7,0X1C,0XFF,0XDF,0XE7,0X3C,0XFF,0XDF,
-0XFF,0XFF,0XEF,0X7D,0XEF,0X5D,0XF7,0XBE,0X31,0X86,0X00,0X00,0X00,0X20,0X00,0X00,
-0X63,0X0C,0XEF,0X7D,0XF7,0XBE,0XF7,0X9E,0XF7,0XBE,0XF7,0XBE,0XF7,0XBE,0XF7,0X9E,
-0XEF,0X7D,0X21,0X24,0X00,0X00,0X08,0X41,0X00,0X20,0X7B,0XCF,0XEF,0X7D,0XFF,0XFF,
-0XEF,0X7D,0XF7,0X9E,0XF7,0X9E,0XEF,0X7D,0XFF,0XFF,0XEF,0X5D,0XF7,0X9E,0XDE,0XFB,
-0X73,0X8E,0X08,0X41,0X00,0X00,0X08,0X61,0X00,0X00,0X00,0X20,0X00,0X20,0X00,0X20,
-0X08,0X61,0X00,0X20,0X39,0XE7,0XDE,0XDB,0XFF,0XFF,0XEF,0X7D,0XFF,0XDF,0XFF,0XDF,
-0XF7,0X9E,0XF7,0X9E,0XF7,0XBE,0XF7,0X9E,0XF7,0XBE,0XF7,0X9E,0X42,0X08,0X00,0X20,
-0X00,0X20,0X00,0X20,0X52,0X8A,0XF7,0XBE,0XEF,0X7D,0XF7,0XBE,0XEF,0X5D,0XF7,0XBE,
-0XF7,0XBE,0XEF,0X7D,0XF7,0XBE,0X29,0X45,0X00,0X20,0X00,0X00,0X00,0X00,0X6B,0X6D,
-0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,
-0XEF,0X7D,0XEF,0X7D,0XE7,0X3C,0X7B,0XCF,0X00,0X20,0X00,0X00,0X08,0X61,0X00,0X00,
-0X00,0X20,0X00,0X20,0X00,0X00,0X08,0X61,0XCE,0X59,0XEF,0X5D,0XE7,0X3C,0XFF,0XDF,
-0XFF,0XDF,0XEF,0X7D,0XF7,0X9E,0XF7,0X9E,0XF7,0XBE,0XF7,0X9E,0XF7,0XBE,0XF7,0X9E,
-0X42,0X08,0X00,0X20,0X00,0X20,0X00,0X00,0X4A,0X69,0XF7,0XBE,0XF7,0X9E,0XFF,0XFF,
-0XF7,0X9E,0XF7,0XBE,0XF7,0X9E,0XF7,0X9E,0XEF,0X5D,0X18,0XE3,0X00,0X00,0X00,0X20,
-0X00,0X00,0X73,0XAE,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,
-0XF7,0X9E,0XF7,0X9E,0XFF,0XFF,0XEF,0X7D,0XDE,0XDB,0XE7,0X3C,0X8C,0X51,0X10,0X82,
-0X08,0X41,0X00,0X00,0X00,0X20,0X00,0X20,0X29,0X65,0XBD,0XD7,0XE7,0X3C,0XFF,0XDF,
-0XF7,0XBE,0XEF,0X5D,0XFF,0XFF,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0XBE,0XF7,0X9E,
-0XF7,0XBE,0XF7,0X9E,0X42,0X08,0X00,0X20,0X00,0X20,0X00,0X00,0X42,0X28,0XF7,0XBE,
-0XF7,0X9E,0XFF,0XFF,0XF7,0X9E,0XF7,0X9E,0XEF,0X7D,0XFF,0XFF,0XD6,0XBA,0X29,0X65,
-0X08,0X61,0X00,0X20,0X00,0X00,0X63,0X2C,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,
-0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XEF,0X7D,0XDE,0XFB,0XF7,0XBE,0XEF,0X5D,
-0XCE,0X59,0X6B,0X6D,0X00,0X00,0X08,0X61,0X00,0X20,0X00,0X20,0X73,0X8E,0XE7,0X1C,
-0XFF,0XFF,0XF7,0X9E,0XDE,0XDB,0XFF,0XFF,0XF7,0XBE,0XFF,0XDF,0XF7,0X9E,0XF7,0X9E,
-0XF7,0XBE,0XF7,0X9E,0XF7,0XBE,0XF7,0X9E,0X42,0X08,0X00,0X20,0X00,0X20,0X00,0X20,
-0X42,0X08,0XF7,0X9E,0XEF,0X7D,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XEF,0X5D,
-0XFF,0XFF,0X31,0X86,0X00,0X00,0X08,0X61,0X29,0X65,0XAD,0X55,0XF7,0X9E,0XF7,0X9E,
-0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,
-0XE7,0X3C,0XE7,0X3C,0X9C,0XF3,0X18,0XE3,0X00,0X00,0X08,0X41,0X00,0X20,0X00,0X20,
-0X18,0XE3,0XAD,0X75,0XF7,0XBE,0XDE,0XDB,0XFF,0XFF,0XF7,0X9E,0XEF,0X5D,0XF7,0XBE,
-0XF7,0X9E,0XF7,0X9E,0XF7,0XBE,0XF7,0X9E,0XF7,0XBE,0XF7,0X9E,0X42,0X08,0X00,0X20,
-0X00,0X20,0X08,0X41,0X42,0X08,0XF7,0X9E,0XEF,0X5D,0XEF,0X7D,0XFF,0XDF,0XF7,0XBE,
-0XF7,0XBE,0XEF,0X7D,0XC6,0X18,0X00,0X20,0X08,0X41,0X10,0XA2,0XD6,0X9A,0XF7,0X9E,
-0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,
-0XEF,0X7D,0XF7,0X9E,0XEF,0X7D,0XAD,0X75,0X21,0X24,0X00,0X00,0X08,0X41,0X00,0X00,
-0X00,0X20,0X00,0X20,0X08,0X41,0X08,0X41,0XA5,0X34,0XFF,0XFF,0XF7,0X9E,0XF7,0XBE,
-0XF7,0X9E,0XEF,0X7D,0XF7,0X9E,0XF7,0X9E,0XF7,0XBE,0XF7,0X9E,0XF7,0XBE,0XF7,0X9E,
-0X42,0X08,0X00,0X20,0X00,0X20,0X08,0X41,0X39,0XE7,0XF7,0X9E,0XEF,0X7D,0XF7,0X9E,
-0XFF,0XFF,0XF7,0XBE,0XF7,0X9E,0XD6,0X9A,0X00,0X00,0X10,0XA2,0X21,0X04,0XBD,0XD7,
-0XF7,0X9E,0XBD,0XF7,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,
-0XF7,0X9E,0XF7,0X9E,0XF7,0XBE,0XEF,0X5D,0XB5,0X96,0X18,0XE3,0X00,0X00,0X18,0XC3,
-0X00,0X20,0X08,0X41,0X00,0X20,0X00,0X20,0X00,0X20,0X10,0X82,0X08,0X61,0XAD,0X75,
-0XE7,0X3C,0XE7,0X3C,0XFF,0XDF,0XF7,0XBE,0XF7,0X9E,0XF7,0X9E,0XF7,0XBE,0XF7,0X9E,
-0XF7,0XBE,0XF7,0X9E,0X42,0X08,0X00,0X20,0X00,0X20,0X08,0X41,0X31,0XA6,0XF7,0X9E,
-0XF7,0XBE,0XF7,0X9E,0XFF,0XDF,0XE7,0X3C,0XBD,0XF7,0X21,0X24,0X08,0X61,0X18,0XE3,
-0XAD,0X55,0XEF,0X7D,0X73,0XAE,0X63,0X2C,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,
-0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XFF,0XDF,0XB5,0XB6,0X18,0XC3,0X00,0X00,
-0X18,0XC3,0X00,0X00,0X00,0X00,0X08,0X41,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X00,
-0X08,0X41,0X10,0X82,0XA5,0X14,0XFF,0XDF,0XEF,0X7D,0XF7,0XBE,0XF7,0X9E,0XF7,0X9E,
-0XF7,0XBE,0XF7,0X9E,0XF7,0XBE,0XF7,0X9E,0X42,0X08,0X00,0X20,0X08,0X41,0X08,0X41,
-0X31,0X86,0XF7,0X9E,0XF7,0XBE,0XEF,0X7D,0XEF,0X7D,0XCE,0X79,0X21,0X24,0X08,0X61,
-0X10,0X82,0XB5,0X96,0XE7,0X3C,0X8C,0X51,0X10,0X82,0X63,0X0C,0XF7,0X9E,0XF7,0X9E,
-0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XB5,0X96,0X18,0XE3,
-0X00,0X00,0X10,0X82,0X00,0X00,0X00,0X20,0X10,0XA2,0X00,0X00,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X00,0X08,0X41,0X00,0X00,0X18,0XE3,0X9C,0XD3,0XF7,0XBE,0XEF,0X7D,
-0XEF,0X5D,0XFF,0XFF,0XF7,0XBE,0XFF,0XFF,0XEF,0X5D,0XEF,0X7D,0X42,0X28,0X08,0X61,
-0X00,0X00,0X08,0X41,0X39,0XC7,0XEF,0X7D,0XFF,0XDF,0XFF,0XFF,0XBD,0XD7,0X31,0X86,
-0X00,0X00,0X21,0X04,0X94,0XB2,0XF7,0X9E,0X8C,0X71,0X10,0X82,0X00,0X00,0X63,0X2C,
-0XFF,0XDF,0XEF,0X7D,0XFF,0XDF,0XF7,0X9E,0XE7,0X3C,0XFF,0XFF,0XEF,0X5D,0XC6,0X18,
-0X10,0XA2,0X10,0X82,0X08,0X41,0X00,0X00,0X00,0X00,0X00,0X20,0X00,0X20,0X08,0X41,
-0X00,0X20,0X00,0X20,0X00,0X20,0X08,0X41,0X08,0X61,0X00,0X20,0X00,0X00,0X21,0X24,
-0X94,0X92,0XF7,0XBE,0XEF,0X7D,0XF7,0XBE,0XEF,0X5D,0XF7,0XBE,0XF7,0X9E,0XFF,0XDF,
-0X4A,0X49,0X00,0X00,0X00,0X20,0X08,0X41,0X31,0X86,0XF7,0X9E,0XFF,0XDF,0XBD,0XD7,
-0X31,0X86,0X10,0X82,0X10,0X82,0X9C,0XF3,0XF7,0X9E,0X94,0XB2,0X18,0XE3,0X00,0X00,
-0X08,0X61,0X63,0X0C,0XEF,0X5D,0XFF,0XDF,0XEF,0X7D,0XF7,0X9E,0XFF,0XFF,0XE7,0X1C,
-0XBD,0XD7,0X31,0XA6,0X08,0X61,0X08,0X41,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X08,0X41,0X00,0X20,0X08,0X41,
-0X00,0X20,0X00,0X00,0X21,0X04,0X9C,0XD3,0XFF,0XDF,0XFF,0XFF,0XF7,0X9E,0XF7,0XBE,
-0XF7,0X9E,0XF7,0X9E,0X42,0X28,0X00,0X20,0X00,0X00,0X08,0X41,0X73,0XAE,0XF7,0X9E,
-0XCE,0X79,0X31,0X86,0X00,0X00,0X08,0X61,0X94,0XB2,0XF7,0X9E,0XF7,0XBE,0X39,0XE7,
-0X00,0X00,0X08,0X61,0X08,0X41,0X52,0X8A,0XEF,0X7D,0XF7,0XBE,0XF7,0X9E,0XF7,0X9E,
-0XEF,0X7D,0XCE,0X79,0X29,0X45,0X00,0X00,0X00,0X20,0X00,0X00,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X00,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X00,0X00,0X20,0X18,0XE3,0X00,0X20,0X00,0X00,0X18,0XE3,0X94,0XB2,0XDE,0XFB,
-0XFF,0XFF,0XF7,0XBE,0XE7,0X3C,0XF7,0X9E,0X52,0XAA,0X08,0X61,0X08,0X41,0X52,0XAA,
-0XE7,0X1C,0XD6,0XBA,0X31,0XA6,0X10,0XA2,0X10,0X82,0X8C,0X51,0XEF,0X7D,0XFF,0XDF,
-0XEF,0X7D,0X31,0XA6,0X08,0X61,0X00,0X00,0X00,0X00,0X6B,0X6D,0XF7,0X9E,0XF7,0X9E,
-0XFF,0XDF,0XEF,0X5D,0XD6,0X9A,0X42,0X08,0X08,0X61,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X00,0X08,0X41,0X08,0X41,0X00,0X20,0X00,0X00,
-0X10,0XA2,0X94,0X92,0XEF,0X7D,0XFF,0XDF,0XF7,0X9E,0XF7,0X9E,0X52,0X8A,0X00,0X00,
-0X52,0XAA,0XD6,0XBA,0XDE,0XDB,0X42,0X28,0X08,0X61,0X00,0X00,0X94,0XB2,0XF7,0XBE,
-0XF7,0XBE,0XEF,0X5D,0XF7,0XBE,0X39,0XE7,0X00,0X00,0X00,0X00,0X00,0X20,0X63,0X2C,
-0XEF,0X5D,0XF7,0XBE,0XEF,0X7D,0XE7,0X3C,0X4A,0X69,0X08,0X41,0X00,0X00,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X00,0X00,0X00,0X08,0X41,0X00,0X00,0X00,0X20,0X08,0X41,0X00,0X00,0X00,0X00,
-0X10,0X82,0X08,0X41,0X00,0X00,0X29,0X65,0X8C,0X71,0XE7,0X1C,0XFF,0XFF,0XEF,0X5D,
-0X5A,0XEB,0X4A,0X49,0XDE,0XDB,0XE7,0X1C,0X39,0XE7,0X00,0X20,0X10,0X82,0X7B,0XEF,
-0XF7,0X9E,0XFF,0XDF,0XFF,0XFF,0XE7,0X3C,0XEF,0X7D,0X39,0XE7,0X00,0X00,0X08,0X61,
-0X10,0XA2,0X4A,0X49,0XF7,0X9E,0XF7,0XBE,0XE7,0X3C,0X4A,0X49,0X18,0XC3,0X00,0X20,
-0X00,0X00,0X08,0X61,0X08,0X41,0X08,0X41,0X08,0X41,0X00,0X20,0X00,0X00,0X00,0X00,
-0X00,0X20,0X00,0X20,0X00,0X00,0X00,0X00,0X08,0X41,0X00,0X00,0X00,0X00,0X08,0X41,
-0X00,0X20,0X08,0X41,0X08,0X41,0X00,0X20,0X00,0X20,0X00,0X00,0X18,0XE3,0X84,0X10,
-0XE7,0X1C,0XF7,0XBE,0XB5,0X96,0XD6,0XBA,0XEF,0X5D,0X31,0X86,0X18,0XE3,0X08,0X61,
-0X73,0XAE,0XFF,0XFF,0XEF,0X7D,0XEF,0X7D,0XF7,0XBE,0XF7,0X9E,0XF7,0XBE,0X4A,0X69,
-0X00,0X00,0X00,0X00,0X08,0X41,0X5A,0XCB,0XE7,0X3C,0XEF,0X5D,0X52,0X8A,0X08,0X41,
-0X00,0X00,0X00,0X20,0X00,0X20,0X08,0X41,0X00,0X20,0X00,0X20,0X08,0X41,0X00,0X20,
-0X00,0X20,0X00,0X00,0X00,0X20,0X00,0X20,0X00,0X00,0X00,0X00,0X00,0X20,0X08,0X61,
-0X08,0X41,0X00,0X00,0X00,0X20,0X00,0X20,0X00,0X00,0X00,0X20,0X08,0X61,0X00,0X20,
-0X00,0X20,0X18,0XC3,0X84,0X30,0XFF,0XFF,0XE7,0X3C,0XEF,0X5D,0X4A,0X69,0X08,0X41,
-0X00,0X00,0X7B,0XEF,0XE7,0X1C,0XFF,0XFF,0XE7,0X3C,0XFF,0XFF,0XEF,0X7D,0XFF,0XFF,
-0XEF,0X5D,0X42,0X08,0X00,0X00,0X00,0X00,0X08,0X41,0X52,0X8A,0XFF,0XDF,0X4A,0X69,
-0X08,0X61,0X08,0X41,0X00,0X00,0X00,0X20,0X10,0X82,0X00,0X00,0X00,0X00,0X00,0X20,
-0X08,0X41,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X00,0X00,0X00,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X08,0X41,0X00,0X00,0X00,0X20,0X10,0X82,0X84,0X10,0XCE,0X59,0X52,0XAA,
-0X00,0X00,0X10,0XA2,0X21,0X04,0XE7,0X3C,0XEF,0X7D,0XF7,0XBE,0XEF,0X7D,0XF7,0X9E,
-0XFF,0XFF,0XEF,0X7D,0XE7,0X3C,0X4A,0X49,0X00,0X00,0X00,0X20,0X08,0X61,0X42,0X28,
-0X52,0XAA,0X18,0XE3,0X00,0X00,0X00,0X00,0X10,0X82,0X00,0X20,0X00,0X00,0X08,0X41,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X00,0X00,0X00,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X08,0X41,0X08,0X61,0X00,0X00,0X00,0X00,0X00,0X00,0X10,0X82,
-0X31,0XA6,0X00,0X00,0X08,0X61,0X00,0X20,0X21,0X24,0XE7,0X1C,0XF7,0X9E,0XF7,0XBE,
-0XEF,0X7D,0XFF,0XDF,0XEF,0X5D,0XEF,0X7D,0XFF,0XFF,0X4A,0X69,0X00,0X20,0X08,0X41,
-0X00,0X00,0X10,0XA2,0X10,0XA2,0X00,0X20,0X00,0X00,0X00,0X20,0X08,0X41,0X00,0X00,
-0X00,0X00,0X08,0X41,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X00,0X00,0X00,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X00,0X10,0X82,0X00,0X00,0X08,0X41,
-0X10,0X82,0X00,0X00,0X00,0X20,0X00,0X20,0X08,0X41,0X00,0X00,0X29,0X65,0XE7,0X3C,
-0XF7,0XBE,0XFF,0XDF,0XF7,0X9E,0XF7,0X9E,0XF7,0X9E,0XEF,0X7D,0XFF,0XFF,0X42,0X08,
-0X00,0X20,0X08,0X61,0X00,0X00,0X00,0X20,0X00,0X00,0X00,0X20,0X08,0X61,0X08,0X41,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X00,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X00,0X00,0X00,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X00,0X10,0XA2,
-0X00,0X00,0X00,0X00,0X10,0X82,0X08,0X41,0X08,0X41,0X00,0X20,0X00,0X00,0X00,0X00,
-0X21,0X24,0XE7,0X3C,0XEF,0X7D,0XF7,0XBE,0XF7,0XBE,0XEF,0X7D,0XFF,0XFF,0XEF,0X5D,
-0XF7,0X9E,0X39,0XC7,0X00,0X20,0X08,0X61,0X00,0X00,0X08,0X61,0X00,0X20,0X08,0X61,
-0X08,0X61,0X00,0X20,0X00,0X20,0X08,0X41,0X08,0X41,0X00,0X00,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X00,0X00,0X00,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X08,0X41,0X08,0X61,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X08,0X41,0X00,0X00,
-0X00,0X20,0X08,0X61,0X10,0X82,0XF7,0X9E,0XEF,0X7D,0XEF,0X7D,0XF7,0X9E,0XFF,0XDF,
-0XEF,0X7D,0XF7,0XBE,0XFF,0XDF,0X4A,0X49,0X08,0X41,0X08,0X41,0X00,0X00,0X00,0X20,
-0X08,0X41,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X20,0X08,0X41,0X08,0X41,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X00,0X00,0X00,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X00,0X00,0X20,0X10,0X82,0X00,0X20,0X00,0X00,
-0X08,0X61,0X08,0X61,0X08,0X41,0X08,0X41,0X10,0X82,0XEF,0X7D,0XFF,0XFF,0XF7,0XBE,
-0XEF,0X5D,0XFF,0XFF,0XEF,0X7D,0XFF,0XFF,0XE7,0X3C,0X4A,0X49,0X00,0X00,0X00,0X20,
-0X08,0X41,0X00,0X20,0X00,0X20,0X00,0X00,0X00,0X20,0X08,0X41,0X00,0X20,0X00,0X00,
-0X00,0X00,0X08,0X61,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X00,0X00,0X00,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X08,0X41,0X00,0X00,0X08,0X41,0X08,0X61,
-0X00,0X20,0X00,0X00,0X00,0X00,0X00,0X20,0X00,0X20,0X00,0X00,0X10,0XA2,0X94,0XB2,
-0XDE,0XFB,0XFF,0XFF,0XEF,0X5D,0XF7,0X9E,0XF7,0XBE,0XDE,0XFB,0X84,0X10,0X21,0X24,
-0X00,0X00,0X00,0X20,0X08,0X61,0X08,0X41,0X08,0X41,0X08,0X41,0X08,0X41,0X08,0X61,
-0X08,0X41,0X00,0X00,0X00,0X00,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X00,0X00,0X00,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X08,0X41,
-0X00,0X20,0X00,0X00,0X08,0X41,0X10,0X82,0X00,0X00,0X00,0X20,0X08,0X41,0X00,0X00,
-0X08,0X61,0X10,0X82,0X84,0X30,0XF7,0XBE,0XF7,0X9E,0XF7,0X9E,0XEF,0X7D,0X9C,0XD3,
-0X08,0X61,0X00,0X20,0X00,0X20,0X08,0X41,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X20,0X08,0X41,0X08,0X41,0X00,0X00,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X00,0X00,0X00,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X00,0X08,0X61,0X00,0X00,0X00,0X20,0X21,0X24,0X73,0X8E,0XF7,0XBE,0XF7,0XBE,
-0X84,0X10,0X29,0X45,0X00,0X00,0X00,0X00,0X08,0X41,0X08,0X41,0X00,0X00,0X08,0X41,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X08,0X61,0X10,0X82,0X00,0X00,0X00,0X00,0X00,0X00,0X21,0X04,
-0X94,0XB2,0X9C,0XF3,0X21,0X24,0X00,0X20,0X00,0X20,0X08,0X41,0X08,0X41,0X08,0X41,
-0X00,0X00,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,0X00,0X20,
-0X00,0X20,0X00,0X00,0X00,0X00,0X00,0X00,};
 
+const unsigned char gImage_HAAVK[3600] = {
+ //50x50 RLE
+ 0x52, 0x4C, 0x45, 0x31, 0x00, 0x32, 0x00, 0x32, 0x8F, 0x00, 0x20, 0x05, 0x00, 0x00, 0x08, 0x61,
+ 0x6B, 0x6D, 0x29, 0x65, 0x00, 0x00, 0x08, 0x41, 0x81, 0x00, 0x00, 0x00, 0x08, 0x61, 0x81, 0x00,
+ 0x00, 0x00, 0x08, 0x61, 0x81, 0x00, 0x00, 0x01, 0x08, 0x41, 0x00, 0x00, 0xA1, 0x00, 0x20, 0x08,
+ 0x08, 0x41, 0x00, 0x00, 0x84, 0x10, 0xC6, 0x18, 0x29, 0x65, 0x00, 0x20, 0x00, 0x00, 0x10, 0x82,
+ 0x00, 0x00, 0x81, 0x08, 0x61, 0x81, 0x00, 0x00, 0x82, 0x08, 0x41, 0xA1, 0x00, 0x20, 0x09, 0x08,
+ 0x61, 0x00, 0x00, 0x8C, 0x71, 0xE7, 0x3C, 0xBD, 0xF7, 0x31, 0xA6, 0x08, 0x41, 0x00, 0x00, 0x00,
+ 0x20, 0x08, 0x61, 0x81, 0x00, 0x00, 0x03, 0x10, 0x82, 0x08, 0x41, 0x00, 0x00, 0x08, 0x41, 0xA1,
+ 0x00, 0x20, 0x06, 0x00, 0x00, 0x10, 0xA2, 0x6B, 0x6D, 0xE7, 0x3C, 0xEF, 0x7D, 0xB5, 0xB6, 0x52,
+ 0x8A, 0x81, 0x00, 0x00, 0x00, 0x00, 0x20, 0x81, 0x00, 0x00, 0x02, 0x08, 0x61, 0x00, 0x20, 0x00,
+ 0x00, 0xA2, 0x00, 0x20, 0x07, 0x00, 0x00, 0x10, 0x82, 0x7B, 0xEF, 0xEF, 0x7D, 0xE7, 0x1C, 0xEF,
+ 0x7D, 0xCE, 0x59, 0x42, 0x28, 0x81, 0x00, 0x00, 0x01, 0x10, 0x82, 0x08, 0x41, 0x81, 0x00, 0x00,
+ 0x00, 0x08, 0x61, 0xA2, 0x00, 0x20, 0x0D, 0x00, 0x00, 0x00, 0x20, 0x84, 0x30, 0xE7, 0x1C, 0xFF,
+ 0xDF, 0xE7, 0x3C, 0xFF, 0xDF, 0xBD, 0xD7, 0x4A, 0x69, 0x00, 0x20, 0x00, 0x00, 0x08, 0x41, 0x00,
+ 0x20, 0x00, 0x00, 0xA3, 0x00, 0x20, 0x02, 0x00, 0x00, 0x10, 0xA2, 0x6B, 0x4D, 0x81, 0xF7, 0x9E,
+ 0x07, 0xF7, 0xBE, 0xE7, 0x1C, 0xF7, 0xBE, 0xC6, 0x38, 0x4A, 0x69, 0x00, 0x00, 0x00, 0x20, 0x10,
+ 0xA2, 0x81, 0x00, 0x00, 0xA2, 0x00, 0x20, 0x0A, 0x08, 0x41, 0x00, 0x00, 0x8C, 0x71, 0xF7, 0x9E,
+ 0xEF, 0x7D, 0xE7, 0x1C, 0xFF, 0xDF, 0xEF, 0x5D, 0xFF, 0xDF, 0xC6, 0x18, 0x52, 0x8A, 0x81, 0x00,
+ 0x00, 0x02, 0x08, 0x41, 0x00, 0x20, 0x08, 0x41, 0x99, 0x00, 0x20, 0x0C, 0x00, 0x00, 0x10, 0xA2,
+ 0x00, 0x00, 0x08, 0x41, 0x08, 0x61, 0x00, 0x00, 0x10, 0xA2, 0x00, 0x00, 0x08, 0x41, 0x00, 0x20,
+ 0x7B, 0xCF, 0xF7, 0xBE, 0xEF, 0x7D, 0x82, 0xF7, 0x9E, 0x08, 0xFF, 0xDF, 0xEF, 0x7D, 0xA5, 0x14,
+ 0x00, 0x00, 0x08, 0x61, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x82, 0x81, 0x00, 0x00, 0x81,
+ 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x20, 0x08, 0x41, 0x91, 0x00, 0x20, 0x01, 0x10, 0x82, 0x00,
+ 0x00, 0x81, 0x08, 0x41, 0x00, 0x00, 0x20, 0x81, 0x00, 0x00, 0x00, 0x10, 0x82, 0x81, 0x00, 0x20,
+ 0x02, 0x7B, 0xCF, 0xF7, 0xBE, 0xEF, 0x7D, 0x82, 0xF7, 0x9E, 0x02, 0xEF, 0x7D, 0xF7, 0x9E, 0xB5,
+ 0xB6, 0x81, 0x00, 0x20, 0x06, 0x00, 0x00, 0x08, 0x61, 0x08, 0x41, 0x00, 0x00, 0x08, 0x41, 0x08,
+ 0x61, 0x00, 0x20, 0x81, 0x08, 0x41, 0x00, 0x00, 0x00, 0x92, 0x00, 0x20, 0x01, 0x08, 0x61, 0x00,
+ 0x00, 0x81, 0x00, 0x20, 0x03, 0x00, 0x00, 0x10, 0x82, 0x00, 0x00, 0x08, 0x41, 0x81, 0x00, 0x20,
+ 0x02, 0x7B, 0xCF, 0xF7, 0xBE, 0xEF, 0x7D, 0x82, 0xF7, 0x9E, 0x09, 0xEF, 0x5D, 0xF7, 0xBE, 0xC6,
+ 0x38, 0x08, 0x41, 0x00, 0x00, 0x00, 0x20, 0x08, 0x41, 0x00, 0x00, 0x08, 0x41, 0x08, 0x61, 0x81,
+ 0x00, 0x00, 0x03, 0x10, 0x82, 0x00, 0x20, 0x00, 0x00, 0x08, 0x61, 0x91, 0x00, 0x20, 0x04, 0x00,
+ 0x00, 0x08, 0x41, 0x00, 0x00, 0x08, 0x61, 0x00, 0x00, 0x81, 0x00, 0x20, 0x00, 0x00, 0x00, 0x81,
+ 0x00, 0x20, 0x02, 0x7B, 0xCF, 0xF7, 0xBE, 0xEF, 0x7D, 0x82, 0xF7, 0x9E, 0x02, 0xF7, 0xBE, 0xEF,
+ 0x7D, 0xC6, 0x38, 0x81, 0x08, 0x41, 0x00, 0x08, 0x61, 0x81, 0x00, 0x00, 0x02, 0x08, 0x61, 0x00,
+ 0x20, 0x00, 0x00, 0x81, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x20, 0x08, 0x41, 0x92, 0x00, 0x20,
+ 0x06, 0x08, 0x61, 0x08, 0x41, 0x08, 0x61, 0x00, 0x00, 0x08, 0x41, 0x00, 0x00, 0x08, 0x41, 0x81,
+ 0x00, 0x20, 0x02, 0x7B, 0xCF, 0xF7, 0xBE, 0xEF, 0x7D, 0x82, 0xF7, 0x9E, 0x02, 0xFF, 0xFF, 0xEF,
+ 0x5D, 0xC6, 0x38, 0x82, 0x08, 0x41, 0x09, 0x00, 0x00, 0x39, 0xC7, 0x08, 0x41, 0x00, 0x00, 0x10,
+ 0x82, 0x08, 0x61, 0x00, 0x00, 0x00, 0x20, 0x10, 0xA2, 0x00, 0x00, 0x91, 0x00, 0x20, 0x07, 0x08,
+ 0x41, 0x00, 0x20, 0x08, 0x61, 0x00, 0x00, 0x18, 0xE3, 0x7B, 0xEF, 0x10, 0x82, 0x08, 0x41, 0x81,
+ 0x00, 0x20, 0x02, 0x7B, 0xCF, 0xF7, 0xBE, 0xEF, 0x7D, 0x81, 0xF7, 0xBE, 0x03, 0xF7, 0x9E, 0xFF,
+ 0xDF, 0xEF, 0x7D, 0xD6, 0x9A, 0x81, 0x08, 0x41, 0x06, 0x00, 0x00, 0x08, 0x41, 0x8C, 0x51, 0x63,
+ 0x0C, 0x08, 0x61, 0x00, 0x00, 0x08, 0x41, 0x81, 0x00, 0x20, 0x01, 0x08, 0x61, 0x00, 0x00, 0x92,
+ 0x00, 0x20, 0x0B, 0x00, 0x00, 0x08, 0x41, 0x10, 0xA2, 0x84, 0x30, 0xE7, 0x3C, 0x29, 0x65, 0x00,
+ 0x00, 0x00, 0x20, 0x00, 0x00, 0x7B, 0xCF, 0xF7, 0xBE, 0xEF, 0x7D, 0x82, 0xF7, 0xBE, 0x0F, 0xF7,
+ 0x9E, 0xF7, 0xBE, 0xDE, 0xDB, 0x00, 0x20, 0x08, 0x41, 0x00, 0x00, 0x00, 0x20, 0xB5, 0x96, 0xDE,
+ 0xDB, 0x63, 0x2C, 0x08, 0x41, 0x00, 0x00, 0x10, 0x82, 0x00, 0x20, 0x00, 0x00, 0x10, 0x82, 0x91,
+ 0x00, 0x20, 0x06, 0x08, 0x41, 0x00, 0x00, 0x08, 0x41, 0x84, 0x10, 0xFF, 0xDF, 0xE7, 0x3C, 0x18,
+ 0xE3, 0x81, 0x00, 0x20, 0x03, 0x00, 0x00, 0x7B, 0xCF, 0xF7, 0xBE, 0xEF, 0x7D, 0x82, 0xF7, 0xBE,
+ 0x0A, 0xEF, 0x7D, 0xFF, 0xDF, 0xDE, 0xFB, 0x00, 0x00, 0x08, 0x61, 0x00, 0x20, 0x00, 0x00, 0xA5,
+ 0x34, 0xFF, 0xDF, 0xDE, 0xDB, 0x63, 0x2C, 0x81, 0x00, 0x20, 0x02, 0x08, 0x41, 0x00, 0x00, 0x08,
+ 0x41, 0x8A, 0x00, 0x20, 0x00, 0x08, 0x41, 0x81, 0x00, 0x00, 0x81, 0x08, 0x41, 0x0C, 0x00, 0x00,
+ 0x08, 0x41, 0x00, 0x00, 0x08, 0x41, 0x7B, 0xCF, 0xF7, 0x9E, 0xF7, 0xBE, 0xE7, 0x3C, 0x29, 0x65,
+ 0x08, 0x41, 0x00, 0x00, 0x08, 0x41, 0x73, 0x8E, 0x82, 0xF7, 0x9E, 0x00, 0xF7, 0xBE, 0x81, 0xF7,
+ 0x9E, 0x0D, 0xF7, 0xBE, 0xDE, 0xDB, 0x10, 0x82, 0x00, 0x20, 0x08, 0x41, 0x00, 0x00, 0x9C, 0xF3,
+ 0xEF, 0x7D, 0xFF, 0xDF, 0xE7, 0x3C, 0x63, 0x2C, 0x00, 0x00, 0x00, 0x20, 0x08, 0x41, 0x84, 0x00,
+ 0x20, 0x02, 0x00, 0x00, 0x00, 0x20, 0x08, 0x41, 0x82, 0x00, 0x20, 0x03, 0x08, 0x41, 0x00, 0x00,
+ 0x00, 0x20, 0x08, 0x61, 0x83, 0x00, 0x20, 0x06, 0x08, 0x41, 0x7B, 0xCF, 0xE7, 0x1C, 0xFF, 0xDF,
+ 0xEF, 0x5D, 0xF7, 0x9E, 0x31, 0xA6, 0x81, 0x00, 0x00, 0x01, 0x08, 0x41, 0x73, 0x8E, 0x82, 0xF7,
+ 0x9E, 0x00, 0xF7, 0xBE, 0x81, 0xF7, 0x9E, 0x0D, 0xF7, 0xBE, 0xDE, 0xFB, 0x10, 0x82, 0x00, 0x20,
+ 0x08, 0x41, 0x00, 0x00, 0x9C, 0xD3, 0xEF, 0x7D, 0xFF, 0xDF, 0xF7, 0x9E, 0xE7, 0x1C, 0x63, 0x2C,
+ 0x00, 0x00, 0x10, 0x82, 0x81, 0x00, 0x00, 0x81, 0x10, 0x82, 0x81, 0x00, 0x00, 0x01, 0x00, 0x20,
+ 0x00, 0x00, 0x82, 0x00, 0x20, 0x81, 0x08, 0x41, 0x81, 0x00, 0x00, 0x81, 0x08, 0x41, 0x04, 0x00,
+ 0x20, 0x10, 0x82, 0x73, 0xAE, 0xDE, 0xFB, 0xFF, 0xFF, 0x81, 0xEF, 0x7D, 0x05, 0xF7, 0xBE, 0x29,
+ 0x45, 0x08, 0x41, 0x00, 0x00, 0x08, 0x41, 0x6B, 0x6D, 0x82, 0xF7, 0x9E, 0x00, 0xF7, 0xBE, 0x81,
+ 0xF7, 0x9E, 0x06, 0xF7, 0xBE, 0xE7, 0x1C, 0x18, 0xC3, 0x00, 0x20, 0x08, 0x41, 0x00, 0x00, 0x94,
+ 0x92, 0x81, 0xF7, 0x9E, 0x03, 0xF7, 0xBE, 0xFF, 0xFF, 0xDE, 0xFB, 0x6B, 0x4D, 0x81, 0x00, 0x00,
+ 0x01, 0x08, 0x41, 0x08, 0x61, 0x81, 0x00, 0x00, 0x03, 0x08, 0x61, 0x00, 0x20, 0x00, 0x00, 0x08,
+ 0x61, 0x82, 0x00, 0x20, 0x00, 0x10, 0x82, 0x81, 0x00, 0x00, 0x0F, 0x10, 0x82, 0x00, 0x00, 0x08,
+ 0x61, 0x73, 0x8E, 0xE7, 0x3C, 0xFF, 0xDF, 0xF7, 0x9E, 0xE7, 0x3C, 0xF7, 0xBE, 0xF7, 0x9E, 0x21,
+ 0x04, 0x10, 0x82, 0x00, 0x00, 0x00, 0x20, 0x6B, 0x6D, 0xEF, 0x7D, 0x81, 0xF7, 0x9E, 0x00, 0xF7,
+ 0xBE, 0x81, 0xF7, 0x9E, 0x0F, 0xF7, 0xBE, 0xE7, 0x3C, 0x18, 0xE3, 0x00, 0x20, 0x08, 0x41, 0x00,
+ 0x00, 0x8C, 0x51, 0xF7, 0xBE, 0xF7, 0x9E, 0xEF, 0x7D, 0xE7, 0x1C, 0xFF, 0xFF, 0xE7, 0x3C, 0x52,
+ 0xAA, 0x10, 0x82, 0x08, 0x61, 0x81, 0x00, 0x00, 0x01, 0x00, 0x20, 0x08, 0x41, 0x81, 0x00, 0x20,
+ 0x00, 0x08, 0x41, 0x81, 0x00, 0x20, 0x03, 0x08, 0x41, 0x00, 0x20, 0x08, 0x41, 0x08, 0x61, 0x81,
+ 0x00, 0x00, 0x09, 0x5A, 0xEB, 0xEF, 0x5D, 0xF7, 0x9E, 0xF7, 0xBE, 0xFF, 0xDF, 0xF7, 0x9E, 0xEF,
+ 0x7D, 0xF7, 0x9E, 0x29, 0x65, 0x00, 0x00, 0x81, 0x00, 0x20, 0x03, 0x6B, 0x4D, 0xEF, 0x7D, 0xF7,
+ 0xBE, 0xF7, 0x9E, 0x81, 0xF7, 0xBE, 0x81, 0xF7, 0x9E, 0x15, 0xEF, 0x5D, 0x21, 0x04, 0x00, 0x20,
+ 0x08, 0x41, 0x00, 0x00, 0x84, 0x10, 0xF7, 0x9E, 0xF7, 0xBE, 0xEF, 0x7D, 0xFF, 0xDF, 0xEF, 0x5D,
+ 0xF7, 0x9E, 0xEF, 0x5D, 0x63, 0x2C, 0x08, 0x41, 0x00, 0x00, 0x08, 0x61, 0x10, 0x82, 0x00, 0x00,
+ 0x00, 0x20, 0x10, 0x82, 0x00, 0x00, 0x82, 0x00, 0x20, 0x01, 0x00, 0x00, 0x08, 0x61, 0x81, 0x00,
+ 0x00, 0x09, 0x63, 0x2C, 0xDE, 0xFB, 0xFF, 0xDF, 0xF7, 0x9E, 0xEF, 0x5D, 0xF7, 0xBE, 0xFF, 0xFF,
+ 0xEF, 0x7D, 0xF7, 0xBE, 0x39, 0xC7, 0x81, 0x00, 0x20, 0x04, 0x00, 0x00, 0x63, 0x2C, 0xEF, 0x7D,
+ 0xF7, 0xBE, 0xF7, 0x9E, 0x82, 0xF7, 0xBE, 0x12, 0xF7, 0x9E, 0xEF, 0x5D, 0x21, 0x24, 0x00, 0x00,
+ 0x08, 0x41, 0x00, 0x00, 0x7B, 0xEF, 0xF7, 0xBE, 0xEF, 0x5D, 0xFF, 0xDF, 0xFF, 0xFF, 0xE7, 0x3C,
+ 0xEF, 0x7D, 0xFF, 0xFF, 0xDE, 0xDB, 0x6B, 0x4D, 0x10, 0xA2, 0x00, 0x00, 0x08, 0x41, 0x81, 0x00,
+ 0x00, 0x01, 0x08, 0x41, 0x00, 0x00, 0x81, 0x00, 0x20, 0x00, 0x00, 0x00, 0x81, 0x00, 0x20, 0x05,
+ 0x08, 0x61, 0x5A, 0xCB, 0xDE, 0xDB, 0xFF, 0xFF, 0xDE, 0xFB, 0xFF, 0xFF, 0x81, 0xEF, 0x5D, 0x0A,
+ 0xF7, 0xBE, 0xF7, 0x9E, 0xF7, 0xBE, 0x31, 0xA6, 0x08, 0x61, 0x00, 0x20, 0x00, 0x00, 0x63, 0x2C,
+ 0xEF, 0x7D, 0xF7, 0xBE, 0xF7, 0x9E, 0x82, 0xF7, 0xBE, 0x13, 0xF7, 0x9E, 0xEF, 0x7D, 0x21, 0x24,
+ 0x00, 0x00, 0x08, 0x41, 0x00, 0x20, 0x7B, 0xCF, 0xFF, 0xDF, 0xEF, 0x5D, 0xFF, 0xDF, 0xEF, 0x5D,
+ 0xF7, 0xBE, 0xFF, 0xFF, 0xDE, 0xFB, 0xFF, 0xFF, 0xDE, 0xFB, 0x73, 0x8E, 0x10, 0x82, 0x00, 0x00,
+ 0x08, 0x41, 0x81, 0x00, 0x00, 0x00, 0x08, 0x61, 0x82, 0x00, 0x20, 0x14, 0x08, 0x41, 0x00, 0x00,
+ 0x4A, 0x49, 0xD6, 0xBA, 0xFF, 0xFF, 0xE7, 0x1C, 0xFF, 0xDF, 0xE7, 0x3C, 0xFF, 0xDF, 0xFF, 0xFF,
+ 0xEF, 0x7D, 0xEF, 0x5D, 0xF7, 0xBE, 0x31, 0x86, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x63, 0x0C,
+ 0xEF, 0x7D, 0xF7, 0xBE, 0xF7, 0x9E, 0x82, 0xF7, 0xBE, 0x09, 0xF7, 0x9E, 0xEF, 0x7D, 0x21, 0x24,
+ 0x00, 0x00, 0x08, 0x41, 0x00, 0x20, 0x7B, 0xCF, 0xEF, 0x7D, 0xFF, 0xFF, 0xEF, 0x7D, 0x81, 0xF7,
+ 0x9E, 0x09, 0xEF, 0x7D, 0xFF, 0xFF, 0xEF, 0x5D, 0xF7, 0x9E, 0xDE, 0xFB, 0x73, 0x8E, 0x08, 0x41,
+ 0x00, 0x00, 0x08, 0x61, 0x00, 0x00, 0x82, 0x00, 0x20, 0x05, 0x08, 0x61, 0x00, 0x20, 0x39, 0xE7,
+ 0xDE, 0xDB, 0xFF, 0xFF, 0xEF, 0x7D, 0x81, 0xFF, 0xDF, 0x81, 0xF7, 0x9E, 0x04, 0xF7, 0xBE, 0xF7,
+ 0x9E, 0xF7, 0xBE, 0xF7, 0x9E, 0x42, 0x08, 0x82, 0x00, 0x20, 0x04, 0x52, 0x8A, 0xF7, 0xBE, 0xEF,
+ 0x7D, 0xF7, 0xBE, 0xEF, 0x5D, 0x81, 0xF7, 0xBE, 0x03, 0xEF, 0x7D, 0xF7, 0xBE, 0x29, 0x45, 0x00,
+ 0x20, 0x81, 0x00, 0x00, 0x00, 0x6B, 0x6D, 0x87, 0xF7, 0x9E, 0x81, 0xEF, 0x7D, 0x05, 0xE7, 0x3C,
+ 0x7B, 0xCF, 0x00, 0x20, 0x00, 0x00, 0x08, 0x61, 0x00, 0x00, 0x81, 0x00, 0x20, 0x04, 0x00, 0x00,
+ 0x08, 0x61, 0xCE, 0x59, 0xEF, 0x5D, 0xE7, 0x3C, 0x81, 0xFF, 0xDF, 0x00, 0xEF, 0x7D, 0x81, 0xF7,
+ 0x9E, 0x04, 0xF7, 0xBE, 0xF7, 0x9E, 0xF7, 0xBE, 0xF7, 0x9E, 0x42, 0x08, 0x81, 0x00, 0x20, 0x06,
+ 0x00, 0x00, 0x4A, 0x69, 0xF7, 0xBE, 0xF7, 0x9E, 0xFF, 0xFF, 0xF7, 0x9E, 0xF7, 0xBE, 0x81, 0xF7,
+ 0x9E, 0x05, 0xEF, 0x5D, 0x18, 0xE3, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x73, 0xAE, 0x87, 0xF7,
+ 0x9E, 0x07, 0xFF, 0xFF, 0xEF, 0x7D, 0xDE, 0xDB, 0xE7, 0x3C, 0x8C, 0x51, 0x10, 0x82, 0x08, 0x41,
+ 0x00, 0x00, 0x81, 0x00, 0x20, 0x06, 0x29, 0x65, 0xBD, 0xD7, 0xE7, 0x3C, 0xFF, 0xDF, 0xF7, 0xBE,
+ 0xEF, 0x5D, 0xFF, 0xFF, 0x82, 0xF7, 0x9E, 0x04, 0xF7, 0xBE, 0xF7, 0x9E, 0xF7, 0xBE, 0xF7, 0x9E,
+ 0x42, 0x08, 0x81, 0x00, 0x20, 0x04, 0x00, 0x00, 0x42, 0x28, 0xF7, 0xBE, 0xF7, 0x9E, 0xFF, 0xFF,
+ 0x81, 0xF7, 0x9E, 0x07, 0xEF, 0x7D, 0xFF, 0xFF, 0xD6, 0xBA, 0x29, 0x65, 0x08, 0x61, 0x00, 0x20,
+ 0x00, 0x00, 0x63, 0x2C, 0x87, 0xF7, 0x9E, 0x07, 0xEF, 0x7D, 0xDE, 0xFB, 0xF7, 0xBE, 0xEF, 0x5D,
+ 0xCE, 0x59, 0x6B, 0x6D, 0x00, 0x00, 0x08, 0x61, 0x81, 0x00, 0x20, 0x07, 0x73, 0x8E, 0xE7, 0x1C,
+ 0xFF, 0xFF, 0xF7, 0x9E, 0xDE, 0xDB, 0xFF, 0xFF, 0xF7, 0xBE, 0xFF, 0xDF, 0x81, 0xF7, 0x9E, 0x04,
+ 0xF7, 0xBE, 0xF7, 0x9E, 0xF7, 0xBE, 0xF7, 0x9E, 0x42, 0x08, 0x82, 0x00, 0x20, 0x02, 0x42, 0x08,
+ 0xF7, 0x9E, 0xEF, 0x7D, 0x83, 0xF7, 0x9E, 0x06, 0xEF, 0x5D, 0xFF, 0xFF, 0x31, 0x86, 0x00, 0x00,
+ 0x08, 0x61, 0x29, 0x65, 0xAD, 0x55, 0x89, 0xF7, 0x9E, 0x81, 0xE7, 0x3C, 0x03, 0x9C, 0xF3, 0x18,
+ 0xE3, 0x00, 0x00, 0x08, 0x41, 0x81, 0x00, 0x20, 0x07, 0x18, 0xE3, 0xAD, 0x75, 0xF7, 0xBE, 0xDE,
+ 0xDB, 0xFF, 0xFF, 0xF7, 0x9E, 0xEF, 0x5D, 0xF7, 0xBE, 0x81, 0xF7, 0x9E, 0x04, 0xF7, 0xBE, 0xF7,
+ 0x9E, 0xF7, 0xBE, 0xF7, 0x9E, 0x42, 0x08, 0x81, 0x00, 0x20, 0x05, 0x08, 0x41, 0x42, 0x08, 0xF7,
+ 0x9E, 0xEF, 0x5D, 0xEF, 0x7D, 0xFF, 0xDF, 0x81, 0xF7, 0xBE, 0x05, 0xEF, 0x7D, 0xC6, 0x18, 0x00,
+ 0x20, 0x08, 0x41, 0x10, 0xA2, 0xD6, 0x9A, 0x88, 0xF7, 0x9E, 0x07, 0xEF, 0x7D, 0xF7, 0x9E, 0xEF,
+ 0x7D, 0xAD, 0x75, 0x21, 0x24, 0x00, 0x00, 0x08, 0x41, 0x00, 0x00, 0x81, 0x00, 0x20, 0x81, 0x08,
+ 0x41, 0x05, 0xA5, 0x34, 0xFF, 0xFF, 0xF7, 0x9E, 0xF7, 0xBE, 0xF7, 0x9E, 0xEF, 0x7D, 0x81, 0xF7,
+ 0x9E, 0x04, 0xF7, 0xBE, 0xF7, 0x9E, 0xF7, 0xBE, 0xF7, 0x9E, 0x42, 0x08, 0x81, 0x00, 0x20, 0x0E,
+ 0x08, 0x41, 0x39, 0xE7, 0xF7, 0x9E, 0xEF, 0x7D, 0xF7, 0x9E, 0xFF, 0xFF, 0xF7, 0xBE, 0xF7, 0x9E,
+ 0xD6, 0x9A, 0x00, 0x00, 0x10, 0xA2, 0x21, 0x04, 0xBD, 0xD7, 0xF7, 0x9E, 0xBD, 0xF7, 0x87, 0xF7,
+ 0x9E, 0x07, 0xF7, 0xBE, 0xEF, 0x5D, 0xB5, 0x96, 0x18, 0xE3, 0x00, 0x00, 0x18, 0xC3, 0x00, 0x20,
+ 0x08, 0x41, 0x82, 0x00, 0x20, 0x02, 0x10, 0x82, 0x08, 0x61, 0xAD, 0x75, 0x81, 0xE7, 0x3C, 0x01,
+ 0xFF, 0xDF, 0xF7, 0xBE, 0x81, 0xF7, 0x9E, 0x04, 0xF7, 0xBE, 0xF7, 0x9E, 0xF7, 0xBE, 0xF7, 0x9E,
+ 0x42, 0x08, 0x81, 0x00, 0x20, 0x0E, 0x08, 0x41, 0x31, 0xA6, 0xF7, 0x9E, 0xF7, 0xBE, 0xF7, 0x9E,
+ 0xFF, 0xDF, 0xE7, 0x3C, 0xBD, 0xF7, 0x21, 0x24, 0x08, 0x61, 0x18, 0xE3, 0xAD, 0x55, 0xEF, 0x7D,
+ 0x73, 0xAE, 0x63, 0x2C, 0x87, 0xF7, 0x9E, 0x04, 0xFF, 0xDF, 0xB5, 0xB6, 0x18, 0xC3, 0x00, 0x00,
+ 0x18, 0xC3, 0x81, 0x00, 0x00, 0x00, 0x08, 0x41, 0x82, 0x00, 0x20, 0x06, 0x00, 0x00, 0x08, 0x41,
+ 0x10, 0x82, 0xA5, 0x14, 0xFF, 0xDF, 0xEF, 0x7D, 0xF7, 0xBE, 0x81, 0xF7, 0x9E, 0x05, 0xF7, 0xBE,
+ 0xF7, 0x9E, 0xF7, 0xBE, 0xF7, 0x9E, 0x42, 0x08, 0x00, 0x20, 0x81, 0x08, 0x41, 0x02, 0x31, 0x86,
+ 0xF7, 0x9E, 0xF7, 0xBE, 0x81, 0xEF, 0x7D, 0x08, 0xCE, 0x79, 0x21, 0x24, 0x08, 0x61, 0x10, 0x82,
+ 0xB5, 0x96, 0xE7, 0x3C, 0x8C, 0x51, 0x10, 0x82, 0x63, 0x0C, 0x87, 0xF7, 0x9E, 0x07, 0xB5, 0x96,
+ 0x18, 0xE3, 0x00, 0x00, 0x10, 0x82, 0x00, 0x00, 0x00, 0x20, 0x10, 0xA2, 0x00, 0x00, 0x82, 0x00,
+ 0x20, 0x29, 0x00, 0x00, 0x08, 0x41, 0x00, 0x00, 0x18, 0xE3, 0x9C, 0xD3, 0xF7, 0xBE, 0xEF, 0x7D,
+ 0xEF, 0x5D, 0xFF, 0xFF, 0xF7, 0xBE, 0xFF, 0xFF, 0xEF, 0x5D, 0xEF, 0x7D, 0x42, 0x28, 0x08, 0x61,
+ 0x00, 0x00, 0x08, 0x41, 0x39, 0xC7, 0xEF, 0x7D, 0xFF, 0xDF, 0xFF, 0xFF, 0xBD, 0xD7, 0x31, 0x86,
+ 0x00, 0x00, 0x21, 0x04, 0x94, 0xB2, 0xF7, 0x9E, 0x8C, 0x71, 0x10, 0x82, 0x00, 0x00, 0x63, 0x2C,
+ 0xFF, 0xDF, 0xEF, 0x7D, 0xFF, 0xDF, 0xF7, 0x9E, 0xE7, 0x3C, 0xFF, 0xFF, 0xEF, 0x5D, 0xC6, 0x18,
+ 0x10, 0xA2, 0x10, 0x82, 0x08, 0x41, 0x81, 0x00, 0x00, 0x81, 0x00, 0x20, 0x00, 0x08, 0x41, 0x82,
+ 0x00, 0x20, 0x15, 0x08, 0x41, 0x08, 0x61, 0x00, 0x20, 0x00, 0x00, 0x21, 0x24, 0x94, 0x92, 0xF7,
+ 0xBE, 0xEF, 0x7D, 0xF7, 0xBE, 0xEF, 0x5D, 0xF7, 0xBE, 0xF7, 0x9E, 0xFF, 0xDF, 0x4A, 0x49, 0x00,
+ 0x00, 0x00, 0x20, 0x08, 0x41, 0x31, 0x86, 0xF7, 0x9E, 0xFF, 0xDF, 0xBD, 0xD7, 0x31, 0x86, 0x81,
+ 0x10, 0x82, 0x10, 0x9C, 0xF3, 0xF7, 0x9E, 0x94, 0xB2, 0x18, 0xE3, 0x00, 0x00, 0x08, 0x61, 0x63,
+ 0x0C, 0xEF, 0x5D, 0xFF, 0xDF, 0xEF, 0x7D, 0xF7, 0x9E, 0xFF, 0xFF, 0xE7, 0x1C, 0xBD, 0xD7, 0x31,
+ 0xA6, 0x08, 0x61, 0x08, 0x41, 0x88, 0x00, 0x20, 0x0A, 0x08, 0x41, 0x00, 0x20, 0x08, 0x41, 0x00,
+ 0x20, 0x00, 0x00, 0x21, 0x04, 0x9C, 0xD3, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0x9E, 0xF7, 0xBE, 0x81,
+ 0xF7, 0x9E, 0x13, 0x42, 0x28, 0x00, 0x20, 0x00, 0x00, 0x08, 0x41, 0x73, 0xAE, 0xF7, 0x9E, 0xCE,
+ 0x79, 0x31, 0x86, 0x00, 0x00, 0x08, 0x61, 0x94, 0xB2, 0xF7, 0x9E, 0xF7, 0xBE, 0x39, 0xE7, 0x00,
+ 0x00, 0x08, 0x61, 0x08, 0x41, 0x52, 0x8A, 0xEF, 0x7D, 0xF7, 0xBE, 0x81, 0xF7, 0x9E, 0x05, 0xEF,
+ 0x7D, 0xCE, 0x79, 0x29, 0x45, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x84, 0x00, 0x20, 0x00, 0x00,
+ 0x00, 0x83, 0x00, 0x20, 0x1A, 0x00, 0x00, 0x00, 0x20, 0x18, 0xE3, 0x00, 0x20, 0x00, 0x00, 0x18,
+ 0xE3, 0x94, 0xB2, 0xDE, 0xFB, 0xFF, 0xFF, 0xF7, 0xBE, 0xE7, 0x3C, 0xF7, 0x9E, 0x52, 0xAA, 0x08,
+ 0x61, 0x08, 0x41, 0x52, 0xAA, 0xE7, 0x1C, 0xD6, 0xBA, 0x31, 0xA6, 0x10, 0xA2, 0x10, 0x82, 0x8C,
+ 0x51, 0xEF, 0x7D, 0xFF, 0xDF, 0xEF, 0x7D, 0x31, 0xA6, 0x08, 0x61, 0x81, 0x00, 0x00, 0x00, 0x6B,
+ 0x6D, 0x81, 0xF7, 0x9E, 0x04, 0xFF, 0xDF, 0xEF, 0x5D, 0xD6, 0x9A, 0x42, 0x08, 0x08, 0x61, 0x82,
+ 0x00, 0x00, 0x84, 0x00, 0x20, 0x82, 0x00, 0x00, 0x82, 0x00, 0x20, 0x00, 0x00, 0x00, 0x81, 0x08,
+ 0x41, 0x05, 0x00, 0x20, 0x00, 0x00, 0x10, 0xA2, 0x94, 0x92, 0xEF, 0x7D, 0xFF, 0xDF, 0x81, 0xF7,
+ 0x9E, 0x08, 0x52, 0x8A, 0x00, 0x00, 0x52, 0xAA, 0xD6, 0xBA, 0xDE, 0xDB, 0x42, 0x28, 0x08, 0x61,
+ 0x00, 0x00, 0x94, 0xB2, 0x81, 0xF7, 0xBE, 0x02, 0xEF, 0x5D, 0xF7, 0xBE, 0x39, 0xE7, 0x81, 0x00,
+ 0x00, 0x08, 0x00, 0x20, 0x63, 0x2C, 0xEF, 0x5D, 0xF7, 0xBE, 0xEF, 0x7D, 0xE7, 0x3C, 0x4A, 0x69,
+ 0x08, 0x41, 0x00, 0x00, 0x88, 0x00, 0x20, 0x81, 0x00, 0x00, 0x03, 0x08, 0x41, 0x00, 0x00, 0x00,
+ 0x20, 0x08, 0x41, 0x81, 0x00, 0x00, 0x21, 0x10, 0x82, 0x08, 0x41, 0x00, 0x00, 0x29, 0x65, 0x8C,
+ 0x71, 0xE7, 0x1C, 0xFF, 0xFF, 0xEF, 0x5D, 0x5A, 0xEB, 0x4A, 0x49, 0xDE, 0xDB, 0xE7, 0x1C, 0x39,
+ 0xE7, 0x00, 0x20, 0x10, 0x82, 0x7B, 0xEF, 0xF7, 0x9E, 0xFF, 0xDF, 0xFF, 0xFF, 0xE7, 0x3C, 0xEF,
+ 0x7D, 0x39, 0xE7, 0x00, 0x00, 0x08, 0x61, 0x10, 0xA2, 0x4A, 0x49, 0xF7, 0x9E, 0xF7, 0xBE, 0xE7,
+ 0x3C, 0x4A, 0x49, 0x18, 0xC3, 0x00, 0x20, 0x00, 0x00, 0x08, 0x61, 0x82, 0x08, 0x41, 0x00, 0x00,
+ 0x20, 0x81, 0x00, 0x00, 0x81, 0x00, 0x20, 0x81, 0x00, 0x00, 0x00, 0x08, 0x41, 0x81, 0x00, 0x00,
+ 0x01, 0x08, 0x41, 0x00, 0x20, 0x81, 0x08, 0x41, 0x81, 0x00, 0x20, 0x0C, 0x00, 0x00, 0x18, 0xE3,
+ 0x84, 0x10, 0xE7, 0x1C, 0xF7, 0xBE, 0xB5, 0x96, 0xD6, 0xBA, 0xEF, 0x5D, 0x31, 0x86, 0x18, 0xE3,
+ 0x08, 0x61, 0x73, 0xAE, 0xFF, 0xFF, 0x81, 0xEF, 0x7D, 0x03, 0xF7, 0xBE, 0xF7, 0x9E, 0xF7, 0xBE,
+ 0x4A, 0x69, 0x81, 0x00, 0x00, 0x06, 0x08, 0x41, 0x5A, 0xCB, 0xE7, 0x3C, 0xEF, 0x5D, 0x52, 0x8A,
+ 0x08, 0x41, 0x00, 0x00, 0x81, 0x00, 0x20, 0x00, 0x08, 0x41, 0x81, 0x00, 0x20, 0x00, 0x08, 0x41,
+ 0x81, 0x00, 0x20, 0x00, 0x00, 0x00, 0x81, 0x00, 0x20, 0x81, 0x00, 0x00, 0x03, 0x00, 0x20, 0x08,
+ 0x61, 0x08, 0x41, 0x00, 0x00, 0x81, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x20, 0x08, 0x61, 0x81,
+ 0x00, 0x20, 0x10, 0x18, 0xC3, 0x84, 0x30, 0xFF, 0xFF, 0xE7, 0x3C, 0xEF, 0x5D, 0x4A, 0x69, 0x08,
+ 0x41, 0x00, 0x00, 0x7B, 0xEF, 0xE7, 0x1C, 0xFF, 0xFF, 0xE7, 0x3C, 0xFF, 0xFF, 0xEF, 0x7D, 0xFF,
+ 0xFF, 0xEF, 0x5D, 0x42, 0x08, 0x81, 0x00, 0x00, 0x08, 0x08, 0x41, 0x52, 0x8A, 0xFF, 0xDF, 0x4A,
+ 0x69, 0x08, 0x61, 0x08, 0x41, 0x00, 0x00, 0x00, 0x20, 0x10, 0x82, 0x81, 0x00, 0x00, 0x01, 0x00,
+ 0x20, 0x08, 0x41, 0x84, 0x00, 0x20, 0x81, 0x00, 0x00, 0x88, 0x00, 0x20, 0x18, 0x08, 0x41, 0x00,
+ 0x00, 0x00, 0x20, 0x10, 0x82, 0x84, 0x10, 0xCE, 0x59, 0x52, 0xAA, 0x00, 0x00, 0x10, 0xA2, 0x21,
+ 0x04, 0xE7, 0x3C, 0xEF, 0x7D, 0xF7, 0xBE, 0xEF, 0x7D, 0xF7, 0x9E, 0xFF, 0xFF, 0xEF, 0x7D, 0xE7,
+ 0x3C, 0x4A, 0x49, 0x00, 0x00, 0x00, 0x20, 0x08, 0x61, 0x42, 0x28, 0x52, 0xAA, 0x18, 0xE3, 0x81,
+ 0x00, 0x00, 0x03, 0x10, 0x82, 0x00, 0x20, 0x00, 0x00, 0x08, 0x41, 0x87, 0x00, 0x20, 0x81, 0x00,
+ 0x00, 0x87, 0x00, 0x20, 0x01, 0x08, 0x41, 0x08, 0x61, 0x82, 0x00, 0x00, 0x11, 0x10, 0x82, 0x31,
+ 0xA6, 0x00, 0x00, 0x08, 0x61, 0x00, 0x20, 0x21, 0x24, 0xE7, 0x1C, 0xF7, 0x9E, 0xF7, 0xBE, 0xEF,
+ 0x7D, 0xFF, 0xDF, 0xEF, 0x5D, 0xEF, 0x7D, 0xFF, 0xFF, 0x4A, 0x69, 0x00, 0x20, 0x08, 0x41, 0x00,
+ 0x00, 0x81, 0x10, 0xA2, 0x03, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x08, 0x41, 0x81, 0x00, 0x00,
+ 0x00, 0x08, 0x41, 0x87, 0x00, 0x20, 0x81, 0x00, 0x00, 0x87, 0x00, 0x20, 0x05, 0x00, 0x00, 0x10,
+ 0x82, 0x00, 0x00, 0x08, 0x41, 0x10, 0x82, 0x00, 0x00, 0x81, 0x00, 0x20, 0x05, 0x08, 0x41, 0x00,
+ 0x00, 0x29, 0x65, 0xE7, 0x3C, 0xF7, 0xBE, 0xFF, 0xDF, 0x82, 0xF7, 0x9E, 0x0A, 0xEF, 0x7D, 0xFF,
+ 0xFF, 0x42, 0x08, 0x00, 0x20, 0x08, 0x61, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x08,
+ 0x61, 0x08, 0x41, 0x82, 0x00, 0x20, 0x00, 0x00, 0x00, 0x87, 0x00, 0x20, 0x81, 0x00, 0x00, 0x87,
+ 0x00, 0x20, 0x01, 0x00, 0x00, 0x10, 0xA2, 0x81, 0x00, 0x00, 0x00, 0x10, 0x82, 0x81, 0x08, 0x41,
+ 0x00, 0x00, 0x20, 0x81, 0x00, 0x00, 0x02, 0x21, 0x24, 0xE7, 0x3C, 0xEF, 0x7D, 0x81, 0xF7, 0xBE,
+ 0x09, 0xEF, 0x7D, 0xFF, 0xFF, 0xEF, 0x5D, 0xF7, 0x9E, 0x39, 0xC7, 0x00, 0x20, 0x08, 0x61, 0x00,
+ 0x00, 0x08, 0x61, 0x00, 0x20, 0x81, 0x08, 0x61, 0x81, 0x00, 0x20, 0x81, 0x08, 0x41, 0x00, 0x00,
+ 0x00, 0x87, 0x00, 0x20, 0x81, 0x00, 0x00, 0x87, 0x00, 0x20, 0x01, 0x08, 0x41, 0x08, 0x61, 0x83,
+ 0x00, 0x00, 0x05, 0x08, 0x41, 0x00, 0x00, 0x00, 0x20, 0x08, 0x61, 0x10, 0x82, 0xF7, 0x9E, 0x81,
+ 0xEF, 0x7D, 0x05, 0xF7, 0x9E, 0xFF, 0xDF, 0xEF, 0x7D, 0xF7, 0xBE, 0xFF, 0xDF, 0x4A, 0x49, 0x81,
+ 0x08, 0x41, 0x02, 0x00, 0x00, 0x00, 0x20, 0x08, 0x41, 0x82, 0x00, 0x00, 0x00, 0x00, 0x20, 0x81,
+ 0x08, 0x41, 0x88, 0x00, 0x20, 0x81, 0x00, 0x00, 0x88, 0x00, 0x20, 0x04, 0x00, 0x00, 0x00, 0x20,
+ 0x10, 0x82, 0x00, 0x20, 0x00, 0x00, 0x81, 0x08, 0x61, 0x81, 0x08, 0x41, 0x0C, 0x10, 0x82, 0xEF,
+ 0x7D, 0xFF, 0xFF, 0xF7, 0xBE, 0xEF, 0x5D, 0xFF, 0xFF, 0xEF, 0x7D, 0xFF, 0xFF, 0xE7, 0x3C, 0x4A,
+ 0x49, 0x00, 0x00, 0x00, 0x20, 0x08, 0x41, 0x81, 0x00, 0x20, 0x03, 0x00, 0x00, 0x00, 0x20, 0x08,
+ 0x41, 0x00, 0x20, 0x81, 0x00, 0x00, 0x00, 0x08, 0x61, 0x87, 0x00, 0x20, 0x81, 0x00, 0x00, 0x87,
+ 0x00, 0x20, 0x04, 0x08, 0x41, 0x00, 0x00, 0x08, 0x41, 0x08, 0x61, 0x00, 0x20, 0x81, 0x00, 0x00,
+ 0x81, 0x00, 0x20, 0x0D, 0x00, 0x00, 0x10, 0xA2, 0x94, 0xB2, 0xDE, 0xFB, 0xFF, 0xFF, 0xEF, 0x5D,
+ 0xF7, 0x9E, 0xF7, 0xBE, 0xDE, 0xFB, 0x84, 0x10, 0x21, 0x24, 0x00, 0x00, 0x00, 0x20, 0x08, 0x61,
+ 0x83, 0x08, 0x41, 0x01, 0x08, 0x61, 0x08, 0x41, 0x81, 0x00, 0x00, 0x88, 0x00, 0x20, 0x81, 0x00,
+ 0x00, 0x88, 0x00, 0x20, 0x0C, 0x08, 0x41, 0x00, 0x20, 0x00, 0x00, 0x08, 0x41, 0x10, 0x82, 0x00,
+ 0x00, 0x00, 0x20, 0x08, 0x41, 0x00, 0x00, 0x08, 0x61, 0x10, 0x82, 0x84, 0x30, 0xF7, 0xBE, 0x81,
+ 0xF7, 0x9E, 0x02, 0xEF, 0x7D, 0x9C, 0xD3, 0x08, 0x61, 0x81, 0x00, 0x20, 0x00, 0x08, 0x41, 0x82,
+ 0x00, 0x20, 0x82, 0x00, 0x00, 0x00, 0x00, 0x20, 0x81, 0x08, 0x41, 0x00, 0x00, 0x00, 0x87, 0x00,
+ 0x20, 0x81, 0x00, 0x00, 0x8F, 0x00, 0x20, 0x05, 0x00, 0x00, 0x08, 0x61, 0x00, 0x00, 0x00, 0x20,
+ 0x21, 0x24, 0x73, 0x8E, 0x81, 0xF7, 0xBE, 0x01, 0x84, 0x10, 0x29, 0x45, 0x81, 0x00, 0x00, 0x81,
+ 0x08, 0x41, 0x01, 0x00, 0x00, 0x08, 0x41, 0x8E, 0x00, 0x20, 0x82, 0x00, 0x00, 0x8F, 0x00, 0x20,
+ 0x01, 0x08, 0x61, 0x10, 0x82, 0x82, 0x00, 0x00, 0x03, 0x21, 0x04, 0x94, 0xB2, 0x9C, 0xF3, 0x21,
+ 0x24, 0x81, 0x00, 0x20, 0x82, 0x08, 0x41, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x20, 0x82, 0x00, 0x00,
+};
 
-const unsigned char gImage_QC[5008] = { 0X10,0X10,0X00,0X32,0X00,0X32,0X01,0X1B,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XDE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDE,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFD,0XFF,0XFD,0XFF,0XFE,0XF7,0XDC,0XFF,0XFE,0XFF,0XFE,0XFF,0XFE,0XF7,0XDD,
-0XFF,0XFF,0XFF,0XFE,0XF7,0XDD,0XFF,0XFE,0XFF,0XFE,0XF7,0XDD,0XFF,0XFE,0XFF,0XFE,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XBE,0XFF,0XFF,0XFF,0XFE,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XBE,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF7,0XBE,0XFF,0XDE,0XF7,0XDD,0XFF,0XDE,0XFF,0XFE,0XFF,0XFF,0XF7,0XFE,
-0XF7,0XDE,0XFF,0XFF,0XE7,0X7D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF7,0XBE,0XFF,0XFF,0XF7,0X9E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF7,0XDE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDE,0XFF,0XFF,0XFF,0XFF,
-0XF7,0XBE,0XEF,0X7D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,
-0XF7,0XDF,0XF7,0XBF,0XF7,0XBF,0XF7,0XBF,0XFF,0XFF,0XFF,0XFF,0XF7,0XDF,0XEF,0X7F,
-0XF7,0XBF,0XFF,0XFF,0XF7,0XBF,0XEF,0X5D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF7,0X9E,0XFF,0XDF,0XF7,0XDE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XDE,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0X7E,0XFF,0XFF,0XFF,0XDF,
-0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XE7,0X3F,0XC6,0X3B,0X9D,0X37,0XA5,0X37,0X8C,0X95,
-0X94,0XF6,0XB5,0XB9,0XD6,0XBD,0XEF,0X7F,0XFF,0XBF,0XFF,0XFF,0XF7,0XBF,0XFF,0XFF,
-0XFF,0XFF,0XF7,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF7,0XDE,0XFF,0XFF,0XF7,0XDF,0XF7,0XDF,0XFF,0XFF,0XFF,0XFF,0XEF,0X9E,0XFF,0XFF,
-0XF7,0X9F,0XF7,0XBF,0XC6,0X5B,0X7C,0X32,0X31,0XCA,0X29,0X89,0X63,0X50,0X73,0XD2,
-0X73,0XF2,0X73,0XD2,0X84,0X54,0X6B,0X91,0X42,0X4C,0X3A,0X0A,0X5A,0XEE,0X9C,0XF6,
-0XF7,0XBF,0XEF,0X7E,0XF7,0XBF,0XFF,0XFF,0XF7,0XBF,0XE7,0X5D,0XEF,0X7D,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0X9E,0XFF,0XFF,0XFF,0XFF,0XEF,0X9E,0XEF,0X9F,
-0XFF,0XFF,0XE7,0X5E,0XBD,0XF9,0X63,0X4E,0X3A,0X0A,0X94,0XF5,0XE7,0X3F,0XEF,0X9F,
-0XEF,0XDF,0XCE,0XBD,0XCE,0XBD,0XC6,0X7C,0XE7,0X5F,0XE7,0X5F,0XEF,0X9F,0XE7,0X5F,
-0XA5,0X57,0X84,0X53,0X31,0XC8,0X8C,0X93,0XEF,0X7F,0XFF,0XFF,0XF7,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XDF,0XF7,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XF7,0XDF,0XFF,0XFF,0XCE,0XBC,0X63,0X4E,0X52,0XAB,0XBE,0X19,0XEF,0XBF,0XDF,0X5E,
-0XBE,0X39,0XCE,0XDC,0XEF,0XDF,0XA5,0X98,0XAD,0XD9,0XB6,0X1A,0XD7,0X3E,0XC6,0X9B,
-0XBE,0X1A,0XC6,0X9B,0XC6,0X7B,0XE7,0X7F,0XE7,0X7F,0X6B,0XB0,0X42,0X4A,0X8C,0X93,
-0XEF,0X9F,0XFF,0XFF,0XEF,0X9F,0XF7,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XBE,0XFF,0XFF,
-0XEF,0X9E,0XEF,0X9F,0XFF,0XFF,0X94,0XD4,0X3A,0X2A,0XA5,0X56,0XE7,0X5E,0XD6,0XFC,
-0XBE,0X7A,0XD7,0X1D,0XBE,0X7A,0XAE,0X19,0XD7,0X3E,0XBE,0X7B,0XCE,0XFD,0XBE,0X7B,
-0XDF,0X5F,0XCE,0XFD,0XBE,0X5A,0XB6,0X19,0XB6,0X19,0XEF,0XBF,0XEF,0XBF,0XE7,0X7F,
-0XBE,0X1A,0X5B,0X2E,0X63,0X6F,0XD6,0XBC,0XFF,0XFF,0XF7,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XF7,0XBE,0XF7,0XBF,0XF7,0XFF,0XFF,0XFF,0X7C,0X32,0X4A,0X8C,0XE7,0X5F,0XC6,0X7B,
-0XD7,0X1D,0X8C,0XF5,0XB6,0X3A,0XC6,0XDC,0XCE,0XFD,0XDF,0X9F,0XA5,0XD9,0X7C,0X94,
-0X74,0X73,0X8C,0XF6,0X74,0X53,0X84,0X94,0XC6,0XBC,0XE7,0X9F,0XE7,0X7F,0XF7,0XFF,
-0XF7,0XFF,0XAD,0X98,0XD6,0XFE,0XE7,0X5F,0X8C,0XB4,0X4A,0XAC,0XD6,0XDC,0XF7,0XFF,
-0XEF,0XBF,0XF7,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,
-0XFF,0XFF,0XF7,0XDF,0XFF,0XFF,0XF7,0XBF,0XE7,0X7F,0X7C,0X32,0X63,0X4F,0XDF,0X3F,
-0XBE,0X1A,0XAD,0XB9,0XAD,0XD9,0XE7,0XBF,0XDF,0X7F,0X8C,0XF6,0X7C,0X54,0X95,0X38,
-0XA5,0XDA,0XC6,0XFF,0XB6,0X5C,0XAD,0XFB,0XB6,0X3C,0XC6,0XDE,0XB6,0X1C,0X7C,0X54,
-0X7C,0X75,0XBE,0X3C,0XCE,0XDE,0XDF,0X5F,0XCE,0XBD,0XBE,0X5B,0XCE,0XDD,0X94,0XD5,
-0X4A,0XAC,0XD6,0XDC,0XFF,0XFF,0XF7,0XBF,0XF7,0XDF,0XF7,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE7,0X5E,0XF7,0XFF,0X9D,0X16,0X52,0XCD,
-0XE7,0X7F,0XCE,0XDE,0XC6,0X7D,0XBE,0X5C,0XCE,0XDF,0X95,0X19,0X8C,0XF8,0XBE,0X7F,
-0X9D,0X7B,0X4B,0X32,0X32,0X2E,0X19,0X6B,0X19,0X6B,0X19,0X8C,0X21,0XCD,0X21,0X8C,
-0X29,0XED,0X6B,0XF5,0XAD,0XBC,0XAD,0XFC,0X84,0X96,0XC6,0X9D,0XDF,0X5F,0X9D,0X58,
-0XEF,0XBF,0XCE,0XBC,0XB5,0XD9,0X3A,0X09,0XCE,0XBC,0XFF,0XFF,0XEF,0XBF,0XFF,0XFF,
-0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XBF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XF7,0XFF,0XBE,0X3A,
-0X3A,0X2A,0XDF,0X5F,0XEF,0XBF,0XF7,0XFF,0XBE,0X3C,0XBE,0X5D,0X8C,0XB8,0XAD,0XFE,
-0X8C,0XDA,0X3A,0X70,0X19,0X4C,0X32,0X50,0X6C,0X17,0X84,0XDA,0XAE,0X3F,0XA5,0XBE,
-0XA5,0XBE,0X95,0X3C,0X53,0X54,0X21,0XAE,0X29,0XEF,0X4A,0XD1,0XA5,0XBB,0X9D,0X58,
-0XAD,0XBA,0XD7,0X1F,0X9D,0X58,0XDF,0X3F,0XC6,0X9C,0X9D,0X36,0X5B,0X2E,0XF7,0XDF,
-0XF7,0XBF,0XFF,0XFF,0XF7,0X9E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XBF,0XF7,0XBF,0XFF,0XFF,
-0XE7,0X5E,0X31,0XC8,0XDF,0X1E,0XBE,0X3B,0X9D,0X37,0XDF,0X3F,0XDF,0X5F,0X7C,0X35,
-0XCE,0XDF,0X53,0X13,0X19,0X6D,0X4B,0X13,0XA5,0XBE,0XCF,0X1F,0X9D,0XBE,0X63,0XF7,
-0X3A,0XB2,0X53,0X55,0X53,0X34,0X5B,0X96,0XAD,0XFF,0XD7,0X3F,0X8C,0XFB,0X21,0XAD,
-0X32,0X0D,0X8C,0XF7,0XA5,0X9A,0X9D,0X38,0XE7,0XBF,0XA5,0X99,0XCE,0XBD,0XE7,0X7F,
-0X63,0X6F,0X94,0XD4,0XEF,0X9F,0XFF,0XFF,0XF7,0XBF,0XFF,0XDF,0XFF,0XFF,0XFF,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XBF,0XFF,0XDF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0X84,0X73,0X84,0X73,0XEF,0XBF,0XCE,0X9D,0XCE,0XDE,0XE7,0X9F,
-0X63,0X71,0XDF,0X5F,0X32,0X4F,0X19,0X8D,0X8D,0X1A,0XC6,0XFF,0X63,0XD6,0X09,0X0B,
-0X09,0X2C,0X2A,0X30,0X4B,0X14,0X4B,0X13,0X3A,0X91,0X21,0XCE,0X11,0X6D,0X21,0XAE,
-0X74,0X38,0XDF,0X9F,0X53,0X52,0X19,0X49,0X84,0XB6,0XB6,0X1C,0X95,0X38,0XF7,0XFF,
-0XDF,0X3F,0XAD,0XB9,0XD6,0XDD,0X4A,0X8B,0XCE,0X7B,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XBE,0XFF,0XFF,0XFF,0XFF,
-0XF7,0XBF,0XFF,0XFF,0XFF,0XFF,0XCE,0X7A,0X3A,0X2A,0XEF,0XBF,0XAD,0X98,0XAD,0XDA,
-0XE7,0X9F,0X7C,0X34,0XE7,0X7F,0X29,0XEC,0X32,0X2D,0XBE,0X7F,0X95,0X5A,0X11,0X6B,
-0X22,0X0D,0X8D,0X5B,0XC7,0X1F,0XC7,0X1F,0XA6,0X3E,0X9D,0XDD,0XBE,0XBF,0XDF,0X9F,
-0XAE,0X3E,0X5B,0X94,0X2A,0X0E,0X21,0XED,0XCE,0XFF,0X7C,0X55,0X19,0X49,0X7C,0X76,
-0XA5,0X9A,0XAD,0XFB,0XB5,0XFA,0XDF,0X5F,0XDF,0X3E,0X84,0X73,0X84,0X52,0XEF,0X7E,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XBE,
-0XFF,0XFF,0XFF,0XFF,0XEF,0X7E,0XFF,0XFF,0XE7,0X3D,0X7C,0X31,0X9D,0X36,0XDF,0X3E,
-0XE7,0X5F,0XD7,0X1F,0X9D,0X59,0XB6,0X3C,0X53,0X31,0X2A,0X0D,0XAE,0X3D,0X74,0X77,
-0X11,0X6B,0X63,0XF5,0XC6,0XFF,0X84,0XF9,0X3A,0XB0,0X11,0X6B,0X19,0XAC,0X09,0X2A,
-0X11,0X4B,0X19,0XCC,0X53,0X53,0XB6,0X5E,0XAE,0X1D,0X3A,0X8F,0X21,0XAB,0XBE,0X7E,
-0X7C,0X77,0X11,0X4A,0XAD,0XFC,0X7C,0X75,0XD7,0X3F,0XA5,0X77,0X84,0X73,0XF7,0XFF,
-0X42,0X2A,0XD6,0XDC,0XF7,0XDF,0XFF,0XFF,0XF7,0XBE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFE,0XFF,0XFE,0XF7,0XBE,0XFF,0XFF,0XFF,0XFF,0XF7,0XDF,0XDF,0X3E,0X42,0X2A,
-0XFF,0XFF,0XB5,0X99,0XAD,0X99,0XDE,0XFF,0X8C,0XB7,0X95,0X19,0X21,0XCD,0XA5,0XDD,
-0X74,0X78,0X09,0X6C,0X84,0XFA,0XAE,0X3F,0X32,0X50,0X21,0XCE,0X4B,0X13,0X8C,0XFA,
-0XB6,0X5F,0XC6,0XDF,0XA5,0XFD,0X74,0X77,0X3A,0X90,0X11,0X6B,0X5B,0XD5,0XD7,0X7F,
-0X3A,0XAF,0X32,0X4E,0XB6,0X7F,0X4B,0X12,0X3A,0X6F,0XC6,0X9F,0X8C,0XF6,0XC6,0X9C,
-0XD7,0X1D,0XC6,0X5A,0X8C,0X94,0X8C,0X74,0XEF,0X9F,0XFF,0XFF,0XF7,0XBF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFE,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XF7,0XFF,
-0X9D,0X16,0X7C,0X12,0XCE,0X5C,0XB5,0XB9,0XD6,0X9D,0XA5,0X39,0XCE,0X9F,0X3A,0X70,
-0X5B,0X74,0XA5,0XFE,0X19,0XCF,0X6C,0X58,0XAE,0X5F,0X32,0X50,0X32,0X30,0XA5,0XBD,
-0XC6,0XBF,0X6B,0XD5,0X42,0X90,0X42,0XB0,0X4A,0XF1,0X7C,0XB8,0XC6,0XDF,0X7C,0XD8,
-0X19,0XAC,0X3A,0XB0,0XC7,0X1F,0X19,0XCC,0X42,0XD2,0XC6,0XDF,0X19,0X8D,0X84,0X77,
-0X7C,0X75,0XE7,0X7F,0XAD,0X97,0XD6,0XFD,0XE7,0X3F,0X39,0XEB,0XEF,0X7F,0XEF,0X7F,
-0XFF,0XFF,0XE7,0X5C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,
-0XEF,0XBF,0XF7,0XFF,0X52,0XCD,0XC6,0X5B,0XE7,0X5F,0XD6,0X9D,0XFF,0XFF,0X8C,0X76,
-0X95,0X19,0X09,0X09,0XB6,0X5F,0X53,0X54,0X3A,0XB2,0XC6,0XDF,0X2A,0X0F,0X32,0X50,
-0XCE,0XFF,0X6B,0XF5,0X08,0XE8,0X31,0XEC,0X4A,0XD0,0X63,0XB3,0X4A,0XD0,0X09,0X09,
-0X32,0X4E,0XAD,0XFD,0XA5,0XDD,0X2A,0X2E,0X64,0X15,0XB6,0X7F,0X11,0X4C,0X95,0X5C,
-0X6B,0XD6,0X21,0XAC,0XDF,0X5F,0X8C,0XD5,0XC6,0X7B,0XAD,0XB8,0XCE,0X7C,0X5B,0X0F,
-0XD6,0XBD,0XEF,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDE,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XEF,0XBF,0XEF,0XBF,0X3A,0X2A,0XEF,0X9F,0XAD,0X98,0XA5,0X37,
-0XC6,0X3C,0XB5,0XDB,0X4A,0XD0,0X5B,0X53,0XC6,0XBF,0X00,0XEA,0XA5,0XDE,0X63,0XD6,
-0X29,0XCD,0XC6,0X9F,0X52,0XF0,0X29,0XAB,0X84,0X75,0XF7,0XFF,0XEF,0XBF,0XE7,0X5F,
-0XEF,0XBF,0XD7,0X3F,0X4A,0XF0,0X19,0X6A,0X7C,0X97,0X9D,0X9B,0X09,0X6B,0XA6,0X1E,
-0X5B,0XB5,0X29,0XEF,0XDF,0X5F,0X11,0X09,0X9D,0X58,0X8C,0XD5,0XEF,0XBF,0XF7,0XFF,
-0XCE,0X7D,0X84,0X54,0X9C,0XF6,0XFF,0XFF,0XE7,0X5D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XDE,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XCE,0XBC,0X52,0XED,0XE7,0X5F,
-0XE7,0X5F,0XFF,0XFF,0X9D,0X17,0XCE,0X7D,0X21,0X6A,0X9D,0X7B,0X53,0X33,0X3A,0X91,
-0XBE,0X9F,0X29,0XCD,0X8C,0XD9,0X8C,0XF8,0X19,0X29,0XB5,0XFB,0XDF,0X1F,0XEF,0XBF,
-0XFF,0XFF,0XF7,0XDF,0XEF,0X9F,0XF7,0XFF,0XD7,0X3F,0X63,0X73,0X42,0X90,0XB6,0X3E,
-0X3A,0XF1,0X43,0X12,0XBE,0X9F,0X11,0X4C,0XA5,0XDE,0X53,0X52,0X42,0XAE,0XAD,0XB8,
-0XD6,0XFC,0XAD,0X97,0XBE,0X1B,0XBE,0X1B,0X52,0XCE,0XEF,0X5F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XF7,0XDF,0XA5,0X57,
-0X7C,0X12,0XCE,0X9C,0X94,0XB5,0XEF,0X7F,0X84,0X54,0XB5,0XBA,0X21,0X8B,0XCE,0XFF,
-0X21,0XED,0X7C,0XB9,0X74,0X37,0X29,0XCD,0XBE,0X5E,0X32,0X0D,0X74,0X13,0XEF,0XBF,
-0XFF,0XFF,0XFF,0XFF,0XEF,0X9F,0XF7,0XDF,0XE7,0X9F,0XAD,0XDA,0XE7,0XBF,0XC6,0XBF,
-0X29,0XED,0X6C,0X16,0X8D,0X5B,0X19,0XCD,0XAE,0X5F,0X42,0XB2,0X6C,0X17,0X84,0XD8,
-0X3A,0X6D,0XBE,0X3A,0XAD,0XD8,0XEF,0X9F,0XDF,0X3F,0XCE,0X7D,0X4A,0X4C,0XFF,0XFF,
-0XFF,0XFF,0XEF,0X9D,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XF7,0XDF,0XFF,0XFF,
-0XEF,0XBF,0X84,0X73,0X94,0XF5,0XD6,0XDD,0XB5,0XD9,0XEF,0X9F,0X94,0XD6,0X7C,0X34,
-0X3A,0X4E,0XD7,0X5F,0X63,0XF6,0XAE,0X5F,0X42,0X91,0X73,0XF6,0X8C,0XD9,0X21,0X6A,
-0XDF,0X3F,0XE7,0X7F,0XFF,0XFF,0XEF,0XDF,0XFF,0XFF,0XE7,0X9F,0XA5,0X78,0X11,0X28,
-0X5B,0X31,0XE7,0XBF,0X84,0XDA,0X11,0X4B,0XD7,0XBF,0X09,0X6B,0X8D,0X3C,0X7C,0X9A,
-0X95,0X3C,0XA5,0X9C,0X08,0XC6,0XEF,0XBF,0X94,0XF5,0XBE,0X3A,0XB5,0XB9,0XEF,0X9F,
-0X39,0XEA,0XEF,0X9F,0XEF,0XBE,0XF7,0XBE,0XFF,0XFF,0XFF,0XFF,0XFF,0XBF,0XFF,0XFF,
-0XF7,0XBF,0XFF,0XFF,0XEF,0XBF,0X7C,0X32,0XA5,0X57,0XEF,0X9F,0XEF,0XBF,0XF7,0XDF,
-0X94,0XD6,0X6B,0XD3,0X8C,0XB7,0XBE,0X9F,0X5B,0XD5,0X8D,0X3B,0XA5,0XBE,0XB6,0X1F,
-0X6B,0XD5,0X4A,0XD0,0XEF,0XDF,0XF7,0XFF,0XDF,0X3E,0XF7,0XFF,0XEF,0XDF,0XE7,0XBF,
-0X8C,0XF6,0X29,0XEB,0X3A,0X6F,0XBE,0X7F,0XBE,0X9F,0X11,0X6D,0XAE,0X5F,0X8D,0X5B,
-0XAE,0X5F,0X6C,0X18,0X63,0XD6,0XEF,0XFF,0X4A,0XAE,0XB6,0X3A,0X84,0X93,0XF7,0XFF,
-0XFF,0XFF,0XE7,0X5F,0X4A,0X6D,0XDF,0X3E,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XF7,0XDF,0XEF,0XBF,0X7C,0X52,0XA5,0X77,0XFF,0XFF,
-0XF7,0XBF,0XE7,0X7F,0XA5,0X58,0X8C,0XF7,0XAD,0XFC,0X63,0XD5,0X22,0X0E,0X09,0X2C,
-0X11,0X6D,0X53,0X75,0X9D,0X9C,0X9D,0XBC,0XEF,0XFF,0X95,0X58,0X42,0XCD,0XEF,0XFF,
-0XEF,0XFF,0X9D,0X77,0X32,0X4C,0X11,0X6A,0X2A,0X0E,0X5B,0X95,0XBE,0X9F,0X9D,0XBE,
-0X7C,0XFA,0X2A,0X2F,0X09,0X0C,0X19,0X6E,0X19,0X8D,0XAD,0XFD,0X95,0X18,0XC6,0X9C,
-0X8C,0XD4,0XF7,0XDF,0XFF,0XFF,0XEF,0X9F,0X42,0X4C,0XDF,0X3E,0XFF,0XFF,0XF7,0XDE,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XF7,0XDF,0XF7,0XDF,0X7C,0X12,
-0XB5,0XF9,0XEF,0XBF,0XBE,0X1A,0XE7,0X5F,0X94,0XD6,0XA5,0X9A,0XB6,0X1D,0X84,0XB9,
-0X3A,0XF2,0X22,0X30,0X11,0XAF,0X11,0X8E,0X09,0X4C,0X42,0XF1,0X84,0XD8,0X4B,0X30,
-0X53,0X50,0XB6,0X5B,0XEF,0XFF,0XD7,0X3F,0X63,0XD3,0X19,0XAC,0X09,0X4B,0XAE,0X3F,
-0X7C,0XDC,0X11,0X6E,0X09,0X4C,0X22,0X2F,0X21,0XEF,0X2A,0X31,0X5B,0X96,0X8C,0XFA,
-0X9D,0X58,0XD6,0XFE,0X8C,0XD4,0XEF,0XDF,0XBE,0X3B,0XF7,0XDF,0X42,0X4C,0XDF,0X3E,
-0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XF7,0XDF,
-0XF7,0XFF,0X7C,0X32,0XB5,0XF9,0XEF,0X9F,0X8C,0XB5,0XEF,0XBF,0X8C,0XB6,0X95,0X18,
-0X84,0XD8,0X74,0X78,0X74,0X99,0X7C,0XDB,0X85,0X3D,0X74,0XBB,0X43,0X34,0X11,0XAD,
-0X19,0XCD,0X11,0X8B,0X19,0X8A,0XA5,0XFB,0XCF,0X1F,0X63,0XF4,0X22,0X0D,0X19,0XCD,
-0X19,0XAE,0X09,0X4D,0X01,0X0D,0X21,0XF0,0X6C,0X58,0X7C,0XDA,0X7C,0XBA,0X84,0XDB,
-0X8C,0XFB,0X7C,0X98,0X84,0XD7,0XAD,0XF9,0X8C,0XD4,0XEF,0XBF,0X8C,0XB5,0XF7,0XFF,
-0X3A,0X2B,0XE7,0X7F,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,
-0XFF,0XDF,0XF7,0XDF,0XFF,0XFF,0X94,0XD4,0X8C,0XD4,0XF7,0XFF,0X8C,0XB4,0XF7,0XFF,
-0X8C,0X95,0X52,0XF0,0X3A,0XB0,0X32,0X70,0X64,0X18,0X6C,0X9B,0X74,0XDC,0X74,0XDC,
-0X85,0X3D,0X7D,0X1C,0X6C,0X78,0X43,0X12,0X11,0X6B,0X9D,0XBB,0XE7,0XFF,0XCF,0X3F,
-0X32,0X4F,0X11,0X4C,0X09,0X4C,0X5B,0XB7,0X84,0XFD,0X84,0XFC,0X7C,0XDA,0X95,0X9D,
-0X85,0X1C,0X6C,0X39,0X53,0X55,0X42,0XB1,0X21,0XAA,0X9D,0X98,0X9D,0X77,0XDF,0X5F,
-0X9D,0X37,0XEF,0X7F,0X39,0XEA,0XF7,0XFF,0XFF,0XFF,0XF7,0XFE,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XBF,0XFF,0XFF,0XFF,0XBF,0XFF,0XDF,0XFF,0XFF,0XB5,0XF9,0X5B,0X0D,0XF7,0XFF,
-0X8C,0XD4,0XE7,0X9F,0X6B,0XD2,0X29,0XCC,0X19,0X6C,0X11,0X6D,0X19,0XF0,0X01,0X4E,
-0X01,0X6F,0X1A,0X31,0X2A,0XB3,0X74,0XBA,0X74,0XBA,0X7C,0XB9,0X74,0X57,0X42,0XF2,
-0X8D,0X3A,0X74,0X37,0X21,0XAD,0X53,0X54,0X7C,0X9A,0X74,0X59,0X6C,0X39,0X6C,0X59,
-0X3A,0XD2,0X00,0XEB,0X09,0X4D,0X21,0XD0,0X00,0XEB,0X19,0X8D,0X21,0XCB,0X21,0X88,
-0XC6,0X9C,0XBE,0X3A,0XCE,0XBD,0XCE,0XBD,0X4A,0X8C,0XF7,0XFF,0XF7,0XFF,0XF7,0XFE,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XBE,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XDF,0X1D,
-0X42,0X4A,0XF7,0XFF,0XA5,0X77,0XDF,0X5F,0XAD,0XBA,0X84,0X97,0X7C,0X98,0X7C,0XBA,
-0X6C,0X5A,0X64,0X5B,0X4B,0X97,0X43,0X77,0X22,0X31,0X09,0X6E,0X19,0XCF,0X5B,0XB6,
-0X74,0X79,0X63,0XB5,0X53,0X54,0X53,0X13,0X7C,0X58,0X6C,0X17,0X84,0XDB,0X3A,0X92,
-0X19,0X6E,0X11,0X6D,0X2A,0X70,0X4B,0X75,0X6C,0X39,0X74,0X7A,0X84,0XFB,0X63,0XD5,
-0X9D,0X9A,0X5B,0X90,0XE7,0X9F,0X95,0X16,0XEF,0X9F,0XA5,0X58,0X7C,0X33,0XEF,0XBF,
-0XEF,0XDE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDE,0XFF,0XFF,0XFF,0XDF,0XF7,0XDF,
-0XF7,0XFF,0XEF,0XBF,0X52,0XEC,0XCE,0XBC,0XD6,0XDD,0XB6,0X1A,0XD7,0X1F,0X84,0X97,
-0X84,0XDA,0X21,0XEF,0X01,0X2E,0X11,0XD1,0X32,0XB4,0X2A,0XB3,0X5C,0X19,0X6C,0X7A,
-0X7C,0XDB,0X53,0X75,0X2A,0X10,0X6B,0XF7,0X63,0X96,0X84,0X99,0X5B,0X75,0X4A,0XB2,
-0X29,0XEF,0X7C,0X79,0X74,0X18,0X74,0X79,0X5B,0XD6,0X32,0X91,0X21,0XF0,0X11,0X4E,
-0X19,0X8E,0X29,0XEE,0XC6,0XBF,0X84,0XD5,0XE7,0XBF,0X94,0XF5,0XF7,0XDF,0X63,0X70,
-0XB5,0XFA,0XF7,0XFF,0XEF,0XBE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDE,0XFF,0XFF,
-0XFF,0XFF,0XF7,0XDF,0XF7,0XFF,0XF7,0XFF,0X73,0XD0,0XAD,0X97,0XF7,0XDF,0X84,0X74,
-0XF7,0XFF,0X84,0X76,0XD7,0X1F,0X19,0X8D,0X09,0X4D,0X11,0X8E,0X09,0X6D,0X09,0X8D,
-0X09,0X8D,0X11,0X8D,0X19,0XCE,0X2A,0X30,0X7C,0X79,0X6C,0X17,0X42,0X91,0X63,0X74,
-0X4A,0XF2,0X7C,0X78,0X6B,0XD5,0X4A,0XF2,0X5B,0X74,0X63,0XB5,0X6C,0X17,0X6C,0X58,
-0X9D,0X9E,0XAE,0X1F,0X95,0X5C,0X84,0X98,0XBE,0X7D,0XBE,0X7C,0XDF,0X3F,0XA5,0X57,
-0XF7,0XDF,0X31,0XCA,0XDF,0X1E,0XFF,0XFF,0XEF,0XDF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XDE,0XFF,0XFF,0XF7,0XBE,0XFF,0XFF,0XF7,0XDF,0XFF,0XFF,0XD6,0XDC,0X42,0X4A,
-0XF7,0XFF,0XA5,0X78,0XCE,0XBD,0XCE,0XDF,0XA5,0XBA,0X7C,0X76,0X19,0X6B,0X19,0XAB,
-0X19,0XAB,0X11,0XAB,0X11,0XAB,0X32,0X6F,0X3A,0XB0,0X42,0XF1,0X63,0XD4,0X5B,0X94,
-0XB6,0X5E,0XAE,0X1C,0XAD,0XFC,0X95,0X59,0X8D,0X18,0X9D,0X9B,0XAD,0XDC,0XBE,0X7F,
-0XC6,0XBF,0XBE,0X7F,0XB6,0X5F,0XA5,0XBD,0X7C,0X78,0XE7,0XBF,0X84,0X76,0XEF,0XBF,
-0X94,0XF7,0XE7,0X5F,0XC6,0X3B,0X52,0XAD,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XDE,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XDF,0X1D,0X63,0X4E,0XBE,0X3A,0XEF,0X9F,0X9D,0X37,0XEF,0XBF,0X84,0X95,0XD7,0X1F,
-0X84,0X95,0X9D,0X79,0XBE,0XBD,0XCF,0X3F,0XEF,0XFF,0XDF,0X9F,0XCF,0X1F,0XBE,0X9E,
-0X84,0XF8,0X9D,0XBA,0X84,0XD7,0X74,0X54,0X6C,0X13,0X5B,0X71,0X4B,0X10,0X4A,0XCF,
-0X2A,0X0D,0X21,0XAC,0X19,0X4B,0X29,0XCD,0X19,0X4B,0X11,0X09,0X84,0X97,0XA5,0X9B,
-0XC6,0X5D,0XDF,0X3F,0X9D,0X17,0XEF,0XBF,0X5A,0XCD,0XB5,0XB9,0XFF,0XFF,0XFF,0XFF,
-0XF7,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,
-0XFF,0XDF,0XFF,0XFF,0XF7,0XBF,0XA5,0X56,0X63,0X4F,0XF7,0XFF,0X9D,0X37,0XBE,0X5C,
-0XDF,0X5F,0X94,0XF7,0XE7,0X9F,0XBE,0X5C,0XDF,0X9F,0XEF,0XFF,0XDF,0X9F,0XDF,0X9F,
-0XC6,0XDF,0X95,0X59,0X95,0X79,0X74,0X75,0X7C,0X95,0X74,0X33,0X6C,0X13,0X5B,0X92,
-0X5B,0X72,0X53,0X33,0X32,0X0F,0X21,0X8D,0X29,0XAC,0X08,0XC8,0X19,0X6A,0X74,0X14,
-0XC6,0X7E,0X95,0X18,0XDF,0X5F,0X94,0XF6,0XDF,0X3F,0XC6,0X3A,0X42,0X4B,0XF7,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XF7,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XDF,0XFF,0XFF,0XF7,0XBF,0XFF,0XFF,0XFF,0XFF,0XE7,0X3E,0X52,0XAC,0XB5,0XD9,
-0XF7,0XFF,0X84,0X94,0XEF,0XBF,0XBE,0X3C,0X8C,0XD6,0XBE,0X5D,0X21,0XAB,0X21,0XCC,
-0X4B,0X12,0X63,0XD5,0X74,0X57,0X9D,0X7B,0XBE,0X7F,0XD7,0X5F,0XEF,0XDF,0XEF,0XFF,
-0XF7,0XFF,0XF7,0XFF,0XEF,0XDF,0XF7,0XFF,0XE7,0X9F,0XEF,0XBF,0XB6,0X3D,0X8C,0XD7,
-0X74,0X13,0XD7,0X1F,0X74,0X33,0XD7,0X1F,0XC6,0X9C,0XAD,0X98,0XF7,0XDF,0X5B,0X2D,
-0XB5,0XD8,0XF7,0XDF,0XF7,0XBE,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XF7,0XBF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XBE,0X19,0X4A,0X8C,0XF7,0XDF,0XCE,0XBD,0X9D,0X17,0XE7,0X7F,0XAD,0XDA,0XA5,0XBB,
-0XBE,0X7F,0X42,0XB3,0X11,0X2D,0X21,0X6F,0X21,0X90,0X19,0X2E,0X10,0XED,0X21,0X6E,
-0X29,0XCE,0X6B,0XB4,0XC6,0X5D,0XE7,0X9F,0XF7,0XFF,0XF7,0XFF,0XEF,0XDF,0XF7,0XFF,
-0XDF,0X5F,0XF7,0XFF,0XDF,0X5F,0X6B,0XD1,0XDF,0X5F,0XE7,0X7F,0X84,0X94,0XEF,0XDF,
-0X94,0XF4,0X4A,0XAB,0XFF,0XFF,0XEF,0XBE,0XFF,0XFE,0XFF,0XFF,0XFF,0XFE,0XFF,0XFE,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X7C,0X11,0X63,0X6F,0XF7,0XFF,0XC6,0X5B,0X94,0XF6,
-0XF7,0XFF,0XA5,0XBA,0X84,0X98,0XD7,0X1F,0X74,0X18,0X19,0X2D,0X19,0X4E,0X21,0X4E,
-0X31,0XEF,0X3A,0X4F,0X6B,0XD4,0XA5,0X79,0XEF,0XBF,0XF7,0XFF,0XFF,0XFF,0XF7,0XFF,
-0XEF,0XBE,0XF7,0XFF,0XF7,0XFF,0XC6,0X9C,0X7C,0X33,0XF7,0XFF,0XCE,0XDC,0X73,0XF1,
-0XF7,0XFF,0XCE,0XBB,0X5B,0X0C,0XC6,0X59,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFE,0XFF,0XFE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XF7,0XDF,0XEF,0X9F,0XF7,0XDF,0X5B,0X0D,0X94,0XF5,
-0XEF,0XBF,0XB5,0XF9,0XB5,0XD9,0XEF,0XDF,0XCF,0X1F,0X7C,0X75,0XBE,0X9D,0XCF,0X1F,
-0X9D,0X78,0XC6,0XBC,0XE7,0XDF,0XE7,0X9D,0XF7,0XFE,0XF7,0XFD,0XF7,0XFD,0XEF,0XBC,
-0XE7,0X9C,0XF7,0XDE,0XF7,0XDF,0XFF,0XFF,0X95,0X15,0X7C,0X32,0XF7,0XFF,0XDF,0X5F,
-0X8C,0XB4,0XE7,0X5E,0XE7,0X5E,0X42,0X6A,0X9D,0X35,0XFF,0XFF,0XEF,0X7D,0XFF,0XFF,
-0XFF,0XFF,0XF7,0XDE,0XFF,0XFE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XBF,
-0XEF,0X9F,0X42,0X4A,0XA5,0X77,0XEF,0XBF,0XF7,0XFF,0XEF,0XBF,0XE7,0XDF,0XE7,0XDF,
-0X9D,0X55,0X7C,0X92,0XB6,0X38,0XDF,0X7D,0XEF,0XFE,0XF7,0XFE,0XF7,0XFD,0XEF,0XDC,
-0XFF,0XFD,0XFF,0XFE,0XFF,0XFE,0XE7,0X5C,0XA5,0X35,0X7B,0XF1,0XC6,0X7B,0XE7,0X7F,
-0XE7,0X9F,0XEF,0XBF,0XEF,0XDF,0XEF,0X9F,0X32,0X08,0XA5,0X76,0XFF,0XFF,0XFF,0XFF,
-0XF7,0XBE,0XF7,0XDE,0XFF,0XFF,0XFF,0XFE,0XFF,0XFF,0XFF,0XDE,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XE7,0X3D,0XFF,0XFF,0XD6,0XFD,0X52,0XCC,0X84,0X52,0XFF,0XFF,0XEF,0XBF,
-0XDF,0X9C,0XB6,0X37,0XC6,0XDA,0XEF,0XFF,0XC6,0X7B,0X8C,0XB5,0X7C,0X54,0X84,0X74,
-0X94,0XB5,0X8C,0XB4,0X94,0XF4,0X7C,0X11,0X84,0X31,0XAD,0X76,0XC6,0X19,0XE7,0X5E,
-0XCE,0XBC,0X9D,0X16,0XEF,0XBF,0XF7,0XDF,0XD6,0XDC,0X42,0X4A,0X9C,0XF5,0XF7,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XBF,0XEF,0X9E,0XFF,0XFF,0XCE,0X9B,0X52,0XCC,
-0X5B,0X0D,0XE7,0X5D,0XCE,0XDA,0XA5,0XB6,0XDF,0X5D,0XF7,0XFF,0XD7,0X1E,0XC6,0X7D,
-0XF7,0XBF,0XEF,0X7F,0XD6,0XDE,0XE7,0X5F,0XF7,0XBF,0XF7,0XDF,0XFF,0XFF,0XDE,0XDC,
-0XB5,0XD8,0XF7,0X9F,0XE7,0X5F,0XB5,0XD9,0XA5,0X57,0XA5,0X77,0X4A,0X8B,0XA5,0X77,
-0XFF,0XFF,0XF7,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE7,0X3D,0XFF,0XFF,0XFF,0XFF,0XEF,0XBF,
-0XFF,0XFF,0XFF,0XFF,0X94,0XD3,0X3A,0X09,0X94,0XF5,0XC6,0X9C,0XF7,0XFF,0XC6,0X7B,
-0XBE,0X3B,0XB5,0XF9,0XE7,0X5E,0XDF,0X5D,0XC6,0X79,0XF7,0XDE,0XD6,0XFB,0XBE,0X18,
-0XF7,0XBF,0XEF,0X7F,0XB5,0XD9,0XD6,0XDD,0XFF,0XFF,0XBE,0X3A,0X6B,0X90,0X4A,0X8B,
-0XDE,0XFD,0XF7,0XDF,0XFF,0XDF,0XF7,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XE7,0X5D,0XEF,0XBE,0XF7,0XBF,0XCE,0X9B,0X63,0X6F,0X3A,0X2B,
-0X94,0XD5,0XDF,0X1F,0XF7,0XDF,0XDF,0X1E,0XE7,0X7E,0XBE,0X18,0XB5,0XF7,0XFF,0XFF,
-0XE7,0X5D,0XBE,0X18,0XEF,0X9F,0XFF,0XFF,0XCE,0X7D,0XBE,0X1B,0X52,0XCD,0X4A,0X8B,
-0X9D,0X15,0XF7,0XDF,0XF7,0XBF,0XEF,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF7,0XFF,0XC6,0X59,0X6B,0X8F,0X39,0XEA,0X5B,0X0F,0X94,0XB6,0XBD,0XFC,0XD6,0X9E,
-0XC6,0X7D,0XDF,0X1F,0XCE,0X9E,0XAD,0X9A,0X94,0XB7,0X63,0X52,0X4A,0X6F,0X52,0XAF,
-0XAD,0X77,0XF7,0XBF,0XE7,0X3E,0XFF,0XFF,0XEF,0X5E,0XFF,0XFF,0XEF,0X7E,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XDE,0XFF,0XFF,0XFF,0XFF,0XF7,0XDE,
-0XEF,0X9E,0XFF,0XFF,0XFF,0XFF,0XEF,0X7D,0XF7,0XDF,0XFF,0XFF,0XB5,0XB9,0X7B,0XF4,
-0X63,0X31,0X4A,0X8E,0X39,0XEB,0X39,0XEB,0X42,0X4D,0X6B,0X92,0X84,0X55,0X94,0XF8,
-0XCE,0XBF,0XF7,0XFF,0XE7,0X3E,0XFF,0XFF,0XFF,0XFF,0XF7,0XBF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XDF,0XF7,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XDE,0XFF,0XFF,0XFF,0XFF,0XEF,0X7D,0XF7,0X9F,0XFF,0XFF,0XFF,0XFF,0XE7,0X5F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XBF,0XFF,0XFF,0XF7,0XFF,0XEF,0XBE,0XEF,0XDE,
-0XEF,0XFF,0XF7,0XFF,0XF7,0XFF,0XF7,0XFF,0XFF,0XFF,0XEF,0X7D,0XE7,0X5D,0XFF,0XFF,
-0XF7,0XDE,0XF7,0XBE,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XBE,0XF7,0XDE,0XFF,0XFF,0XFF,0XFF,0XEF,0X7F,
-0XFF,0XFF,0XF7,0X9F,0XFF,0XFF,0XE7,0X5E,0XFF,0XFF,0XFF,0XFF,0XEF,0XBD,0XFF,0XFE,
-0XF7,0XFD,0XF7,0XFD,0XF7,0XFE,0XEF,0XFD,0XF7,0XFE,0XF7,0XDE,0XEF,0X9D,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XBD,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,};
+const unsigned char gImage_QC[3982] = {
+ //50x50 RLE
+ 0x52, 0x4C, 0x45, 0x31, 0x00, 0x32, 0x00, 0x32, 0x88, 0xFF, 0xFF, 0x00, 0xFF, 0xDE, 0x82, 0xFF,
+ 0xFF, 0x00, 0xFF, 0xDE, 0x81, 0xFF, 0xFF, 0x81, 0xFF, 0xFD, 0x01, 0xFF, 0xFE, 0xF7, 0xDC, 0x82,
+ 0xFF, 0xFE, 0x03, 0xF7, 0xDD, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xDD, 0x81, 0xFF, 0xFE, 0x00, 0xF7,
+ 0xDD, 0x81, 0xFF, 0xFE, 0x84, 0xFF, 0xFF, 0x02, 0xF7, 0xBE, 0xFF, 0xFF, 0xFF, 0xFE, 0x94, 0xFF,
+ 0xFF, 0x00, 0xF7, 0xBE, 0x82, 0xFF, 0xFF, 0x09, 0xF7, 0xBE, 0xFF, 0xDE, 0xF7, 0xDD, 0xFF, 0xDE,
+ 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xFE, 0xF7, 0xDE, 0xFF, 0xFF, 0xE7, 0x7D, 0x86, 0xFF, 0xFF, 0x02,
+ 0xF7, 0xBE, 0xFF, 0xFF, 0xF7, 0x9E, 0x83, 0xFF, 0xFF, 0x00, 0xF7, 0xDE, 0x92, 0xFF, 0xFF, 0x00,
+ 0xFF, 0xDE, 0x81, 0xFF, 0xFF, 0x01, 0xF7, 0xBE, 0xEF, 0x7D, 0x84, 0xFF, 0xFF, 0x01, 0xFF, 0xDF,
+ 0xF7, 0xDF, 0x82, 0xF7, 0xBF, 0x81, 0xFF, 0xFF, 0x05, 0xF7, 0xDF, 0xEF, 0x7F, 0xF7, 0xBF, 0xFF,
+ 0xFF, 0xF7, 0xBF, 0xEF, 0x5D, 0x84, 0xFF, 0xFF, 0x02, 0xF7, 0x9E, 0xFF, 0xDF, 0xF7, 0xDE, 0x91,
+ 0xFF, 0xFF, 0x00, 0xF7, 0xDE, 0x85, 0xFF, 0xFF, 0x01, 0xEF, 0x7E, 0xFF, 0xFF, 0x81, 0xFF, 0xDF,
+ 0x81, 0xFF, 0xFF, 0x0B, 0xE7, 0x3F, 0xC6, 0x3B, 0x9D, 0x37, 0xA5, 0x37, 0x8C, 0x95, 0x94, 0xF6,
+ 0xB5, 0xB9, 0xD6, 0xBD, 0xEF, 0x7F, 0xFF, 0xBF, 0xFF, 0xFF, 0xF7, 0xBF, 0x81, 0xFF, 0xFF, 0x00,
+ 0xF7, 0xDF, 0x95, 0xFF, 0xFF, 0x01, 0xF7, 0xDE, 0xFF, 0xFF, 0x81, 0xF7, 0xDF, 0x81, 0xFF, 0xFF,
+ 0x18, 0xEF, 0x9E, 0xFF, 0xFF, 0xF7, 0x9F, 0xF7, 0xBF, 0xC6, 0x5B, 0x7C, 0x32, 0x31, 0xCA, 0x29,
+ 0x89, 0x63, 0x50, 0x73, 0xD2, 0x73, 0xF2, 0x73, 0xD2, 0x84, 0x54, 0x6B, 0x91, 0x42, 0x4C, 0x3A,
+ 0x0A, 0x5A, 0xEE, 0x9C, 0xF6, 0xF7, 0xBF, 0xEF, 0x7E, 0xF7, 0xBF, 0xFF, 0xFF, 0xF7, 0xBF, 0xE7,
+ 0x5D, 0xEF, 0x7D, 0x93, 0xFF, 0xFF, 0x00, 0xEF, 0x9E, 0x81, 0xFF, 0xFF, 0x0A, 0xEF, 0x9E, 0xEF,
+ 0x9F, 0xFF, 0xFF, 0xE7, 0x5E, 0xBD, 0xF9, 0x63, 0x4E, 0x3A, 0x0A, 0x94, 0xF5, 0xE7, 0x3F, 0xEF,
+ 0x9F, 0xEF, 0xDF, 0x81, 0xCE, 0xBD, 0x00, 0xC6, 0x7C, 0x81, 0xE7, 0x5F, 0x08, 0xEF, 0x9F, 0xE7,
+ 0x5F, 0xA5, 0x57, 0x84, 0x53, 0x31, 0xC8, 0x8C, 0x93, 0xEF, 0x7F, 0xFF, 0xFF, 0xF7, 0xFF, 0x94,
+ 0xFF, 0xFF, 0x81, 0xF7, 0xDF, 0x81, 0xFF, 0xFF, 0x12, 0xF7, 0xDF, 0xFF, 0xFF, 0xCE, 0xBC, 0x63,
+ 0x4E, 0x52, 0xAB, 0xBE, 0x19, 0xEF, 0xBF, 0xDF, 0x5E, 0xBE, 0x39, 0xCE, 0xDC, 0xEF, 0xDF, 0xA5,
+ 0x98, 0xAD, 0xD9, 0xB6, 0x1A, 0xD7, 0x3E, 0xC6, 0x9B, 0xBE, 0x1A, 0xC6, 0x9B, 0xC6, 0x7B, 0x81,
+ 0xE7, 0x7F, 0x06, 0x6B, 0xB0, 0x42, 0x4A, 0x8C, 0x93, 0xEF, 0x9F, 0xFF, 0xFF, 0xEF, 0x9F, 0xF7,
+ 0xDF, 0x91, 0xFF, 0xFF, 0x14, 0xF7, 0xBE, 0xFF, 0xFF, 0xEF, 0x9E, 0xEF, 0x9F, 0xFF, 0xFF, 0x94,
+ 0xD4, 0x3A, 0x2A, 0xA5, 0x56, 0xE7, 0x5E, 0xD6, 0xFC, 0xBE, 0x7A, 0xD7, 0x1D, 0xBE, 0x7A, 0xAE,
+ 0x19, 0xD7, 0x3E, 0xBE, 0x7B, 0xCE, 0xFD, 0xBE, 0x7B, 0xDF, 0x5F, 0xCE, 0xFD, 0xBE, 0x5A, 0x81,
+ 0xB6, 0x19, 0x81, 0xEF, 0xBF, 0x06, 0xE7, 0x7F, 0xBE, 0x1A, 0x5B, 0x2E, 0x63, 0x6F, 0xD6, 0xBC,
+ 0xFF, 0xFF, 0xF7, 0xDF, 0x8A, 0xFF, 0xFF, 0x00, 0xFF, 0xBF, 0x82, 0xFF, 0xFF, 0x00, 0xFF, 0xDF,
+ 0x81, 0xFF, 0xFF, 0x16, 0xF7, 0xBE, 0xF7, 0xBF, 0xF7, 0xFF, 0xFF, 0xFF, 0x7C, 0x32, 0x4A, 0x8C,
+ 0xE7, 0x5F, 0xC6, 0x7B, 0xD7, 0x1D, 0x8C, 0xF5, 0xB6, 0x3A, 0xC6, 0xDC, 0xCE, 0xFD, 0xDF, 0x9F,
+ 0xA5, 0xD9, 0x7C, 0x94, 0x74, 0x73, 0x8C, 0xF6, 0x74, 0x53, 0x84, 0x94, 0xC6, 0xBC, 0xE7, 0x9F,
+ 0xE7, 0x7F, 0x81, 0xF7, 0xFF, 0x08, 0xAD, 0x98, 0xD6, 0xFE, 0xE7, 0x5F, 0x8C, 0xB4, 0x4A, 0xAC,
+ 0xD6, 0xDC, 0xF7, 0xFF, 0xEF, 0xBF, 0xF7, 0xDF, 0x81, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x87, 0xFF,
+ 0xFF, 0x81, 0xFF, 0xDF, 0x81, 0xFF, 0xFF, 0x22, 0xF7, 0xDF, 0xFF, 0xFF, 0xF7, 0xBF, 0xE7, 0x7F,
+ 0x7C, 0x32, 0x63, 0x4F, 0xDF, 0x3F, 0xBE, 0x1A, 0xAD, 0xB9, 0xAD, 0xD9, 0xE7, 0xBF, 0xDF, 0x7F,
+ 0x8C, 0xF6, 0x7C, 0x54, 0x95, 0x38, 0xA5, 0xDA, 0xC6, 0xFF, 0xB6, 0x5C, 0xAD, 0xFB, 0xB6, 0x3C,
+ 0xC6, 0xDE, 0xB6, 0x1C, 0x7C, 0x54, 0x7C, 0x75, 0xBE, 0x3C, 0xCE, 0xDE, 0xDF, 0x5F, 0xCE, 0xBD,
+ 0xBE, 0x5B, 0xCE, 0xDD, 0x94, 0xD5, 0x4A, 0xAC, 0xD6, 0xDC, 0xFF, 0xFF, 0xF7, 0xBF, 0x81, 0xF7,
+ 0xDF, 0x81, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x82, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x81, 0xFF, 0xFF,
+ 0x00, 0xFF, 0xDF, 0x83, 0xFF, 0xFF, 0x0E, 0xE7, 0x5E, 0xF7, 0xFF, 0x9D, 0x16, 0x52, 0xCD, 0xE7,
+ 0x7F, 0xCE, 0xDE, 0xC6, 0x7D, 0xBE, 0x5C, 0xCE, 0xDF, 0x95, 0x19, 0x8C, 0xF8, 0xBE, 0x7F, 0x9D,
+ 0x7B, 0x4B, 0x32, 0x32, 0x2E, 0x81, 0x19, 0x6B, 0x13, 0x19, 0x8C, 0x21, 0xCD, 0x21, 0x8C, 0x29,
+ 0xED, 0x6B, 0xF5, 0xAD, 0xBC, 0xAD, 0xFC, 0x84, 0x96, 0xC6, 0x9D, 0xDF, 0x5F, 0x9D, 0x58, 0xEF,
+ 0xBF, 0xCE, 0xBC, 0xB5, 0xD9, 0x3A, 0x09, 0xCE, 0xBC, 0xFF, 0xFF, 0xEF, 0xBF, 0xFF, 0xFF, 0xFF,
+ 0xDF, 0x84, 0xFF, 0xFF, 0x00, 0xFF, 0xBF, 0x84, 0xFF, 0xFF, 0x12, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7,
+ 0xFF, 0xBE, 0x3A, 0x3A, 0x2A, 0xDF, 0x5F, 0xEF, 0xBF, 0xF7, 0xFF, 0xBE, 0x3C, 0xBE, 0x5D, 0x8C,
+ 0xB8, 0xAD, 0xFE, 0x8C, 0xDA, 0x3A, 0x70, 0x19, 0x4C, 0x32, 0x50, 0x6C, 0x17, 0x84, 0xDA, 0xAE,
+ 0x3F, 0x81, 0xA5, 0xBE, 0x11, 0x95, 0x3C, 0x53, 0x54, 0x21, 0xAE, 0x29, 0xEF, 0x4A, 0xD1, 0xA5,
+ 0xBB, 0x9D, 0x58, 0xAD, 0xBA, 0xD7, 0x1F, 0x9D, 0x58, 0xDF, 0x3F, 0xC6, 0x9C, 0x9D, 0x36, 0x5B,
+ 0x2E, 0xF7, 0xDF, 0xF7, 0xBF, 0xFF, 0xFF, 0xF7, 0x9E, 0x89, 0xFF, 0xFF, 0x81, 0xF7, 0xBF, 0x28,
+ 0xFF, 0xFF, 0xE7, 0x5E, 0x31, 0xC8, 0xDF, 0x1E, 0xBE, 0x3B, 0x9D, 0x37, 0xDF, 0x3F, 0xDF, 0x5F,
+ 0x7C, 0x35, 0xCE, 0xDF, 0x53, 0x13, 0x19, 0x6D, 0x4B, 0x13, 0xA5, 0xBE, 0xCF, 0x1F, 0x9D, 0xBE,
+ 0x63, 0xF7, 0x3A, 0xB2, 0x53, 0x55, 0x53, 0x34, 0x5B, 0x96, 0xAD, 0xFF, 0xD7, 0x3F, 0x8C, 0xFB,
+ 0x21, 0xAD, 0x32, 0x0D, 0x8C, 0xF7, 0xA5, 0x9A, 0x9D, 0x38, 0xE7, 0xBF, 0xA5, 0x99, 0xCE, 0xBD,
+ 0xE7, 0x7F, 0x63, 0x6F, 0x94, 0xD4, 0xEF, 0x9F, 0xFF, 0xFF, 0xF7, 0xBF, 0xFF, 0xDF, 0xFF, 0xFF,
+ 0xFF, 0xDF, 0x82, 0xFF, 0xFF, 0x03, 0xFF, 0xBF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0x82, 0xFF,
+ 0xFF, 0x81, 0x84, 0x73, 0x20, 0xEF, 0xBF, 0xCE, 0x9D, 0xCE, 0xDE, 0xE7, 0x9F, 0x63, 0x71, 0xDF,
+ 0x5F, 0x32, 0x4F, 0x19, 0x8D, 0x8D, 0x1A, 0xC6, 0xFF, 0x63, 0xD6, 0x09, 0x0B, 0x09, 0x2C, 0x2A,
+ 0x30, 0x4B, 0x14, 0x4B, 0x13, 0x3A, 0x91, 0x21, 0xCE, 0x11, 0x6D, 0x21, 0xAE, 0x74, 0x38, 0xDF,
+ 0x9F, 0x53, 0x52, 0x19, 0x49, 0x84, 0xB6, 0xB6, 0x1C, 0x95, 0x38, 0xF7, 0xFF, 0xDF, 0x3F, 0xAD,
+ 0xB9, 0xD6, 0xDD, 0x4A, 0x8B, 0xCE, 0x7B, 0x81, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x84, 0xFF, 0xFF,
+ 0x00, 0xFF, 0xBE, 0x81, 0xFF, 0xFF, 0x00, 0xF7, 0xBF, 0x81, 0xFF, 0xFF, 0x0E, 0xCE, 0x7A, 0x3A,
+ 0x2A, 0xEF, 0xBF, 0xAD, 0x98, 0xAD, 0xDA, 0xE7, 0x9F, 0x7C, 0x34, 0xE7, 0x7F, 0x29, 0xEC, 0x32,
+ 0x2D, 0xBE, 0x7F, 0x95, 0x5A, 0x11, 0x6B, 0x22, 0x0D, 0x8D, 0x5B, 0x81, 0xC7, 0x1F, 0x13, 0xA6,
+ 0x3E, 0x9D, 0xDD, 0xBE, 0xBF, 0xDF, 0x9F, 0xAE, 0x3E, 0x5B, 0x94, 0x2A, 0x0E, 0x21, 0xED, 0xCE,
+ 0xFF, 0x7C, 0x55, 0x19, 0x49, 0x7C, 0x76, 0xA5, 0x9A, 0xAD, 0xFB, 0xB5, 0xFA, 0xDF, 0x5F, 0xDF,
+ 0x3E, 0x84, 0x73, 0x84, 0x52, 0xEF, 0x7E, 0x86, 0xFF, 0xFF, 0x00, 0xFF, 0xBE, 0x81, 0xFF, 0xFF,
+ 0x2A, 0xEF, 0x7E, 0xFF, 0xFF, 0xE7, 0x3D, 0x7C, 0x31, 0x9D, 0x36, 0xDF, 0x3E, 0xE7, 0x5F, 0xD7,
+ 0x1F, 0x9D, 0x59, 0xB6, 0x3C, 0x53, 0x31, 0x2A, 0x0D, 0xAE, 0x3D, 0x74, 0x77, 0x11, 0x6B, 0x63,
+ 0xF5, 0xC6, 0xFF, 0x84, 0xF9, 0x3A, 0xB0, 0x11, 0x6B, 0x19, 0xAC, 0x09, 0x2A, 0x11, 0x4B, 0x19,
+ 0xCC, 0x53, 0x53, 0xB6, 0x5E, 0xAE, 0x1D, 0x3A, 0x8F, 0x21, 0xAB, 0xBE, 0x7E, 0x7C, 0x77, 0x11,
+ 0x4A, 0xAD, 0xFC, 0x7C, 0x75, 0xD7, 0x3F, 0xA5, 0x77, 0x84, 0x73, 0xF7, 0xFF, 0x42, 0x2A, 0xD6,
+ 0xDC, 0xF7, 0xDF, 0xFF, 0xFF, 0xF7, 0xBE, 0x82, 0xFF, 0xFF, 0x81, 0xFF, 0xFE, 0x00, 0xF7, 0xBE,
+ 0x81, 0xFF, 0xFF, 0x29, 0xF7, 0xDF, 0xDF, 0x3E, 0x42, 0x2A, 0xFF, 0xFF, 0xB5, 0x99, 0xAD, 0x99,
+ 0xDE, 0xFF, 0x8C, 0xB7, 0x95, 0x19, 0x21, 0xCD, 0xA5, 0xDD, 0x74, 0x78, 0x09, 0x6C, 0x84, 0xFA,
+ 0xAE, 0x3F, 0x32, 0x50, 0x21, 0xCE, 0x4B, 0x13, 0x8C, 0xFA, 0xB6, 0x5F, 0xC6, 0xDF, 0xA5, 0xFD,
+ 0x74, 0x77, 0x3A, 0x90, 0x11, 0x6B, 0x5B, 0xD5, 0xD7, 0x7F, 0x3A, 0xAF, 0x32, 0x4E, 0xB6, 0x7F,
+ 0x4B, 0x12, 0x3A, 0x6F, 0xC6, 0x9F, 0x8C, 0xF6, 0xC6, 0x9C, 0xD7, 0x1D, 0xC6, 0x5A, 0x8C, 0x94,
+ 0x8C, 0x74, 0xEF, 0x9F, 0xFF, 0xFF, 0xF7, 0xBF, 0x82, 0xFF, 0xFF, 0x81, 0xFF, 0xFE, 0x81, 0xFF,
+ 0xFF, 0x81, 0xF7, 0xFF, 0x25, 0x9D, 0x16, 0x7C, 0x12, 0xCE, 0x5C, 0xB5, 0xB9, 0xD6, 0x9D, 0xA5,
+ 0x39, 0xCE, 0x9F, 0x3A, 0x70, 0x5B, 0x74, 0xA5, 0xFE, 0x19, 0xCF, 0x6C, 0x58, 0xAE, 0x5F, 0x32,
+ 0x50, 0x32, 0x30, 0xA5, 0xBD, 0xC6, 0xBF, 0x6B, 0xD5, 0x42, 0x90, 0x42, 0xB0, 0x4A, 0xF1, 0x7C,
+ 0xB8, 0xC6, 0xDF, 0x7C, 0xD8, 0x19, 0xAC, 0x3A, 0xB0, 0xC7, 0x1F, 0x19, 0xCC, 0x42, 0xD2, 0xC6,
+ 0xDF, 0x19, 0x8D, 0x84, 0x77, 0x7C, 0x75, 0xE7, 0x7F, 0xAD, 0x97, 0xD6, 0xFD, 0xE7, 0x3F, 0x39,
+ 0xEB, 0x81, 0xEF, 0x7F, 0x01, 0xFF, 0xFF, 0xE7, 0x5C, 0x81, 0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0x81,
+ 0xFF, 0xFF, 0x2A, 0xF7, 0xFF, 0xEF, 0xBF, 0xF7, 0xFF, 0x52, 0xCD, 0xC6, 0x5B, 0xE7, 0x5F, 0xD6,
+ 0x9D, 0xFF, 0xFF, 0x8C, 0x76, 0x95, 0x19, 0x09, 0x09, 0xB6, 0x5F, 0x53, 0x54, 0x3A, 0xB2, 0xC6,
+ 0xDF, 0x2A, 0x0F, 0x32, 0x50, 0xCE, 0xFF, 0x6B, 0xF5, 0x08, 0xE8, 0x31, 0xEC, 0x4A, 0xD0, 0x63,
+ 0xB3, 0x4A, 0xD0, 0x09, 0x09, 0x32, 0x4E, 0xAD, 0xFD, 0xA5, 0xDD, 0x2A, 0x2E, 0x64, 0x15, 0xB6,
+ 0x7F, 0x11, 0x4C, 0x95, 0x5C, 0x6B, 0xD6, 0x21, 0xAC, 0xDF, 0x5F, 0x8C, 0xD5, 0xC6, 0x7B, 0xAD,
+ 0xB8, 0xCE, 0x7C, 0x5B, 0x0F, 0xD6, 0xBD, 0xEF, 0x7F, 0x83, 0xFF, 0xFF, 0x00, 0xFF, 0xDE, 0x82,
+ 0xFF, 0xFF, 0x81, 0xEF, 0xBF, 0x28, 0x3A, 0x2A, 0xEF, 0x9F, 0xAD, 0x98, 0xA5, 0x37, 0xC6, 0x3C,
+ 0xB5, 0xDB, 0x4A, 0xD0, 0x5B, 0x53, 0xC6, 0xBF, 0x00, 0xEA, 0xA5, 0xDE, 0x63, 0xD6, 0x29, 0xCD,
+ 0xC6, 0x9F, 0x52, 0xF0, 0x29, 0xAB, 0x84, 0x75, 0xF7, 0xFF, 0xEF, 0xBF, 0xE7, 0x5F, 0xEF, 0xBF,
+ 0xD7, 0x3F, 0x4A, 0xF0, 0x19, 0x6A, 0x7C, 0x97, 0x9D, 0x9B, 0x09, 0x6B, 0xA6, 0x1E, 0x5B, 0xB5,
+ 0x29, 0xEF, 0xDF, 0x5F, 0x11, 0x09, 0x9D, 0x58, 0x8C, 0xD5, 0xEF, 0xBF, 0xF7, 0xFF, 0xCE, 0x7D,
+ 0x84, 0x54, 0x9C, 0xF6, 0xFF, 0xFF, 0xE7, 0x5D, 0x82, 0xFF, 0xFF, 0x01, 0xFF, 0xDE, 0xFF, 0xDF,
+ 0x81, 0xFF, 0xFF, 0x02, 0xF7, 0xFF, 0xCE, 0xBC, 0x52, 0xED, 0x81, 0xE7, 0x5F, 0x20, 0xFF, 0xFF,
+ 0x9D, 0x17, 0xCE, 0x7D, 0x21, 0x6A, 0x9D, 0x7B, 0x53, 0x33, 0x3A, 0x91, 0xBE, 0x9F, 0x29, 0xCD,
+ 0x8C, 0xD9, 0x8C, 0xF8, 0x19, 0x29, 0xB5, 0xFB, 0xDF, 0x1F, 0xEF, 0xBF, 0xFF, 0xFF, 0xF7, 0xDF,
+ 0xEF, 0x9F, 0xF7, 0xFF, 0xD7, 0x3F, 0x63, 0x73, 0x42, 0x90, 0xB6, 0x3E, 0x3A, 0xF1, 0x43, 0x12,
+ 0xBE, 0x9F, 0x11, 0x4C, 0xA5, 0xDE, 0x53, 0x52, 0x42, 0xAE, 0xAD, 0xB8, 0xD6, 0xFC, 0xAD, 0x97,
+ 0x81, 0xBE, 0x1B, 0x01, 0x52, 0xCE, 0xEF, 0x5F, 0x83, 0xFF, 0xFF, 0x81, 0xFF, 0xDF, 0x81, 0xFF,
+ 0xFF, 0x11, 0xF7, 0xDF, 0xA5, 0x57, 0x7C, 0x12, 0xCE, 0x9C, 0x94, 0xB5, 0xEF, 0x7F, 0x84, 0x54,
+ 0xB5, 0xBA, 0x21, 0x8B, 0xCE, 0xFF, 0x21, 0xED, 0x7C, 0xB9, 0x74, 0x37, 0x29, 0xCD, 0xBE, 0x5E,
+ 0x32, 0x0D, 0x74, 0x13, 0xEF, 0xBF, 0x81, 0xFF, 0xFF, 0x14, 0xEF, 0x9F, 0xF7, 0xDF, 0xE7, 0x9F,
+ 0xAD, 0xDA, 0xE7, 0xBF, 0xC6, 0xBF, 0x29, 0xED, 0x6C, 0x16, 0x8D, 0x5B, 0x19, 0xCD, 0xAE, 0x5F,
+ 0x42, 0xB2, 0x6C, 0x17, 0x84, 0xD8, 0x3A, 0x6D, 0xBE, 0x3A, 0xAD, 0xD8, 0xEF, 0x9F, 0xDF, 0x3F,
+ 0xCE, 0x7D, 0x4A, 0x4C, 0x81, 0xFF, 0xFF, 0x00, 0xEF, 0x9D, 0x81, 0xFF, 0xFF, 0x2F, 0xFF, 0xDF,
+ 0xFF, 0xFF, 0xF7, 0xDF, 0xFF, 0xFF, 0xEF, 0xBF, 0x84, 0x73, 0x94, 0xF5, 0xD6, 0xDD, 0xB5, 0xD9,
+ 0xEF, 0x9F, 0x94, 0xD6, 0x7C, 0x34, 0x3A, 0x4E, 0xD7, 0x5F, 0x63, 0xF6, 0xAE, 0x5F, 0x42, 0x91,
+ 0x73, 0xF6, 0x8C, 0xD9, 0x21, 0x6A, 0xDF, 0x3F, 0xE7, 0x7F, 0xFF, 0xFF, 0xEF, 0xDF, 0xFF, 0xFF,
+ 0xE7, 0x9F, 0xA5, 0x78, 0x11, 0x28, 0x5B, 0x31, 0xE7, 0xBF, 0x84, 0xDA, 0x11, 0x4B, 0xD7, 0xBF,
+ 0x09, 0x6B, 0x8D, 0x3C, 0x7C, 0x9A, 0x95, 0x3C, 0xA5, 0x9C, 0x08, 0xC6, 0xEF, 0xBF, 0x94, 0xF5,
+ 0xBE, 0x3A, 0xB5, 0xB9, 0xEF, 0x9F, 0x39, 0xEA, 0xEF, 0x9F, 0xEF, 0xBE, 0xF7, 0xBE, 0x81, 0xFF,
+ 0xFF, 0x2E, 0xFF, 0xBF, 0xFF, 0xFF, 0xF7, 0xBF, 0xFF, 0xFF, 0xEF, 0xBF, 0x7C, 0x32, 0xA5, 0x57,
+ 0xEF, 0x9F, 0xEF, 0xBF, 0xF7, 0xDF, 0x94, 0xD6, 0x6B, 0xD3, 0x8C, 0xB7, 0xBE, 0x9F, 0x5B, 0xD5,
+ 0x8D, 0x3B, 0xA5, 0xBE, 0xB6, 0x1F, 0x6B, 0xD5, 0x4A, 0xD0, 0xEF, 0xDF, 0xF7, 0xFF, 0xDF, 0x3E,
+ 0xF7, 0xFF, 0xEF, 0xDF, 0xE7, 0xBF, 0x8C, 0xF6, 0x29, 0xEB, 0x3A, 0x6F, 0xBE, 0x7F, 0xBE, 0x9F,
+ 0x11, 0x6D, 0xAE, 0x5F, 0x8D, 0x5B, 0xAE, 0x5F, 0x6C, 0x18, 0x63, 0xD6, 0xEF, 0xFF, 0x4A, 0xAE,
+ 0xB6, 0x3A, 0x84, 0x93, 0xF7, 0xFF, 0xFF, 0xFF, 0xE7, 0x5F, 0x4A, 0x6D, 0xDF, 0x3E, 0xF7, 0xFF,
+ 0x82, 0xFF, 0xFF, 0x81, 0xFF, 0xDF, 0x14, 0xFF, 0xFF, 0xF7, 0xDF, 0xEF, 0xBF, 0x7C, 0x52, 0xA5,
+ 0x77, 0xFF, 0xFF, 0xF7, 0xBF, 0xE7, 0x7F, 0xA5, 0x58, 0x8C, 0xF7, 0xAD, 0xFC, 0x63, 0xD5, 0x22,
+ 0x0E, 0x09, 0x2C, 0x11, 0x6D, 0x53, 0x75, 0x9D, 0x9C, 0x9D, 0xBC, 0xEF, 0xFF, 0x95, 0x58, 0x42,
+ 0xCD, 0x81, 0xEF, 0xFF, 0x16, 0x9D, 0x77, 0x32, 0x4C, 0x11, 0x6A, 0x2A, 0x0E, 0x5B, 0x95, 0xBE,
+ 0x9F, 0x9D, 0xBE, 0x7C, 0xFA, 0x2A, 0x2F, 0x09, 0x0C, 0x19, 0x6E, 0x19, 0x8D, 0xAD, 0xFD, 0x95,
+ 0x18, 0xC6, 0x9C, 0x8C, 0xD4, 0xF7, 0xDF, 0xFF, 0xFF, 0xEF, 0x9F, 0x42, 0x4C, 0xDF, 0x3E, 0xFF,
+ 0xFF, 0xF7, 0xDE, 0x81, 0xFF, 0xFF, 0x81, 0xFF, 0xDF, 0x00, 0xFF, 0xFF, 0x81, 0xF7, 0xDF, 0x29,
+ 0x7C, 0x12, 0xB5, 0xF9, 0xEF, 0xBF, 0xBE, 0x1A, 0xE7, 0x5F, 0x94, 0xD6, 0xA5, 0x9A, 0xB6, 0x1D,
+ 0x84, 0xB9, 0x3A, 0xF2, 0x22, 0x30, 0x11, 0xAF, 0x11, 0x8E, 0x09, 0x4C, 0x42, 0xF1, 0x84, 0xD8,
+ 0x4B, 0x30, 0x53, 0x50, 0xB6, 0x5B, 0xEF, 0xFF, 0xD7, 0x3F, 0x63, 0xD3, 0x19, 0xAC, 0x09, 0x4B,
+ 0xAE, 0x3F, 0x7C, 0xDC, 0x11, 0x6E, 0x09, 0x4C, 0x22, 0x2F, 0x21, 0xEF, 0x2A, 0x31, 0x5B, 0x96,
+ 0x8C, 0xFA, 0x9D, 0x58, 0xD6, 0xFE, 0x8C, 0xD4, 0xEF, 0xDF, 0xBE, 0x3B, 0xF7, 0xDF, 0x42, 0x4C,
+ 0xDF, 0x3E, 0xF7, 0xFF, 0x83, 0xFF, 0xFF, 0x2D, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xDF, 0xF7, 0xFF,
+ 0x7C, 0x32, 0xB5, 0xF9, 0xEF, 0x9F, 0x8C, 0xB5, 0xEF, 0xBF, 0x8C, 0xB6, 0x95, 0x18, 0x84, 0xD8,
+ 0x74, 0x78, 0x74, 0x99, 0x7C, 0xDB, 0x85, 0x3D, 0x74, 0xBB, 0x43, 0x34, 0x11, 0xAD, 0x19, 0xCD,
+ 0x11, 0x8B, 0x19, 0x8A, 0xA5, 0xFB, 0xCF, 0x1F, 0x63, 0xF4, 0x22, 0x0D, 0x19, 0xCD, 0x19, 0xAE,
+ 0x09, 0x4D, 0x01, 0x0D, 0x21, 0xF0, 0x6C, 0x58, 0x7C, 0xDA, 0x7C, 0xBA, 0x84, 0xDB, 0x8C, 0xFB,
+ 0x7C, 0x98, 0x84, 0xD7, 0xAD, 0xF9, 0x8C, 0xD4, 0xEF, 0xBF, 0x8C, 0xB5, 0xF7, 0xFF, 0x3A, 0x2B,
+ 0xE7, 0x7F, 0xF7, 0xFF, 0x82, 0xFF, 0xFF, 0x0F, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xDF,
+ 0xFF, 0xFF, 0x94, 0xD4, 0x8C, 0xD4, 0xF7, 0xFF, 0x8C, 0xB4, 0xF7, 0xFF, 0x8C, 0x95, 0x52, 0xF0,
+ 0x3A, 0xB0, 0x32, 0x70, 0x64, 0x18, 0x6C, 0x9B, 0x81, 0x74, 0xDC, 0x1D, 0x85, 0x3D, 0x7D, 0x1C,
+ 0x6C, 0x78, 0x43, 0x12, 0x11, 0x6B, 0x9D, 0xBB, 0xE7, 0xFF, 0xCF, 0x3F, 0x32, 0x4F, 0x11, 0x4C,
+ 0x09, 0x4C, 0x5B, 0xB7, 0x84, 0xFD, 0x84, 0xFC, 0x7C, 0xDA, 0x95, 0x9D, 0x85, 0x1C, 0x6C, 0x39,
+ 0x53, 0x55, 0x42, 0xB1, 0x21, 0xAA, 0x9D, 0x98, 0x9D, 0x77, 0xDF, 0x5F, 0x9D, 0x37, 0xEF, 0x7F,
+ 0x39, 0xEA, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0x81, 0xFF, 0xFF, 0x12, 0xFF, 0xBF, 0xFF, 0xFF,
+ 0xFF, 0xBF, 0xFF, 0xDF, 0xFF, 0xFF, 0xB5, 0xF9, 0x5B, 0x0D, 0xF7, 0xFF, 0x8C, 0xD4, 0xE7, 0x9F,
+ 0x6B, 0xD2, 0x29, 0xCC, 0x19, 0x6C, 0x11, 0x6D, 0x19, 0xF0, 0x01, 0x4E, 0x01, 0x6F, 0x1A, 0x31,
+ 0x2A, 0xB3, 0x81, 0x74, 0xBA, 0x14, 0x7C, 0xB9, 0x74, 0x57, 0x42, 0xF2, 0x8D, 0x3A, 0x74, 0x37,
+ 0x21, 0xAD, 0x53, 0x54, 0x7C, 0x9A, 0x74, 0x59, 0x6C, 0x39, 0x6C, 0x59, 0x3A, 0xD2, 0x00, 0xEB,
+ 0x09, 0x4D, 0x21, 0xD0, 0x00, 0xEB, 0x19, 0x8D, 0x21, 0xCB, 0x21, 0x88, 0xC6, 0x9C, 0xBE, 0x3A,
+ 0x81, 0xCE, 0xBD, 0x00, 0x4A, 0x8C, 0x81, 0xF7, 0xFF, 0x00, 0xF7, 0xFE, 0x81, 0xFF, 0xFF, 0x02,
+ 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xDF, 0x81, 0xFF, 0xFF, 0x29, 0xDF, 0x1D, 0x42, 0x4A, 0xF7, 0xFF,
+ 0xA5, 0x77, 0xDF, 0x5F, 0xAD, 0xBA, 0x84, 0x97, 0x7C, 0x98, 0x7C, 0xBA, 0x6C, 0x5A, 0x64, 0x5B,
+ 0x4B, 0x97, 0x43, 0x77, 0x22, 0x31, 0x09, 0x6E, 0x19, 0xCF, 0x5B, 0xB6, 0x74, 0x79, 0x63, 0xB5,
+ 0x53, 0x54, 0x53, 0x13, 0x7C, 0x58, 0x6C, 0x17, 0x84, 0xDB, 0x3A, 0x92, 0x19, 0x6E, 0x11, 0x6D,
+ 0x2A, 0x70, 0x4B, 0x75, 0x6C, 0x39, 0x74, 0x7A, 0x84, 0xFB, 0x63, 0xD5, 0x9D, 0x9A, 0x5B, 0x90,
+ 0xE7, 0x9F, 0x95, 0x16, 0xEF, 0x9F, 0xA5, 0x58, 0x7C, 0x33, 0xEF, 0xBF, 0xEF, 0xDE, 0x82, 0xFF,
+ 0xFF, 0x2E, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xDF, 0xF7, 0xFF, 0xEF, 0xBF, 0x52, 0xEC,
+ 0xCE, 0xBC, 0xD6, 0xDD, 0xB6, 0x1A, 0xD7, 0x1F, 0x84, 0x97, 0x84, 0xDA, 0x21, 0xEF, 0x01, 0x2E,
+ 0x11, 0xD1, 0x32, 0xB4, 0x2A, 0xB3, 0x5C, 0x19, 0x6C, 0x7A, 0x7C, 0xDB, 0x53, 0x75, 0x2A, 0x10,
+ 0x6B, 0xF7, 0x63, 0x96, 0x84, 0x99, 0x5B, 0x75, 0x4A, 0xB2, 0x29, 0xEF, 0x7C, 0x79, 0x74, 0x18,
+ 0x74, 0x79, 0x5B, 0xD6, 0x32, 0x91, 0x21, 0xF0, 0x11, 0x4E, 0x19, 0x8E, 0x29, 0xEE, 0xC6, 0xBF,
+ 0x84, 0xD5, 0xE7, 0xBF, 0x94, 0xF5, 0xF7, 0xDF, 0x63, 0x70, 0xB5, 0xFA, 0xF7, 0xFF, 0xEF, 0xBE,
+ 0x82, 0xFF, 0xFF, 0x00, 0xFF, 0xDE, 0x81, 0xFF, 0xFF, 0x00, 0xF7, 0xDF, 0x81, 0xF7, 0xFF, 0x0A,
+ 0x73, 0xD0, 0xAD, 0x97, 0xF7, 0xDF, 0x84, 0x74, 0xF7, 0xFF, 0x84, 0x76, 0xD7, 0x1F, 0x19, 0x8D,
+ 0x09, 0x4D, 0x11, 0x8E, 0x09, 0x6D, 0x81, 0x09, 0x8D, 0x1C, 0x11, 0x8D, 0x19, 0xCE, 0x2A, 0x30,
+ 0x7C, 0x79, 0x6C, 0x17, 0x42, 0x91, 0x63, 0x74, 0x4A, 0xF2, 0x7C, 0x78, 0x6B, 0xD5, 0x4A, 0xF2,
+ 0x5B, 0x74, 0x63, 0xB5, 0x6C, 0x17, 0x6C, 0x58, 0x9D, 0x9E, 0xAE, 0x1F, 0x95, 0x5C, 0x84, 0x98,
+ 0xBE, 0x7D, 0xBE, 0x7C, 0xDF, 0x3F, 0xA5, 0x57, 0xF7, 0xDF, 0x31, 0xCA, 0xDF, 0x1E, 0xFF, 0xFF,
+ 0xEF, 0xDF, 0xF7, 0xFF, 0x81, 0xFF, 0xFF, 0x0E, 0xFF, 0xDE, 0xFF, 0xFF, 0xF7, 0xBE, 0xFF, 0xFF,
+ 0xF7, 0xDF, 0xFF, 0xFF, 0xD6, 0xDC, 0x42, 0x4A, 0xF7, 0xFF, 0xA5, 0x78, 0xCE, 0xBD, 0xCE, 0xDF,
+ 0xA5, 0xBA, 0x7C, 0x76, 0x19, 0x6B, 0x81, 0x19, 0xAB, 0x81, 0x11, 0xAB, 0x18, 0x32, 0x6F, 0x3A,
+ 0xB0, 0x42, 0xF1, 0x63, 0xD4, 0x5B, 0x94, 0xB6, 0x5E, 0xAE, 0x1C, 0xAD, 0xFC, 0x95, 0x59, 0x8D,
+ 0x18, 0x9D, 0x9B, 0xAD, 0xDC, 0xBE, 0x7F, 0xC6, 0xBF, 0xBE, 0x7F, 0xB6, 0x5F, 0xA5, 0xBD, 0x7C,
+ 0x78, 0xE7, 0xBF, 0x84, 0x76, 0xEF, 0xBF, 0x94, 0xF7, 0xE7, 0x5F, 0xC6, 0x3B, 0x52, 0xAD, 0x81,
+ 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x82, 0xFF, 0xFF, 0x02, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xDF, 0x82,
+ 0xFF, 0xFF, 0x25, 0xDF, 0x1D, 0x63, 0x4E, 0xBE, 0x3A, 0xEF, 0x9F, 0x9D, 0x37, 0xEF, 0xBF, 0x84,
+ 0x95, 0xD7, 0x1F, 0x84, 0x95, 0x9D, 0x79, 0xBE, 0xBD, 0xCF, 0x3F, 0xEF, 0xFF, 0xDF, 0x9F, 0xCF,
+ 0x1F, 0xBE, 0x9E, 0x84, 0xF8, 0x9D, 0xBA, 0x84, 0xD7, 0x74, 0x54, 0x6C, 0x13, 0x5B, 0x71, 0x4B,
+ 0x10, 0x4A, 0xCF, 0x2A, 0x0D, 0x21, 0xAC, 0x19, 0x4B, 0x29, 0xCD, 0x19, 0x4B, 0x11, 0x09, 0x84,
+ 0x97, 0xA5, 0x9B, 0xC6, 0x5D, 0xDF, 0x3F, 0x9D, 0x17, 0xEF, 0xBF, 0x5A, 0xCD, 0xB5, 0xB9, 0x81,
+ 0xFF, 0xFF, 0x00, 0xF7, 0xBF, 0x82, 0xFF, 0xFF, 0x11, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
+ 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xBF, 0xA5, 0x56, 0x63, 0x4F, 0xF7, 0xFF, 0x9D, 0x37, 0xBE,
+ 0x5C, 0xDF, 0x5F, 0x94, 0xF7, 0xE7, 0x9F, 0xBE, 0x5C, 0xDF, 0x9F, 0xEF, 0xFF, 0x81, 0xDF, 0x9F,
+ 0x17, 0xC6, 0xDF, 0x95, 0x59, 0x95, 0x79, 0x74, 0x75, 0x7C, 0x95, 0x74, 0x33, 0x6C, 0x13, 0x5B,
+ 0x92, 0x5B, 0x72, 0x53, 0x33, 0x32, 0x0F, 0x21, 0x8D, 0x29, 0xAC, 0x08, 0xC8, 0x19, 0x6A, 0x74,
+ 0x14, 0xC6, 0x7E, 0x95, 0x18, 0xDF, 0x5F, 0x94, 0xF6, 0xDF, 0x3F, 0xC6, 0x3A, 0x42, 0x4B, 0xF7,
+ 0xDF, 0x81, 0xFF, 0xFF, 0x00, 0xF7, 0xDF, 0x84, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7,
+ 0xBF, 0x81, 0xFF, 0xFF, 0x12, 0xE7, 0x3E, 0x52, 0xAC, 0xB5, 0xD9, 0xF7, 0xFF, 0x84, 0x94, 0xEF,
+ 0xBF, 0xBE, 0x3C, 0x8C, 0xD6, 0xBE, 0x5D, 0x21, 0xAB, 0x21, 0xCC, 0x4B, 0x12, 0x63, 0xD5, 0x74,
+ 0x57, 0x9D, 0x7B, 0xBE, 0x7F, 0xD7, 0x5F, 0xEF, 0xDF, 0xEF, 0xFF, 0x81, 0xF7, 0xFF, 0x12, 0xEF,
+ 0xDF, 0xF7, 0xFF, 0xE7, 0x9F, 0xEF, 0xBF, 0xB6, 0x3D, 0x8C, 0xD7, 0x74, 0x13, 0xD7, 0x1F, 0x74,
+ 0x33, 0xD7, 0x1F, 0xC6, 0x9C, 0xAD, 0x98, 0xF7, 0xDF, 0x5B, 0x2D, 0xB5, 0xD8, 0xF7, 0xDF, 0xF7,
+ 0xBE, 0xFF, 0xFF, 0xFF, 0xDF, 0x83, 0xFF, 0xFF, 0x81, 0xFF, 0xDF, 0x02, 0xFF, 0xFF, 0xF7, 0xBF,
+ 0xFF, 0xDF, 0x81, 0xFF, 0xFF, 0x13, 0xBE, 0x19, 0x4A, 0x8C, 0xF7, 0xDF, 0xCE, 0xBD, 0x9D, 0x17,
+ 0xE7, 0x7F, 0xAD, 0xDA, 0xA5, 0xBB, 0xBE, 0x7F, 0x42, 0xB3, 0x11, 0x2D, 0x21, 0x6F, 0x21, 0x90,
+ 0x19, 0x2E, 0x10, 0xED, 0x21, 0x6E, 0x29, 0xCE, 0x6B, 0xB4, 0xC6, 0x5D, 0xE7, 0x9F, 0x81, 0xF7,
+ 0xFF, 0x0F, 0xEF, 0xDF, 0xF7, 0xFF, 0xDF, 0x5F, 0xF7, 0xFF, 0xDF, 0x5F, 0x6B, 0xD1, 0xDF, 0x5F,
+ 0xE7, 0x7F, 0x84, 0x94, 0xEF, 0xDF, 0x94, 0xF4, 0x4A, 0xAB, 0xFF, 0xFF, 0xEF, 0xBE, 0xFF, 0xFE,
+ 0xFF, 0xFF, 0x81, 0xFF, 0xFE, 0x81, 0xFF, 0xFF, 0x81, 0xFF, 0xDF, 0x86, 0xFF, 0xFF, 0x15, 0x7C,
+ 0x11, 0x63, 0x6F, 0xF7, 0xFF, 0xC6, 0x5B, 0x94, 0xF6, 0xF7, 0xFF, 0xA5, 0xBA, 0x84, 0x98, 0xD7,
+ 0x1F, 0x74, 0x18, 0x19, 0x2D, 0x19, 0x4E, 0x21, 0x4E, 0x31, 0xEF, 0x3A, 0x4F, 0x6B, 0xD4, 0xA5,
+ 0x79, 0xEF, 0xBF, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xEF, 0xBE, 0x81, 0xF7, 0xFF, 0x08, 0xC6,
+ 0x9C, 0x7C, 0x33, 0xF7, 0xFF, 0xCE, 0xDC, 0x73, 0xF1, 0xF7, 0xFF, 0xCE, 0xBB, 0x5B, 0x0C, 0xC6,
+ 0x59, 0x83, 0xFF, 0xFF, 0x81, 0xFF, 0xFE, 0x87, 0xFF, 0xFF, 0x12, 0xFF, 0xDF, 0xF7, 0xDF, 0xEF,
+ 0x9F, 0xF7, 0xDF, 0x5B, 0x0D, 0x94, 0xF5, 0xEF, 0xBF, 0xB5, 0xF9, 0xB5, 0xD9, 0xEF, 0xDF, 0xCF,
+ 0x1F, 0x7C, 0x75, 0xBE, 0x9D, 0xCF, 0x1F, 0x9D, 0x78, 0xC6, 0xBC, 0xE7, 0xDF, 0xE7, 0x9D, 0xF7,
+ 0xFE, 0x81, 0xF7, 0xFD, 0x09, 0xEF, 0xBC, 0xE7, 0x9C, 0xF7, 0xDE, 0xF7, 0xDF, 0xFF, 0xFF, 0x95,
+ 0x15, 0x7C, 0x32, 0xF7, 0xFF, 0xDF, 0x5F, 0x8C, 0xB4, 0x81, 0xE7, 0x5E, 0x03, 0x42, 0x6A, 0x9D,
+ 0x35, 0xFF, 0xFF, 0xEF, 0x7D, 0x81, 0xFF, 0xFF, 0x01, 0xF7, 0xDE, 0xFF, 0xFE, 0x85, 0xFF, 0xFF,
+ 0x81, 0xFF, 0xDF, 0x83, 0xFF, 0xFF, 0x06, 0xF7, 0xBF, 0xEF, 0x9F, 0x42, 0x4A, 0xA5, 0x77, 0xEF,
+ 0xBF, 0xF7, 0xFF, 0xEF, 0xBF, 0x81, 0xE7, 0xDF, 0x08, 0x9D, 0x55, 0x7C, 0x92, 0xB6, 0x38, 0xDF,
+ 0x7D, 0xEF, 0xFE, 0xF7, 0xFE, 0xF7, 0xFD, 0xEF, 0xDC, 0xFF, 0xFD, 0x81, 0xFF, 0xFE, 0x0A, 0xE7,
+ 0x5C, 0xA5, 0x35, 0x7B, 0xF1, 0xC6, 0x7B, 0xE7, 0x7F, 0xE7, 0x9F, 0xEF, 0xBF, 0xEF, 0xDF, 0xEF,
+ 0x9F, 0x32, 0x08, 0xA5, 0x76, 0x81, 0xFF, 0xFF, 0x05, 0xF7, 0xBE, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF,
+ 0xFE, 0xFF, 0xFF, 0xFF, 0xDE, 0x8A, 0xFF, 0xFF, 0x1E, 0xE7, 0x3D, 0xFF, 0xFF, 0xD6, 0xFD, 0x52,
+ 0xCC, 0x84, 0x52, 0xFF, 0xFF, 0xEF, 0xBF, 0xDF, 0x9C, 0xB6, 0x37, 0xC6, 0xDA, 0xEF, 0xFF, 0xC6,
+ 0x7B, 0x8C, 0xB5, 0x7C, 0x54, 0x84, 0x74, 0x94, 0xB5, 0x8C, 0xB4, 0x94, 0xF4, 0x7C, 0x11, 0x84,
+ 0x31, 0xAD, 0x76, 0xC6, 0x19, 0xE7, 0x5E, 0xCE, 0xBC, 0x9D, 0x16, 0xEF, 0xBF, 0xF7, 0xDF, 0xD6,
+ 0xDC, 0x42, 0x4A, 0x9C, 0xF5, 0xF7, 0xDF, 0x92, 0xFF, 0xFF, 0x1E, 0xF7, 0xBF, 0xEF, 0x9E, 0xFF,
+ 0xFF, 0xCE, 0x9B, 0x52, 0xCC, 0x5B, 0x0D, 0xE7, 0x5D, 0xCE, 0xDA, 0xA5, 0xB6, 0xDF, 0x5D, 0xF7,
+ 0xFF, 0xD7, 0x1E, 0xC6, 0x7D, 0xF7, 0xBF, 0xEF, 0x7F, 0xD6, 0xDE, 0xE7, 0x5F, 0xF7, 0xBF, 0xF7,
+ 0xDF, 0xFF, 0xFF, 0xDE, 0xDC, 0xB5, 0xD8, 0xF7, 0x9F, 0xE7, 0x5F, 0xB5, 0xD9, 0xA5, 0x57, 0xA5,
+ 0x77, 0x4A, 0x8B, 0xA5, 0x77, 0xFF, 0xFF, 0xF7, 0xDF, 0x91, 0xFF, 0xFF, 0x00, 0xE7, 0x3D, 0x81,
+ 0xFF, 0xFF, 0x00, 0xEF, 0xBF, 0x81, 0xFF, 0xFF, 0x19, 0x94, 0xD3, 0x3A, 0x09, 0x94, 0xF5, 0xC6,
+ 0x9C, 0xF7, 0xFF, 0xC6, 0x7B, 0xBE, 0x3B, 0xB5, 0xF9, 0xE7, 0x5E, 0xDF, 0x5D, 0xC6, 0x79, 0xF7,
+ 0xDE, 0xD6, 0xFB, 0xBE, 0x18, 0xF7, 0xBF, 0xEF, 0x7F, 0xB5, 0xD9, 0xD6, 0xDD, 0xFF, 0xFF, 0xBE,
+ 0x3A, 0x6B, 0x90, 0x4A, 0x8B, 0xDE, 0xFD, 0xF7, 0xDF, 0xFF, 0xDF, 0xF7, 0xBF, 0x92, 0xFF, 0xFF,
+ 0x00, 0xF7, 0xDF, 0x81, 0xFF, 0xFF, 0x19, 0xE7, 0x5D, 0xEF, 0xBE, 0xF7, 0xBF, 0xCE, 0x9B, 0x63,
+ 0x6F, 0x3A, 0x2B, 0x94, 0xD5, 0xDF, 0x1F, 0xF7, 0xDF, 0xDF, 0x1E, 0xE7, 0x7E, 0xBE, 0x18, 0xB5,
+ 0xF7, 0xFF, 0xFF, 0xE7, 0x5D, 0xBE, 0x18, 0xEF, 0x9F, 0xFF, 0xFF, 0xCE, 0x7D, 0xBE, 0x1B, 0x52,
+ 0xCD, 0x4A, 0x8B, 0x9D, 0x15, 0xF7, 0xDF, 0xF7, 0xBF, 0xEF, 0x7F, 0x94, 0xFF, 0xFF, 0x81, 0xFF,
+ 0xDF, 0x84, 0xFF, 0xFF, 0x16, 0xF7, 0xFF, 0xC6, 0x59, 0x6B, 0x8F, 0x39, 0xEA, 0x5B, 0x0F, 0x94,
+ 0xB6, 0xBD, 0xFC, 0xD6, 0x9E, 0xC6, 0x7D, 0xDF, 0x1F, 0xCE, 0x9E, 0xAD, 0x9A, 0x94, 0xB7, 0x63,
+ 0x52, 0x4A, 0x6F, 0x52, 0xAF, 0xAD, 0x77, 0xF7, 0xBF, 0xE7, 0x3E, 0xFF, 0xFF, 0xEF, 0x5E, 0xFF,
+ 0xFF, 0xEF, 0x7E, 0x94, 0xFF, 0xFF, 0x00, 0xF7, 0xDE, 0x81, 0xFF, 0xFF, 0x01, 0xF7, 0xDE, 0xEF,
+ 0x9E, 0x81, 0xFF, 0xFF, 0x06, 0xEF, 0x7D, 0xF7, 0xDF, 0xFF, 0xFF, 0xB5, 0xB9, 0x7B, 0xF4, 0x63,
+ 0x31, 0x4A, 0x8E, 0x81, 0x39, 0xEB, 0x06, 0x42, 0x4D, 0x6B, 0x92, 0x84, 0x55, 0x94, 0xF8, 0xCE,
+ 0xBF, 0xF7, 0xFF, 0xE7, 0x3E, 0x81, 0xFF, 0xFF, 0x00, 0xF7, 0xBF, 0x81, 0xFF, 0xFF, 0x01, 0xFF,
+ 0xDF, 0xF7, 0xBF, 0x95, 0xFF, 0xFF, 0x00, 0xFF, 0xDE, 0x81, 0xFF, 0xFF, 0x01, 0xEF, 0x7D, 0xF7,
+ 0x9F, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x5F, 0x82, 0xFF, 0xFF, 0x05, 0xEF, 0xBF, 0xFF, 0xFF, 0xF7,
+ 0xFF, 0xEF, 0xBE, 0xEF, 0xDE, 0xEF, 0xFF, 0x82, 0xF7, 0xFF, 0x06, 0xFF, 0xFF, 0xEF, 0x7D, 0xE7,
+ 0x5D, 0xFF, 0xFF, 0xF7, 0xDE, 0xF7, 0xBE, 0xFF, 0xDF, 0x97, 0xFF, 0xFF, 0x01, 0xF7, 0xBE, 0xF7,
+ 0xDE, 0x81, 0xFF, 0xFF, 0x04, 0xEF, 0x7F, 0xFF, 0xFF, 0xF7, 0x9F, 0xFF, 0xFF, 0xE7, 0x5E, 0x81,
+ 0xFF, 0xFF, 0x01, 0xEF, 0xBD, 0xFF, 0xFE, 0x81, 0xF7, 0xFD, 0x04, 0xF7, 0xFE, 0xEF, 0xFD, 0xF7,
+ 0xFE, 0xF7, 0xDE, 0xEF, 0x9D, 0x85, 0xFF, 0xFF, 0x00, 0xF7, 0xBD, 0xED, 0xFF, 0xFF,
+};
 
+const unsigned char img_logo[9850] = {
+ //177x58 RLE
+ 0x52, 0x4C, 0x45, 0x31, 0x00, 0xB1, 0x00, 0x3A, 0x90, 0xFF, 0xFF, 0x8D, 0xFF, 0xDF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0x0A,
+ 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
+ 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xBE, 0x81, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x84, 0xFF, 0xFF, 0x00,
+ 0xFF, 0xDF, 0x81, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9B, 0xFF, 0xFF, 0x03, 0xFF,
+ 0xBF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x82, 0xFF, 0xDF, 0x01, 0xFF, 0xFF, 0xFF, 0x9E, 0x81,
+ 0xFF, 0xFF, 0x02, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xDF, 0x82, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x81,
+ 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xA6, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x87, 0xFF,
+ 0xFF, 0x00, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9B, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
+ 0xDF, 0x83, 0xFF, 0xFF, 0x00, 0xF7, 0x9E, 0x82, 0xFF, 0xFF, 0x02, 0xF7, 0x9E, 0xFF, 0xFF, 0xFF,
+ 0xDF, 0x84, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9A, 0xFF, 0xFF, 0x00, 0xF7, 0xDF,
+ 0x81, 0xFF, 0xFF, 0x81, 0xF7, 0xDF, 0x83, 0xFF, 0xFF, 0x04, 0xF7, 0xBF, 0xFF, 0xFF, 0xF7, 0xDF,
+ 0xFF, 0xFF, 0xF7, 0xBF, 0x81, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0x81, 0xFF,
+ 0xFF, 0x00, 0xF7, 0xBE, 0xFF, 0xFF, 0xFF, 0x9A, 0xFF, 0xFF, 0x81, 0xF7, 0xFF, 0x05, 0xFF, 0xFF,
+ 0xE7, 0x9E, 0xF7, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xE7, 0x9E, 0x81, 0xF7, 0xFF, 0x03, 0xFF, 0xFF,
+ 0xDF, 0x5D, 0xFF, 0xFF, 0xF7, 0xFF, 0x81, 0xF7, 0xDF, 0x05, 0xFF, 0xDF, 0xFF, 0xFF, 0xEF, 0x5D,
+ 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xBE, 0xFF, 0xFF, 0xFF, 0x9A, 0xFF, 0xFF, 0x07, 0xEF, 0xDF, 0xEF,
+ 0xFF, 0xE7, 0xBF, 0xC6, 0xBA, 0xDF, 0x5D, 0xE7, 0xDF, 0xE7, 0xBF, 0xBE, 0x79, 0x82, 0xE7, 0xBF,
+ 0x0A, 0xB6, 0x38, 0xEF, 0xDF, 0xE7, 0xBF, 0xD7, 0x1C, 0xD6, 0xDB, 0xF7, 0xDF, 0xFF, 0xDF, 0xD6,
+ 0xBA, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9B, 0xFF, 0xFF, 0x06, 0xF7, 0xFF,
+ 0xEF, 0xDF, 0xBE, 0x9A, 0xD7, 0x9D, 0xEF, 0xFF, 0xE7, 0xDF, 0xAE, 0x18, 0x81, 0xF7, 0xFF, 0x09,
+ 0xE7, 0xBF, 0xA5, 0xD8, 0xF7, 0xFF, 0xEF, 0xFF, 0xCF, 0x1C, 0xC6, 0xBB, 0xF7, 0xFF, 0xEF, 0xBE,
+ 0xBE, 0x59, 0xDF, 0x3C, 0x82, 0xFF, 0xFF, 0x00, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0x90, 0xFF, 0xFF,
+ 0x01, 0xFF, 0xDF, 0xFF, 0xFF, 0x81, 0xFF, 0xDF, 0x81, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x82, 0xFF,
+ 0xFF, 0x01, 0xF7, 0xDF, 0xC6, 0xBA, 0x81, 0xD7, 0xFD, 0x09, 0xE7, 0xFF, 0xC6, 0xBA, 0xF7, 0xDD,
+ 0xF7, 0xDE, 0xF7, 0xFF, 0xB6, 0x5B, 0xF7, 0xFF, 0xF7, 0xDF, 0xCF, 0x3D, 0xD7, 0x9F, 0x81, 0xEF,
+ 0xFF, 0x03, 0xB6, 0xDB, 0xD7, 0x9E, 0xF7, 0xFF, 0xF7, 0xBE, 0x81, 0xFF, 0xDF, 0x00, 0xFF, 0xDD,
+ 0x82, 0xFF, 0xFE, 0x03, 0xFF, 0x9E, 0xFF, 0xFF, 0xEF, 0xFF, 0xF7, 0xFF, 0x85, 0xFF, 0xFF, 0x06,
+ 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xBF, 0x85, 0xFF,
+ 0xFF, 0x03, 0xF7, 0xBD, 0xFF, 0xFE, 0xFF, 0xDE, 0xFF, 0xFE, 0x82, 0xFF, 0xFF, 0x01, 0xEF, 0xDE,
+ 0xF7, 0xFF, 0x81, 0xFF, 0xFF, 0x03, 0xFF, 0xDE, 0xFF, 0xBE, 0xFF, 0xDF, 0xFF, 0x9F, 0x81, 0xF7,
+ 0xFF, 0x81, 0xFF, 0xDF, 0x03, 0xF7, 0x7F, 0xFF, 0xFF, 0xF7, 0xDF, 0xFF, 0xBE, 0x81, 0xFF, 0xBF,
+ 0x00, 0xFF, 0xBE, 0x83, 0xFF, 0xFF, 0x08, 0xF7, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
+ 0x9F, 0xFF, 0x9E, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDE, 0x81, 0xFF, 0xFF, 0x81, 0xFF, 0xFE, 0x81,
+ 0xFF, 0xDF, 0x00, 0xFF, 0xDE, 0x82, 0xFF, 0xFF, 0x00, 0xF7, 0x9E, 0x84, 0xFF, 0xFF, 0x81, 0xFF,
+ 0xFE, 0x15, 0xFF, 0xDF, 0xF7, 0x7F, 0xF7, 0x9F, 0xFF, 0xFF, 0xEF, 0xBD, 0xFF, 0xFF, 0xF7, 0xDF,
+ 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xBF, 0xFF, 0xFF, 0xEF, 0xBF, 0xF7, 0xFF, 0xF7, 0xFE, 0xF7, 0xFD,
+ 0xFF, 0xFD, 0xEF, 0xBB, 0xFF, 0xFE, 0xEF, 0xDF, 0xF7, 0xFF, 0xF7, 0xBF, 0xFF, 0xBE, 0x81, 0xFF,
+ 0xFE, 0x05, 0xEF, 0xDD, 0xFF, 0xFF, 0xF7, 0x9C, 0xFF, 0xDE, 0xF7, 0xBF, 0xFF, 0xFF, 0x81, 0xFF,
+ 0xDF, 0x03, 0xEF, 0xFF, 0xE7, 0xFF, 0xF7, 0xFE, 0xF7, 0xDD, 0x81, 0xF7, 0xFF, 0x00, 0xEF, 0xBF,
+ 0x81, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0x92, 0xFF, 0xFF, 0x81, 0xFF, 0xDF,
+ 0x81, 0xFF, 0xFF, 0x81, 0xFF, 0xDF, 0x00, 0xEF, 0x9E, 0x81, 0xF7, 0xFF, 0x08, 0xAE, 0x5A, 0xBF,
+ 0xBC, 0xD7, 0xFF, 0xDF, 0xFF, 0x95, 0x97, 0xEF, 0xFF, 0xF7, 0xFF, 0xD7, 0x9F, 0x8D, 0x79, 0x81,
+ 0xEF, 0xFF, 0x07, 0xAE, 0xBD, 0xAE, 0xDD, 0xEF, 0xFF, 0xDF, 0xFF, 0x96, 0x18, 0xC7, 0xBF, 0xEF,
+ 0xFF, 0xF7, 0xFF, 0x81, 0xFF, 0xFF, 0x09, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF, 0xDD, 0xFF, 0xFE, 0xFF,
+ 0xBE, 0xFF, 0xFF, 0xF7, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xEF, 0x7D, 0x81, 0xF7, 0xFF, 0x00, 0xEF,
+ 0x9E, 0x81, 0xFF, 0xFF, 0x03, 0xEF, 0xBF, 0xEF, 0xDF, 0xF7, 0xFF, 0xF7, 0xBF, 0x81, 0xFF, 0xFF,
+ 0x02, 0xEF, 0x9F, 0xF7, 0x9E, 0xFF, 0xDF, 0x81, 0xFF, 0xFE, 0x82, 0xFF, 0xFF, 0x02, 0xFF, 0xFE,
+ 0xFF, 0xBE, 0xFF, 0xDE, 0x82, 0xFF, 0xFF, 0x81, 0xF7, 0xFF, 0x06, 0xF7, 0xDE, 0xF7, 0x9E, 0xFF,
+ 0xFF, 0xF7, 0x5E, 0xFF, 0xFF, 0xEF, 0xFF, 0xE7, 0xDF, 0x81, 0xFF, 0xDF, 0x0A, 0xF7, 0xDF, 0xF7,
+ 0xFF, 0xFF, 0xFF, 0xF7, 0x9D, 0xFF, 0xDE, 0xF7, 0x1C, 0xF7, 0xBE, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7,
+ 0xBF, 0xEF, 0xDF, 0x81, 0xF7, 0xFF, 0x00, 0xEF, 0xBD, 0x81, 0xFF, 0xDF, 0x05, 0xFF, 0xFF, 0xF7,
+ 0x9D, 0xFF, 0xFE, 0xFF, 0xDE, 0xFF, 0xDF, 0xFF, 0xFF, 0x81, 0xFF, 0xFE, 0x05, 0xFF, 0xFF, 0xFF,
+ 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0x7F, 0xFF, 0xDF, 0x83, 0xFF, 0xFF, 0x11, 0xFF, 0xBE, 0xFF,
+ 0xFE, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xDF, 0xFF, 0xFF, 0xF7,
+ 0xFE, 0xF7, 0xFF, 0xEF, 0x9F, 0xF7, 0x9F, 0xFF, 0xFF, 0xEF, 0xDF, 0xF7, 0xFF, 0xEF, 0xFF, 0xF7,
+ 0xFE, 0x81, 0xFF, 0xFD, 0x00, 0xF7, 0xFD, 0x83, 0xF7, 0xFF, 0x0E, 0xF7, 0xDF, 0xFF, 0xFE, 0xF7,
+ 0xFD, 0xEF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0x9F, 0xF7,
+ 0x3E, 0xEF, 0xFF, 0xE7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0x82, 0xF7, 0xFF, 0x00, 0xFF, 0xFF, 0x81,
+ 0xFF, 0xDF, 0x01, 0xFF, 0xFF, 0xFF, 0xDF, 0x95, 0xFF, 0xFF, 0x82, 0xF7, 0xFF, 0x04, 0xE7, 0xFF,
+ 0xDF, 0xFF, 0xCF, 0xDF, 0x85, 0xDB, 0x97, 0x1D, 0x81, 0xBF, 0xFF, 0x18, 0x5C, 0x96, 0xCF, 0xFF,
+ 0xDF, 0xFF, 0xAF, 0x5F, 0x65, 0x3A, 0xCF, 0xFF, 0xD7, 0xFF, 0x8E, 0x9E, 0x8E, 0x7D, 0xE7, 0xFF,
+ 0xDF, 0xDF, 0x8D, 0xD8, 0xB7, 0x5E, 0xCF, 0xBF, 0xEF, 0xFF, 0xF7, 0xFF, 0xEF, 0xDF, 0xF7, 0xFF,
+ 0xF7, 0xFE, 0xF7, 0xFD, 0xFF, 0xFE, 0xFF, 0xBE, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0x81, 0xFF,
+ 0xFF, 0x01, 0xF7, 0xFE, 0xEF, 0xDE, 0x83, 0xFF, 0xFF, 0x03, 0xEF, 0xDF, 0xF7, 0xFF, 0xF7, 0xDE,
+ 0xF7, 0xBE, 0x82, 0xFF, 0xFF, 0x00, 0xF7, 0xBD, 0x81, 0xFF, 0xFE, 0x0A, 0xFF, 0xFF, 0xF7, 0xFF,
+ 0xE7, 0xDF, 0xEF, 0xDF, 0xF7, 0xDF, 0xFF, 0xFF, 0xEF, 0x9E, 0xEF, 0xBD, 0xF7, 0xFE, 0xE7, 0xBC,
+ 0xEF, 0xFF, 0x81, 0xF7, 0xFF, 0x02, 0xF7, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0x81, 0xE7, 0xFE, 0x00,
+ 0xEF, 0xFF, 0x81, 0xF7, 0xFF, 0x02, 0xEF, 0xFF, 0xEF, 0xFE, 0xF7, 0xFE, 0x81, 0xFF, 0xFE, 0x01,
+ 0xF7, 0xFE, 0xE7, 0xFD, 0x82, 0xEF, 0xFF, 0x82, 0xE7, 0xFF, 0x01, 0xF7, 0xFF, 0xF7, 0xDF, 0x81,
+ 0xFF, 0xFF, 0x0E, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xFF, 0xFF,
+ 0xFF, 0xF7, 0xFF, 0xEF, 0xBE, 0xFF, 0xFF, 0xEF, 0xBF, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xDE, 0xF7,
+ 0xFF, 0x81, 0xFF, 0xFF, 0x00, 0xEF, 0xBD, 0x81, 0xFF, 0xFE, 0x05, 0xEF, 0xBF, 0xF7, 0xFF, 0xE7,
+ 0xBF, 0xF7, 0xDF, 0xEF, 0x9C, 0xFF, 0xFD, 0x83, 0xFF, 0xFF, 0x01, 0xE7, 0x9F, 0xF7, 0xFF, 0x82,
+ 0xFF, 0xFF, 0x06, 0xFF, 0x9E, 0xF7, 0xFF, 0xEF, 0xBF, 0xF7, 0xBF, 0xEF, 0xFF, 0xE7, 0xFF, 0xDF,
+ 0xBF, 0x81, 0xFF, 0xFF, 0x07, 0xFF, 0xBF, 0xFF, 0xDF, 0xFF, 0xFE, 0xF7, 0xFF, 0xEF, 0xFF, 0xF7,
+ 0xFF, 0xFF, 0xBF, 0xFF, 0x5F, 0x81, 0xFF, 0xDF, 0x02, 0xF7, 0xFF, 0xE7, 0x9E, 0xE7, 0xBF, 0x81,
+ 0xF7, 0xFF, 0x04, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xDF, 0x91, 0xFF, 0xFF,
+ 0x00, 0xFF, 0xDF, 0x81, 0xFF, 0xFF, 0x82, 0xF7, 0xFF, 0x16, 0xEF, 0xFF, 0xD7, 0xFF, 0x8E, 0x7E,
+ 0x8E, 0x3E, 0x64, 0xF8, 0x65, 0xB9, 0x76, 0x3B, 0x86, 0x3D, 0x4C, 0x35, 0x85, 0xFA, 0x8E, 0x7C,
+ 0x75, 0xFC, 0x3C, 0x76, 0x86, 0x1C, 0x86, 0x3C, 0x55, 0x59, 0x65, 0x79, 0x8D, 0xFA, 0x9D, 0xFA,
+ 0x64, 0xF5, 0x7D, 0xB8, 0x96, 0x3B, 0xBE, 0xDD, 0x82, 0xEF, 0xFF, 0x02, 0xEF, 0xFE, 0xF7, 0xFE,
+ 0xFF, 0xFF, 0x81, 0xFF, 0xDF, 0x05, 0xFF, 0xFF, 0xF7, 0xFF, 0xE7, 0x9E, 0xE7, 0xFF, 0xB6, 0xFB,
+ 0xB6, 0xDB, 0x81, 0xEF, 0xFF, 0x10, 0xDF, 0x9F, 0xEF, 0xFF, 0xE7, 0xFF, 0xCF, 0x9E, 0xAE, 0x5A,
+ 0xE7, 0xDF, 0xEF, 0xBF, 0xEF, 0xFF, 0xDF, 0xBF, 0xC6, 0xDA, 0xF7, 0xFE, 0xFF, 0xFF, 0xF7, 0xFF,
+ 0xE7, 0xDF, 0xAE, 0x7C, 0xCF, 0x5F, 0xEF, 0xFF, 0x81, 0xF7, 0xFF, 0x00, 0xC6, 0xDA, 0x81, 0xF7,
+ 0xFE, 0x0A, 0xE7, 0xFF, 0xDF, 0xFF, 0xD7, 0x7F, 0xCF, 0x3F, 0xC7, 0x1D, 0xBF, 0x3C, 0xA6, 0xBA,
+ 0xBF, 0x5D, 0xB7, 0x1D, 0xB6, 0xDC, 0xB6, 0xFC, 0x81, 0xBF, 0x1B, 0x0E, 0xE7, 0xFF, 0xBE, 0xDB,
+ 0xD7, 0x9E, 0xE7, 0xFF, 0xD7, 0xFF, 0xDF, 0xFF, 0xB6, 0xFD, 0xB6, 0xFE, 0x9E, 0x5C, 0x96, 0x39,
+ 0xAE, 0xBC, 0xBF, 0x1F, 0xDF, 0xDF, 0xEF, 0xFF, 0xF7, 0xFF, 0x81, 0xFF, 0xFF, 0x01, 0xFF, 0xDF,
+ 0xFF, 0xFF, 0x81, 0xF7, 0xFF, 0x81, 0xEF, 0xFF, 0x03, 0xD7, 0x5D, 0xE7, 0xFF, 0xAE, 0x9C, 0xD7,
+ 0xBF, 0x81, 0xEF, 0xFF, 0x12, 0xE7, 0xFF, 0xDF, 0xFF, 0xE7, 0xFF, 0xE7, 0xDF, 0xF7, 0xFF, 0xE7,
+ 0xDE, 0xB6, 0xBC, 0xC7, 0x5F, 0xD7, 0xDF, 0xC7, 0x1C, 0xC6, 0xFB, 0xEF, 0xFF, 0x9D, 0xD7, 0xA6,
+ 0x19, 0xAE, 0x3A, 0x9D, 0xB8, 0xAE, 0x9D, 0xB6, 0x9D, 0xF7, 0xFF, 0x81, 0xFF, 0xFF, 0x07, 0xF7,
+ 0xBF, 0xE7, 0xDF, 0xA6, 0x3E, 0xA5, 0xFD, 0xA6, 0x3D, 0x8E, 0x7C, 0x96, 0x7B, 0xDF, 0xDF, 0x81,
+ 0xFF, 0xFF, 0x0E, 0xF7, 0xBF, 0xF7, 0xFE, 0xC7, 0x1B, 0x96, 0x3B, 0xB6, 0xBE, 0xFF, 0xDF, 0xFF,
+ 0x9F, 0xFF, 0xBF, 0xF7, 0x7F, 0xBE, 0xDC, 0x95, 0x97, 0xC6, 0xFC, 0xEF, 0xDF, 0xF7, 0xDF, 0xFF,
+ 0xFF, 0x81, 0xFF, 0xDF, 0x8A, 0xFF, 0xFF, 0x81, 0xF7, 0xFF, 0x85, 0xFF, 0xFF, 0x00, 0xFF, 0xDF,
+ 0x82, 0xFF, 0xFF, 0x1D, 0xF7, 0xBF, 0xFF, 0xDF, 0xFF, 0xFF, 0xE7, 0xFF, 0x96, 0x7C, 0x44, 0x75,
+ 0x75, 0x39, 0x6D, 0x19, 0x75, 0x98, 0x65, 0x57, 0x7D, 0x9A, 0x75, 0x39, 0x75, 0x57, 0x6D, 0x56,
+ 0x6D, 0xB9, 0x5D, 0x37, 0x6D, 0x77, 0x6D, 0x57, 0x65, 0x57, 0x65, 0x78, 0x6D, 0x37, 0x6D, 0x57,
+ 0x65, 0x57, 0x65, 0x37, 0x7D, 0x78, 0x64, 0x54, 0xCF, 0x1F, 0xE7, 0xBF, 0xEF, 0xFF, 0xEF, 0xDF,
+ 0x81, 0xFF, 0xFF, 0x3C, 0xFF, 0xDF, 0xFF, 0xDE, 0xFF, 0xFF, 0xEF, 0xFF, 0xAE, 0xFE, 0x6D, 0x79,
+ 0x44, 0xB5, 0x4D, 0x37, 0x65, 0x59, 0x6D, 0x7A, 0x75, 0x7A, 0x6D, 0x7A, 0x65, 0xBA, 0x5D, 0x79,
+ 0x34, 0x14, 0x75, 0xBA, 0x75, 0x39, 0xCF, 0xFF, 0xBF, 0xFF, 0x54, 0x94, 0xCF, 0x7D, 0xF7, 0xFF,
+ 0xEF, 0xFF, 0xD7, 0x5E, 0x74, 0xD7, 0xB6, 0xFF, 0xE7, 0xFF, 0xEF, 0xFF, 0xD7, 0xFF, 0x5C, 0x31,
+ 0xCE, 0xFA, 0xEF, 0xFE, 0x95, 0xD8, 0x64, 0x74, 0x75, 0x17, 0x8D, 0xFB, 0x54, 0xB6, 0x4C, 0x95,
+ 0x4C, 0x74, 0x5D, 0x37, 0x34, 0x35, 0x44, 0x77, 0x4C, 0xB6, 0x4C, 0xB5, 0x86, 0x1B, 0xB7, 0x9F,
+ 0x65, 0x39, 0x65, 0x38, 0x8E, 0x9C, 0xBF, 0xFF, 0x86, 0xDF, 0x44, 0x98, 0x4C, 0x57, 0x5C, 0xD7,
+ 0x4C, 0x74, 0x54, 0xD5, 0x65, 0x18, 0xCF, 0xFF, 0xE7, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF,
+ 0xDF, 0x3C, 0xFF, 0xFF, 0xF7, 0xFF, 0xE7, 0xFF, 0xCF, 0xDF, 0xB7, 0x1F, 0x75, 0x57, 0x9E, 0x9C,
+ 0x44, 0x75, 0x75, 0xFB, 0x85, 0xFA, 0x96, 0x7C, 0x8E, 0x7C, 0x86, 0x5C, 0x8E, 0x7C, 0xCF, 0xFF,
+ 0xDF, 0xFF, 0xC7, 0xDF, 0x6D, 0xDA, 0x7E, 0x5D, 0xCF, 0xFF, 0x75, 0xDA, 0x6D, 0x58, 0x9F, 0x3F,
+ 0x54, 0xF6, 0x4C, 0xF6, 0x55, 0x16, 0x44, 0xB5, 0x3C, 0xB6, 0x4C, 0xB5, 0xD7, 0xFF, 0xE7, 0xFE,
+ 0xF7, 0xFE, 0xE7, 0xFF, 0xAF, 0xDF, 0x44, 0xD7, 0x44, 0x53, 0x44, 0x93, 0x2C, 0xD5, 0x3C, 0xF6,
+ 0xA6, 0xFE, 0xE7, 0xFF, 0xF7, 0xFF, 0xF7, 0xDF, 0xE7, 0xFF, 0x96, 0x99, 0x34, 0xB5, 0x5D, 0xBA,
+ 0xDF, 0xBF, 0xFF, 0xDF, 0xFF, 0xFF, 0xE7, 0xBF, 0x8E, 0x7C, 0x4C, 0x94, 0xAE, 0x7B, 0xE7, 0xBF,
+ 0xF7, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0x90, 0xFF, 0xFF, 0x00,
+ 0xFF, 0xBF, 0x81, 0xFF, 0xFF, 0x00, 0xF7, 0xBF, 0x81, 0xFF, 0xFF, 0x04, 0xF7, 0xFF, 0xE7, 0xFF,
+ 0x86, 0x5B, 0x6D, 0xB9, 0xCF, 0xDF, 0x81, 0xDF, 0xFF, 0x05, 0xCF, 0xDF, 0xDF, 0xFF, 0xDF, 0xDF,
+ 0xDF, 0xFF, 0xC7, 0xFF, 0xCF, 0xFF, 0x82, 0xD7, 0xFF, 0x02, 0xDF, 0xFF, 0xCF, 0xFF, 0xDF, 0xFF,
+ 0x81, 0xCF, 0xFF, 0x81, 0xC7, 0xFF, 0x20, 0x5C, 0x75, 0xBE, 0xFF, 0xEF, 0xFF, 0xE7, 0xFF, 0xEF,
+ 0xFF, 0xF7, 0xFF, 0xF7, 0xBE, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFE, 0xEF, 0xFF, 0xAE, 0xFF, 0x6D,
+ 0xBA, 0x3C, 0xB5, 0x3C, 0xF7, 0x55, 0x7A, 0x5D, 0x5A, 0x65, 0x3A, 0x6D, 0x7A, 0x4D, 0x59, 0x55,
+ 0xBA, 0x2C, 0x55, 0x5D, 0x59, 0x64, 0xD8, 0xD7, 0xFF, 0xC7, 0xFF, 0x2B, 0xD1, 0xAF, 0x1C, 0xE7,
+ 0xFF, 0xF7, 0xFF, 0xDF, 0x7F, 0x5C, 0x35, 0xB6, 0xFF, 0x81, 0xE7, 0xFF, 0x1F, 0xC7, 0xFF, 0x44,
+ 0x11, 0xDF, 0x9D, 0xF7, 0xFF, 0xA6, 0x3B, 0x96, 0x3C, 0xB7, 0x5F, 0xB7, 0xBF, 0xB7, 0xFF, 0xA7,
+ 0x9F, 0xB7, 0xBF, 0x9E, 0xFF, 0x44, 0xDA, 0x86, 0xFF, 0xAF, 0xDF, 0xAF, 0x7F, 0xBF, 0xBF, 0xCF,
+ 0xFF, 0xAF, 0x9F, 0x9F, 0x3F, 0xA7, 0x7F, 0xAF, 0xBF, 0x4D, 0x1A, 0x65, 0xDE, 0xA7, 0x9F, 0xBF,
+ 0xFF, 0xAF, 0xFF, 0x97, 0x3F, 0x55, 0x18, 0x86, 0x3C, 0xBF, 0x5E, 0xE7, 0xFF, 0x81, 0xFF, 0xFF,
+ 0x17, 0xFF, 0xDF, 0xFF, 0xFF, 0xEF, 0xDF, 0xC7, 0x5D, 0x8E, 0x1A, 0x54, 0xB6, 0x96, 0xBD, 0xA7,
+ 0x5F, 0x34, 0x75, 0x65, 0xFB, 0x5D, 0x18, 0x54, 0xB6, 0x55, 0x17, 0x44, 0xD6, 0x4D, 0x17, 0x5D,
+ 0x37, 0xBF, 0x7F, 0xA6, 0xDD, 0x2C, 0x35, 0x34, 0xD8, 0x5D, 0x9A, 0x3C, 0x55, 0x4C, 0xB7, 0x97,
+ 0x1F, 0x82, 0xAF, 0xFF, 0x0E, 0x9F, 0xFF, 0x34, 0xF7, 0x5D, 0x99, 0xDF, 0xFF, 0xE7, 0xFE, 0xEF,
+ 0xFE, 0xDF, 0xFF, 0x7F, 0x1F, 0x1C, 0x96, 0x4D, 0x36, 0x66, 0x18, 0x3D, 0x78, 0x24, 0xB6, 0x7E,
+ 0x1C, 0xD7, 0xDF, 0x81, 0xF7, 0xDF, 0x04, 0xE7, 0xFF, 0x7E, 0x58, 0x1C, 0xF7, 0x45, 0xFC, 0xD7,
+ 0xFF, 0x81, 0xFF, 0xFF, 0x04, 0xE7, 0xFF, 0x86, 0xDE, 0x34, 0xB6, 0xA6, 0x9B, 0xEF, 0xFF, 0x81,
+ 0xF7, 0xFF, 0x82, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x88, 0xFF, 0xFF, 0x85, 0xFF, 0xDF, 0x81, 0xFF,
+ 0xFF, 0x03, 0xFF, 0xDF, 0xFF, 0xFF, 0xE7, 0x7D, 0xCF, 0x3C, 0x81, 0xE7, 0xFF, 0x04, 0xC7, 0x3C,
+ 0xB7, 0x3C, 0x55, 0x35, 0x75, 0xB8, 0xE7, 0xFF, 0x82, 0xEF, 0xFF, 0x81, 0xF7, 0xDF, 0x03, 0xEF,
+ 0xFF, 0xDF, 0xFF, 0xE7, 0xFE, 0xEF, 0xFF, 0x81, 0xF7, 0xFD, 0x16, 0xF7, 0xFF, 0xEF, 0xFF, 0xF7,
+ 0xFF, 0xEF, 0xFF, 0xE7, 0xFF, 0xDF, 0xFF, 0xD7, 0xFF, 0x54, 0x75, 0x85, 0xFA, 0xA6, 0xFE, 0xBF,
+ 0xBF, 0xDF, 0xFF, 0xDF, 0xDF, 0xCE, 0xDB, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xBE, 0xFF, 0xFF, 0xDF,
+ 0xDF, 0xC7, 0xDF, 0x9E, 0xFC, 0x96, 0xFC, 0xBF, 0xFF, 0x81, 0xD7, 0xFF, 0x1F, 0xDF, 0xFF, 0xCF,
+ 0xFF, 0xAF, 0xDF, 0x86, 0x3B, 0xBF, 0x9F, 0xDF, 0xBF, 0xE7, 0xFF, 0xC7, 0xDF, 0x5C, 0xD4, 0xA7,
+ 0x1D, 0xDF, 0xFF, 0xF7, 0xFF, 0xEF, 0xDF, 0x5C, 0x34, 0xBF, 0x3F, 0xE7, 0xFF, 0xDF, 0xFF, 0xAF,
+ 0xDF, 0x4C, 0x96, 0xEF, 0xFF, 0xF7, 0xFF, 0xC7, 0x3F, 0xCF, 0xFF, 0xD7, 0xFF, 0xCF, 0xFF, 0xD7,
+ 0xFF, 0xBF, 0x7F, 0xEF, 0xFF, 0xC7, 0x1D, 0x4C, 0x35, 0xAF, 0x7F, 0xDF, 0xFF, 0x82, 0xE7, 0xFF,
+ 0x0E, 0xB7, 0x5F, 0xBF, 0x9F, 0xCF, 0xDF, 0x75, 0x35, 0x3B, 0xF3, 0x7E, 0x1E, 0x86, 0x9F, 0x76,
+ 0x3F, 0x8F, 0x1F, 0x7E, 0xDF, 0x45, 0x18, 0x3C, 0x75, 0x96, 0x7B, 0xEF, 0xFF, 0xFF, 0xFF, 0x82,
+ 0xFF, 0xDF, 0x37, 0xE7, 0xBF, 0xBF, 0x1D, 0x6D, 0xB9, 0x33, 0xF2, 0xBF, 0x9F, 0x9E, 0xFD, 0x3C,
+ 0xB5, 0x97, 0x7F, 0xCF, 0xFF, 0xB7, 0x5F, 0xCF, 0xFF, 0xB7, 0xFF, 0x6D, 0xFB, 0x4C, 0x94, 0xE7,
+ 0xFF, 0xCF, 0xBF, 0x44, 0xF7, 0x4D, 0xDA, 0x65, 0xBA, 0x65, 0x38, 0x64, 0x97, 0xAE, 0xBF, 0xD7,
+ 0xFF, 0xCF, 0xFF, 0xC7, 0xFF, 0xAF, 0xBF, 0x3C, 0x76, 0x96, 0x9E, 0xEF, 0xFF, 0xFF, 0xFF, 0xF7,
+ 0xDE, 0xDF, 0xFF, 0x5D, 0xBE, 0x24, 0xB9, 0x86, 0xFE, 0xB7, 0xFF, 0x8F, 0x7F, 0x3C, 0xF8, 0x5D,
+ 0x19, 0xDF, 0xDF, 0xFF, 0x9F, 0xFF, 0xBF, 0xEF, 0xFF, 0x86, 0x39, 0x1D, 0x19, 0x3D, 0xFD, 0xD7,
+ 0xFF, 0xF7, 0xFF, 0xF7, 0xFD, 0xDF, 0xFF, 0x76, 0xDF, 0x2C, 0x77, 0xAE, 0xBC, 0xF7, 0xFF, 0xFF,
+ 0xFF, 0xF7, 0xDF, 0x82, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x88, 0xFF, 0xFF, 0x86, 0xFF, 0xDF, 0x0C,
+ 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xC6, 0xBA, 0xA5, 0xF7, 0xC7, 0x1C, 0xB6, 0xBA, 0x7D, 0x34,
+ 0x64, 0xF4, 0x4D, 0x15, 0x6D, 0xD8, 0xE7, 0xFF, 0xE7, 0xBF, 0x81, 0xEF, 0xFF, 0x05, 0xFF, 0xBF,
+ 0xFF, 0xFF, 0xDF, 0xBF, 0xEF, 0xFF, 0xF7, 0xFE, 0xF7, 0xFC, 0x81, 0xFF, 0xDC, 0x37, 0xFF, 0xFE,
+ 0xFF, 0xFF, 0xF7, 0xBF, 0xF7, 0xFF, 0xEF, 0xFF, 0xDF, 0xFF, 0xD7, 0xFF, 0x5C, 0xD5, 0x5C, 0xF6,
+ 0x5C, 0xD5, 0x96, 0x5A, 0xB7, 0x1D, 0xB6, 0x9A, 0xAD, 0xD7, 0xF7, 0xBE, 0xFF, 0xFF, 0xFF, 0xDE,
+ 0xFF, 0xFF, 0xEF, 0xFF, 0xC7, 0x9F, 0xBF, 0xDE, 0xB7, 0x9E, 0xA6, 0xFD, 0xBF, 0x9F, 0xDF, 0xDF,
+ 0xB6, 0x9C, 0xAF, 0x3D, 0xD7, 0xFF, 0xAF, 0x5F, 0xA6, 0x9C, 0xEF, 0xDF, 0xF7, 0xFF, 0xDF, 0xFF,
+ 0x54, 0x73, 0xAF, 0x1E, 0xD7, 0xFF, 0xEF, 0xDF, 0xEF, 0xFF, 0x5C, 0x53, 0xB7, 0x5E, 0xE7, 0xFF,
+ 0xDF, 0xFF, 0x9F, 0x7F, 0x3C, 0x35, 0xDF, 0x9F, 0xEF, 0x9F, 0xB6, 0xDF, 0x7D, 0xBB, 0x65, 0x36,
+ 0x86, 0x7A, 0x96, 0xDC, 0x85, 0x97, 0xEF, 0xDF, 0xDF, 0x9E, 0x54, 0x75, 0xAF, 0x9F, 0x81, 0xDF,
+ 0xFF, 0x10, 0xF7, 0xFF, 0xE7, 0xDF, 0x54, 0x55, 0x64, 0xF7, 0xD7, 0xFF, 0x7D, 0x34, 0x7D, 0xBA,
+ 0x55, 0x1A, 0x55, 0x5D, 0x24, 0x18, 0x45, 0x19, 0x45, 0x18, 0x4D, 0xBA, 0x4D, 0x78, 0xB7, 0x7E,
+ 0xDF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xBF, 0x16, 0xFF, 0xFF, 0xF7, 0xFF, 0xD7, 0xFF, 0x8E, 0xDD,
+ 0x55, 0x37, 0xBF, 0x7F, 0xB7, 0x5F, 0x8E, 0xFD, 0xC7, 0xFF, 0xCF, 0xFF, 0x64, 0x94, 0xA7, 0x1D,
+ 0xB7, 0xDF, 0x65, 0x57, 0x96, 0x5B, 0xDF, 0x9F, 0xE7, 0xFF, 0x5D, 0x98, 0x66, 0x5C, 0xC7, 0xFF,
+ 0x75, 0x79, 0x8D, 0xDC, 0xD7, 0xFF, 0x81, 0xCF, 0xFF, 0x0F, 0xAF, 0x9F, 0x7E, 0x5D, 0x3C, 0x76,
+ 0xAF, 0x5F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xDF, 0xFF, 0x3C, 0xDB, 0x24, 0x79, 0x9F, 0x3F,
+ 0xCF, 0xFF, 0xBF, 0xFF, 0x3C, 0xB8, 0x34, 0x16, 0xCF, 0xBF, 0x81, 0xFF, 0x9F, 0x0A, 0xF7, 0xDF,
+ 0x8E, 0x7A, 0x14, 0xF9, 0x35, 0xDD, 0xDF, 0xFF, 0xF7, 0xFF, 0xF7, 0xFD, 0xDF, 0xFF, 0x86, 0xFF,
+ 0x34, 0x98, 0xAE, 0xBD, 0x81, 0xF7, 0xFF, 0x00, 0xEF, 0x9E, 0x94, 0xFF, 0xFF, 0x07, 0xFF, 0xDF,
+ 0xFF, 0xFF, 0xF7, 0xBF, 0xE7, 0x5E, 0xEF, 0xFF, 0xF7, 0xFF, 0xDF, 0x7E, 0xCF, 0xDF, 0x81, 0x5D,
+ 0xF9, 0x08, 0xDF, 0xFF, 0xE7, 0xBF, 0xE7, 0xFF, 0xEF, 0xFF, 0xF7, 0xDF, 0xEF, 0xDF, 0xDF, 0xFF,
+ 0xD7, 0xDF, 0xEF, 0xFF, 0x81, 0xFF, 0xFE, 0x02, 0xFF, 0xDE, 0xF7, 0xBE, 0xFF, 0xFF, 0x81, 0xF7,
+ 0xFF, 0x00, 0xEF, 0xFF, 0x81, 0xE7, 0xFF, 0x05, 0x64, 0x94, 0x9E, 0x3B, 0xCF, 0xBF, 0xE7, 0xFF,
+ 0xE7, 0xDF, 0xEF, 0xDF, 0x82, 0xF7, 0xFF, 0x75, 0xFF, 0xFF, 0xF7, 0xFF, 0xE7, 0xFF, 0x7D, 0x99,
+ 0x7D, 0xD7, 0xCF, 0xFF, 0x54, 0xD6, 0x9E, 0xDF, 0xD7, 0xFF, 0x85, 0x78, 0x8E, 0x5A, 0xCF, 0xFF,
+ 0xB7, 0xDF, 0x54, 0x54, 0xE7, 0xBF, 0xF7, 0xFF, 0xD7, 0xFF, 0x64, 0xD5, 0xB6, 0xFE, 0xD7, 0xBF,
+ 0xF7, 0xFF, 0xE7, 0xFF, 0x4C, 0x93, 0x9F, 0x5E, 0xE7, 0xFF, 0xDF, 0xFF, 0x96, 0xBE, 0x54, 0x56,
+ 0xF7, 0xFF, 0xE7, 0x5F, 0x8D, 0x9A, 0x5C, 0xD7, 0x65, 0x56, 0xAF, 0xFF, 0x97, 0x5F, 0x4C, 0xD5,
+ 0xDF, 0xDF, 0xCF, 0x7F, 0x44, 0x96, 0x55, 0x9A, 0x75, 0xF9, 0x7D, 0x76, 0xAE, 0x5A, 0xDF, 0xFF,
+ 0x96, 0xDF, 0x3C, 0x75, 0xB7, 0x9F, 0xA7, 0x5D, 0x97, 0x3F, 0x87, 0x3F, 0x87, 0x1F, 0x45, 0x1C,
+ 0x5D, 0xBC, 0x8F, 0x7F, 0x87, 0x7F, 0x97, 0x9F, 0xBF, 0xDF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF,
+ 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xDF, 0xFF, 0xB7, 0xFF, 0x3C, 0x94, 0xBF, 0x7F, 0xD7, 0xFF,
+ 0xB7, 0xDF, 0xBF, 0xFF, 0xDF, 0xFF, 0x5C, 0x53, 0xA6, 0xBB, 0xC7, 0xFF, 0x9E, 0xDD, 0xD7, 0xFF,
+ 0xF7, 0xDF, 0xEF, 0xDF, 0x6D, 0xB9, 0x6E, 0x7D, 0xCF, 0xFF, 0x6D, 0x99, 0x65, 0xBC, 0x97, 0x7F,
+ 0x4D, 0x7A, 0x3D, 0x18, 0x45, 0x99, 0x2C, 0xF7, 0x3D, 0x38, 0x4C, 0xD6, 0xDF, 0xDE, 0xFF, 0xFF,
+ 0xF7, 0xBF, 0xBE, 0xDE, 0x3C, 0x58, 0x44, 0xF9, 0xCF, 0xFF, 0xD7, 0xFF, 0xBF, 0xFF, 0x6E, 0x3E,
+ 0x2C, 0x97, 0x76, 0x1D, 0xFF, 0xDF, 0xFF, 0x9F, 0xF7, 0xBE, 0x8E, 0x7A, 0x14, 0xD9, 0x45, 0xFE,
+ 0xE7, 0xFF, 0xFF, 0xFE, 0xF7, 0xFC, 0xDF, 0xFF, 0x97, 0x1F, 0x44, 0x78, 0xB6, 0xDD, 0xF7, 0xFF,
+ 0xF7, 0xDF, 0xEF, 0x9E, 0x81, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x91, 0xFF, 0xFF, 0x03, 0xF7, 0xBE,
+ 0xFF, 0xFF, 0xF7, 0xFF, 0xE7, 0x9F, 0x81, 0xF7, 0xFF, 0x13, 0xE7, 0xBF, 0xD7, 0xFF, 0x55, 0xFA,
+ 0x66, 0x7C, 0xD7, 0xFF, 0xE7, 0xFF, 0xD7, 0xFF, 0x9E, 0x5B, 0x9D, 0x7A, 0x95, 0x5A, 0x9E, 0x5D,
+ 0xD7, 0xFF, 0xEF, 0xFF, 0xE7, 0x7C, 0xFF, 0xFF, 0xF7, 0x7E, 0xFF, 0xFF, 0xF7, 0xFF, 0xE7, 0x9D,
+ 0xF7, 0xFD, 0x81, 0xEF, 0xFF, 0x04, 0xE7, 0xFF, 0x74, 0xF5, 0xA6, 0x9C, 0xDF, 0xFF, 0xDF, 0xDF,
+ 0x81, 0xEF, 0xFF, 0x00, 0xD7, 0x5D, 0x83, 0xF7, 0xFF, 0x5E, 0xDF, 0xFF, 0x75, 0x58, 0x8D, 0xF8,
+ 0xD7, 0xFF, 0x5C, 0xF7, 0xA7, 0x1F, 0xD7, 0xFF, 0x7D, 0x57, 0x85, 0xB8, 0xCF, 0xFF, 0xBF, 0xFF,
+ 0x54, 0x55, 0xD7, 0x7F, 0xEF, 0xFF, 0xCF, 0xDF, 0x7D, 0x37, 0xA5, 0xFA, 0xE7, 0xDF, 0xE7, 0xFF,
+ 0xBF, 0xBE, 0x45, 0x15, 0x87, 0x3D, 0xCF, 0xFE, 0xE7, 0xFF, 0xA6, 0xBE, 0x53, 0xD4, 0xE7, 0x3E,
+ 0xF7, 0xFF, 0xD7, 0xFF, 0x86, 0x3B, 0x75, 0xB8, 0xBF, 0xFF, 0x7E, 0xFD, 0x55, 0x16, 0xE7, 0xFF,
+ 0xCF, 0x9F, 0x34, 0x76, 0x4D, 0xBA, 0x65, 0x97, 0x75, 0x76, 0xAE, 0x5A, 0xDF, 0xFF, 0xBF, 0xFF,
+ 0x3C, 0xB6, 0x9F, 0x5D, 0x5D, 0x35, 0x34, 0x96, 0x3D, 0x1A, 0x3D, 0x1B, 0x2C, 0x78, 0x3C, 0xB8,
+ 0x44, 0xF7, 0x2C, 0xD7, 0x24, 0x33, 0x8E, 0x19, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0xBF,
+ 0xF7, 0xDF, 0xF7, 0xFF, 0xE7, 0xFF, 0xAF, 0xFF, 0x3C, 0x73, 0xC7, 0x9F, 0xD7, 0xFF, 0x7D, 0xD8,
+ 0x8E, 0xBB, 0xC7, 0xBF, 0x54, 0x32, 0xA6, 0xBB, 0xC7, 0xBF, 0x5C, 0xB6, 0xCF, 0xDF, 0xF7, 0x9F,
+ 0xEF, 0xDF, 0x6D, 0x99, 0x6E, 0x5C, 0xBF, 0xFF, 0x75, 0xFA, 0x65, 0xDA, 0x97, 0x9F, 0x6E, 0x5B,
+ 0x6E, 0x7B, 0x5E, 0x7C, 0x24, 0xB5, 0x45, 0x37, 0x7E, 0x5A, 0xDF, 0xDE, 0xF7, 0xFE, 0xEF, 0xFF,
+ 0x85, 0xDB, 0x3C, 0xDA, 0x66, 0x3F, 0xD7, 0xFF, 0x81, 0xCF, 0xFF, 0x10, 0x8F, 0x5F, 0x1D, 0x18,
+ 0x4D, 0xBA, 0xDF, 0x9F, 0xFF, 0xDF, 0xF7, 0xFF, 0x86, 0x39, 0x1D, 0x3A, 0x45, 0xFD, 0xE7, 0xFF,
+ 0xF7, 0xBD, 0xEF, 0xFB, 0xDF, 0xFE, 0xA7, 0x1F, 0x4C, 0x18, 0xBE, 0xFE, 0xF7, 0xFF, 0x81, 0xF7,
+ 0xDF, 0x81, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x89, 0xFF, 0xFF, 0x84, 0xFF, 0xDF, 0x83, 0xFF, 0xFF,
+ 0x22, 0xEF, 0xDE, 0xD7, 0x3C, 0xBE, 0xDB, 0xCF, 0x7E, 0xCF, 0x9E, 0x9E, 0x7A, 0x86, 0x5A, 0x3D,
+ 0x58, 0x5E, 0x3C, 0xD7, 0xFF, 0xE7, 0xFF, 0xA7, 0x3E, 0x54, 0x95, 0x85, 0x39, 0x7C, 0xF9, 0x33,
+ 0xD4, 0x75, 0xBA, 0xDF, 0xDF, 0xE7, 0x7D, 0xFF, 0xFF, 0xEF, 0x7F, 0xF7, 0xFF, 0xEF, 0xDF, 0xFF,
+ 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xFF, 0xD7, 0xDF, 0x5C, 0x93, 0x6D, 0x97, 0x96, 0x9B, 0xA6,
+ 0xBC, 0xCF, 0x9F, 0xCF, 0x5E, 0xAE, 0x18, 0x81, 0xF7, 0xFF, 0x39, 0xFF, 0xDF, 0xFF, 0xFF, 0xE7,
+ 0xFF, 0x75, 0x16, 0x9D, 0xF8, 0xDF, 0xFF, 0x5C, 0xD6, 0xA7, 0x1F, 0xDF, 0xFF, 0x8D, 0x77, 0x95,
+ 0x97, 0xDF, 0xFF, 0xCF, 0xFF, 0x5C, 0x74, 0xCE, 0xFC, 0xEF, 0xDF, 0xE7, 0xFF, 0xC6, 0xDD, 0xEF,
+ 0x3F, 0xF7, 0x9F, 0xE7, 0xFF, 0x86, 0x99, 0x1C, 0xD4, 0x5E, 0x7B, 0xDF, 0xFF, 0xEF, 0xFF, 0xDF,
+ 0xBF, 0xB6, 0x3C, 0xF7, 0xBF, 0xEF, 0xFF, 0xCF, 0xFF, 0x7E, 0x1A, 0x75, 0xB8, 0xC7, 0xFF, 0x86,
+ 0xFE, 0x5D, 0x16, 0xEF, 0xFF, 0xDF, 0xBF, 0x54, 0xF7, 0x9F, 0xBF, 0xBF, 0xFF, 0xDF, 0xFF, 0xE7,
+ 0x7E, 0xEF, 0xFF, 0xD7, 0xFF, 0x44, 0x74, 0xB7, 0xBF, 0x86, 0x39, 0x65, 0x79, 0x97, 0x5F, 0x7F,
+ 0x1F, 0x3D, 0x1A, 0x65, 0xBB, 0x8E, 0xFF, 0x97, 0xBF, 0x55, 0x98, 0xC7, 0x9F, 0xF7, 0xFF, 0x81,
+ 0xFF, 0xFF, 0x82, 0xF7, 0xFF, 0x14, 0xE7, 0xFF, 0xB7, 0xFF, 0x3C, 0x53, 0xBF, 0x7F, 0xD7, 0xFF,
+ 0x54, 0x94, 0x8E, 0x9C, 0xC7, 0xFF, 0x54, 0x74, 0xAE, 0xFC, 0xC7, 0xBF, 0x3B, 0xF4, 0xC7, 0xDF,
+ 0xFF, 0xFF, 0xF7, 0xFF, 0x65, 0x5A, 0x6E, 0x7E, 0xC7, 0xFF, 0x7D, 0xF9, 0x96, 0x18, 0xE7, 0xFF,
+ 0x81, 0xDF, 0xFF, 0x1E, 0xC7, 0xFF, 0x65, 0xB8, 0x86, 0x5A, 0xD7, 0xFF, 0xEF, 0xFF, 0xE7, 0xFF,
+ 0xD7, 0xFF, 0x3C, 0x99, 0x1C, 0x9B, 0x45, 0xBF, 0x76, 0x7E, 0x76, 0x1B, 0x76, 0x7C, 0x56, 0x5B,
+ 0x04, 0xD6, 0x25, 0x78, 0xB7, 0xBF, 0xEF, 0xFF, 0xE7, 0xFF, 0x7E, 0x38, 0x14, 0xD8, 0x3D, 0x9C,
+ 0xE7, 0xFF, 0xFF, 0xFE, 0xF7, 0xFC, 0xE7, 0xFF, 0xBF, 0x9F, 0x5C, 0x38, 0xCF, 0x3F, 0xEF, 0xFF,
+ 0xF7, 0xDF, 0x81, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x8A, 0xFF, 0xFF, 0x85, 0xFF, 0xDF, 0x82, 0xFF,
+ 0xFF, 0x08, 0xEF, 0xDF, 0xCF, 0x1C, 0xB6, 0xBA, 0xC7, 0x5D, 0xBF, 0x5E, 0x8E, 0x18, 0x75, 0xB8,
+ 0x3D, 0x38, 0x55, 0xBA, 0x81, 0xDF, 0xFF, 0x29, 0x65, 0x77, 0x3C, 0x33, 0xB7, 0x5F, 0xCF, 0xFF,
+ 0x76, 0x3F, 0x3C, 0x55, 0xE7, 0xFF, 0xF7, 0xFF, 0xEF, 0xBF, 0xF7, 0xFF, 0xDF, 0xFF, 0xCF, 0x5F,
+ 0xEF, 0xBF, 0xFF, 0xDE, 0xFF, 0xFF, 0xF7, 0xFF, 0xDF, 0xFF, 0x54, 0xB4, 0x65, 0x76, 0x75, 0xB7,
+ 0xA6, 0xBC, 0xC7, 0x5E, 0xCF, 0x3D, 0xB6, 0x59, 0xEF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
+ 0xD7, 0xFF, 0x64, 0xD4, 0xBE, 0x7A, 0xE7, 0xFF, 0x5C, 0xB6, 0x9E, 0xFF, 0xD7, 0xFF, 0x8D, 0x97,
+ 0x9D, 0x97, 0xE7, 0xFF, 0xD7, 0xFF, 0x64, 0x95, 0xBE, 0x9A, 0xEF, 0xFE, 0x81, 0xEF, 0xFF, 0x17,
+ 0xFF, 0xBF, 0xEF, 0x7F, 0xDF, 0xFF, 0x55, 0x55, 0x2D, 0x57, 0x3D, 0x57, 0xCF, 0xFF, 0xE7, 0xBF,
+ 0xDF, 0x7F, 0xEF, 0xBF, 0xFF, 0xFF, 0xE7, 0xFE, 0xD7, 0xFF, 0x7E, 0x1A, 0x75, 0x99, 0xC7, 0xFF,
+ 0x97, 0x5F, 0x4C, 0xB4, 0xE7, 0x9F, 0xD7, 0x3F, 0x44, 0x13, 0xB7, 0xFF, 0xD7, 0xFF, 0xE7, 0xFF,
+ 0x81, 0xFF, 0xFF, 0x04, 0xD7, 0xFF, 0x4C, 0x32, 0xAF, 0x3D, 0x8E, 0x5A, 0x65, 0x38, 0x81, 0xB7,
+ 0xFF, 0x18, 0x3C, 0xF8, 0x86, 0x9E, 0xC7, 0xFF, 0x9F, 0xDF, 0x2C, 0x12, 0xC7, 0x9F, 0xEF, 0xDF,
+ 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xEF, 0xFF, 0xEF, 0xDF, 0xE7, 0xFF, 0xBF, 0xFF, 0x3C, 0x53,
+ 0xB7, 0x3F, 0xDF, 0xFF, 0x4C, 0x32, 0xB7, 0x9F, 0xCF, 0xFF, 0x4C, 0x74, 0xAE, 0xFC, 0xDF, 0xFF,
+ 0x4C, 0x56, 0xAE, 0xDF, 0x81, 0xF7, 0xFF, 0x18, 0x65, 0x39, 0x66, 0x1D, 0xBF, 0xFF, 0x65, 0x36,
+ 0x9D, 0xB5, 0xEF, 0x9C, 0xF7, 0xFD, 0xF7, 0xFF, 0xD7, 0xFF, 0x6D, 0x37, 0x95, 0xD8, 0xE7, 0xFF,
+ 0xEF, 0xFF, 0xDF, 0xFF, 0xA7, 0xDF, 0x24, 0x79, 0x1C, 0x9B, 0x2C, 0xDB, 0x3C, 0x97, 0x4C, 0xF6,
+ 0x44, 0x73, 0x34, 0xF5, 0x0D, 0x16, 0x1D, 0x38, 0x97, 0x1F, 0x81, 0xD7, 0xFF, 0x0B, 0x86, 0x9A,
+ 0x24, 0xD8, 0x4D, 0x9C, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xDF, 0x9D, 0xC7, 0x3F, 0x5C, 0x16,
+ 0xDF, 0x9F, 0xEF, 0xFF, 0xF7, 0xDF, 0x81, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x92, 0xFF, 0xFF, 0x03,
+ 0xF7, 0xBE, 0xFF, 0xFF, 0xF7, 0xFF, 0xE7, 0xDF, 0x81, 0xEF, 0xFF, 0x11, 0xD7, 0xDF, 0xD7, 0xFF,
+ 0x65, 0xDB, 0x6D, 0xBB, 0xE7, 0xFF, 0xD7, 0xBF, 0x6D, 0xD8, 0x3C, 0xB4, 0xA7, 0x1F, 0xCF, 0xFF,
+ 0x6E, 0x5F, 0x34, 0x76, 0xD7, 0xDF, 0xE7, 0xBE, 0xC6, 0xBB, 0xE7, 0xFF, 0xAE, 0xFF, 0x64, 0xD6,
+ 0x81, 0xE7, 0xFF, 0x06, 0xEF, 0xFF, 0xE7, 0xFF, 0xDF, 0xFF, 0x5C, 0xF5, 0xA7, 0x3E, 0xCF, 0xFF,
+ 0xE7, 0xFF, 0x81, 0xEF, 0xFF, 0x1C, 0xE7, 0xDF, 0xEF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF,
+ 0xBF, 0xBF, 0x5C, 0x94, 0xD7, 0x3D, 0xF7, 0xFF, 0x64, 0xF7, 0x8E, 0xDF, 0xCF, 0xFF, 0x9E, 0x59,
+ 0xB6, 0x3A, 0xE7, 0xDF, 0xD7, 0xFF, 0x64, 0xD6, 0xA6, 0x58, 0xEF, 0xFF, 0xE7, 0xFF, 0xEF, 0xFF,
+ 0xF7, 0xFF, 0xEF, 0xFF, 0xA6, 0xDB, 0x4C, 0xB4, 0x7E, 0xDE, 0x4D, 0x38, 0x85, 0xB9, 0xE7, 0xFF,
+ 0x81, 0xEF, 0xFF, 0x58, 0xDF, 0xBD, 0xE7, 0xFF, 0xD7, 0xFF, 0x7D, 0xF9, 0x7D, 0x78, 0xD7, 0xFF,
+ 0x9F, 0x9F, 0x54, 0xB5, 0xF7, 0xFF, 0xF7, 0xDF, 0x4C, 0x13, 0xB7, 0xDF, 0xD7, 0xFF, 0xD7, 0x9F,
+ 0xEF, 0x3F, 0xF7, 0x7F, 0xE7, 0xFF, 0x64, 0xB4, 0xBF, 0x9F, 0x8E, 0x5B, 0x75, 0x9A, 0xC7, 0xFF,
+ 0x9F, 0xFF, 0x2C, 0x96, 0x86, 0x5C, 0xCF, 0xFF, 0xB7, 0xFF, 0x44, 0xB5, 0xCF, 0xBF, 0xEF, 0xBF,
+ 0xF7, 0xDF, 0xEF, 0xBF, 0xC7, 0x3D, 0xE7, 0xFF, 0xEF, 0xFF, 0xE7, 0xFF, 0xBF, 0xDF, 0x44, 0x54,
+ 0xC7, 0x5F, 0xCF, 0x7E, 0x5B, 0xF1, 0xCF, 0xFF, 0xC7, 0xFF, 0x44, 0x32, 0xB6, 0xBA, 0xEF, 0xFF,
+ 0x75, 0x18, 0x95, 0xDB, 0xFF, 0xDF, 0xFF, 0xFF, 0x9E, 0xBF, 0x55, 0x39, 0x8F, 0x1E, 0x65, 0x15,
+ 0xD7, 0x3D, 0xFF, 0xDF, 0xF7, 0xBF, 0xEF, 0xFF, 0xD7, 0xFF, 0x75, 0x19, 0x9D, 0xB8, 0xF7, 0xFF,
+ 0xEF, 0xFF, 0xDF, 0xFF, 0x76, 0x7F, 0x2C, 0xDA, 0x55, 0xDD, 0x76, 0x5D, 0x86, 0x3B, 0x9E, 0x7B,
+ 0x96, 0x5A, 0x86, 0x3A, 0x6E, 0x7D, 0x24, 0x76, 0x65, 0x7A, 0xCF, 0xFF, 0xD7, 0xFF, 0x96, 0x7B,
+ 0x3C, 0xD9, 0x5D, 0x7C, 0xEF, 0xBF, 0xFF, 0x7F, 0xFF, 0x9D, 0xF7, 0x9E, 0xDF, 0xDF, 0x95, 0xDC,
+ 0xDF, 0xBF, 0xEF, 0xFF, 0xF7, 0xDF, 0x8D, 0xFF, 0xFF, 0x81, 0xF7, 0xFF, 0x85, 0xFF, 0xFF, 0x19,
+ 0xF7, 0xBE, 0xFF, 0xFF, 0xF7, 0xFF, 0xE7, 0xBF, 0xF7, 0xFF, 0xEF, 0xFF, 0xDF, 0xBF, 0xD7, 0xFF,
+ 0x6D, 0x9B, 0x7D, 0xDB, 0xE7, 0xDF, 0xE7, 0xFF, 0xAF, 0xFF, 0x45, 0x36, 0x44, 0x95, 0x65, 0xDC,
+ 0x24, 0x99, 0x76, 0xBF, 0xDF, 0xFF, 0xBE, 0xBB, 0x8D, 0x77, 0xBF, 0x9F, 0x9F, 0x5F, 0x3C, 0x95,
+ 0xCF, 0xFF, 0xCF, 0xDF, 0x81, 0xDF, 0xFF, 0x04, 0xC7, 0xFF, 0x4C, 0x74, 0x96, 0xFE, 0xCF, 0xFF,
+ 0xE7, 0xFF, 0x81, 0xEF, 0xDF, 0x1E, 0xEF, 0xFF, 0xE7, 0xFE, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF,
+ 0xB7, 0xBF, 0x4C, 0x94, 0xDF, 0x7E, 0xE7, 0xBF, 0x5D, 0x38, 0x7E, 0xFF, 0xC7, 0xFF, 0xCF, 0xFF,
+ 0xDF, 0xDF, 0xEF, 0xFF, 0xD7, 0xFF, 0x65, 0x58, 0x8E, 0x17, 0xE7, 0xFF, 0xDF, 0xFF, 0xE7, 0xFF,
+ 0xCF, 0xDF, 0x9E, 0x7A, 0x54, 0x73, 0x86, 0x1A, 0xC7, 0xFF, 0x9E, 0xBE, 0x64, 0xB6, 0x9E, 0x5B,
+ 0xCF, 0xDF, 0xDF, 0xFF, 0x82, 0xD7, 0xFF, 0x04, 0x85, 0xB8, 0x85, 0x78, 0xD7, 0xFF, 0x86, 0xFE,
+ 0x44, 0xB6, 0x81, 0xDF, 0x9F, 0x2C, 0x4C, 0x55, 0x9F, 0x7F, 0xCF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xDF, 0xCF, 0x9F, 0x4C, 0x32, 0xA7, 0x5F, 0x75, 0xD9, 0x7D, 0xFC, 0xA7, 0x9F, 0x2C, 0x96,
+ 0x3C, 0xF7, 0x9F, 0x1F, 0xCF, 0xFF, 0xB7, 0xFF, 0x54, 0xD6, 0xA6, 0x5B, 0xE7, 0x9F, 0xF7, 0xDF,
+ 0xB6, 0x59, 0x75, 0x15, 0xCF, 0xFF, 0xEF, 0xFF, 0xE7, 0xFF, 0xB7, 0x9F, 0x4C, 0x74, 0xC7, 0xBF,
+ 0xAE, 0x7B, 0x6C, 0x93, 0xDF, 0xFF, 0xB7, 0xFF, 0x44, 0xB4, 0xB6, 0xDB, 0xE7, 0xFF, 0x8D, 0xDC,
+ 0x8D, 0xBB, 0xFF, 0xFF, 0xF7, 0xFF, 0xCF, 0xFF, 0x3C, 0x77, 0x44, 0xF6, 0x5D, 0x56, 0xDF, 0xFF,
+ 0x81, 0xF7, 0xFF, 0x1E, 0xE7, 0xFF, 0xD7, 0xFF, 0x6D, 0x1A, 0x9D, 0x57, 0xF7, 0xFF, 0xE7, 0xDE,
+ 0xDF, 0xFF, 0x3D, 0x3A, 0x24, 0xB9, 0x96, 0xFF, 0xCF, 0xFF, 0xE7, 0xFF, 0xE7, 0xDF, 0xEF, 0xFF,
+ 0xD7, 0xFF, 0xBF, 0xBF, 0x3C, 0x37, 0x44, 0x57, 0xC7, 0xFF, 0xDF, 0xFF, 0x86, 0x19, 0x34, 0x77,
+ 0x5D, 0x5B, 0xE7, 0xDF, 0xFF, 0xDF, 0xFF, 0xBF, 0xFF, 0xFF, 0xC7, 0xDF, 0x9E, 0xBE, 0xC7, 0x3E,
+ 0xEF, 0xFF, 0x81, 0xF7, 0xDF, 0x82, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x91, 0xFF, 0xFF, 0x02, 0xF7,
+ 0xBE, 0xD7, 0x1C, 0xC6, 0xBB, 0x81, 0xCF, 0x7E, 0x7F, 0x9E, 0x3A, 0x85, 0xDA, 0x54, 0xB8, 0x7D,
+ 0x9C, 0xE7, 0xDF, 0xE7, 0xFF, 0x97, 0xDF, 0x35, 0x37, 0x45, 0x59, 0x34, 0xD9, 0x1C, 0xFB, 0x6F,
+ 0x1F, 0xBF, 0xFF, 0x74, 0xF4, 0x33, 0x70, 0x65, 0xBA, 0x77, 0x1F, 0x2C, 0xD7, 0x6D, 0xDA, 0x7D,
+ 0x99, 0x9E, 0x3D, 0xDF, 0xFF, 0xC7, 0xFF, 0x4C, 0xF7, 0x55, 0x57, 0x75, 0xF9, 0xB6, 0xFD, 0xCF,
+ 0x1D, 0xD7, 0x1C, 0xC6, 0xDA, 0xE7, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xA7, 0x9F, 0x3C,
+ 0x95, 0xDF, 0xBF, 0xD7, 0x9F, 0x55, 0x5A, 0x56, 0x3D, 0x97, 0xBF, 0xAF, 0xBF, 0xC7, 0x3F, 0xBE,
+ 0xFF, 0xB7, 0xDF, 0x65, 0xBB, 0x7E, 0x17, 0xD7, 0xFF, 0xBF, 0x5F, 0xA6, 0xFF, 0x65, 0xF9, 0x4D,
+ 0x15, 0x75, 0x37, 0xE7, 0xDF, 0xF7, 0xFF, 0xEF, 0xBF, 0x95, 0xDA, 0x54, 0x94, 0x65, 0x76, 0x86,
+ 0xBB, 0xAF, 0xBF, 0xD7, 0xFF, 0xDF, 0xFF, 0xA6, 0x1A, 0x95, 0xB8, 0xCF, 0xFF, 0x77, 0x1E, 0x45,
+ 0xBA, 0xA7, 0x1F, 0xA6, 0xDF, 0x45, 0x18, 0x77, 0x1E, 0x9F, 0xFF, 0xAF, 0x9F, 0xD7, 0x9F, 0xE7,
+ 0xFF, 0x86, 0x1A, 0x44, 0xB4, 0x76, 0xDD, 0x76, 0xDE, 0x8F, 0x7F, 0x9F, 0xFF, 0x6E, 0xFF, 0x7F,
+ 0x1F, 0x9E, 0xFF, 0xAF, 0x1F, 0xAF, 0xDF, 0x8E, 0x9D, 0xB6, 0x9D, 0xF7, 0xFF, 0xEF, 0xFF, 0xAE,
+ 0x19, 0x5C, 0x93, 0xC7, 0xDF, 0xEF, 0xFF, 0xE7, 0xFF, 0xB7, 0x9F, 0x4C, 0x75, 0xBF, 0xDF, 0x85,
+ 0xD9, 0x7D, 0x99, 0xCF, 0xFF, 0x87, 0x9F, 0x3D, 0x17, 0xAF, 0x3E, 0xCF, 0xFF, 0x86, 0x3F, 0x65,
+ 0x1A, 0xE7, 0xFF, 0xCF, 0x7F, 0x8E, 0xBF, 0x34, 0xDA, 0x35, 0x39, 0x45, 0x77, 0x96, 0xFD, 0xCF,
+ 0xFF, 0xDF, 0xFF, 0xB7, 0x5F, 0x9F, 0x7F, 0x5D, 0x3C, 0xA5, 0xD9, 0xF7, 0xFF, 0xEF, 0xFF, 0xC7,
+ 0xFF, 0x2C, 0xB8, 0x2C, 0xB9, 0xC7, 0xBF, 0xF7, 0xFF, 0x15, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0xFF,
+ 0xEF, 0xFF, 0xDF, 0xDF, 0x6C, 0xFB, 0x3C, 0x57, 0x8F, 0x1F, 0xCF, 0xFF, 0x76, 0x19, 0x24, 0x97,
+ 0x55, 0x9C, 0xD7, 0xFF, 0xF7, 0xFF, 0xF7, 0x9F, 0xEF, 0xFF, 0x5D, 0xD8, 0x3D, 0x15, 0x96, 0x39,
+ 0xEF, 0xDF, 0xF7, 0xFF, 0xF7, 0xDF, 0x81, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x92, 0xFF, 0xFF, 0x23,
+ 0xEF, 0xBE, 0xDF, 0x5D, 0xC6, 0xDB, 0xCF, 0x5E, 0xC7, 0x5E, 0x96, 0x19, 0x85, 0xFA, 0x4C, 0xD8,
+ 0x75, 0xDC, 0xEF, 0xFF, 0xDF, 0xFF, 0x4D, 0x57, 0x2D, 0x16, 0xB7, 0xFF, 0x87, 0x7F, 0x2D, 0x9D,
+ 0x1C, 0x98, 0xAF, 0x7F, 0x85, 0xB8, 0x5D, 0x17, 0x86, 0xFF, 0x77, 0x5F, 0x24, 0xB7, 0x8E, 0xFE,
+ 0x7D, 0x99, 0x64, 0xD7, 0xD7, 0xFF, 0xB7, 0xDF, 0x6D, 0xBA, 0x5D, 0x78, 0x7D, 0xF9, 0xAE, 0xBC,
+ 0xDF, 0x7E, 0xDF, 0x3C, 0xB5, 0xF6, 0xF7, 0xFF, 0x81, 0xFF, 0xFF, 0x02, 0xEF, 0xDF, 0x96, 0xDD,
+ 0x3C, 0x53, 0x81, 0xEF, 0xFF, 0x5A, 0x6D, 0x9A, 0x3C, 0xF7, 0x44, 0xD5, 0x4C, 0x73, 0x6C, 0x53,
+ 0x6C, 0x75, 0x9E, 0xBF, 0x75, 0xDB, 0x7D, 0xF7, 0xC7, 0xFF, 0x85, 0xB8, 0x54, 0x54, 0x55, 0x76,
+ 0x8E, 0xFC, 0xE7, 0xFF, 0xEF, 0x9F, 0xFF, 0x7F, 0xFF, 0x9F, 0xEF, 0xFF, 0xB7, 0x5E, 0x6D, 0xB7,
+ 0x4C, 0xD3, 0x75, 0x97, 0xCF, 0xFF, 0xE7, 0xFF, 0xA5, 0xB8, 0x95, 0x56, 0xDF, 0xFF, 0x45, 0x16,
+ 0x24, 0x74, 0x54, 0xD8, 0x54, 0x76, 0x34, 0x75, 0x45, 0x36, 0x45, 0x15, 0x4C, 0x74, 0x8D, 0x78,
+ 0xDF, 0xFF, 0x64, 0xD4, 0x65, 0x77, 0x34, 0x94, 0x45, 0x37, 0x34, 0x75, 0x34, 0x96, 0x34, 0xB6,
+ 0x3C, 0x54, 0x5C, 0x74, 0x64, 0xB5, 0x4C, 0x54, 0x54, 0x75, 0x9D, 0x99, 0xF7, 0xFF, 0xEF, 0xDF,
+ 0xC6, 0xFC, 0x75, 0x56, 0xC7, 0xFF, 0xEF, 0xFF, 0xE7, 0xFF, 0xC7, 0xBF, 0x4C, 0x54, 0xBF, 0xBF,
+ 0x6D, 0x37, 0x8D, 0xFA, 0xB7, 0x7F, 0x55, 0x99, 0x2C, 0x54, 0xB7, 0x5F, 0xDF, 0xFF, 0x9E, 0xBF,
+ 0x4C, 0x16, 0xDF, 0xFF, 0xB6, 0xBC, 0x54, 0x97, 0x6E, 0x1E, 0x97, 0xBF, 0x5D, 0xD9, 0x4C, 0xB4,
+ 0xB7, 0x5E, 0xCF, 0xDF, 0x64, 0xF7, 0x54, 0xD9, 0x4C, 0x57, 0xAE, 0x3A, 0xF7, 0xFF, 0xEF, 0xFF,
+ 0xAE, 0xFD, 0x3C, 0x97, 0x54, 0xF8, 0xEF, 0xFF, 0xEF, 0x7D, 0xFF, 0xBE, 0x81, 0xFF, 0xDF, 0x15,
+ 0xF7, 0xFF, 0xEF, 0xDF, 0xA6, 0x3E, 0x4C, 0x56, 0x65, 0x58, 0xD7, 0xFF, 0x8E, 0x7A, 0x34, 0x75,
+ 0x65, 0x7A, 0xD7, 0xFF, 0xEF, 0xFF, 0xEF, 0xBF, 0xE7, 0xFF, 0x4D, 0x55, 0x3C, 0xF4, 0x7D, 0x55,
+ 0xE7, 0xBF, 0xF7, 0xFF, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBF, 0x91, 0xFF, 0xFF, 0x00,
+ 0xF7, 0xDE, 0x81, 0xF7, 0xFF, 0x34, 0xDF, 0xBE, 0xEF, 0xFF, 0xE7, 0xFF, 0xD7, 0xDF, 0xCF, 0xFF,
+ 0x5E, 0x3B, 0x5D, 0xBA, 0xE7, 0xFF, 0xDF, 0x7F, 0x4C, 0xB6, 0x5E, 0x5B, 0xB7, 0xFF, 0xBF, 0xFF,
+ 0x6E, 0xDF, 0x34, 0x97, 0x96, 0x5C, 0x9E, 0x5D, 0x3C, 0x15, 0xBF, 0xFF, 0x7F, 0x5F, 0x2C, 0xB6,
+ 0xC7, 0xFF, 0x9E, 0x7B, 0x64, 0xB5, 0xCF, 0xFF, 0xBF, 0xFF, 0x5C, 0xD7, 0x9E, 0x9E, 0xDF, 0xFF,
+ 0xE7, 0xDF, 0xFF, 0xFF, 0xFF, 0xDE, 0xE7, 0x1B, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xDE, 0xF7, 0xFF,
+ 0xCF, 0x7E, 0xC7, 0x3C, 0xE7, 0xDF, 0xE7, 0xBF, 0xE7, 0xFF, 0xAE, 0x7B, 0xB6, 0xBB, 0xCF, 0x3D,
+ 0xC6, 0x9C, 0xCF, 0x1D, 0xCF, 0x3E, 0xD7, 0xDF, 0xB6, 0xDB, 0xE7, 0xFF, 0xBE, 0xFB, 0xCF, 0x7E,
+ 0x81, 0xE7, 0xFF, 0x11, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBF, 0xF7, 0xDF, 0xEF, 0xFF,
+ 0xDF, 0xFF, 0xCF, 0x9E, 0xBE, 0xDB, 0xE7, 0xFF, 0xF7, 0xFF, 0xDF, 0x3D, 0xE7, 0x5D, 0xE7, 0xBF,
+ 0xB7, 0x1D, 0xA6, 0xDC, 0xBF, 0x1E, 0xB6, 0xBD, 0x81, 0xAE, 0xDC, 0x30, 0xB7, 0x1C, 0xBE, 0xFB,
+ 0xD7, 0x1D, 0xE7, 0x9E, 0xD7, 0x3C, 0xDF, 0xDF, 0xBF, 0x5D, 0xAF, 0x1D, 0xAF, 0x1E, 0xA6, 0xFE,
+ 0xAE, 0xFD, 0xAE, 0xDD, 0xBF, 0x1E, 0xBE, 0xBC, 0xB6, 0x9C, 0xBE, 0xDD, 0xD7, 0x3E, 0xF7, 0xFF,
+ 0xEF, 0xBF, 0xBE, 0x9A, 0xCF, 0x3C, 0xEF, 0xFF, 0xF7, 0xFF, 0xEF, 0xFF, 0xDF, 0xDF, 0xB6, 0x9B,
+ 0xDF, 0xBF, 0xBE, 0xDC, 0xC7, 0x1D, 0xDF, 0xBF, 0xBF, 0x1E, 0xBE, 0xDC, 0xE7, 0xBF, 0xF7, 0xFF,
+ 0xDF, 0x7F, 0xBE, 0x9B, 0xEF, 0xDF, 0xE7, 0xBF, 0xCF, 0x5E, 0xDF, 0xFF, 0xD7, 0xFF, 0xE7, 0xFF,
+ 0xCF, 0x7E, 0xD7, 0x7F, 0xE7, 0xFF, 0xBE, 0xBC, 0xAE, 0x7C, 0xBE, 0xFE, 0xE7, 0xDF, 0x81, 0xF7,
+ 0xFF, 0x04, 0xC6, 0xDB, 0xAE, 0x7B, 0xD7, 0xBF, 0xF7, 0xFF, 0xF7, 0xBE, 0x81, 0xFF, 0xDF, 0x81,
+ 0xF7, 0xFF, 0x11, 0xF7, 0xDF, 0xDF, 0x5E, 0xBE, 0xBC, 0xCF, 0x3D, 0xE7, 0xDF, 0xD7, 0x7D, 0xB6,
+ 0xDB, 0xC7, 0x1D, 0xEF, 0xFF, 0xE7, 0xDF, 0xF7, 0xFF, 0xE7, 0xFF, 0xC7, 0x9E, 0xAE, 0xFB, 0xCF,
+ 0x7D, 0xE7, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xDF, 0x93, 0xFF, 0xFF, 0x01, 0xEF, 0xFF,
+ 0xDF, 0x9E, 0x81, 0xE7, 0xFF, 0x1E, 0xCF, 0x9F, 0xC7, 0xFF, 0x56, 0x3A, 0x5E, 0x1A, 0xEF, 0xFF,
+ 0xE7, 0x5F, 0x5C, 0x97, 0x5D, 0x78, 0x9F, 0x5D, 0xAF, 0xDF, 0x5D, 0xDA, 0x54, 0xF7, 0xA6, 0x7C,
+ 0xB6, 0xBE, 0x54, 0x97, 0xA7, 0x7F, 0x86, 0xFF, 0x3C, 0x74, 0xCF, 0xFF, 0x9E, 0x19, 0x64, 0xB4,
+ 0xC7, 0xFF, 0xCF, 0xFF, 0x65, 0x38, 0x9E, 0x9E, 0xC7, 0x5F, 0xEF, 0xFF, 0xEF, 0x9E, 0xFF, 0xDE,
+ 0xF7, 0x7C, 0xFF, 0xBD, 0x81, 0xFF, 0xFF, 0x02, 0xEF, 0xDF, 0xDF, 0x7D, 0xEF, 0xFF, 0x82, 0xF7,
+ 0xFF, 0x81, 0xFF, 0xFF, 0x04, 0xF7, 0xFF, 0xFF, 0xFF, 0xE7, 0x7E, 0xF7, 0xFF, 0xEF, 0xFF, 0x81,
+ 0xF7, 0xFF, 0x02, 0xE7, 0xFF, 0xEF, 0xFF, 0xF7, 0xFF, 0x82, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x82,
+ 0xFF, 0xFF, 0x00, 0xF7, 0xFF, 0x81, 0xEF, 0xFF, 0x02, 0xE7, 0xBE, 0xF7, 0xFF, 0xF7, 0xDF, 0x81,
+ 0xFF, 0xFF, 0x03, 0xF7, 0xFF, 0xE7, 0xDF, 0xE7, 0xFF, 0xDF, 0xBF, 0x81, 0xEF, 0xFF, 0x81, 0xF7,
+ 0xFF, 0x81, 0xFF, 0xFF, 0x01, 0xF7, 0xDE, 0xFF, 0xFF, 0x81, 0xEF, 0xFF, 0x05, 0xDF, 0xFF, 0xE7,
+ 0xFF, 0xD7, 0xFF, 0xE7, 0xFF, 0xD7, 0xBF, 0xDF, 0xBF, 0x83, 0xEF, 0xFF, 0x01, 0xF7, 0xFF, 0xE7,
+ 0x9E, 0x81, 0xF7, 0xFF, 0x05, 0xE7, 0xBE, 0xEF, 0xFF, 0xF7, 0xFF, 0xE7, 0xDF, 0xF7, 0xFF, 0xDF,
+ 0x7E, 0x82, 0xF7, 0xFF, 0x00, 0xF7, 0xDF, 0x82, 0xFF, 0xFF, 0x07, 0xEF, 0x9E, 0xFF, 0xFF, 0xF7,
+ 0xFF, 0xF7, 0xDF, 0xF7, 0xFF, 0xEF, 0xDF, 0xF7, 0xFF, 0xE7, 0xBF, 0x81, 0xEF, 0xFF, 0x02, 0xE7,
+ 0xDF, 0xEF, 0xFF, 0xEF, 0xDF, 0x82, 0xF7, 0xFF, 0x04, 0xFF, 0xFF, 0xEF, 0xBE, 0xF7, 0xFF, 0xF7,
+ 0xDF, 0xEF, 0xBF, 0x82, 0xF7, 0xFF, 0x82, 0xFF, 0xFF, 0x04, 0xF7, 0xBE, 0xF7, 0xDF, 0xFF, 0xFF,
+ 0xF7, 0xDE, 0xE7, 0x7D, 0x81, 0xF7, 0xFF, 0x81, 0xEF, 0xFF, 0x03, 0xD7, 0x7D, 0xEF, 0xFF, 0xE7,
+ 0xFF, 0xEF, 0xFF, 0x81, 0xF7, 0xFF, 0x00, 0xF7, 0xDF, 0x81, 0xFF, 0xFF, 0x81, 0xFF, 0xDF, 0x91,
+ 0xFF, 0xFF, 0x24, 0xEF, 0xBE, 0xCE, 0xDB, 0xB6, 0x38, 0xBE, 0x9A, 0xAE, 0x7A, 0x7D, 0x15, 0x5C,
+ 0xD4, 0x34, 0xF5, 0x55, 0x98, 0xEF, 0xFF, 0xFF, 0xDF, 0x9D, 0xBB, 0x6C, 0xF6, 0x5C, 0xF3, 0x4C,
+ 0x91, 0x4C, 0x73, 0x85, 0xD9, 0xC7, 0x5E, 0xCF, 0x9F, 0x74, 0xB6, 0x7D, 0x38, 0x96, 0x9C, 0x7D,
+ 0x57, 0xEF, 0xFF, 0xBE, 0x7A, 0x8D, 0x57, 0xC7, 0xBF, 0xCF, 0xFF, 0x44, 0x54, 0x5C, 0xF7, 0x5C,
+ 0xD5, 0x9E, 0x39, 0xB6, 0x9A, 0xC6, 0x99, 0xC6, 0x37, 0xF7, 0x9D, 0xFF, 0xBF, 0x81, 0xFF, 0xFF,
+ 0x03, 0xF7, 0xFF, 0xEF, 0xFF, 0xD7, 0x5D, 0xF7, 0xFF, 0x81, 0xEF, 0xDF, 0x03, 0xF7, 0xDF, 0xEF,
+ 0x7E, 0xFF, 0xFF, 0xEF, 0xBF, 0x81, 0xF7, 0xFF, 0x04, 0xEF, 0xFF, 0xDF, 0x9E, 0xD7, 0xBE, 0xEF,
+ 0xFF, 0xF7, 0xFF, 0x81, 0xFF, 0xFF, 0x81, 0xFF, 0xDF, 0x0B, 0xFF, 0xFF, 0xF7, 0xFF, 0xEF, 0xBE,
+ 0xDF, 0x7E, 0xDF, 0x9E, 0xF7, 0xFF, 0xE7, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xBE, 0xF7, 0xBF,
+ 0xE7, 0xBF, 0x81, 0xEF, 0xFF, 0x11, 0xDF, 0xBF, 0xE7, 0xFF, 0xD7, 0xBE, 0xE7, 0xDF, 0xEF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xF7, 0xFF, 0xE7, 0xDF, 0xEF, 0xFF, 0xBF, 0x5E, 0xCF, 0xFF,
+ 0xD7, 0xFF, 0xA6, 0x9B, 0xDF, 0xFF, 0xCF, 0xBF, 0xD7, 0x7E, 0x81, 0xEF, 0xFF, 0x00, 0xF7, 0xFF,
+ 0x82, 0xFF, 0xFF, 0x82, 0xF7, 0xFF, 0x03, 0xEF, 0xBF, 0xCE, 0xBB, 0xE7, 0xDF, 0xEF, 0xFF, 0x82,
+ 0xF7, 0xFF, 0x81, 0xFF, 0xFF, 0x00, 0xF7, 0xBE, 0x82, 0xFF, 0xFF, 0x81, 0xF7, 0xFF, 0x06, 0xEF,
+ 0xFF, 0xE7, 0xBF, 0xE7, 0xFF, 0xB6, 0xBB, 0xCF, 0x9E, 0xC7, 0x1D, 0xE7, 0xFF, 0x81, 0xF7, 0xFF,
+ 0x03, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0x7E, 0xFF, 0xFF, 0x82, 0xF7, 0xFF, 0x07, 0xE7, 0xFF, 0xBE,
+ 0xDB, 0xD7, 0x7D, 0xF7, 0xFF, 0xF7, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xDE, 0x82, 0xFF, 0xFF,
+ 0x81, 0xF7, 0xFF, 0x08, 0xC7, 0x1C, 0xCF, 0x5E, 0xC7, 0x7E, 0xAE, 0xBC, 0xC7, 0xDF, 0xBF, 0x5E,
+ 0xBE, 0xFC, 0xDF, 0x9E, 0xF7, 0xFF, 0x82, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x92, 0xFF, 0xFF, 0x02,
+ 0xF7, 0xDF, 0xE7, 0x9E, 0xD7, 0x3C, 0x81, 0xE7, 0xFF, 0x0D, 0xC7, 0x3D, 0xAF, 0x5E, 0x55, 0xD8,
+ 0x66, 0x1A, 0xEF, 0xFF, 0xFF, 0xDF, 0xEF, 0x9F, 0xCF, 0x3F, 0xAE, 0xFB, 0x9E, 0xD9, 0xBF, 0x5E,
+ 0xD7, 0xFF, 0xE7, 0xFF, 0xEF, 0xFF, 0x81, 0xD7, 0x3F, 0x0D, 0xEF, 0xFF, 0xCF, 0x3D, 0xEF, 0xDF,
+ 0xDF, 0x3D, 0xCF, 0x1D, 0xDF, 0xFF, 0xD7, 0xFF, 0x54, 0xD6, 0x8E, 0x9C, 0xA7, 0x3E, 0xC7, 0xBF,
+ 0xE7, 0xFF, 0xE7, 0xBE, 0xCE, 0xDA, 0x81, 0xFF, 0xFF, 0x05, 0xF7, 0x7F, 0xFF, 0xFF, 0xC6, 0xBB,
+ 0xA6, 0x18, 0xA5, 0xF8, 0xC6, 0xBA, 0x82, 0xF7, 0xFF, 0x00, 0xFF, 0xFF, 0x81, 0xF7, 0xDF, 0x81,
+ 0xF7, 0xFF, 0x04, 0xAE, 0x19, 0xBE, 0xDC, 0xAE, 0x5A, 0xCF, 0x5D, 0xF7, 0xFF, 0x84, 0xFF, 0xFF,
+ 0x06, 0xEF, 0xBE, 0xD7, 0x1C, 0xAE, 0x18, 0xAE, 0x38, 0xCF, 0x1C, 0xE7, 0xBE, 0xF7, 0xFF, 0x81,
+ 0xFF, 0xFF, 0x0A, 0xFF, 0xDF, 0xEF, 0xBF, 0xF7, 0xFF, 0xD7, 0x7E, 0x8D, 0x56, 0x9E, 0x38, 0xA6,
+ 0x59, 0xDF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x81, 0xFF, 0xFF, 0x0B, 0xEF, 0xBF, 0xDF,
+ 0xFF, 0x95, 0xF8, 0x9E, 0xBB, 0x9E, 0xDD, 0x5C, 0xB4, 0xA6, 0xDC, 0xAE, 0xBC, 0x95, 0x97, 0xDF,
+ 0xBF, 0xEF, 0xFF, 0xF7, 0xFF, 0x81, 0xFF, 0xFF, 0x01, 0xF7, 0xBE, 0xF7, 0xBF, 0x81, 0xFF, 0xFF,
+ 0x06, 0xDF, 0x3D, 0xAD, 0xD8, 0xB6, 0x5A, 0xEF, 0xFF, 0xE7, 0x9F, 0xF7, 0xFF, 0xEF, 0xBF, 0x81,
+ 0xFF, 0xFF, 0x02, 0xFF, 0xDE, 0xF7, 0xDE, 0xFF, 0xFF, 0x81, 0xF7, 0xFF, 0x0E, 0xE7, 0xBE, 0xDF,
+ 0x9E, 0xDF, 0xDF, 0xD7, 0xBF, 0x75, 0x14, 0xA6, 0xBB, 0x95, 0xF8, 0xCF, 0x5D, 0xEF, 0xFF, 0xF7,
+ 0xFF, 0xFF, 0xDF, 0xFF, 0xBF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0x81, 0xEF, 0xFF, 0x03, 0xDF,
+ 0xFF, 0x85, 0xD7, 0xCF, 0xDF, 0xF7, 0xFF, 0x82, 0xFF, 0xFF, 0x0F, 0xF7, 0xFF, 0xF7, 0xDE, 0xF7,
+ 0xDF, 0xF7, 0xFF, 0xE7, 0xBE, 0xDF, 0xBF, 0x9D, 0xD8, 0x9E, 0x3A, 0x7D, 0x98, 0x7D, 0xD9, 0x7D,
+ 0xFA, 0x75, 0x98, 0x95, 0xF8, 0xC7, 0x1B, 0xEF, 0xDF, 0xF7, 0xFF, 0x81, 0xFF, 0xFF, 0x00, 0xFF,
+ 0xDF, 0x91, 0xFF, 0xFF, 0x0D, 0xEF, 0x9D, 0xFF, 0xFF, 0xF7, 0xFF, 0xE7, 0xBE, 0xEF, 0xFF, 0xE7,
+ 0xFF, 0xD7, 0x9F, 0xD7, 0xFF, 0x5E, 0x19, 0x66, 0x1A, 0xDF, 0x9F, 0xF7, 0x7F, 0xFF, 0xDF, 0xEF,
+ 0xFF, 0x82, 0xE7, 0xFF, 0x03, 0xDF, 0xFF, 0xE7, 0xFF, 0xE7, 0xFE, 0xF7, 0xDF, 0x81, 0xFF, 0xFF,
+ 0x07, 0xEF, 0xBF, 0xEF, 0xDE, 0xF7, 0xFF, 0xEF, 0xFF, 0xDF, 0xFF, 0xC7, 0xFF, 0x44, 0x33, 0x9E,
+ 0xDD, 0x81, 0xD7, 0xFF, 0x03, 0xDF, 0xFF, 0xEF, 0xFF, 0xE7, 0x9E, 0xF7, 0xFF, 0x81, 0xFF, 0xFF,
+ 0x06, 0xEF, 0xFF, 0xD7, 0x7F, 0xD7, 0x9F, 0xDF, 0xDF, 0x84, 0xD3, 0xEF, 0xDF, 0xFF, 0xFF, 0x81,
+ 0xF7, 0xDF, 0x08, 0xF7, 0xBE, 0xFF, 0xFF, 0xF7, 0xFF, 0xEF, 0xFF, 0x8D, 0x35, 0xCF, 0x5E, 0xA6,
+ 0x5A, 0xB6, 0x9B, 0xF7, 0xFF, 0x84, 0xFF, 0xFF, 0x06, 0xE7, 0xBF, 0xCF, 0x1C, 0xD7, 0x9E, 0xB6,
+ 0x9A, 0x9D, 0xB7, 0xE7, 0xDF, 0xF7, 0xFF, 0x82, 0xFF, 0xFF, 0x09, 0xF7, 0x9F, 0xF7, 0xFF, 0xDF,
+ 0x9F, 0x9E, 0x18, 0xCF, 0xDF, 0xD7, 0xFF, 0xE7, 0xFF, 0xE7, 0xBE, 0xEF, 0x9E, 0xEF, 0x3C, 0x81,
+ 0xFF, 0xDF, 0x09, 0xF7, 0xFF, 0xEF, 0xFF, 0x96, 0x19, 0xA7, 0x3D, 0x86, 0x5B, 0x9E, 0xFD, 0x75,
+ 0x97, 0xAE, 0xFD, 0xBF, 0x1D, 0xE7, 0xFF, 0x81, 0xF7, 0xFF, 0x84, 0xFF, 0xFF, 0x05, 0xF7, 0xDF,
+ 0xEF, 0xBF, 0xE7, 0x7F, 0x8D, 0x15, 0xCF, 0x3D, 0xEF, 0xFF, 0x81, 0xF7, 0xFF, 0x85, 0xFF, 0xFF,
+ 0x09, 0xEF, 0xFF, 0xB6, 0x7A, 0x9D, 0xF8, 0xAE, 0x7A, 0x95, 0xF8, 0x5C, 0xF3, 0xA7, 0x3C, 0xA6,
+ 0x9A, 0xCF, 0x9E, 0xEF, 0xFF, 0x81, 0xFF, 0xFF, 0x81, 0xFF, 0xDF, 0x09, 0xFF, 0x9E, 0xFF, 0xFF,
+ 0xCF, 0x1C, 0xBF, 0x3C, 0xB7, 0x5D, 0x5C, 0xF3, 0xBF, 0xDF, 0xC6, 0xFB, 0xDF, 0x1C, 0xE7, 0x9D,
+ 0x82, 0xFF, 0xFF, 0x81, 0xF7, 0xFF, 0x0B, 0xE7, 0xDF, 0xEF, 0xFF, 0xBF, 0x5E, 0xA6, 0xFE, 0x6D,
+ 0x58, 0x8E, 0xBE, 0x76, 0x3D, 0x86, 0x7D, 0xBF, 0x3D, 0xDF, 0xBE, 0xE7, 0xDF, 0xEF, 0xDF, 0x95,
+ 0xFF, 0xFF, 0x02, 0xF7, 0xFF, 0xEF, 0xBE, 0xDF, 0x7D, 0x81, 0xEF, 0xFF, 0x04, 0xD7, 0x5E, 0xC7,
+ 0x9F, 0x55, 0x76, 0x6E, 0x1A, 0xEF, 0xFF, 0x81, 0xFF, 0xDF, 0x00, 0xF7, 0xDF, 0x81, 0xE7, 0xFF,
+ 0x01, 0xDF, 0xFF, 0xE7, 0xFF, 0x81, 0xEF, 0xFF, 0x82, 0xFF, 0xDF, 0x0D, 0xFF, 0xFF, 0xF7, 0xDF,
+ 0xF7, 0xFF, 0xEF, 0xFF, 0xDF, 0xFF, 0xD7, 0xFF, 0x65, 0x16, 0x8E, 0x7B, 0xB7, 0x7F, 0xCF, 0xFF,
+ 0xDF, 0xFF, 0xE7, 0xFF, 0xD7, 0x3C, 0xF7, 0xFF, 0x81, 0xFF, 0xFF, 0x00, 0xEF, 0xDF, 0x82, 0xE7,
+ 0xFF, 0x01, 0x74, 0x72, 0xEF, 0xDF, 0x84, 0xFF, 0xFF, 0x05, 0xF7, 0xFF, 0xD7, 0x5D, 0x9D, 0x97,
+ 0xE7, 0xFF, 0xBF, 0x3E, 0x9D, 0xF9, 0x82, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x81, 0xFF, 0xFF, 0x04,
+ 0xEF, 0xFF, 0xE7, 0xDF, 0xEF, 0xFF, 0xC7, 0x3C, 0x9D, 0xD7, 0x81, 0xF7, 0xFF, 0x0B, 0xF7, 0xBF,
+ 0xFF, 0xDF, 0xFF, 0xBF, 0xFF, 0xDF, 0xF7, 0xFF, 0xC6, 0xDC, 0x7D, 0x14, 0x9E, 0x7A, 0x9E, 0x59,
+ 0xE7, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xDF, 0x0C, 0xFF, 0xBF, 0xEF, 0x9F, 0xD7, 0x7E,
+ 0x6D, 0x14, 0x86, 0x39, 0x65, 0x98, 0x86, 0x9C, 0x6D, 0x77, 0x85, 0xF9, 0x95, 0xF8, 0xCF, 0x5D,
+ 0xE7, 0xDF, 0xE7, 0x9D, 0x83, 0xFF, 0xFF, 0x81, 0xF7, 0xDF, 0x05, 0xF7, 0xFF, 0xE7, 0xBF, 0x85,
+ 0x15, 0x8D, 0x36, 0xEF, 0xFF, 0xDF, 0x7E, 0x81, 0xFF, 0xFF, 0x00, 0xF7, 0x9D, 0x81, 0xFF, 0xFF,
+ 0x0B, 0xF7, 0x9D, 0xFF, 0xFF, 0xF7, 0xFF, 0xCF, 0x1D, 0xB6, 0xBB, 0xBF, 0x3E, 0xBF, 0x7F, 0x75,
+ 0xD8, 0xB7, 0xFF, 0xC7, 0xFF, 0xE7, 0xFF, 0xF7, 0xFF, 0x81, 0xFF, 0xFF, 0x0C, 0xFF, 0xBE, 0xFF,
+ 0x9E, 0xFF, 0x7D, 0xFF, 0xFF, 0xBE, 0xBA, 0xB6, 0xFB, 0xA6, 0xFC, 0x54, 0xF4, 0x7E, 0x18, 0xAE,
+ 0x79, 0xCE, 0xDB, 0xDF, 0x3C, 0xEF, 0x9E, 0x82, 0xFF, 0xFF, 0x00, 0xF7, 0xFF, 0x81, 0xE7, 0xFF,
+ 0x09, 0xB6, 0xFD, 0x86, 0x1A, 0x54, 0xF7, 0x7E, 0x9E, 0x65, 0xFC, 0x65, 0xDA, 0xAE, 0xDC, 0xD7,
+ 0xBE, 0xEF, 0xFF, 0xF7, 0xFF, 0x95, 0xFF, 0xFF, 0x0C, 0xEF, 0x9D, 0xCE, 0xBA, 0xB6, 0x18, 0xC6,
+ 0xBB, 0xBE, 0x9A, 0x8C, 0xF4, 0x6C, 0x92, 0x4C, 0xF4, 0x6D, 0x77, 0xEF, 0xDF, 0xF7, 0x5F, 0xF7,
+ 0xFF, 0xEF, 0xDF, 0x81, 0xF7, 0xFF, 0x81, 0xE7, 0xFF, 0x01, 0xE7, 0xFE, 0xF7, 0xDD, 0x81, 0xFF,
+ 0xFF, 0x01, 0xFF, 0xDE, 0xF7, 0xBE, 0x81, 0xFF, 0xFF, 0x14, 0xE7, 0xDF, 0xD7, 0xFF, 0xCF, 0xFF,
+ 0x4C, 0x94, 0x4C, 0xB3, 0x5D, 0x15, 0x86, 0x18, 0xB7, 0x3C, 0xB6, 0xBA, 0xAD, 0xF7, 0xF7, 0xBF,
+ 0xFF, 0xDF, 0xFF, 0x7F, 0xFF, 0xFF, 0xEF, 0xFF, 0xD7, 0xDF, 0xB6, 0x9B, 0xAE, 0x19, 0xEF, 0xFF,
+ 0xF7, 0xDF, 0xF7, 0xBE, 0x82, 0xFF, 0xFF, 0x05, 0xF7, 0xFF, 0xCF, 0x1C, 0x9D, 0xD8, 0xE7, 0xFF,
+ 0xC7, 0x7F, 0x95, 0xD8, 0x84, 0xFF, 0xFF, 0x81, 0xF7, 0xFF, 0x06, 0xEF, 0xFF, 0xBF, 0x1C, 0xA6,
+ 0x18, 0xBE, 0xDB, 0xEF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xDF, 0x06, 0xEF, 0xFF, 0xBF,
+ 0x1C, 0xBF, 0x7D, 0x85, 0x96, 0xCF, 0xBE, 0xEF, 0xFF, 0xFF, 0xDF, 0x81, 0xFF, 0xBF, 0x0B, 0xFF,
+ 0x9F, 0xFF, 0xFF, 0xE7, 0xFF, 0x96, 0x18, 0xAF, 0x5E, 0x76, 0x1A, 0x86, 0x5B, 0xAF, 0x7F, 0x85,
+ 0xD8, 0x95, 0xD8, 0xDF, 0xDF, 0xEF, 0xFF, 0x81, 0xFF, 0xFF, 0x00, 0xFF, 0xDE, 0x81, 0xFF, 0xFF,
+ 0x07, 0xF7, 0xDF, 0xF7, 0xFF, 0xE7, 0x7F, 0xA5, 0xF9, 0xBE, 0xDC, 0x9D, 0xB8, 0xD7, 0x7F, 0xE7,
+ 0xBF, 0x81, 0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0x83, 0xFF, 0xFF, 0x09, 0xE7, 0xBF, 0xC7, 0x1D, 0x9E,
+ 0x19, 0x7D, 0x57, 0xA6, 0xBC, 0x96, 0xBB, 0xB7, 0x9E, 0xD7, 0xFF, 0xE7, 0xFF, 0xF7, 0xFF, 0x81,
+ 0xFF, 0xFF, 0x00, 0xFF, 0x9E, 0x81, 0xFF, 0xDE, 0x06, 0xFF, 0xFF, 0xDF, 0x9E, 0xDF, 0xFF, 0xA7,
+ 0x1D, 0x86, 0x7A, 0x6D, 0x76, 0xD7, 0xBF, 0x81, 0xF7, 0xFF, 0x00, 0xEF, 0xDF, 0x81, 0xFF, 0xFF,
+ 0x0F, 0xF7, 0xDE, 0xFF, 0xFF, 0xF7, 0xFF, 0xDF, 0xDF, 0xA6, 0x9B, 0x75, 0x57, 0x75, 0xDA, 0x7E,
+ 0x5D, 0x76, 0x7E, 0x55, 0x38, 0x85, 0x97, 0xC7, 0x1C, 0xEF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xDF, 0x92, 0xFF, 0xFF, 0x03, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xDF, 0xE7, 0x7E, 0x81, 0xF7, 0xFF,
+ 0x0F, 0xD7, 0x5D, 0xCF, 0x9F, 0x65, 0x77, 0x75, 0xD9, 0xEF, 0xFF, 0xE7, 0xBF, 0xE7, 0xFF, 0xDF,
+ 0xFF, 0xEF, 0xFF, 0xE7, 0xFF, 0xD7, 0xFF, 0xDF, 0xFF, 0xE7, 0xFF, 0xF7, 0xFF, 0xEF, 0xBF, 0xEF,
+ 0xFF, 0x81, 0xE7, 0xFF, 0x14, 0xE7, 0xDF, 0xEF, 0xFF, 0xE7, 0xFF, 0xDF, 0xFF, 0xCF, 0xFF, 0x5C,
+ 0xF5, 0x86, 0x5A, 0xC7, 0xFF, 0xCF, 0xFF, 0xDF, 0xFF, 0xEF, 0xFF, 0xDF, 0x5D, 0xF7, 0xDF, 0xFF,
+ 0xFF, 0xFF, 0xDF, 0xF7, 0x9F, 0xE7, 0xFF, 0xC7, 0x5F, 0x85, 0x36, 0xE7, 0xDF, 0xF7, 0xFF, 0x81,
+ 0xFF, 0xFF, 0x81, 0xFF, 0xDE, 0x07, 0xFF, 0xFF, 0xF7, 0xFF, 0xDF, 0x7E, 0x95, 0x77, 0xE7, 0xFF,
+ 0xBF, 0x3F, 0x9D, 0xFA, 0xF7, 0xFF, 0x83, 0xFF, 0xFF, 0x00, 0xF7, 0xFF, 0x81, 0xEF, 0xFF, 0x0F,
+ 0xAE, 0x9A, 0x9E, 0x17, 0xEF, 0xFF, 0xE7, 0xFF, 0xF7, 0xFF, 0xF7, 0xBF, 0xFF, 0xDF, 0xFF, 0x9F,
+ 0xFF, 0xDF, 0xEF, 0x5E, 0xEF, 0xFF, 0xE7, 0xFF, 0xD7, 0xFF, 0x7D, 0x75, 0xC7, 0x7D, 0xEF, 0xFF,
+ 0x81, 0xFF, 0xDF, 0x0C, 0xFF, 0xBF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0x9E, 0x85, 0xD7, 0x9E, 0xDC,
+ 0x6D, 0x78, 0xAF, 0x7F, 0xBF, 0x9F, 0x7D, 0x57, 0xDF, 0xDF, 0xEF, 0xFF, 0xEF, 0xBE, 0x81, 0xFF,
+ 0xFF, 0x00, 0xFF, 0xDE, 0x81, 0xFF, 0xFF, 0x18, 0xE7, 0x7E, 0xF7, 0xFF, 0xDF, 0x9F, 0x8D, 0x56,
+ 0xE7, 0xFF, 0xC7, 0x1D, 0x95, 0x56, 0xF7, 0xFF, 0xEF, 0xBF, 0xF7, 0xBE, 0xFF, 0xFF, 0xFF, 0xDE,
+ 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xFF, 0xE7, 0xBF, 0xEF, 0xFF, 0xC7, 0x5F, 0x8D, 0xD9, 0xDF, 0xFF,
+ 0xAE, 0xFD, 0xA6, 0xBB, 0xD7, 0xBF, 0xDF, 0xBF, 0xF7, 0xFF, 0x81, 0xFF, 0xFF, 0x00, 0xFF, 0xFE,
+ 0x81, 0xFF, 0xDE, 0x09, 0xEF, 0xBE, 0xEF, 0xFF, 0xDF, 0xFF, 0x85, 0xB8, 0xB7, 0x7F, 0x96, 0x5A,
+ 0xB6, 0xBC, 0xE7, 0xBF, 0xEF, 0xFF, 0xEF, 0xDF, 0x83, 0xFF, 0xFF, 0x0B, 0xF7, 0xFF, 0xDF, 0x9E,
+ 0xB6, 0xBB, 0x7D, 0x77, 0x9E, 0xDD, 0x75, 0xDA, 0x97, 0x3F, 0x6D, 0x99, 0xA6, 0x7A, 0xD7, 0x7D,
+ 0xEF, 0xFF, 0xEF, 0xDF, 0x99, 0xFF, 0xFF, 0x81, 0xF7, 0xFF, 0x12, 0xE7, 0xFF, 0x86, 0x7D, 0x4D,
+ 0x19, 0x75, 0x7C, 0x7D, 0xDD, 0x6E, 0x1C, 0x66, 0x1C, 0x7E, 0x3D, 0x7E, 0x1D, 0x6E, 0x3C, 0x6E,
+ 0x1C, 0x86, 0x1D, 0x7D, 0xBC, 0x8D, 0xFD, 0x75, 0xBB, 0x6E, 0x1C, 0x6E, 0x5C, 0x6D, 0xD8, 0x8E,
+ 0x5A, 0x81, 0x7D, 0xB8, 0x04, 0x6C, 0xF6, 0x6C, 0xD5, 0xCF, 0x5F, 0xEF, 0xFF, 0xF7, 0xFF, 0x84,
+ 0xFF, 0xFF, 0x81, 0xF7, 0xFF, 0x11, 0xB6, 0xBC, 0x8D, 0x77, 0x9D, 0xB8, 0xBE, 0x7B, 0xEF, 0xBF,
+ 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xF7, 0xBE, 0xFF, 0xFF, 0xEF, 0x9E, 0xF7, 0xFF, 0x9D, 0xB8,
+ 0xA6, 0x1A, 0x95, 0xD9, 0xCF, 0x5E, 0xFF, 0xFF, 0xFF, 0xBF, 0x81, 0xFF, 0xFF, 0x09, 0xF7, 0xBF,
+ 0xF7, 0xFF, 0xE7, 0xBE, 0xA6, 0x17, 0x85, 0x34, 0x9D, 0xF7, 0xC6, 0xFB, 0xE7, 0xBE, 0xF7, 0xFF,
+ 0xFF, 0xFF, 0x81, 0xFF, 0xDF, 0x09, 0xFF, 0x9F, 0xF7, 0xBF, 0xC6, 0xBB, 0xAE, 0x7A, 0x9E, 0x38,
+ 0x9E, 0x59, 0xD7, 0x9E, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x81, 0xFF, 0xBF, 0x08, 0xFF, 0xDF,
+ 0xEF, 0xFF, 0x95, 0xF7, 0x96, 0x5A, 0x7D, 0x98, 0xAE, 0xDE, 0x9E, 0x1B, 0xAE, 0x7C, 0x9D, 0x97,
+ 0x81, 0xF7, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x82, 0xFF, 0xFF, 0x03, 0xEF, 0xFF, 0xB6, 0x79,
+ 0xA6, 0x18, 0xC7, 0x3D, 0x81, 0xE7, 0xFF, 0x04, 0xB6, 0x5A, 0xA5, 0x96, 0xE7, 0x5D, 0xFF, 0xFF,
+ 0xFF, 0xBD, 0x81, 0xFF, 0xFE, 0x0A, 0xFF, 0xDE, 0xFF, 0xFF, 0xF7, 0xFF, 0xCF, 0x5E, 0x9E, 0x19,
+ 0x8D, 0x98, 0x95, 0xF9, 0xCF, 0x7F, 0x95, 0x77, 0xCF, 0x3D, 0xA5, 0xD7, 0x82, 0xFF, 0xFF, 0x01,
+ 0xFF, 0xFE, 0xF7, 0xBD, 0x81, 0xFF, 0xFF, 0x0D, 0xC6, 0x9A, 0xA5, 0xF8, 0xB6, 0xBC, 0xD7, 0xDF,
+ 0xDF, 0xFF, 0x95, 0x98, 0xAE, 0x3A, 0xD7, 0x5E, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xDE, 0xFF, 0xDE,
+ 0xFF, 0xFF, 0xF7, 0xFE, 0x81, 0xEF, 0xFF, 0x06, 0x9E, 0x18, 0xAE, 0xDC, 0x8E, 0x3A, 0x9E, 0xFD,
+ 0x7D, 0xB8, 0xC7, 0x3D, 0xE7, 0xDF, 0x81, 0xF7, 0xFF, 0x89, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x90,
+ 0xFF, 0xFF, 0x18, 0xEF, 0xFF, 0xC7, 0xFF, 0x86, 0x5E, 0x7D, 0xDD, 0x4C, 0xD8, 0x55, 0xB9, 0x66,
+ 0x5C, 0x6E, 0x1C, 0x3C, 0x76, 0x65, 0xBB, 0x75, 0xFC, 0x6D, 0x9C, 0x44, 0x16, 0x7D, 0xBD, 0x75,
+ 0xDC, 0x3D, 0x5A, 0x45, 0xB9, 0x6E, 0x3A, 0x76, 0x19, 0x4C, 0x94, 0x75, 0x78, 0x96, 0x1A, 0xAE,
+ 0x5B, 0xEF, 0xDF, 0xF7, 0xFF, 0x84, 0xFF, 0xFF, 0x0A, 0xFF, 0xFE, 0xF7, 0xFE, 0xF7, 0xFF, 0xCF,
+ 0x3D, 0xAE, 0x5A, 0xB6, 0x7B, 0xCE, 0xDC, 0xE7, 0x9E, 0xFF, 0xFF, 0xEF, 0x9D, 0xFF, 0xDE, 0x82,
+ 0xFF, 0xFF, 0x06, 0xF7, 0xFF, 0xCF, 0x1D, 0xC6, 0xFD, 0xBE, 0xFE, 0xDF, 0xDF, 0xFF, 0xFF, 0xFF,
+ 0xDE, 0x81, 0xFF, 0xFF, 0x08, 0xF7, 0xBF, 0xF7, 0xFF, 0xEF, 0xFF, 0xBE, 0xBA, 0xB6, 0x99, 0xBE,
+ 0xFB, 0xD7, 0x7D, 0xE7, 0xFF, 0xF7, 0xFF, 0x81, 0xFF, 0xFF, 0x81, 0xFF, 0xDF, 0x02, 0xFF, 0xFF,
+ 0xDF, 0x3D, 0xCF, 0x1C, 0x81, 0xBF, 0x1C, 0x01, 0xE7, 0xFF, 0xF7, 0xFF, 0x82, 0xFF, 0xDF, 0x1B,
+ 0xFF, 0x9F, 0xFF, 0xDF, 0xF7, 0xFF, 0xAE, 0x59, 0xB6, 0xFC, 0x9E, 0x3B, 0xBE, 0xFE, 0xB6, 0x7C,
+ 0xC6, 0xFD, 0xBE, 0x3A, 0xEF, 0xBF, 0xEF, 0x9E, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
+ 0xF7, 0xFF, 0xE7, 0xBE, 0xC6, 0xFB, 0xC6, 0xFC, 0xDF, 0xFF, 0xE7, 0xFF, 0xEF, 0xFF, 0xCF, 0x1D,
+ 0xC6, 0x9A, 0xEF, 0x9E, 0xFF, 0xFF, 0xFF, 0xBE, 0x83, 0xFF, 0xFF, 0x08, 0xE7, 0x9E, 0xBE, 0xBB,
+ 0xA6, 0x3A, 0xBF, 0x1E, 0xE7, 0xFF, 0xE7, 0x9F, 0xB5, 0xF9, 0xC6, 0x7B, 0xBE, 0x19, 0x81, 0xFF,
+ 0xFF, 0x0D, 0xF7, 0xFE, 0xF7, 0x9D, 0xFF, 0xFE, 0xFF, 0xFF, 0xEF, 0xBE, 0xCE, 0xDB, 0xCE, 0xBC,
+ 0xDF, 0x9F, 0xEF, 0xFF, 0xE7, 0xDF, 0xC7, 0x1E, 0xC6, 0xFD, 0xD7, 0x1D, 0xEF, 0xBF, 0x81, 0xFF,
+ 0xFF, 0x81, 0xFF, 0xFE, 0x0A, 0xFF, 0xDE, 0xF7, 0xDE, 0xCE, 0xBA, 0xB6, 0x58, 0xAE, 0x59, 0xCF,
+ 0x9E, 0xC7, 0x7E, 0xB6, 0xFC, 0xBE, 0xDB, 0xDF, 0x7D, 0xEF, 0xDF, 0x81, 0xF7, 0xDF, 0x88, 0xFF,
+ 0xFF, 0x00, 0xFF, 0xDF, 0x91, 0xFF, 0xFF, 0x0B, 0xF7, 0xFF, 0xEF, 0xFF, 0xD7, 0xFF, 0x75, 0x76,
+ 0x9E, 0xFB, 0xCF, 0xFF, 0xC7, 0xFF, 0x54, 0x94, 0xDF, 0xFF, 0xE7, 0xFF, 0xB7, 0x5F, 0x64, 0xB6,
+ 0x81, 0xE7, 0xFF, 0x09, 0x7E, 0xBC, 0x76, 0xBC, 0xCF, 0xFF, 0xC7, 0xFF, 0x7D, 0x98, 0xAE, 0xFE,
+ 0xD7, 0xFF, 0xE7, 0xFF, 0xEF, 0xFF, 0xF7, 0xFF, 0x83, 0xFF, 0xFF, 0x82, 0xFF, 0xFE, 0x07, 0xFF,
+ 0xFF, 0xF7, 0xFF, 0xE7, 0xBF, 0xEF, 0xFF, 0xEF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x81,
+ 0xFF, 0xFF, 0x01, 0xFF, 0xFE, 0xFF, 0xFF, 0x81, 0xF7, 0xFF, 0x04, 0xDF, 0x9F, 0xE7, 0xFF, 0xEF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0x81, 0xFF, 0xFF, 0x08, 0xF7, 0xBF, 0xF7, 0xDF, 0xF7, 0xFF, 0xE7,
+ 0x9E, 0xE7, 0xDF, 0xE7, 0xDE, 0xE7, 0xDF, 0xEF, 0xFF, 0xF7, 0xFF, 0x81, 0xFF, 0xFF, 0x00, 0xFF,
+ 0xBF, 0x81, 0xFF, 0xFF, 0x03, 0xEF, 0xBF, 0xE7, 0xDF, 0xE7, 0xFF, 0xE7, 0xDF, 0x81, 0xF7, 0xFF,
+ 0x81, 0xFF, 0xFF, 0x0C, 0xFF, 0xDF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF7, 0xFF, 0xCF, 0x3D, 0xDF, 0xDF,
+ 0xD7, 0x9F, 0xE7, 0xBF, 0xDF, 0x7F, 0xF7, 0xFF, 0xEF, 0x9F, 0xFF, 0xFF, 0xFF, 0xDF, 0x81, 0xFF,
+ 0xFF, 0x05, 0xFF, 0xDE, 0xFF, 0xFF, 0xF7, 0xFF, 0xE7, 0xDE, 0xD7, 0x9D, 0xDF, 0xFF, 0x81, 0xEF,
+ 0xFF, 0x04, 0xF7, 0xFF, 0xEF, 0xFF, 0xE7, 0x9E, 0xF7, 0xDF, 0xFF, 0xFF, 0x81, 0xFF, 0xDE, 0x04,
+ 0xFF, 0xBE, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xEF, 0xFF, 0x81, 0xDF, 0xDF, 0x04, 0xE7, 0xFF,
+ 0xFF, 0xDF, 0xEF, 0x5F, 0xEF, 0x3E, 0xF7, 0xBF, 0x84, 0xFF, 0xFF, 0x03, 0xF7, 0xFF, 0xEF, 0xBE,
+ 0xE7, 0x5D, 0xEF, 0x9F, 0x81, 0xFF, 0xFF, 0x04, 0xF7, 0xDF, 0xF7, 0xFF, 0xDF, 0xBF, 0xDF, 0x5E,
+ 0xE7, 0xBF, 0x82, 0xFF, 0xFF, 0x0D, 0xFF, 0xFE, 0xFF, 0xDD, 0xFF, 0xFE, 0xE7, 0x7C, 0xF7, 0xFF,
+ 0xD7, 0x1B, 0xF7, 0xFF, 0xE7, 0xFF, 0xEF, 0xFF, 0xDF, 0x7E, 0xEF, 0xBF, 0xF7, 0xFF, 0xF7, 0xDF,
+ 0xFF, 0xDF, 0x88, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x91, 0xFF, 0xFF, 0x17, 0xF7, 0x5D, 0xF7, 0xBF,
+ 0xEF, 0xFF, 0x8D, 0xD6, 0xBF, 0x3A, 0xDF, 0xFF, 0xCF, 0xFF, 0x64, 0x72, 0xF7, 0xFF, 0xF7, 0xDF,
+ 0xCF, 0xBF, 0x6C, 0xB4, 0xF7, 0xBF, 0xF7, 0xFF, 0x8E, 0x9A, 0x86, 0xDB, 0xCF, 0xFF, 0xD7, 0xFF,
+ 0x85, 0xB8, 0xC7, 0x5E, 0xE7, 0xFF, 0xEF, 0xFF, 0xE7, 0xDF, 0xEF, 0xDF, 0x83, 0xFF, 0xFF, 0x83,
+ 0xFF, 0xFE, 0x83, 0xF7, 0xFF, 0x00, 0xF7, 0xDF, 0x83, 0xFF, 0xFF, 0x04, 0xF7, 0xBE, 0xFF, 0xFF,
+ 0xF7, 0xDF, 0xF7, 0xFF, 0xE7, 0xBF, 0x81, 0xEF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xDE, 0x81, 0xFF,
+ 0xFF, 0x81, 0xFF, 0xDF, 0x00, 0xFF, 0xFF, 0x81, 0xF7, 0xFF, 0x82, 0xEF, 0xFF, 0x82, 0xFF, 0xFF,
+ 0x00, 0xFF, 0xDF, 0x81, 0xFF, 0xFF, 0x84, 0xF7, 0xFF, 0x00, 0xF7, 0xDF, 0x82, 0xFF, 0xFF, 0x00,
+ 0xFF, 0xDF, 0x81, 0xFF, 0xFF, 0x00, 0xEF, 0xDF, 0x81, 0xF7, 0xFF, 0x01, 0xEF, 0xDF, 0xF7, 0xDF,
+ 0x81, 0xFF, 0xFF, 0x81, 0xF7, 0xBF, 0x81, 0xFF, 0xFF, 0x00, 0xFF, 0xDE, 0x81, 0xFF, 0xFF, 0x84,
+ 0xEF, 0xFF, 0x00, 0xF7, 0xFF, 0x81, 0xFF, 0xFF, 0x00, 0xF7, 0xDF, 0x81, 0xFF, 0xFF, 0x00, 0xFF,
+ 0xDE, 0x82, 0xFF, 0xFF, 0x82, 0xF7, 0xFF, 0x07, 0xEF, 0xFF, 0xEF, 0xDF, 0xF7, 0xBF, 0xFF, 0xDF,
+ 0xF7, 0x9F, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xBE, 0x81, 0xFF, 0xFF, 0x81, 0xF7, 0xFF, 0x81, 0xFF,
+ 0xFF, 0x82, 0xFF, 0xDF, 0x01, 0xFF, 0xFF, 0xF7, 0xFF, 0x81, 0xEF, 0xFF, 0x00, 0xF7, 0xFF, 0x83,
+ 0xFF, 0xFF, 0x00, 0xF7, 0x9D, 0x82, 0xFF, 0xFF, 0x01, 0xFF, 0xFE, 0xF7, 0xFF, 0x81, 0xEF, 0xDE,
+ 0x00, 0xF7, 0xFF, 0x85, 0xFF, 0xFF, 0x00, 0xFF, 0xDE, 0x85, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x91,
+ 0xFF, 0xFF, 0x14, 0xFF, 0xDF, 0xFF, 0x9E, 0xF7, 0xFF, 0xB6, 0xB9, 0xE7, 0xFD, 0xE7, 0xFE, 0xDF,
+ 0xFF, 0xB6, 0x9A, 0xF7, 0x9D, 0xF7, 0x9E, 0xE7, 0xFF, 0xA6, 0x19, 0xFF, 0xBF, 0xF7, 0xBF, 0xB7,
+ 0x3C, 0xBF, 0xFF, 0xD7, 0xFF, 0xDF, 0xFF, 0x9E, 0x39, 0xDF, 0xFF, 0xF7, 0xFF, 0x88, 0xFF, 0xFF,
+ 0x02, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xDE, 0x81, 0xFF, 0xFF, 0x04, 0xFF, 0xDE, 0xF7, 0xDE, 0xFF,
+ 0xFE, 0xFF, 0xFF, 0xFF, 0xDE, 0x84, 0xFF, 0xFF, 0x82, 0xF7, 0xFF, 0x02, 0xFF, 0xFF, 0xF7, 0xFE,
+ 0xFF, 0xFE, 0x85, 0xFF, 0xFF, 0x83, 0xF7, 0xFF, 0x82, 0xFF, 0xFF, 0x01, 0xFF, 0xFE, 0xF7, 0xFE,
+ 0x83, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x83, 0xFF, 0xFF, 0x00, 0xFF, 0xDE, 0x81, 0xFF, 0xFF, 0x01,
+ 0xF7, 0xDF, 0xFF, 0xFF, 0x81, 0xF7, 0xDF, 0x03, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xBF,
+ 0x81, 0xFF, 0xDF, 0x01, 0xFF, 0xFF, 0xFF, 0xDF, 0x81, 0xFF, 0xFF, 0x82, 0xF7, 0xFF, 0x02, 0xEF,
+ 0xDE, 0xF7, 0xFF, 0xF7, 0xDF, 0x81, 0xFF, 0xFF, 0x00, 0xF7, 0xDF, 0x81, 0xFF, 0xFF, 0x00, 0xFF,
+ 0xDF, 0x82, 0xFF, 0xFF, 0x0C, 0xF7, 0xDF, 0xEF, 0x9E, 0xEF, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xDF, 0xFF, 0xFF, 0xF7, 0x7E, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xBE, 0xFF, 0xFF, 0xF7, 0xBE, 0x84,
+ 0xFF, 0xFF, 0x04, 0xFF, 0xBE, 0xFF, 0xBF, 0xFF, 0xFF, 0xF7, 0xDF, 0xF7, 0xFF, 0x82, 0xFF, 0xFF,
+ 0x00, 0xFF, 0xDF, 0x82, 0xFF, 0xFF, 0x02, 0xF7, 0xBE, 0xFF, 0xBE, 0xF7, 0x9D, 0x82, 0xFF, 0xFF,
+ 0x00, 0xF7, 0xDE, 0x81, 0xFF, 0xFF, 0x82, 0xFF, 0xDF, 0x88, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x91,
+ 0xFF, 0xFF, 0x17, 0xFF, 0xDF, 0xFF, 0xBE, 0xEF, 0xFF, 0xAE, 0x58, 0xE7, 0xBC, 0xF7, 0xFF, 0xEF,
+ 0xFF, 0xC6, 0x9B, 0xFF, 0xFF, 0xEF, 0x9D, 0xE7, 0xFF, 0xB6, 0xBB, 0xFF, 0xFF, 0xFF, 0xBF, 0xC7,
+ 0x5C, 0xBF, 0x9D, 0xDF, 0xFF, 0xE7, 0xFF, 0xAE, 0x38, 0xE7, 0x9E, 0xF7, 0xFF, 0xF7, 0xDF, 0xFF,
+ 0xBF, 0xF7, 0x9E, 0x98, 0xFF, 0xFF, 0x81, 0xFF, 0xFE, 0x82, 0xFF, 0xFF, 0x81, 0xFF, 0xDF, 0x83,
+ 0xFF, 0xFF, 0x00, 0xF7, 0xFF, 0x83, 0xFF, 0xFF, 0x00, 0xF7, 0xFE, 0x81, 0xFF, 0xFF, 0x00, 0xFF,
+ 0xBF, 0x81, 0xFF, 0xDF, 0x81, 0xFF, 0xFF, 0x06, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF,
+ 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xDF, 0x8B, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x86, 0xFF, 0xFF, 0x00,
+ 0xFF, 0xDF, 0x82, 0xFF, 0xFF, 0x00, 0xF7, 0xBF, 0x85, 0xFF, 0xFF, 0x00, 0xFF, 0xDE, 0x84, 0xFF,
+ 0xFF, 0x00, 0xF7, 0xBF, 0x83, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x8E, 0xFF, 0xFF, 0x00, 0xFF, 0xDF,
+ 0x84, 0xFF, 0xFF, 0x82, 0xFF, 0xDF, 0x00, 0xFF, 0xBF, 0x81, 0xFF, 0xDF, 0x87, 0xFF, 0xFF, 0x00,
+ 0xFF, 0xDF, 0x91, 0xFF, 0xFF, 0x13, 0xF7, 0xBF, 0xFF, 0xFF, 0xEF, 0xFF, 0xA6, 0x39, 0xCF, 0x3C,
+ 0xF7, 0xFF, 0xE7, 0x5F, 0x9D, 0x37, 0xF7, 0xFF, 0xDF, 0xDE, 0xBF, 0x5E, 0x9E, 0x3A, 0xF7, 0xBF,
+ 0xFF, 0xBF, 0xC6, 0xDB, 0xAE, 0x79, 0xEF, 0xDF, 0xF7, 0x9E, 0xC6, 0x38, 0xEF, 0x7C, 0x81, 0xFF,
+ 0xFE, 0x00, 0xFF, 0xFF, 0x83, 0xF7, 0xFF, 0x82, 0xFF, 0xFF, 0x81, 0xFF, 0xDF, 0x07, 0xFF, 0xDE,
+ 0xFF, 0xFE, 0xFF, 0xBD, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xDE, 0x82, 0xFF,
+ 0xFF, 0x00, 0xFF, 0xFE, 0x83, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x82, 0xFF, 0xDF,
+ 0x83, 0xFF, 0xFF, 0x81, 0xF7, 0xFF, 0x81, 0xFF, 0xFF, 0x81, 0xF7, 0xFE, 0x01, 0xFF, 0xFF, 0xFF,
+ 0xDF, 0x82, 0xFF, 0xBF, 0x06, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFE, 0xF7, 0xFF, 0xF7, 0xFE, 0xFF,
+ 0xFF, 0xFF, 0xDE, 0x81, 0xFF, 0xDF, 0x81, 0xFF, 0xFF, 0x02, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xDF,
+ 0x84, 0xFF, 0xFF, 0x81, 0xFF, 0xDF, 0x00, 0xFF, 0xFF, 0x81, 0xFF, 0xDF, 0x8A, 0xFF, 0xFF, 0x01,
+ 0xF7, 0x9E, 0xF7, 0xBE, 0x81, 0xFF, 0xFF, 0x81, 0xFF, 0xFE, 0x01, 0xEF, 0xDD, 0xF7, 0xFF, 0x82,
+ 0xFF, 0xFF, 0x01, 0xF7, 0x7E, 0xFF, 0xFF, 0x84, 0xFF, 0xDF, 0x00, 0xFF, 0xFF, 0x83, 0xFF, 0xFE,
+ 0x00, 0xFF, 0xFF, 0x81, 0xFF, 0xFE, 0x83, 0xFF, 0xFF, 0x00, 0xF7, 0xBF, 0x82, 0xFF, 0xFF, 0x81,
+ 0xFF, 0xDF, 0x00, 0xFF, 0xBE, 0x82, 0xFF, 0xFF, 0x84, 0xFF, 0xDF, 0x9A, 0xFF, 0xFF, 0x16, 0xF7,
+ 0xFF, 0xE7, 0xDF, 0xBE, 0xDC, 0xDF, 0x9E, 0xF7, 0xFF, 0xEF, 0x5F, 0xD6, 0x9D, 0xE7, 0xBE, 0xEF,
+ 0xFF, 0xCF, 0xBF, 0xB6, 0x7B, 0xFF, 0xFF, 0xFF, 0xDF, 0xD7, 0x3C, 0xDF, 0x5D, 0xFF, 0xFF, 0xFF,
+ 0xBE, 0xDE, 0x99, 0xEF, 0x5C, 0xFF, 0xDE, 0xEF, 0xBD, 0xFF, 0xFF, 0xEF, 0xDD, 0x82, 0xF7, 0xFF,
+ 0x81, 0xFF, 0xFF, 0x82, 0xFF, 0xDF, 0x02, 0xFF, 0xDE, 0xFF, 0xFE, 0xFF, 0xBD, 0x81, 0xFF, 0xFF,
+ 0x00, 0xF7, 0xBE, 0x84, 0xFF, 0xFF, 0x05, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF,
+ 0xDE, 0xF7, 0xFE, 0x81, 0xFF, 0xFF, 0x03, 0xFF, 0xDE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0x88,
+ 0xFF, 0xFF, 0x06, 0xF7, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBF, 0xFF, 0xDF, 0xFF,
+ 0x9F, 0x81, 0xFF, 0xFF, 0x06, 0xF7, 0xFE, 0xF7, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF,
+ 0xDF, 0xFF, 0xBF, 0x81, 0xFF, 0xFF, 0x00, 0xF7, 0xDE, 0x82, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x82,
+ 0xFF, 0xFF, 0x81, 0xFF, 0xDF, 0x04, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x9E, 0xFF, 0xFF, 0xFF, 0xDE,
+ 0x84, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x85, 0xFF, 0xFF, 0x03, 0xFF, 0xBE, 0xFF, 0xBD, 0xFF, 0xFE,
+ 0xFF, 0xFF, 0x81, 0xF7, 0xFF, 0x83, 0xFF, 0xFF, 0x01, 0xFF, 0xBF, 0xFF, 0xDF, 0x82, 0xFF, 0xFF,
+ 0x83, 0xFF, 0xFE, 0x01, 0xFF, 0xDD, 0xFF, 0xFE, 0x88, 0xFF, 0xFF, 0x00, 0xF7, 0xBF, 0x82, 0xFF,
+ 0xFF, 0x86, 0xFF, 0xDF, 0x9C, 0xFF, 0xFF, 0x82, 0xF7, 0xFF, 0x83, 0xFF, 0xFF, 0x82, 0xF7, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xFF, 0xFF,
+};
 
-const unsigned char img_logo[20540] = { 0X10,0X10,0X00,0XB1,0X00,0X3A,0X01,0X1B,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,
-0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XDF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XBE,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,
-0XFF,0XDF,0XFF,0XFF,0XFF,0XBE,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XBF,0XFF,0XFF,0XFF,0XBF,0XFF,0XFF,0XFF,0XDF,
-0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XFF,0X9E,0XFF,0XFF,0XFF,0XFF,0XFF,0XBE,0XFF,0XFF,
-0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X9E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF7,0X9E,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XDF,0XFF,0XFF,0XFF,0XFF,0XF7,0XDF,
-0XF7,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XBF,0XFF,0XFF,0XF7,0XDF,
-0XFF,0XFF,0XF7,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,
-0XFF,0XFF,0XF7,0XBE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XF7,0XFF,0XFF,0XFF,
-0XE7,0X9E,0XF7,0XDF,0XF7,0XFF,0XFF,0XFF,0XE7,0X9E,0XF7,0XFF,0XF7,0XFF,0XFF,0XFF,
-0XDF,0X5D,0XFF,0XFF,0XF7,0XFF,0XF7,0XDF,0XF7,0XDF,0XFF,0XDF,0XFF,0XFF,0XEF,0X5D,
-0XFF,0XDF,0XFF,0XFF,0XF7,0XBE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XDF,0XEF,0XFF,
-0XE7,0XBF,0XC6,0XBA,0XDF,0X5D,0XE7,0XDF,0XE7,0XBF,0XBE,0X79,0XE7,0XBF,0XE7,0XBF,
-0XE7,0XBF,0XB6,0X38,0XEF,0XDF,0XE7,0XBF,0XD7,0X1C,0XD6,0XDB,0XF7,0XDF,0XFF,0XDF,
-0XD6,0XBA,0XEF,0X7D,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF7,0XFF,0XEF,0XDF,0XBE,0X9A,0XD7,0X9D,0XEF,0XFF,0XE7,0XDF,0XAE,0X18,0XF7,0XFF,
-0XF7,0XFF,0XE7,0XBF,0XA5,0XD8,0XF7,0XFF,0XEF,0XFF,0XCF,0X1C,0XC6,0XBB,0XF7,0XFF,
-0XEF,0XBE,0XBE,0X59,0XDF,0X3C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XBE,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XDF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF7,0XDF,0XC6,0XBA,0XD7,0XFD,0XD7,0XFD,0XE7,0XFF,0XC6,0XBA,
-0XF7,0XDD,0XF7,0XDE,0XF7,0XFF,0XB6,0X5B,0XF7,0XFF,0XF7,0XDF,0XCF,0X3D,0XD7,0X9F,
-0XEF,0XFF,0XEF,0XFF,0XB6,0XDB,0XD7,0X9E,0XF7,0XFF,0XF7,0XBE,0XFF,0XDF,0XFF,0XDF,
-0XFF,0XDD,0XFF,0XFE,0XFF,0XFE,0XFF,0XFE,0XFF,0X9E,0XFF,0XFF,0XEF,0XFF,0XF7,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XFF,0XFF,
-0XF7,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XF7,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XBD,0XFF,0XFE,0XFF,0XDE,0XFF,0XFE,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XEF,0XDE,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDE,0XFF,0XBE,
-0XFF,0XDF,0XFF,0X9F,0XF7,0XFF,0XF7,0XFF,0XFF,0XDF,0XFF,0XDF,0XF7,0X7F,0XFF,0XFF,
-0XF7,0XDF,0XFF,0XBE,0XFF,0XBF,0XFF,0XBF,0XFF,0XBE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF7,0XFF,0XF7,0XFE,0XFF,0XFF,0XFF,0XDF,0XFF,0X9F,0XFF,0X9E,0XFF,0XFF,
-0XFF,0XFE,0XFF,0XDE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFE,0XFF,0XDF,0XFF,0XDF,
-0XFF,0XDE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X9E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFE,0XFF,0XDF,0XF7,0X7F,0XF7,0X9F,0XFF,0XFF,
-0XEF,0XBD,0XFF,0XFF,0XF7,0XDF,0XF7,0XFF,0XFF,0XFF,0XF7,0XBF,0XFF,0XFF,0XEF,0XBF,
-0XF7,0XFF,0XF7,0XFE,0XF7,0XFD,0XFF,0XFD,0XEF,0XBB,0XFF,0XFE,0XEF,0XDF,0XF7,0XFF,
-0XF7,0XBF,0XFF,0XBE,0XFF,0XFE,0XFF,0XFE,0XEF,0XDD,0XFF,0XFF,0XF7,0X9C,0XFF,0XDE,
-0XF7,0XBF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XEF,0XFF,0XE7,0XFF,0XF7,0XFE,0XF7,0XDD,
-0XF7,0XFF,0XF7,0XFF,0XEF,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,
-0XFF,0XDF,0XEF,0X9E,0XF7,0XFF,0XF7,0XFF,0XAE,0X5A,0XBF,0XBC,0XD7,0XFF,0XDF,0XFF,
-0X95,0X97,0XEF,0XFF,0XF7,0XFF,0XD7,0X9F,0X8D,0X79,0XEF,0XFF,0XEF,0XFF,0XAE,0XBD,
-0XAE,0XDD,0XEF,0XFF,0XDF,0XFF,0X96,0X18,0XC7,0XBF,0XEF,0XFF,0XF7,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFD,0XFF,0XFE,0XFF,0XDD,0XFF,0XFE,0XFF,0XBE,0XFF,0XFF,0XF7,0XFF,
-0XEF,0XFF,0XFF,0XFF,0XEF,0X7D,0XF7,0XFF,0XF7,0XFF,0XEF,0X9E,0XFF,0XFF,0XFF,0XFF,
-0XEF,0XBF,0XEF,0XDF,0XF7,0XFF,0XF7,0XBF,0XFF,0XFF,0XFF,0XFF,0XEF,0X9F,0XF7,0X9E,
-0XFF,0XDF,0XFF,0XFE,0XFF,0XFE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XBE,
-0XFF,0XDE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XF7,0XFF,0XF7,0XDE,0XF7,0X9E,
-0XFF,0XFF,0XF7,0X5E,0XFF,0XFF,0XEF,0XFF,0XE7,0XDF,0XFF,0XDF,0XFF,0XDF,0XF7,0XDF,
-0XF7,0XFF,0XFF,0XFF,0XF7,0X9D,0XFF,0XDE,0XF7,0X1C,0XF7,0XBE,0XFF,0XFF,0XFF,0XDF,
-0XF7,0XBF,0XEF,0XDF,0XF7,0XFF,0XF7,0XFF,0XEF,0XBD,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,
-0XF7,0X9D,0XFF,0XFE,0XFF,0XDE,0XFF,0XDF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFE,0XFF,0XFF,
-0XFF,0XDF,0XFF,0XFF,0XFF,0XFE,0XF7,0X7F,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XBE,0XFF,0XFE,0XFF,0XFD,0XFF,0XFE,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,
-0XF7,0XDF,0XFF,0XFF,0XF7,0XFE,0XF7,0XFF,0XEF,0X9F,0XF7,0X9F,0XFF,0XFF,0XEF,0XDF,
-0XF7,0XFF,0XEF,0XFF,0XF7,0XFE,0XFF,0XFD,0XFF,0XFD,0XF7,0XFD,0XF7,0XFF,0XF7,0XFF,
-0XF7,0XFF,0XF7,0XFF,0XF7,0XDF,0XFF,0XFE,0XF7,0XFD,0XEF,0XBD,0XFF,0XFF,0XFF,0XFD,
-0XFF,0XFE,0XF7,0XFF,0XFF,0XDF,0XFF,0X9F,0XF7,0X3E,0XEF,0XFF,0XE7,0XDF,0XFF,0XFF,
-0XFF,0XFE,0XF7,0XFF,0XF7,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,
-0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,
-0XF7,0XFF,0XF7,0XFF,0XE7,0XFF,0XDF,0XFF,0XCF,0XDF,0X85,0XDB,0X97,0X1D,0XBF,0XFF,
-0XBF,0XFF,0X5C,0X96,0XCF,0XFF,0XDF,0XFF,0XAF,0X5F,0X65,0X3A,0XCF,0XFF,0XD7,0XFF,
-0X8E,0X9E,0X8E,0X7D,0XE7,0XFF,0XDF,0XDF,0X8D,0XD8,0XB7,0X5E,0XCF,0XBF,0XEF,0XFF,
-0XF7,0XFF,0XEF,0XDF,0XF7,0XFF,0XF7,0XFE,0XF7,0XFD,0XFF,0XFE,0XFF,0XBE,0XFF,0XDF,
-0XFF,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFE,0XEF,0XDE,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XEF,0XDF,0XF7,0XFF,0XF7,0XDE,0XF7,0XBE,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF7,0XBD,0XFF,0XFE,0XFF,0XFE,0XFF,0XFF,0XF7,0XFF,0XE7,0XDF,0XEF,0XDF,
-0XF7,0XDF,0XFF,0XFF,0XEF,0X9E,0XEF,0XBD,0XF7,0XFE,0XE7,0XBC,0XEF,0XFF,0XF7,0XFF,
-0XF7,0XFF,0XF7,0XDF,0XFF,0XFF,0XF7,0XFF,0XE7,0XFE,0XE7,0XFE,0XEF,0XFF,0XF7,0XFF,
-0XF7,0XFF,0XEF,0XFF,0XEF,0XFE,0XF7,0XFE,0XFF,0XFE,0XFF,0XFE,0XF7,0XFE,0XE7,0XFD,
-0XEF,0XFF,0XEF,0XFF,0XEF,0XFF,0XE7,0XFF,0XE7,0XFF,0XE7,0XFF,0XF7,0XFF,0XF7,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFE,0XF7,0XFF,
-0XFF,0XFF,0XF7,0XFF,0XEF,0XBE,0XFF,0XFF,0XEF,0XBF,0XF7,0XFF,0XFF,0XFF,0XF7,0XDE,
-0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XBD,0XFF,0XFE,0XFF,0XFE,0XEF,0XBF,0XF7,0XFF,
-0XE7,0XBF,0XF7,0XDF,0XEF,0X9C,0XFF,0XFD,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XE7,0X9F,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X9E,0XF7,0XFF,0XEF,0XBF,
-0XF7,0XBF,0XEF,0XFF,0XE7,0XFF,0XDF,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XBF,0XFF,0XDF,
-0XFF,0XFE,0XF7,0XFF,0XEF,0XFF,0XF7,0XFF,0XFF,0XBF,0XFF,0X5F,0XFF,0XDF,0XFF,0XDF,
-0XF7,0XFF,0XE7,0X9E,0XE7,0XBF,0XF7,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XBF,
-0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,
-0XF7,0XFF,0XF7,0XFF,0XEF,0XFF,0XD7,0XFF,0X8E,0X7E,0X8E,0X3E,0X64,0XF8,0X65,0XB9,
-0X76,0X3B,0X86,0X3D,0X4C,0X35,0X85,0XFA,0X8E,0X7C,0X75,0XFC,0X3C,0X76,0X86,0X1C,
-0X86,0X3C,0X55,0X59,0X65,0X79,0X8D,0XFA,0X9D,0XFA,0X64,0XF5,0X7D,0XB8,0X96,0X3B,
-0XBE,0XDD,0XEF,0XFF,0XEF,0XFF,0XEF,0XFF,0XEF,0XFE,0XF7,0XFE,0XFF,0XFF,0XFF,0XDF,
-0XFF,0XDF,0XFF,0XFF,0XF7,0XFF,0XE7,0X9E,0XE7,0XFF,0XB6,0XFB,0XB6,0XDB,0XEF,0XFF,
-0XEF,0XFF,0XDF,0X9F,0XEF,0XFF,0XE7,0XFF,0XCF,0X9E,0XAE,0X5A,0XE7,0XDF,0XEF,0XBF,
-0XEF,0XFF,0XDF,0XBF,0XC6,0XDA,0XF7,0XFE,0XFF,0XFF,0XF7,0XFF,0XE7,0XDF,0XAE,0X7C,
-0XCF,0X5F,0XEF,0XFF,0XF7,0XFF,0XF7,0XFF,0XC6,0XDA,0XF7,0XFE,0XF7,0XFE,0XE7,0XFF,
-0XDF,0XFF,0XD7,0X7F,0XCF,0X3F,0XC7,0X1D,0XBF,0X3C,0XA6,0XBA,0XBF,0X5D,0XB7,0X1D,
-0XB6,0XDC,0XB6,0XFC,0XBF,0X1B,0XBF,0X1B,0XE7,0XFF,0XBE,0XDB,0XD7,0X9E,0XE7,0XFF,
-0XD7,0XFF,0XDF,0XFF,0XB6,0XFD,0XB6,0XFE,0X9E,0X5C,0X96,0X39,0XAE,0XBC,0XBF,0X1F,
-0XDF,0XDF,0XEF,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XF7,0XFF,
-0XF7,0XFF,0XEF,0XFF,0XEF,0XFF,0XD7,0X5D,0XE7,0XFF,0XAE,0X9C,0XD7,0XBF,0XEF,0XFF,
-0XEF,0XFF,0XE7,0XFF,0XDF,0XFF,0XE7,0XFF,0XE7,0XDF,0XF7,0XFF,0XE7,0XDE,0XB6,0XBC,
-0XC7,0X5F,0XD7,0XDF,0XC7,0X1C,0XC6,0XFB,0XEF,0XFF,0X9D,0XD7,0XA6,0X19,0XAE,0X3A,
-0X9D,0XB8,0XAE,0X9D,0XB6,0X9D,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XBF,0XE7,0XDF,
-0XA6,0X3E,0XA5,0XFD,0XA6,0X3D,0X8E,0X7C,0X96,0X7B,0XDF,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XF7,0XBF,0XF7,0XFE,0XC7,0X1B,0X96,0X3B,0XB6,0XBE,0XFF,0XDF,0XFF,0X9F,0XFF,0XBF,
-0XF7,0X7F,0XBE,0XDC,0X95,0X97,0XC6,0XFC,0XEF,0XDF,0XF7,0XDF,0XFF,0XFF,0XFF,0XDF,
-0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF7,0XBF,0XFF,0XDF,0XFF,0XFF,0XE7,0XFF,0X96,0X7C,0X44,0X75,0X75,0X39,0X6D,0X19,
-0X75,0X98,0X65,0X57,0X7D,0X9A,0X75,0X39,0X75,0X57,0X6D,0X56,0X6D,0XB9,0X5D,0X37,
-0X6D,0X77,0X6D,0X57,0X65,0X57,0X65,0X78,0X6D,0X37,0X6D,0X57,0X65,0X57,0X65,0X37,
-0X7D,0X78,0X64,0X54,0XCF,0X1F,0XE7,0XBF,0XEF,0XFF,0XEF,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XDF,0XFF,0XDE,0XFF,0XFF,0XEF,0XFF,0XAE,0XFE,0X6D,0X79,0X44,0XB5,0X4D,0X37,
-0X65,0X59,0X6D,0X7A,0X75,0X7A,0X6D,0X7A,0X65,0XBA,0X5D,0X79,0X34,0X14,0X75,0XBA,
-0X75,0X39,0XCF,0XFF,0XBF,0XFF,0X54,0X94,0XCF,0X7D,0XF7,0XFF,0XEF,0XFF,0XD7,0X5E,
-0X74,0XD7,0XB6,0XFF,0XE7,0XFF,0XEF,0XFF,0XD7,0XFF,0X5C,0X31,0XCE,0XFA,0XEF,0XFE,
-0X95,0XD8,0X64,0X74,0X75,0X17,0X8D,0XFB,0X54,0XB6,0X4C,0X95,0X4C,0X74,0X5D,0X37,
-0X34,0X35,0X44,0X77,0X4C,0XB6,0X4C,0XB5,0X86,0X1B,0XB7,0X9F,0X65,0X39,0X65,0X38,
-0X8E,0X9C,0XBF,0XFF,0X86,0XDF,0X44,0X98,0X4C,0X57,0X5C,0XD7,0X4C,0X74,0X54,0XD5,
-0X65,0X18,0XCF,0XFF,0XE7,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,
-0XF7,0XFF,0XE7,0XFF,0XCF,0XDF,0XB7,0X1F,0X75,0X57,0X9E,0X9C,0X44,0X75,0X75,0XFB,
-0X85,0XFA,0X96,0X7C,0X8E,0X7C,0X86,0X5C,0X8E,0X7C,0XCF,0XFF,0XDF,0XFF,0XC7,0XDF,
-0X6D,0XDA,0X7E,0X5D,0XCF,0XFF,0X75,0XDA,0X6D,0X58,0X9F,0X3F,0X54,0XF6,0X4C,0XF6,
-0X55,0X16,0X44,0XB5,0X3C,0XB6,0X4C,0XB5,0XD7,0XFF,0XE7,0XFE,0XF7,0XFE,0XE7,0XFF,
-0XAF,0XDF,0X44,0XD7,0X44,0X53,0X44,0X93,0X2C,0XD5,0X3C,0XF6,0XA6,0XFE,0XE7,0XFF,
-0XF7,0XFF,0XF7,0XDF,0XE7,0XFF,0X96,0X99,0X34,0XB5,0X5D,0XBA,0XDF,0XBF,0XFF,0XDF,
-0XFF,0XFF,0XE7,0XBF,0X8E,0X7C,0X4C,0X94,0XAE,0X7B,0XE7,0XBF,0XF7,0XDF,0XF7,0XFF,
-0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XBF,0XFF,0XFF,0XFF,0XFF,
-0XF7,0XBF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XE7,0XFF,0X86,0X5B,0X6D,0XB9,0XCF,0XDF,
-0XDF,0XFF,0XDF,0XFF,0XCF,0XDF,0XDF,0XFF,0XDF,0XDF,0XDF,0XFF,0XC7,0XFF,0XCF,0XFF,
-0XD7,0XFF,0XD7,0XFF,0XD7,0XFF,0XDF,0XFF,0XCF,0XFF,0XDF,0XFF,0XCF,0XFF,0XCF,0XFF,
-0XC7,0XFF,0XC7,0XFF,0X5C,0X75,0XBE,0XFF,0XEF,0XFF,0XE7,0XFF,0XEF,0XFF,0XF7,0XFF,
-0XF7,0XBE,0XFF,0XFF,0XFF,0XDE,0XFF,0XFE,0XEF,0XFF,0XAE,0XFF,0X6D,0XBA,0X3C,0XB5,
-0X3C,0XF7,0X55,0X7A,0X5D,0X5A,0X65,0X3A,0X6D,0X7A,0X4D,0X59,0X55,0XBA,0X2C,0X55,
-0X5D,0X59,0X64,0XD8,0XD7,0XFF,0XC7,0XFF,0X2B,0XD1,0XAF,0X1C,0XE7,0XFF,0XF7,0XFF,
-0XDF,0X7F,0X5C,0X35,0XB6,0XFF,0XE7,0XFF,0XE7,0XFF,0XC7,0XFF,0X44,0X11,0XDF,0X9D,
-0XF7,0XFF,0XA6,0X3B,0X96,0X3C,0XB7,0X5F,0XB7,0XBF,0XB7,0XFF,0XA7,0X9F,0XB7,0XBF,
-0X9E,0XFF,0X44,0XDA,0X86,0XFF,0XAF,0XDF,0XAF,0X7F,0XBF,0XBF,0XCF,0XFF,0XAF,0X9F,
-0X9F,0X3F,0XA7,0X7F,0XAF,0XBF,0X4D,0X1A,0X65,0XDE,0XA7,0X9F,0XBF,0XFF,0XAF,0XFF,
-0X97,0X3F,0X55,0X18,0X86,0X3C,0XBF,0X5E,0XE7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,
-0XFF,0XFF,0XEF,0XDF,0XC7,0X5D,0X8E,0X1A,0X54,0XB6,0X96,0XBD,0XA7,0X5F,0X34,0X75,
-0X65,0XFB,0X5D,0X18,0X54,0XB6,0X55,0X17,0X44,0XD6,0X4D,0X17,0X5D,0X37,0XBF,0X7F,
-0XA6,0XDD,0X2C,0X35,0X34,0XD8,0X5D,0X9A,0X3C,0X55,0X4C,0XB7,0X97,0X1F,0XAF,0XFF,
-0XAF,0XFF,0XAF,0XFF,0X9F,0XFF,0X34,0XF7,0X5D,0X99,0XDF,0XFF,0XE7,0XFE,0XEF,0XFE,
-0XDF,0XFF,0X7F,0X1F,0X1C,0X96,0X4D,0X36,0X66,0X18,0X3D,0X78,0X24,0XB6,0X7E,0X1C,
-0XD7,0XDF,0XF7,0XDF,0XF7,0XDF,0XE7,0XFF,0X7E,0X58,0X1C,0XF7,0X45,0XFC,0XD7,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XE7,0XFF,0X86,0XDE,0X34,0XB6,0XA6,0X9B,0XEF,0XFF,0XF7,0XFF,
-0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,
-0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,
-0XE7,0X7D,0XCF,0X3C,0XE7,0XFF,0XE7,0XFF,0XC7,0X3C,0XB7,0X3C,0X55,0X35,0X75,0XB8,
-0XE7,0XFF,0XEF,0XFF,0XEF,0XFF,0XEF,0XFF,0XF7,0XDF,0XF7,0XDF,0XEF,0XFF,0XDF,0XFF,
-0XE7,0XFE,0XEF,0XFF,0XF7,0XFD,0XF7,0XFD,0XF7,0XFF,0XEF,0XFF,0XF7,0XFF,0XEF,0XFF,
-0XE7,0XFF,0XDF,0XFF,0XD7,0XFF,0X54,0X75,0X85,0XFA,0XA6,0XFE,0XBF,0XBF,0XDF,0XFF,
-0XDF,0XDF,0XCE,0XDB,0XFF,0XFF,0XFF,0XDE,0XFF,0XBE,0XFF,0XFF,0XDF,0XDF,0XC7,0XDF,
-0X9E,0XFC,0X96,0XFC,0XBF,0XFF,0XD7,0XFF,0XD7,0XFF,0XDF,0XFF,0XCF,0XFF,0XAF,0XDF,
-0X86,0X3B,0XBF,0X9F,0XDF,0XBF,0XE7,0XFF,0XC7,0XDF,0X5C,0XD4,0XA7,0X1D,0XDF,0XFF,
-0XF7,0XFF,0XEF,0XDF,0X5C,0X34,0XBF,0X3F,0XE7,0XFF,0XDF,0XFF,0XAF,0XDF,0X4C,0X96,
-0XEF,0XFF,0XF7,0XFF,0XC7,0X3F,0XCF,0XFF,0XD7,0XFF,0XCF,0XFF,0XD7,0XFF,0XBF,0X7F,
-0XEF,0XFF,0XC7,0X1D,0X4C,0X35,0XAF,0X7F,0XDF,0XFF,0XE7,0XFF,0XE7,0XFF,0XE7,0XFF,
-0XB7,0X5F,0XBF,0X9F,0XCF,0XDF,0X75,0X35,0X3B,0XF3,0X7E,0X1E,0X86,0X9F,0X76,0X3F,
-0X8F,0X1F,0X7E,0XDF,0X45,0X18,0X3C,0X75,0X96,0X7B,0XEF,0XFF,0XFF,0XFF,0XFF,0XDF,
-0XFF,0XDF,0XFF,0XDF,0XE7,0XBF,0XBF,0X1D,0X6D,0XB9,0X33,0XF2,0XBF,0X9F,0X9E,0XFD,
-0X3C,0XB5,0X97,0X7F,0XCF,0XFF,0XB7,0X5F,0XCF,0XFF,0XB7,0XFF,0X6D,0XFB,0X4C,0X94,
-0XE7,0XFF,0XCF,0XBF,0X44,0XF7,0X4D,0XDA,0X65,0XBA,0X65,0X38,0X64,0X97,0XAE,0XBF,
-0XD7,0XFF,0XCF,0XFF,0XC7,0XFF,0XAF,0XBF,0X3C,0X76,0X96,0X9E,0XEF,0XFF,0XFF,0XFF,
-0XF7,0XDE,0XDF,0XFF,0X5D,0XBE,0X24,0XB9,0X86,0XFE,0XB7,0XFF,0X8F,0X7F,0X3C,0XF8,
-0X5D,0X19,0XDF,0XDF,0XFF,0X9F,0XFF,0XBF,0XEF,0XFF,0X86,0X39,0X1D,0X19,0X3D,0XFD,
-0XD7,0XFF,0XF7,0XFF,0XF7,0XFD,0XDF,0XFF,0X76,0XDF,0X2C,0X77,0XAE,0XBC,0XF7,0XFF,
-0XFF,0XFF,0XF7,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,
-0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XFF,0XDF,
-0XFF,0XFF,0XC6,0XBA,0XA5,0XF7,0XC7,0X1C,0XB6,0XBA,0X7D,0X34,0X64,0XF4,0X4D,0X15,
-0X6D,0XD8,0XE7,0XFF,0XE7,0XBF,0XEF,0XFF,0XEF,0XFF,0XFF,0XBF,0XFF,0XFF,0XDF,0XBF,
-0XEF,0XFF,0XF7,0XFE,0XF7,0XFC,0XFF,0XDC,0XFF,0XDC,0XFF,0XFE,0XFF,0XFF,0XF7,0XBF,
-0XF7,0XFF,0XEF,0XFF,0XDF,0XFF,0XD7,0XFF,0X5C,0XD5,0X5C,0XF6,0X5C,0XD5,0X96,0X5A,
-0XB7,0X1D,0XB6,0X9A,0XAD,0XD7,0XF7,0XBE,0XFF,0XFF,0XFF,0XDE,0XFF,0XFF,0XEF,0XFF,
-0XC7,0X9F,0XBF,0XDE,0XB7,0X9E,0XA6,0XFD,0XBF,0X9F,0XDF,0XDF,0XB6,0X9C,0XAF,0X3D,
-0XD7,0XFF,0XAF,0X5F,0XA6,0X9C,0XEF,0XDF,0XF7,0XFF,0XDF,0XFF,0X54,0X73,0XAF,0X1E,
-0XD7,0XFF,0XEF,0XDF,0XEF,0XFF,0X5C,0X53,0XB7,0X5E,0XE7,0XFF,0XDF,0XFF,0X9F,0X7F,
-0X3C,0X35,0XDF,0X9F,0XEF,0X9F,0XB6,0XDF,0X7D,0XBB,0X65,0X36,0X86,0X7A,0X96,0XDC,
-0X85,0X97,0XEF,0XDF,0XDF,0X9E,0X54,0X75,0XAF,0X9F,0XDF,0XFF,0XDF,0XFF,0XF7,0XFF,
-0XE7,0XDF,0X54,0X55,0X64,0XF7,0XD7,0XFF,0X7D,0X34,0X7D,0XBA,0X55,0X1A,0X55,0X5D,
-0X24,0X18,0X45,0X19,0X45,0X18,0X4D,0XBA,0X4D,0X78,0XB7,0X7E,0XDF,0XFF,0XFF,0XFF,
-0XFF,0XBF,0XFF,0XBF,0XFF,0XFF,0XF7,0XFF,0XD7,0XFF,0X8E,0XDD,0X55,0X37,0XBF,0X7F,
-0XB7,0X5F,0X8E,0XFD,0XC7,0XFF,0XCF,0XFF,0X64,0X94,0XA7,0X1D,0XB7,0XDF,0X65,0X57,
-0X96,0X5B,0XDF,0X9F,0XE7,0XFF,0X5D,0X98,0X66,0X5C,0XC7,0XFF,0X75,0X79,0X8D,0XDC,
-0XD7,0XFF,0XCF,0XFF,0XCF,0XFF,0XAF,0X9F,0X7E,0X5D,0X3C,0X76,0XAF,0X5F,0XEF,0XFF,
-0XFF,0XFF,0XFF,0XDF,0XDF,0XFF,0X3C,0XDB,0X24,0X79,0X9F,0X3F,0XCF,0XFF,0XBF,0XFF,
-0X3C,0XB8,0X34,0X16,0XCF,0XBF,0XFF,0X9F,0XFF,0X9F,0XF7,0XDF,0X8E,0X7A,0X14,0XF9,
-0X35,0XDD,0XDF,0XFF,0XF7,0XFF,0XF7,0XFD,0XDF,0XFF,0X86,0XFF,0X34,0X98,0XAE,0XBD,
-0XF7,0XFF,0XF7,0XFF,0XEF,0X9E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XDF,0XFF,0XFF,0XF7,0XBF,0XE7,0X5E,0XEF,0XFF,0XF7,0XFF,0XDF,0X7E,0XCF,0XDF,
-0X5D,0XF9,0X5D,0XF9,0XDF,0XFF,0XE7,0XBF,0XE7,0XFF,0XEF,0XFF,0XF7,0XDF,0XEF,0XDF,
-0XDF,0XFF,0XD7,0XDF,0XEF,0XFF,0XFF,0XFE,0XFF,0XFE,0XFF,0XDE,0XF7,0XBE,0XFF,0XFF,
-0XF7,0XFF,0XF7,0XFF,0XEF,0XFF,0XE7,0XFF,0XE7,0XFF,0X64,0X94,0X9E,0X3B,0XCF,0XBF,
-0XE7,0XFF,0XE7,0XDF,0XEF,0XDF,0XF7,0XFF,0XF7,0XFF,0XF7,0XFF,0XFF,0XFF,0XF7,0XFF,
-0XE7,0XFF,0X7D,0X99,0X7D,0XD7,0XCF,0XFF,0X54,0XD6,0X9E,0XDF,0XD7,0XFF,0X85,0X78,
-0X8E,0X5A,0XCF,0XFF,0XB7,0XDF,0X54,0X54,0XE7,0XBF,0XF7,0XFF,0XD7,0XFF,0X64,0XD5,
-0XB6,0XFE,0XD7,0XBF,0XF7,0XFF,0XE7,0XFF,0X4C,0X93,0X9F,0X5E,0XE7,0XFF,0XDF,0XFF,
-0X96,0XBE,0X54,0X56,0XF7,0XFF,0XE7,0X5F,0X8D,0X9A,0X5C,0XD7,0X65,0X56,0XAF,0XFF,
-0X97,0X5F,0X4C,0XD5,0XDF,0XDF,0XCF,0X7F,0X44,0X96,0X55,0X9A,0X75,0XF9,0X7D,0X76,
-0XAE,0X5A,0XDF,0XFF,0X96,0XDF,0X3C,0X75,0XB7,0X9F,0XA7,0X5D,0X97,0X3F,0X87,0X3F,
-0X87,0X1F,0X45,0X1C,0X5D,0XBC,0X8F,0X7F,0X87,0X7F,0X97,0X9F,0XBF,0XDF,0XEF,0XFF,
-0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XDF,0XF7,0XFF,0XDF,0XFF,0XB7,0XFF,0X3C,0X94,
-0XBF,0X7F,0XD7,0XFF,0XB7,0XDF,0XBF,0XFF,0XDF,0XFF,0X5C,0X53,0XA6,0XBB,0XC7,0XFF,
-0X9E,0XDD,0XD7,0XFF,0XF7,0XDF,0XEF,0XDF,0X6D,0XB9,0X6E,0X7D,0XCF,0XFF,0X6D,0X99,
-0X65,0XBC,0X97,0X7F,0X4D,0X7A,0X3D,0X18,0X45,0X99,0X2C,0XF7,0X3D,0X38,0X4C,0XD6,
-0XDF,0XDE,0XFF,0XFF,0XF7,0XBF,0XBE,0XDE,0X3C,0X58,0X44,0XF9,0XCF,0XFF,0XD7,0XFF,
-0XBF,0XFF,0X6E,0X3E,0X2C,0X97,0X76,0X1D,0XFF,0XDF,0XFF,0X9F,0XF7,0XBE,0X8E,0X7A,
-0X14,0XD9,0X45,0XFE,0XE7,0XFF,0XFF,0XFE,0XF7,0XFC,0XDF,0XFF,0X97,0X1F,0X44,0X78,
-0XB6,0XDD,0XF7,0XFF,0XF7,0XDF,0XEF,0X9E,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF7,0XBE,0XFF,0XFF,0XF7,0XFF,0XE7,0X9F,0XF7,0XFF,0XF7,0XFF,0XE7,0XBF,
-0XD7,0XFF,0X55,0XFA,0X66,0X7C,0XD7,0XFF,0XE7,0XFF,0XD7,0XFF,0X9E,0X5B,0X9D,0X7A,
-0X95,0X5A,0X9E,0X5D,0XD7,0XFF,0XEF,0XFF,0XE7,0X7C,0XFF,0XFF,0XF7,0X7E,0XFF,0XFF,
-0XF7,0XFF,0XE7,0X9D,0XF7,0XFD,0XEF,0XFF,0XEF,0XFF,0XE7,0XFF,0X74,0XF5,0XA6,0X9C,
-0XDF,0XFF,0XDF,0XDF,0XEF,0XFF,0XEF,0XFF,0XD7,0X5D,0XF7,0XFF,0XF7,0XFF,0XF7,0XFF,
-0XF7,0XFF,0XDF,0XFF,0X75,0X58,0X8D,0XF8,0XD7,0XFF,0X5C,0XF7,0XA7,0X1F,0XD7,0XFF,
-0X7D,0X57,0X85,0XB8,0XCF,0XFF,0XBF,0XFF,0X54,0X55,0XD7,0X7F,0XEF,0XFF,0XCF,0XDF,
-0X7D,0X37,0XA5,0XFA,0XE7,0XDF,0XE7,0XFF,0XBF,0XBE,0X45,0X15,0X87,0X3D,0XCF,0XFE,
-0XE7,0XFF,0XA6,0XBE,0X53,0XD4,0XE7,0X3E,0XF7,0XFF,0XD7,0XFF,0X86,0X3B,0X75,0XB8,
-0XBF,0XFF,0X7E,0XFD,0X55,0X16,0XE7,0XFF,0XCF,0X9F,0X34,0X76,0X4D,0XBA,0X65,0X97,
-0X75,0X76,0XAE,0X5A,0XDF,0XFF,0XBF,0XFF,0X3C,0XB6,0X9F,0X5D,0X5D,0X35,0X34,0X96,
-0X3D,0X1A,0X3D,0X1B,0X2C,0X78,0X3C,0XB8,0X44,0XF7,0X2C,0XD7,0X24,0X33,0X8E,0X19,
-0XEF,0XFF,0XFF,0XFF,0XFF,0X9E,0XF7,0XBF,0XF7,0XDF,0XF7,0XFF,0XE7,0XFF,0XAF,0XFF,
-0X3C,0X73,0XC7,0X9F,0XD7,0XFF,0X7D,0XD8,0X8E,0XBB,0XC7,0XBF,0X54,0X32,0XA6,0XBB,
-0XC7,0XBF,0X5C,0XB6,0XCF,0XDF,0XF7,0X9F,0XEF,0XDF,0X6D,0X99,0X6E,0X5C,0XBF,0XFF,
-0X75,0XFA,0X65,0XDA,0X97,0X9F,0X6E,0X5B,0X6E,0X7B,0X5E,0X7C,0X24,0XB5,0X45,0X37,
-0X7E,0X5A,0XDF,0XDE,0XF7,0XFE,0XEF,0XFF,0X85,0XDB,0X3C,0XDA,0X66,0X3F,0XD7,0XFF,
-0XCF,0XFF,0XCF,0XFF,0X8F,0X5F,0X1D,0X18,0X4D,0XBA,0XDF,0X9F,0XFF,0XDF,0XF7,0XFF,
-0X86,0X39,0X1D,0X3A,0X45,0XFD,0XE7,0XFF,0XF7,0XBD,0XEF,0XFB,0XDF,0XFE,0XA7,0X1F,
-0X4C,0X18,0XBE,0XFE,0XF7,0XFF,0XF7,0XDF,0XF7,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XDE,0XD7,0X3C,0XBE,0XDB,0XCF,0X7E,0XCF,0X9E,
-0X9E,0X7A,0X86,0X5A,0X3D,0X58,0X5E,0X3C,0XD7,0XFF,0XE7,0XFF,0XA7,0X3E,0X54,0X95,
-0X85,0X39,0X7C,0XF9,0X33,0XD4,0X75,0XBA,0XDF,0XDF,0XE7,0X7D,0XFF,0XFF,0XEF,0X7F,
-0XF7,0XFF,0XEF,0XDF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFF,0XF7,0XFF,0XD7,0XDF,0X5C,0X93,
-0X6D,0X97,0X96,0X9B,0XA6,0XBC,0XCF,0X9F,0XCF,0X5E,0XAE,0X18,0XF7,0XFF,0XF7,0XFF,
-0XFF,0XDF,0XFF,0XFF,0XE7,0XFF,0X75,0X16,0X9D,0XF8,0XDF,0XFF,0X5C,0XD6,0XA7,0X1F,
-0XDF,0XFF,0X8D,0X77,0X95,0X97,0XDF,0XFF,0XCF,0XFF,0X5C,0X74,0XCE,0XFC,0XEF,0XDF,
-0XE7,0XFF,0XC6,0XDD,0XEF,0X3F,0XF7,0X9F,0XE7,0XFF,0X86,0X99,0X1C,0XD4,0X5E,0X7B,
-0XDF,0XFF,0XEF,0XFF,0XDF,0XBF,0XB6,0X3C,0XF7,0XBF,0XEF,0XFF,0XCF,0XFF,0X7E,0X1A,
-0X75,0XB8,0XC7,0XFF,0X86,0XFE,0X5D,0X16,0XEF,0XFF,0XDF,0XBF,0X54,0XF7,0X9F,0XBF,
-0XBF,0XFF,0XDF,0XFF,0XE7,0X7E,0XEF,0XFF,0XD7,0XFF,0X44,0X74,0XB7,0XBF,0X86,0X39,
-0X65,0X79,0X97,0X5F,0X7F,0X1F,0X3D,0X1A,0X65,0XBB,0X8E,0XFF,0X97,0XBF,0X55,0X98,
-0XC7,0X9F,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XF7,0XFF,0XF7,0XFF,0XE7,0XFF,
-0XB7,0XFF,0X3C,0X53,0XBF,0X7F,0XD7,0XFF,0X54,0X94,0X8E,0X9C,0XC7,0XFF,0X54,0X74,
-0XAE,0XFC,0XC7,0XBF,0X3B,0XF4,0XC7,0XDF,0XFF,0XFF,0XF7,0XFF,0X65,0X5A,0X6E,0X7E,
-0XC7,0XFF,0X7D,0XF9,0X96,0X18,0XE7,0XFF,0XDF,0XFF,0XDF,0XFF,0XC7,0XFF,0X65,0XB8,
-0X86,0X5A,0XD7,0XFF,0XEF,0XFF,0XE7,0XFF,0XD7,0XFF,0X3C,0X99,0X1C,0X9B,0X45,0XBF,
-0X76,0X7E,0X76,0X1B,0X76,0X7C,0X56,0X5B,0X04,0XD6,0X25,0X78,0XB7,0XBF,0XEF,0XFF,
-0XE7,0XFF,0X7E,0X38,0X14,0XD8,0X3D,0X9C,0XE7,0XFF,0XFF,0XFE,0XF7,0XFC,0XE7,0XFF,
-0XBF,0X9F,0X5C,0X38,0XCF,0X3F,0XEF,0XFF,0XF7,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,
-0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XDF,0XCF,0X1C,0XB6,0XBA,0XC7,0X5D,
-0XBF,0X5E,0X8E,0X18,0X75,0XB8,0X3D,0X38,0X55,0XBA,0XDF,0XFF,0XDF,0XFF,0X65,0X77,
-0X3C,0X33,0XB7,0X5F,0XCF,0XFF,0X76,0X3F,0X3C,0X55,0XE7,0XFF,0XF7,0XFF,0XEF,0XBF,
-0XF7,0XFF,0XDF,0XFF,0XCF,0X5F,0XEF,0XBF,0XFF,0XDE,0XFF,0XFF,0XF7,0XFF,0XDF,0XFF,
-0X54,0XB4,0X65,0X76,0X75,0XB7,0XA6,0XBC,0XC7,0X5E,0XCF,0X3D,0XB6,0X59,0XEF,0XFF,
-0XF7,0XFF,0XFF,0XDF,0XFF,0XFF,0XD7,0XFF,0X64,0XD4,0XBE,0X7A,0XE7,0XFF,0X5C,0XB6,
-0X9E,0XFF,0XD7,0XFF,0X8D,0X97,0X9D,0X97,0XE7,0XFF,0XD7,0XFF,0X64,0X95,0XBE,0X9A,
-0XEF,0XFE,0XEF,0XFF,0XEF,0XFF,0XFF,0XBF,0XEF,0X7F,0XDF,0XFF,0X55,0X55,0X2D,0X57,
-0X3D,0X57,0XCF,0XFF,0XE7,0XBF,0XDF,0X7F,0XEF,0XBF,0XFF,0XFF,0XE7,0XFE,0XD7,0XFF,
-0X7E,0X1A,0X75,0X99,0XC7,0XFF,0X97,0X5F,0X4C,0XB4,0XE7,0X9F,0XD7,0X3F,0X44,0X13,
-0XB7,0XFF,0XD7,0XFF,0XE7,0XFF,0XFF,0XFF,0XFF,0XFF,0XD7,0XFF,0X4C,0X32,0XAF,0X3D,
-0X8E,0X5A,0X65,0X38,0XB7,0XFF,0XB7,0XFF,0X3C,0XF8,0X86,0X9E,0XC7,0XFF,0X9F,0XDF,
-0X2C,0X12,0XC7,0X9F,0XEF,0XDF,0XFF,0XDF,0XFF,0XFF,0XF7,0XFF,0XEF,0XFF,0XEF,0XDF,
-0XE7,0XFF,0XBF,0XFF,0X3C,0X53,0XB7,0X3F,0XDF,0XFF,0X4C,0X32,0XB7,0X9F,0XCF,0XFF,
-0X4C,0X74,0XAE,0XFC,0XDF,0XFF,0X4C,0X56,0XAE,0XDF,0XF7,0XFF,0XF7,0XFF,0X65,0X39,
-0X66,0X1D,0XBF,0XFF,0X65,0X36,0X9D,0XB5,0XEF,0X9C,0XF7,0XFD,0XF7,0XFF,0XD7,0XFF,
-0X6D,0X37,0X95,0XD8,0XE7,0XFF,0XEF,0XFF,0XDF,0XFF,0XA7,0XDF,0X24,0X79,0X1C,0X9B,
-0X2C,0XDB,0X3C,0X97,0X4C,0XF6,0X44,0X73,0X34,0XF5,0X0D,0X16,0X1D,0X38,0X97,0X1F,
-0XD7,0XFF,0XD7,0XFF,0X86,0X9A,0X24,0XD8,0X4D,0X9C,0XEF,0XFF,0XFF,0XFF,0XFF,0XFD,
-0XDF,0X9D,0XC7,0X3F,0X5C,0X16,0XDF,0X9F,0XEF,0XFF,0XF7,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XBE,0XFF,0XFF,0XF7,0XFF,0XE7,0XDF,
-0XEF,0XFF,0XEF,0XFF,0XD7,0XDF,0XD7,0XFF,0X65,0XDB,0X6D,0XBB,0XE7,0XFF,0XD7,0XBF,
-0X6D,0XD8,0X3C,0XB4,0XA7,0X1F,0XCF,0XFF,0X6E,0X5F,0X34,0X76,0XD7,0XDF,0XE7,0XBE,
-0XC6,0XBB,0XE7,0XFF,0XAE,0XFF,0X64,0XD6,0XE7,0XFF,0XE7,0XFF,0XEF,0XFF,0XE7,0XFF,
-0XDF,0XFF,0X5C,0XF5,0XA7,0X3E,0XCF,0XFF,0XE7,0XFF,0XEF,0XFF,0XEF,0XFF,0XE7,0XDF,
-0XEF,0XFF,0XF7,0XFF,0XFF,0XFF,0XF7,0XFF,0XBF,0XBF,0X5C,0X94,0XD7,0X3D,0XF7,0XFF,
-0X64,0XF7,0X8E,0XDF,0XCF,0XFF,0X9E,0X59,0XB6,0X3A,0XE7,0XDF,0XD7,0XFF,0X64,0XD6,
-0XA6,0X58,0XEF,0XFF,0XE7,0XFF,0XEF,0XFF,0XF7,0XFF,0XEF,0XFF,0XA6,0XDB,0X4C,0XB4,
-0X7E,0XDE,0X4D,0X38,0X85,0XB9,0XE7,0XFF,0XEF,0XFF,0XEF,0XFF,0XDF,0XBD,0XE7,0XFF,
-0XD7,0XFF,0X7D,0XF9,0X7D,0X78,0XD7,0XFF,0X9F,0X9F,0X54,0XB5,0XF7,0XFF,0XF7,0XDF,
-0X4C,0X13,0XB7,0XDF,0XD7,0XFF,0XD7,0X9F,0XEF,0X3F,0XF7,0X7F,0XE7,0XFF,0X64,0XB4,
-0XBF,0X9F,0X8E,0X5B,0X75,0X9A,0XC7,0XFF,0X9F,0XFF,0X2C,0X96,0X86,0X5C,0XCF,0XFF,
-0XB7,0XFF,0X44,0XB5,0XCF,0XBF,0XEF,0XBF,0XF7,0XDF,0XEF,0XBF,0XC7,0X3D,0XE7,0XFF,
-0XEF,0XFF,0XE7,0XFF,0XBF,0XDF,0X44,0X54,0XC7,0X5F,0XCF,0X7E,0X5B,0XF1,0XCF,0XFF,
-0XC7,0XFF,0X44,0X32,0XB6,0XBA,0XEF,0XFF,0X75,0X18,0X95,0XDB,0XFF,0XDF,0XFF,0XFF,
-0X9E,0XBF,0X55,0X39,0X8F,0X1E,0X65,0X15,0XD7,0X3D,0XFF,0XDF,0XF7,0XBF,0XEF,0XFF,
-0XD7,0XFF,0X75,0X19,0X9D,0XB8,0XF7,0XFF,0XEF,0XFF,0XDF,0XFF,0X76,0X7F,0X2C,0XDA,
-0X55,0XDD,0X76,0X5D,0X86,0X3B,0X9E,0X7B,0X96,0X5A,0X86,0X3A,0X6E,0X7D,0X24,0X76,
-0X65,0X7A,0XCF,0XFF,0XD7,0XFF,0X96,0X7B,0X3C,0XD9,0X5D,0X7C,0XEF,0XBF,0XFF,0X7F,
-0XFF,0X9D,0XF7,0X9E,0XDF,0XDF,0X95,0XDC,0XDF,0XBF,0XEF,0XFF,0XF7,0XDF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XF7,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XBE,0XFF,0XFF,0XF7,0XFF,
-0XE7,0XBF,0XF7,0XFF,0XEF,0XFF,0XDF,0XBF,0XD7,0XFF,0X6D,0X9B,0X7D,0XDB,0XE7,0XDF,
-0XE7,0XFF,0XAF,0XFF,0X45,0X36,0X44,0X95,0X65,0XDC,0X24,0X99,0X76,0XBF,0XDF,0XFF,
-0XBE,0XBB,0X8D,0X77,0XBF,0X9F,0X9F,0X5F,0X3C,0X95,0XCF,0XFF,0XCF,0XDF,0XDF,0XFF,
-0XDF,0XFF,0XC7,0XFF,0X4C,0X74,0X96,0XFE,0XCF,0XFF,0XE7,0XFF,0XEF,0XDF,0XEF,0XDF,
-0XEF,0XFF,0XE7,0XFE,0XF7,0XFF,0XFF,0XFF,0XF7,0XFF,0XB7,0XBF,0X4C,0X94,0XDF,0X7E,
-0XE7,0XBF,0X5D,0X38,0X7E,0XFF,0XC7,0XFF,0XCF,0XFF,0XDF,0XDF,0XEF,0XFF,0XD7,0XFF,
-0X65,0X58,0X8E,0X17,0XE7,0XFF,0XDF,0XFF,0XE7,0XFF,0XCF,0XDF,0X9E,0X7A,0X54,0X73,
-0X86,0X1A,0XC7,0XFF,0X9E,0XBE,0X64,0XB6,0X9E,0X5B,0XCF,0XDF,0XDF,0XFF,0XD7,0XFF,
-0XD7,0XFF,0XD7,0XFF,0X85,0XB8,0X85,0X78,0XD7,0XFF,0X86,0XFE,0X44,0XB6,0XDF,0X9F,
-0XDF,0X9F,0X4C,0X55,0X9F,0X7F,0XCF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XDF,0XCF,0X9F,
-0X4C,0X32,0XA7,0X5F,0X75,0XD9,0X7D,0XFC,0XA7,0X9F,0X2C,0X96,0X3C,0XF7,0X9F,0X1F,
-0XCF,0XFF,0XB7,0XFF,0X54,0XD6,0XA6,0X5B,0XE7,0X9F,0XF7,0XDF,0XB6,0X59,0X75,0X15,
-0XCF,0XFF,0XEF,0XFF,0XE7,0XFF,0XB7,0X9F,0X4C,0X74,0XC7,0XBF,0XAE,0X7B,0X6C,0X93,
-0XDF,0XFF,0XB7,0XFF,0X44,0XB4,0XB6,0XDB,0XE7,0XFF,0X8D,0XDC,0X8D,0XBB,0XFF,0XFF,
-0XF7,0XFF,0XCF,0XFF,0X3C,0X77,0X44,0XF6,0X5D,0X56,0XDF,0XFF,0XF7,0XFF,0XF7,0XFF,
-0XE7,0XFF,0XD7,0XFF,0X6D,0X1A,0X9D,0X57,0XF7,0XFF,0XE7,0XDE,0XDF,0XFF,0X3D,0X3A,
-0X24,0XB9,0X96,0XFF,0XCF,0XFF,0XE7,0XFF,0XE7,0XDF,0XEF,0XFF,0XD7,0XFF,0XBF,0XBF,
-0X3C,0X37,0X44,0X57,0XC7,0XFF,0XDF,0XFF,0X86,0X19,0X34,0X77,0X5D,0X5B,0XE7,0XDF,
-0XFF,0XDF,0XFF,0XBF,0XFF,0XFF,0XC7,0XDF,0X9E,0XBE,0XC7,0X3E,0XEF,0XFF,0XF7,0XDF,
-0XF7,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XBE,
-0XD7,0X1C,0XC6,0XBB,0XCF,0X7E,0XCF,0X7E,0X9E,0X3A,0X85,0XDA,0X54,0XB8,0X7D,0X9C,
-0XE7,0XDF,0XE7,0XFF,0X97,0XDF,0X35,0X37,0X45,0X59,0X34,0XD9,0X1C,0XFB,0X6F,0X1F,
-0XBF,0XFF,0X74,0XF4,0X33,0X70,0X65,0XBA,0X77,0X1F,0X2C,0XD7,0X6D,0XDA,0X7D,0X99,
-0X9E,0X3D,0XDF,0XFF,0XC7,0XFF,0X4C,0XF7,0X55,0X57,0X75,0XF9,0XB6,0XFD,0XCF,0X1D,
-0XD7,0X1C,0XC6,0XDA,0XE7,0XDE,0XF7,0XFF,0XFF,0XFF,0XF7,0XFF,0XA7,0X9F,0X3C,0X95,
-0XDF,0XBF,0XD7,0X9F,0X55,0X5A,0X56,0X3D,0X97,0XBF,0XAF,0XBF,0XC7,0X3F,0XBE,0XFF,
-0XB7,0XDF,0X65,0XBB,0X7E,0X17,0XD7,0XFF,0XBF,0X5F,0XA6,0XFF,0X65,0XF9,0X4D,0X15,
-0X75,0X37,0XE7,0XDF,0XF7,0XFF,0XEF,0XBF,0X95,0XDA,0X54,0X94,0X65,0X76,0X86,0XBB,
-0XAF,0XBF,0XD7,0XFF,0XDF,0XFF,0XA6,0X1A,0X95,0XB8,0XCF,0XFF,0X77,0X1E,0X45,0XBA,
-0XA7,0X1F,0XA6,0XDF,0X45,0X18,0X77,0X1E,0X9F,0XFF,0XAF,0X9F,0XD7,0X9F,0XE7,0XFF,
-0X86,0X1A,0X44,0XB4,0X76,0XDD,0X76,0XDE,0X8F,0X7F,0X9F,0XFF,0X6E,0XFF,0X7F,0X1F,
-0X9E,0XFF,0XAF,0X1F,0XAF,0XDF,0X8E,0X9D,0XB6,0X9D,0XF7,0XFF,0XEF,0XFF,0XAE,0X19,
-0X5C,0X93,0XC7,0XDF,0XEF,0XFF,0XE7,0XFF,0XB7,0X9F,0X4C,0X75,0XBF,0XDF,0X85,0XD9,
-0X7D,0X99,0XCF,0XFF,0X87,0X9F,0X3D,0X17,0XAF,0X3E,0XCF,0XFF,0X86,0X3F,0X65,0X1A,
-0XE7,0XFF,0XCF,0X7F,0X8E,0XBF,0X34,0XDA,0X35,0X39,0X45,0X77,0X96,0XFD,0XCF,0XFF,
-0XDF,0XFF,0XB7,0X5F,0X9F,0X7F,0X5D,0X3C,0XA5,0XD9,0XF7,0XFF,0XEF,0XFF,0XC7,0XFF,
-0X2C,0XB8,0X2C,0XB9,0XC7,0XBF,0XF7,0XFF,0XFF,0XFF,0XFF,0XBF,0XF7,0XFF,0XEF,0XFF,
-0XDF,0XDF,0X6C,0XFB,0X3C,0X57,0X8F,0X1F,0XCF,0XFF,0X76,0X19,0X24,0X97,0X55,0X9C,
-0XD7,0XFF,0XF7,0XFF,0XF7,0X9F,0XEF,0XFF,0X5D,0XD8,0X3D,0X15,0X96,0X39,0XEF,0XDF,
-0XF7,0XFF,0XF7,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XEF,0XBE,0XDF,0X5D,0XC6,0XDB,0XCF,0X5E,0XC7,0X5E,0X96,0X19,0X85,0XFA,0X4C,0XD8,
-0X75,0XDC,0XEF,0XFF,0XDF,0XFF,0X4D,0X57,0X2D,0X16,0XB7,0XFF,0X87,0X7F,0X2D,0X9D,
-0X1C,0X98,0XAF,0X7F,0X85,0XB8,0X5D,0X17,0X86,0XFF,0X77,0X5F,0X24,0XB7,0X8E,0XFE,
-0X7D,0X99,0X64,0XD7,0XD7,0XFF,0XB7,0XDF,0X6D,0XBA,0X5D,0X78,0X7D,0XF9,0XAE,0XBC,
-0XDF,0X7E,0XDF,0X3C,0XB5,0XF6,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XDF,0X96,0XDD,
-0X3C,0X53,0XEF,0XFF,0XEF,0XFF,0X6D,0X9A,0X3C,0XF7,0X44,0XD5,0X4C,0X73,0X6C,0X53,
-0X6C,0X75,0X9E,0XBF,0X75,0XDB,0X7D,0XF7,0XC7,0XFF,0X85,0XB8,0X54,0X54,0X55,0X76,
-0X8E,0XFC,0XE7,0XFF,0XEF,0X9F,0XFF,0X7F,0XFF,0X9F,0XEF,0XFF,0XB7,0X5E,0X6D,0XB7,
-0X4C,0XD3,0X75,0X97,0XCF,0XFF,0XE7,0XFF,0XA5,0XB8,0X95,0X56,0XDF,0XFF,0X45,0X16,
-0X24,0X74,0X54,0XD8,0X54,0X76,0X34,0X75,0X45,0X36,0X45,0X15,0X4C,0X74,0X8D,0X78,
-0XDF,0XFF,0X64,0XD4,0X65,0X77,0X34,0X94,0X45,0X37,0X34,0X75,0X34,0X96,0X34,0XB6,
-0X3C,0X54,0X5C,0X74,0X64,0XB5,0X4C,0X54,0X54,0X75,0X9D,0X99,0XF7,0XFF,0XEF,0XDF,
-0XC6,0XFC,0X75,0X56,0XC7,0XFF,0XEF,0XFF,0XE7,0XFF,0XC7,0XBF,0X4C,0X54,0XBF,0XBF,
-0X6D,0X37,0X8D,0XFA,0XB7,0X7F,0X55,0X99,0X2C,0X54,0XB7,0X5F,0XDF,0XFF,0X9E,0XBF,
-0X4C,0X16,0XDF,0XFF,0XB6,0XBC,0X54,0X97,0X6E,0X1E,0X97,0XBF,0X5D,0XD9,0X4C,0XB4,
-0XB7,0X5E,0XCF,0XDF,0X64,0XF7,0X54,0XD9,0X4C,0X57,0XAE,0X3A,0XF7,0XFF,0XEF,0XFF,
-0XAE,0XFD,0X3C,0X97,0X54,0XF8,0XEF,0XFF,0XEF,0X7D,0XFF,0XBE,0XFF,0XDF,0XFF,0XDF,
-0XF7,0XFF,0XEF,0XDF,0XA6,0X3E,0X4C,0X56,0X65,0X58,0XD7,0XFF,0X8E,0X7A,0X34,0X75,
-0X65,0X7A,0XD7,0XFF,0XEF,0XFF,0XEF,0XBF,0XE7,0XFF,0X4D,0X55,0X3C,0XF4,0X7D,0X55,
-0XE7,0XBF,0XF7,0XFF,0XF7,0XDF,0XFF,0XFF,0XFF,0XDF,0XFF,0XBF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF7,0XDE,0XF7,0XFF,0XF7,0XFF,0XDF,0XBE,0XEF,0XFF,0XE7,0XFF,0XD7,0XDF,0XCF,0XFF,
-0X5E,0X3B,0X5D,0XBA,0XE7,0XFF,0XDF,0X7F,0X4C,0XB6,0X5E,0X5B,0XB7,0XFF,0XBF,0XFF,
-0X6E,0XDF,0X34,0X97,0X96,0X5C,0X9E,0X5D,0X3C,0X15,0XBF,0XFF,0X7F,0X5F,0X2C,0XB6,
-0XC7,0XFF,0X9E,0X7B,0X64,0XB5,0XCF,0XFF,0XBF,0XFF,0X5C,0XD7,0X9E,0X9E,0XDF,0XFF,
-0XE7,0XDF,0XFF,0XFF,0XFF,0XDE,0XE7,0X1B,0XFF,0XFE,0XFF,0XFF,0XF7,0XDE,0XF7,0XFF,
-0XCF,0X7E,0XC7,0X3C,0XE7,0XDF,0XE7,0XBF,0XE7,0XFF,0XAE,0X7B,0XB6,0XBB,0XCF,0X3D,
-0XC6,0X9C,0XCF,0X1D,0XCF,0X3E,0XD7,0XDF,0XB6,0XDB,0XE7,0XFF,0XBE,0XFB,0XCF,0X7E,
-0XE7,0XFF,0XE7,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XBF,0XF7,0XDF,0XEF,0XFF,
-0XDF,0XFF,0XCF,0X9E,0XBE,0XDB,0XE7,0XFF,0XF7,0XFF,0XDF,0X3D,0XE7,0X5D,0XE7,0XBF,
-0XB7,0X1D,0XA6,0XDC,0XBF,0X1E,0XB6,0XBD,0XAE,0XDC,0XAE,0XDC,0XB7,0X1C,0XBE,0XFB,
-0XD7,0X1D,0XE7,0X9E,0XD7,0X3C,0XDF,0XDF,0XBF,0X5D,0XAF,0X1D,0XAF,0X1E,0XA6,0XFE,
-0XAE,0XFD,0XAE,0XDD,0XBF,0X1E,0XBE,0XBC,0XB6,0X9C,0XBE,0XDD,0XD7,0X3E,0XF7,0XFF,
-0XEF,0XBF,0XBE,0X9A,0XCF,0X3C,0XEF,0XFF,0XF7,0XFF,0XEF,0XFF,0XDF,0XDF,0XB6,0X9B,
-0XDF,0XBF,0XBE,0XDC,0XC7,0X1D,0XDF,0XBF,0XBF,0X1E,0XBE,0XDC,0XE7,0XBF,0XF7,0XFF,
-0XDF,0X7F,0XBE,0X9B,0XEF,0XDF,0XE7,0XBF,0XCF,0X5E,0XDF,0XFF,0XD7,0XFF,0XE7,0XFF,
-0XCF,0X7E,0XD7,0X7F,0XE7,0XFF,0XBE,0XBC,0XAE,0X7C,0XBE,0XFE,0XE7,0XDF,0XF7,0XFF,
-0XF7,0XFF,0XC6,0XDB,0XAE,0X7B,0XD7,0XBF,0XF7,0XFF,0XF7,0XBE,0XFF,0XDF,0XFF,0XDF,
-0XF7,0XFF,0XF7,0XFF,0XF7,0XDF,0XDF,0X5E,0XBE,0XBC,0XCF,0X3D,0XE7,0XDF,0XD7,0X7D,
-0XB6,0XDB,0XC7,0X1D,0XEF,0XFF,0XE7,0XDF,0XF7,0XFF,0XE7,0XFF,0XC7,0X9E,0XAE,0XFB,
-0XCF,0X7D,0XE7,0XDF,0XF7,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XDF,0X9E,0XE7,0XFF,0XE7,0XFF,0XCF,0X9F,
-0XC7,0XFF,0X56,0X3A,0X5E,0X1A,0XEF,0XFF,0XE7,0X5F,0X5C,0X97,0X5D,0X78,0X9F,0X5D,
-0XAF,0XDF,0X5D,0XDA,0X54,0XF7,0XA6,0X7C,0XB6,0XBE,0X54,0X97,0XA7,0X7F,0X86,0XFF,
-0X3C,0X74,0XCF,0XFF,0X9E,0X19,0X64,0XB4,0XC7,0XFF,0XCF,0XFF,0X65,0X38,0X9E,0X9E,
-0XC7,0X5F,0XEF,0XFF,0XEF,0X9E,0XFF,0XDE,0XF7,0X7C,0XFF,0XBD,0XFF,0XFF,0XFF,0XFF,
-0XEF,0XDF,0XDF,0X7D,0XEF,0XFF,0XF7,0XFF,0XF7,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF7,0XFF,0XFF,0XFF,0XE7,0X7E,0XF7,0XFF,0XEF,0XFF,0XF7,0XFF,0XF7,0XFF,0XE7,0XFF,
-0XEF,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF7,0XFF,0XEF,0XFF,0XEF,0XFF,0XE7,0XBE,0XF7,0XFF,0XF7,0XDF,0XFF,0XFF,
-0XFF,0XFF,0XF7,0XFF,0XE7,0XDF,0XE7,0XFF,0XDF,0XBF,0XEF,0XFF,0XEF,0XFF,0XF7,0XFF,
-0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XDE,0XFF,0XFF,0XEF,0XFF,0XEF,0XFF,0XDF,0XFF,
-0XE7,0XFF,0XD7,0XFF,0XE7,0XFF,0XD7,0XBF,0XDF,0XBF,0XEF,0XFF,0XEF,0XFF,0XEF,0XFF,
-0XEF,0XFF,0XF7,0XFF,0XE7,0X9E,0XF7,0XFF,0XF7,0XFF,0XE7,0XBE,0XEF,0XFF,0XF7,0XFF,
-0XE7,0XDF,0XF7,0XFF,0XDF,0X7E,0XF7,0XFF,0XF7,0XFF,0XF7,0XFF,0XF7,0XDF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XEF,0X9E,0XFF,0XFF,0XF7,0XFF,0XF7,0XDF,0XF7,0XFF,0XEF,0XDF,
-0XF7,0XFF,0XE7,0XBF,0XEF,0XFF,0XEF,0XFF,0XE7,0XDF,0XEF,0XFF,0XEF,0XDF,0XF7,0XFF,
-0XF7,0XFF,0XF7,0XFF,0XFF,0XFF,0XEF,0XBE,0XF7,0XFF,0XF7,0XDF,0XEF,0XBF,0XF7,0XFF,
-0XF7,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XBE,0XF7,0XDF,0XFF,0XFF,
-0XF7,0XDE,0XE7,0X7D,0XF7,0XFF,0XF7,0XFF,0XEF,0XFF,0XEF,0XFF,0XD7,0X7D,0XEF,0XFF,
-0XE7,0XFF,0XEF,0XFF,0XF7,0XFF,0XF7,0XFF,0XF7,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,
-0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XBE,0XCE,0XDB,0XB6,0X38,0XBE,0X9A,0XAE,0X7A,
-0X7D,0X15,0X5C,0XD4,0X34,0XF5,0X55,0X98,0XEF,0XFF,0XFF,0XDF,0X9D,0XBB,0X6C,0XF6,
-0X5C,0XF3,0X4C,0X91,0X4C,0X73,0X85,0XD9,0XC7,0X5E,0XCF,0X9F,0X74,0XB6,0X7D,0X38,
-0X96,0X9C,0X7D,0X57,0XEF,0XFF,0XBE,0X7A,0X8D,0X57,0XC7,0XBF,0XCF,0XFF,0X44,0X54,
-0X5C,0XF7,0X5C,0XD5,0X9E,0X39,0XB6,0X9A,0XC6,0X99,0XC6,0X37,0XF7,0X9D,0XFF,0XBF,
-0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XEF,0XFF,0XD7,0X5D,0XF7,0XFF,0XEF,0XDF,0XEF,0XDF,
-0XF7,0XDF,0XEF,0X7E,0XFF,0XFF,0XEF,0XBF,0XF7,0XFF,0XF7,0XFF,0XEF,0XFF,0XDF,0X9E,
-0XD7,0XBE,0XEF,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,
-0XF7,0XFF,0XEF,0XBE,0XDF,0X7E,0XDF,0X9E,0XF7,0XFF,0XE7,0XDF,0XF7,0XFF,0XFF,0XFF,
-0XF7,0XBE,0XF7,0XBF,0XE7,0XBF,0XEF,0XFF,0XEF,0XFF,0XDF,0XBF,0XE7,0XFF,0XD7,0XBE,
-0XE7,0XDF,0XEF,0XFF,0XFF,0XFF,0XFF,0XDE,0XFF,0XFF,0XF7,0XFF,0XE7,0XDF,0XEF,0XFF,
-0XBF,0X5E,0XCF,0XFF,0XD7,0XFF,0XA6,0X9B,0XDF,0XFF,0XCF,0XBF,0XD7,0X7E,0XEF,0XFF,
-0XEF,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XF7,0XFF,0XF7,0XFF,
-0XEF,0XBF,0XCE,0XBB,0XE7,0XDF,0XEF,0XFF,0XF7,0XFF,0XF7,0XFF,0XF7,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF7,0XBE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XF7,0XFF,0XEF,0XFF,
-0XE7,0XBF,0XE7,0XFF,0XB6,0XBB,0XCF,0X9E,0XC7,0X1D,0XE7,0XFF,0XF7,0XFF,0XF7,0XFF,
-0XFF,0XFF,0XFF,0XDF,0XF7,0X7E,0XFF,0XFF,0XF7,0XFF,0XF7,0XFF,0XF7,0XFF,0XE7,0XFF,
-0XBE,0XDB,0XD7,0X7D,0XF7,0XFF,0XF7,0XDF,0XF7,0XFF,0XFF,0XFF,0XF7,0XDE,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XF7,0XFF,0XC7,0X1C,0XCF,0X5E,0XC7,0X7E,0XAE,0XBC,
-0XC7,0XDF,0XBF,0X5E,0XBE,0XFC,0XDF,0X9E,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XDF,0XE7,0X9E,0XD7,0X3C,0XE7,0XFF,
-0XE7,0XFF,0XC7,0X3D,0XAF,0X5E,0X55,0XD8,0X66,0X1A,0XEF,0XFF,0XFF,0XDF,0XEF,0X9F,
-0XCF,0X3F,0XAE,0XFB,0X9E,0XD9,0XBF,0X5E,0XD7,0XFF,0XE7,0XFF,0XEF,0XFF,0XD7,0X3F,
-0XD7,0X3F,0XEF,0XFF,0XCF,0X3D,0XEF,0XDF,0XDF,0X3D,0XCF,0X1D,0XDF,0XFF,0XD7,0XFF,
-0X54,0XD6,0X8E,0X9C,0XA7,0X3E,0XC7,0XBF,0XE7,0XFF,0XE7,0XBE,0XCE,0XDA,0XFF,0XFF,
-0XFF,0XFF,0XF7,0X7F,0XFF,0XFF,0XC6,0XBB,0XA6,0X18,0XA5,0XF8,0XC6,0XBA,0XF7,0XFF,
-0XF7,0XFF,0XF7,0XFF,0XFF,0XFF,0XF7,0XDF,0XF7,0XDF,0XF7,0XFF,0XF7,0XFF,0XAE,0X19,
-0XBE,0XDC,0XAE,0X5A,0XCF,0X5D,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XEF,0XBE,0XD7,0X1C,0XAE,0X18,0XAE,0X38,0XCF,0X1C,0XE7,0XBE,0XF7,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XEF,0XBF,0XF7,0XFF,0XD7,0X7E,0X8D,0X56,0X9E,0X38,
-0XA6,0X59,0XDF,0XBE,0XF7,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XEF,0XBF,
-0XDF,0XFF,0X95,0XF8,0X9E,0XBB,0X9E,0XDD,0X5C,0XB4,0XA6,0XDC,0XAE,0XBC,0X95,0X97,
-0XDF,0XBF,0XEF,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XBE,0XF7,0XBF,0XFF,0XFF,
-0XFF,0XFF,0XDF,0X3D,0XAD,0XD8,0XB6,0X5A,0XEF,0XFF,0XE7,0X9F,0XF7,0XFF,0XEF,0XBF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XDE,0XF7,0XDE,0XFF,0XFF,0XF7,0XFF,0XF7,0XFF,0XE7,0XBE,
-0XDF,0X9E,0XDF,0XDF,0XD7,0XBF,0X75,0X14,0XA6,0XBB,0X95,0XF8,0XCF,0X5D,0XEF,0XFF,
-0XF7,0XFF,0XFF,0XDF,0XFF,0XBF,0XFF,0XDF,0XFF,0XFF,0XF7,0XFF,0XEF,0XFF,0XEF,0XFF,
-0XDF,0XFF,0X85,0XD7,0XCF,0XDF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,
-0XF7,0XDE,0XF7,0XDF,0XF7,0XFF,0XE7,0XBE,0XDF,0XBF,0X9D,0XD8,0X9E,0X3A,0X7D,0X98,
-0X7D,0XD9,0X7D,0XFA,0X75,0X98,0X95,0XF8,0XC7,0X1B,0XEF,0XDF,0XF7,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0X9D,0XFF,0XFF,0XF7,0XFF,0XE7,0XBE,
-0XEF,0XFF,0XE7,0XFF,0XD7,0X9F,0XD7,0XFF,0X5E,0X19,0X66,0X1A,0XDF,0X9F,0XF7,0X7F,
-0XFF,0XDF,0XEF,0XFF,0XE7,0XFF,0XE7,0XFF,0XE7,0XFF,0XDF,0XFF,0XE7,0XFF,0XE7,0XFE,
-0XF7,0XDF,0XFF,0XFF,0XFF,0XFF,0XEF,0XBF,0XEF,0XDE,0XF7,0XFF,0XEF,0XFF,0XDF,0XFF,
-0XC7,0XFF,0X44,0X33,0X9E,0XDD,0XD7,0XFF,0XD7,0XFF,0XDF,0XFF,0XEF,0XFF,0XE7,0X9E,
-0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XD7,0X7F,0XD7,0X9F,0XDF,0XDF,0X84,0XD3,
-0XEF,0XDF,0XFF,0XFF,0XF7,0XDF,0XF7,0XDF,0XF7,0XBE,0XFF,0XFF,0XF7,0XFF,0XEF,0XFF,
-0X8D,0X35,0XCF,0X5E,0XA6,0X5A,0XB6,0X9B,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XE7,0XBF,0XCF,0X1C,0XD7,0X9E,0XB6,0X9A,0X9D,0XB7,0XE7,0XDF,
-0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X9F,0XF7,0XFF,0XDF,0X9F,0X9E,0X18,
-0XCF,0XDF,0XD7,0XFF,0XE7,0XFF,0XE7,0XBE,0XEF,0X9E,0XEF,0X3C,0XFF,0XDF,0XFF,0XDF,
-0XF7,0XFF,0XEF,0XFF,0X96,0X19,0XA7,0X3D,0X86,0X5B,0X9E,0XFD,0X75,0X97,0XAE,0XFD,
-0XBF,0X1D,0XE7,0XFF,0XF7,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF7,0XDF,0XEF,0XBF,0XE7,0X7F,0X8D,0X15,0XCF,0X3D,0XEF,0XFF,0XF7,0XFF,
-0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,
-0XB6,0X7A,0X9D,0XF8,0XAE,0X7A,0X95,0XF8,0X5C,0XF3,0XA7,0X3C,0XA6,0X9A,0XCF,0X9E,
-0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0X9E,0XFF,0XFF,0XCF,0X1C,
-0XBF,0X3C,0XB7,0X5D,0X5C,0XF3,0XBF,0XDF,0XC6,0XFB,0XDF,0X1C,0XE7,0X9D,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XF7,0XFF,0XE7,0XDF,0XEF,0XFF,0XBF,0X5E,0XA6,0XFE,
-0X6D,0X58,0X8E,0XBE,0X76,0X3D,0X86,0X7D,0XBF,0X3D,0XDF,0XBE,0XE7,0XDF,0XEF,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XEF,0XBE,
-0XDF,0X7D,0XEF,0XFF,0XEF,0XFF,0XD7,0X5E,0XC7,0X9F,0X55,0X76,0X6E,0X1A,0XEF,0XFF,
-0XFF,0XDF,0XFF,0XDF,0XF7,0XDF,0XE7,0XFF,0XE7,0XFF,0XDF,0XFF,0XE7,0XFF,0XEF,0XFF,
-0XEF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XF7,0XDF,0XF7,0XFF,0XEF,0XFF,
-0XDF,0XFF,0XD7,0XFF,0X65,0X16,0X8E,0X7B,0XB7,0X7F,0XCF,0XFF,0XDF,0XFF,0XE7,0XFF,
-0XD7,0X3C,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XDF,0XE7,0XFF,0XE7,0XFF,0XE7,0XFF,
-0X74,0X72,0XEF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,
-0XD7,0X5D,0X9D,0X97,0XE7,0XFF,0XBF,0X3E,0X9D,0XF9,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XE7,0XDF,0XEF,0XFF,0XC7,0X3C,0X9D,0XD7,
-0XF7,0XFF,0XF7,0XFF,0XF7,0XBF,0XFF,0XDF,0XFF,0XBF,0XFF,0XDF,0XF7,0XFF,0XC6,0XDC,
-0X7D,0X14,0X9E,0X7A,0X9E,0X59,0XE7,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,
-0XFF,0XBF,0XEF,0X9F,0XD7,0X7E,0X6D,0X14,0X86,0X39,0X65,0X98,0X86,0X9C,0X6D,0X77,
-0X85,0XF9,0X95,0XF8,0XCF,0X5D,0XE7,0XDF,0XE7,0X9D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF7,0XDF,0XF7,0XDF,0XF7,0XFF,0XE7,0XBF,0X85,0X15,0X8D,0X36,0XEF,0XFF,
-0XDF,0X7E,0XFF,0XFF,0XFF,0XFF,0XF7,0X9D,0XFF,0XFF,0XFF,0XFF,0XF7,0X9D,0XFF,0XFF,
-0XF7,0XFF,0XCF,0X1D,0XB6,0XBB,0XBF,0X3E,0XBF,0X7F,0X75,0XD8,0XB7,0XFF,0XC7,0XFF,
-0XE7,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XBE,0XFF,0X9E,0XFF,0X7D,0XFF,0XFF,
-0XBE,0XBA,0XB6,0XFB,0XA6,0XFC,0X54,0XF4,0X7E,0X18,0XAE,0X79,0XCE,0XDB,0XDF,0X3C,
-0XEF,0X9E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XE7,0XFF,0XE7,0XFF,0XB6,0XFD,
-0X86,0X1A,0X54,0XF7,0X7E,0X9E,0X65,0XFC,0X65,0XDA,0XAE,0XDC,0XD7,0XBE,0XEF,0XFF,
-0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0X9D,
-0XCE,0XBA,0XB6,0X18,0XC6,0XBB,0XBE,0X9A,0X8C,0XF4,0X6C,0X92,0X4C,0XF4,0X6D,0X77,
-0XEF,0XDF,0XF7,0X5F,0XF7,0XFF,0XEF,0XDF,0XF7,0XFF,0XF7,0XFF,0XE7,0XFF,0XE7,0XFF,
-0XE7,0XFE,0XF7,0XDD,0XFF,0XFF,0XFF,0XFF,0XFF,0XDE,0XF7,0XBE,0XFF,0XFF,0XFF,0XFF,
-0XE7,0XDF,0XD7,0XFF,0XCF,0XFF,0X4C,0X94,0X4C,0XB3,0X5D,0X15,0X86,0X18,0XB7,0X3C,
-0XB6,0XBA,0XAD,0XF7,0XF7,0XBF,0XFF,0XDF,0XFF,0X7F,0XFF,0XFF,0XEF,0XFF,0XD7,0XDF,
-0XB6,0X9B,0XAE,0X19,0XEF,0XFF,0XF7,0XDF,0XF7,0XBE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF7,0XFF,0XCF,0X1C,0X9D,0XD8,0XE7,0XFF,0XC7,0X7F,0X95,0XD8,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XF7,0XFF,0XEF,0XFF,0XBF,0X1C,0XA6,0X18,
-0XBE,0XDB,0XEF,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,
-0XEF,0XFF,0XBF,0X1C,0XBF,0X7D,0X85,0X96,0XCF,0XBE,0XEF,0XFF,0XFF,0XDF,0XFF,0XBF,
-0XFF,0XBF,0XFF,0X9F,0XFF,0XFF,0XE7,0XFF,0X96,0X18,0XAF,0X5E,0X76,0X1A,0X86,0X5B,
-0XAF,0X7F,0X85,0XD8,0X95,0XD8,0XDF,0XDF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDE,
-0XFF,0XFF,0XFF,0XFF,0XF7,0XDF,0XF7,0XFF,0XE7,0X7F,0XA5,0XF9,0XBE,0XDC,0X9D,0XB8,
-0XD7,0X7F,0XE7,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XE7,0XBF,0XC7,0X1D,0X9E,0X19,0X7D,0X57,0XA6,0XBC,0X96,0XBB,0XB7,0X9E,
-0XD7,0XFF,0XE7,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X9E,0XFF,0XDE,0XFF,0XDE,
-0XFF,0XFF,0XDF,0X9E,0XDF,0XFF,0XA7,0X1D,0X86,0X7A,0X6D,0X76,0XD7,0XBF,0XF7,0XFF,
-0XF7,0XFF,0XEF,0XDF,0XFF,0XFF,0XFF,0XFF,0XF7,0XDE,0XFF,0XFF,0XF7,0XFF,0XDF,0XDF,
-0XA6,0X9B,0X75,0X57,0X75,0XDA,0X7E,0X5D,0X76,0X7E,0X55,0X38,0X85,0X97,0XC7,0X1C,
-0XEF,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,
-0XFF,0XFF,0XF7,0XDF,0XE7,0X7E,0XF7,0XFF,0XF7,0XFF,0XD7,0X5D,0XCF,0X9F,0X65,0X77,
-0X75,0XD9,0XEF,0XFF,0XE7,0XBF,0XE7,0XFF,0XDF,0XFF,0XEF,0XFF,0XE7,0XFF,0XD7,0XFF,
-0XDF,0XFF,0XE7,0XFF,0XF7,0XFF,0XEF,0XBF,0XEF,0XFF,0XE7,0XFF,0XE7,0XFF,0XE7,0XDF,
-0XEF,0XFF,0XE7,0XFF,0XDF,0XFF,0XCF,0XFF,0X5C,0XF5,0X86,0X5A,0XC7,0XFF,0XCF,0XFF,
-0XDF,0XFF,0XEF,0XFF,0XDF,0X5D,0XF7,0XDF,0XFF,0XFF,0XFF,0XDF,0XF7,0X9F,0XE7,0XFF,
-0XC7,0X5F,0X85,0X36,0XE7,0XDF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDE,0XFF,0XDE,
-0XFF,0XFF,0XF7,0XFF,0XDF,0X7E,0X95,0X77,0XE7,0XFF,0XBF,0X3F,0X9D,0XFA,0XF7,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XEF,0XFF,0XEF,0XFF,0XAE,0X9A,
-0X9E,0X17,0XEF,0XFF,0XE7,0XFF,0XF7,0XFF,0XF7,0XBF,0XFF,0XDF,0XFF,0X9F,0XFF,0XDF,
-0XEF,0X5E,0XEF,0XFF,0XE7,0XFF,0XD7,0XFF,0X7D,0X75,0XC7,0X7D,0XEF,0XFF,0XFF,0XDF,
-0XFF,0XDF,0XFF,0XBF,0XFF,0XDF,0XFF,0XFF,0XDF,0X9E,0X85,0XD7,0X9E,0XDC,0X6D,0X78,
-0XAF,0X7F,0XBF,0X9F,0X7D,0X57,0XDF,0XDF,0XEF,0XFF,0XEF,0XBE,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XDE,0XFF,0XFF,0XFF,0XFF,0XE7,0X7E,0XF7,0XFF,0XDF,0X9F,0X8D,0X56,0XE7,0XFF,
-0XC7,0X1D,0X95,0X56,0XF7,0XFF,0XEF,0XBF,0XF7,0XBE,0XFF,0XFF,0XFF,0XDE,0XFF,0XFE,
-0XFF,0XFF,0XF7,0XFF,0XE7,0XBF,0XEF,0XFF,0XC7,0X5F,0X8D,0XD9,0XDF,0XFF,0XAE,0XFD,
-0XA6,0XBB,0XD7,0XBF,0XDF,0XBF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XDE,
-0XFF,0XDE,0XEF,0XBE,0XEF,0XFF,0XDF,0XFF,0X85,0XB8,0XB7,0X7F,0X96,0X5A,0XB6,0XBC,
-0XE7,0XBF,0XEF,0XFF,0XEF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,
-0XDF,0X9E,0XB6,0XBB,0X7D,0X77,0X9E,0XDD,0X75,0XDA,0X97,0X3F,0X6D,0X99,0XA6,0X7A,
-0XD7,0X7D,0XEF,0XFF,0XEF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XF7,0XFF,0XE7,0XFF,
-0X86,0X7D,0X4D,0X19,0X75,0X7C,0X7D,0XDD,0X6E,0X1C,0X66,0X1C,0X7E,0X3D,0X7E,0X1D,
-0X6E,0X3C,0X6E,0X1C,0X86,0X1D,0X7D,0XBC,0X8D,0XFD,0X75,0XBB,0X6E,0X1C,0X6E,0X5C,
-0X6D,0XD8,0X8E,0X5A,0X7D,0XB8,0X7D,0XB8,0X6C,0XF6,0X6C,0XD5,0XCF,0X5F,0XEF,0XFF,
-0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XF7,0XFF,
-0XB6,0XBC,0X8D,0X77,0X9D,0XB8,0XBE,0X7B,0XEF,0XBF,0XFF,0XFF,0XFF,0XDE,0XFF,0XFF,
-0XF7,0XBE,0XFF,0XFF,0XEF,0X9E,0XF7,0XFF,0X9D,0XB8,0XA6,0X1A,0X95,0XD9,0XCF,0X5E,
-0XFF,0XFF,0XFF,0XBF,0XFF,0XFF,0XFF,0XFF,0XF7,0XBF,0XF7,0XFF,0XE7,0XBE,0XA6,0X17,
-0X85,0X34,0X9D,0XF7,0XC6,0XFB,0XE7,0XBE,0XF7,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,
-0XFF,0X9F,0XF7,0XBF,0XC6,0XBB,0XAE,0X7A,0X9E,0X38,0X9E,0X59,0XD7,0X9E,0XEF,0XFF,
-0XFF,0XFF,0XFF,0XDF,0XFF,0XBF,0XFF,0XBF,0XFF,0XDF,0XEF,0XFF,0X95,0XF7,0X96,0X5A,
-0X7D,0X98,0XAE,0XDE,0X9E,0X1B,0XAE,0X7C,0X9D,0X97,0XF7,0XFF,0XF7,0XFF,0XFF,0XFF,
-0XFF,0XFE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XB6,0X79,0XA6,0X18,0XC7,0X3D,
-0XE7,0XFF,0XE7,0XFF,0XB6,0X5A,0XA5,0X96,0XE7,0X5D,0XFF,0XFF,0XFF,0XBD,0XFF,0XFE,
-0XFF,0XFE,0XFF,0XDE,0XFF,0XFF,0XF7,0XFF,0XCF,0X5E,0X9E,0X19,0X8D,0X98,0X95,0XF9,
-0XCF,0X7F,0X95,0X77,0XCF,0X3D,0XA5,0XD7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,
-0XF7,0XBD,0XFF,0XFF,0XFF,0XFF,0XC6,0X9A,0XA5,0XF8,0XB6,0XBC,0XD7,0XDF,0XDF,0XFF,
-0X95,0X98,0XAE,0X3A,0XD7,0X5E,0XF7,0XFF,0XFF,0XFF,0XF7,0XDE,0XFF,0XDE,0XFF,0XFF,
-0XF7,0XFE,0XEF,0XFF,0XEF,0XFF,0X9E,0X18,0XAE,0XDC,0X8E,0X3A,0X9E,0XFD,0X7D,0XB8,
-0XC7,0X3D,0XE7,0XDF,0XF7,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XEF,0XFF,0XC7,0XFF,0X86,0X5E,0X7D,0XDD,0X4C,0XD8,0X55,0XB9,0X66,0X5C,0X6E,0X1C,
-0X3C,0X76,0X65,0XBB,0X75,0XFC,0X6D,0X9C,0X44,0X16,0X7D,0XBD,0X75,0XDC,0X3D,0X5A,
-0X45,0XB9,0X6E,0X3A,0X76,0X19,0X4C,0X94,0X75,0X78,0X96,0X1A,0XAE,0X5B,0XEF,0XDF,
-0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XF7,0XFE,
-0XF7,0XFF,0XCF,0X3D,0XAE,0X5A,0XB6,0X7B,0XCE,0XDC,0XE7,0X9E,0XFF,0XFF,0XEF,0X9D,
-0XFF,0XDE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XCF,0X1D,0XC6,0XFD,0XBE,0XFE,
-0XDF,0XDF,0XFF,0XFF,0XFF,0XDE,0XFF,0XFF,0XFF,0XFF,0XF7,0XBF,0XF7,0XFF,0XEF,0XFF,
-0XBE,0XBA,0XB6,0X99,0XBE,0XFB,0XD7,0X7D,0XE7,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XDF,0X3D,0XCF,0X1C,0XBF,0X1C,0XBF,0X1C,0XE7,0XFF,
-0XF7,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0X9F,0XFF,0XDF,0XF7,0XFF,0XAE,0X59,
-0XB6,0XFC,0X9E,0X3B,0XBE,0XFE,0XB6,0X7C,0XC6,0XFD,0XBE,0X3A,0XEF,0XBF,0XEF,0X9E,
-0XFF,0XDE,0XFF,0XFF,0XFF,0XFE,0XFF,0XFF,0XF7,0XFF,0XE7,0XBE,0XC6,0XFB,0XC6,0XFC,
-0XDF,0XFF,0XE7,0XFF,0XEF,0XFF,0XCF,0X1D,0XC6,0X9A,0XEF,0X9E,0XFF,0XFF,0XFF,0XBE,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE7,0X9E,0XBE,0XBB,0XA6,0X3A,0XBF,0X1E,
-0XE7,0XFF,0XE7,0X9F,0XB5,0XF9,0XC6,0X7B,0XBE,0X19,0XFF,0XFF,0XFF,0XFF,0XF7,0XFE,
-0XF7,0X9D,0XFF,0XFE,0XFF,0XFF,0XEF,0XBE,0XCE,0XDB,0XCE,0XBC,0XDF,0X9F,0XEF,0XFF,
-0XE7,0XDF,0XC7,0X1E,0XC6,0XFD,0XD7,0X1D,0XEF,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,
-0XFF,0XFE,0XFF,0XDE,0XF7,0XDE,0XCE,0XBA,0XB6,0X58,0XAE,0X59,0XCF,0X9E,0XC7,0X7E,
-0XB6,0XFC,0XBE,0XDB,0XDF,0X7D,0XEF,0XDF,0XF7,0XDF,0XF7,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XEF,0XFF,0XD7,0XFF,0X75,0X76,0X9E,0XFB,0XCF,0XFF,
-0XC7,0XFF,0X54,0X94,0XDF,0XFF,0XE7,0XFF,0XB7,0X5F,0X64,0XB6,0XE7,0XFF,0XE7,0XFF,
-0X7E,0XBC,0X76,0XBC,0XCF,0XFF,0XC7,0XFF,0X7D,0X98,0XAE,0XFE,0XD7,0XFF,0XE7,0XFF,
-0XEF,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFE,
-0XFF,0XFE,0XFF,0XFF,0XF7,0XFF,0XE7,0XBF,0XEF,0XFF,0XEF,0XDF,0XF7,0XFF,0XFF,0XFF,
-0XFF,0XFE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFF,0XF7,0XFF,0XF7,0XFF,0XDF,0X9F,
-0XE7,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XDE,0XFF,0XFF,0XFF,0XFF,0XF7,0XBF,0XF7,0XDF,
-0XF7,0XFF,0XE7,0X9E,0XE7,0XDF,0XE7,0XDE,0XE7,0XDF,0XEF,0XFF,0XF7,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XBF,0XFF,0XFF,0XFF,0XFF,0XEF,0XBF,0XE7,0XDF,0XE7,0XFF,0XE7,0XDF,
-0XF7,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XBF,0XFF,0XFF,0XF7,0XFF,
-0XCF,0X3D,0XDF,0XDF,0XD7,0X9F,0XE7,0XBF,0XDF,0X7F,0XF7,0XFF,0XEF,0X9F,0XFF,0XFF,
-0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDE,0XFF,0XFF,0XF7,0XFF,0XE7,0XDE,0XD7,0X9D,
-0XDF,0XFF,0XEF,0XFF,0XEF,0XFF,0XF7,0XFF,0XEF,0XFF,0XE7,0X9E,0XF7,0XDF,0XFF,0XFF,
-0XFF,0XDE,0XFF,0XDE,0XFF,0XBE,0XFF,0XDF,0XFF,0XFF,0XF7,0XFF,0XEF,0XFF,0XDF,0XDF,
-0XDF,0XDF,0XE7,0XFF,0XFF,0XDF,0XEF,0X5F,0XEF,0X3E,0XF7,0XBF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XEF,0XBE,0XE7,0X5D,0XEF,0X9F,0XFF,0XFF,
-0XFF,0XFF,0XF7,0XDF,0XF7,0XFF,0XDF,0XBF,0XDF,0X5E,0XE7,0XBF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFE,0XFF,0XDD,0XFF,0XFE,0XE7,0X7C,0XF7,0XFF,0XD7,0X1B,0XF7,0XFF,
-0XE7,0XFF,0XEF,0XFF,0XDF,0X7E,0XEF,0XBF,0XF7,0XFF,0XF7,0XDF,0XFF,0XDF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X5D,0XF7,0XBF,0XEF,0XFF,0X8D,0XD6,0XBF,0X3A,
-0XDF,0XFF,0XCF,0XFF,0X64,0X72,0XF7,0XFF,0XF7,0XDF,0XCF,0XBF,0X6C,0XB4,0XF7,0XBF,
-0XF7,0XFF,0X8E,0X9A,0X86,0XDB,0XCF,0XFF,0XD7,0XFF,0X85,0XB8,0XC7,0X5E,0XE7,0XFF,
-0XEF,0XFF,0XE7,0XDF,0XEF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,
-0XFF,0XFE,0XFF,0XFE,0XFF,0XFE,0XF7,0XFF,0XF7,0XFF,0XF7,0XFF,0XF7,0XFF,0XF7,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XBE,0XFF,0XFF,0XF7,0XDF,0XF7,0XFF,
-0XE7,0XBF,0XEF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XDE,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,
-0XFF,0XDF,0XFF,0XFF,0XF7,0XFF,0XF7,0XFF,0XEF,0XFF,0XEF,0XFF,0XEF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XF7,0XFF,0XF7,0XFF,
-0XF7,0XFF,0XF7,0XFF,0XF7,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,
-0XFF,0XFF,0XEF,0XDF,0XF7,0XFF,0XF7,0XFF,0XEF,0XDF,0XF7,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XF7,0XBF,0XF7,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDE,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,
-0XEF,0XFF,0XEF,0XFF,0XEF,0XFF,0XEF,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XDE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XF7,0XFF,
-0XF7,0XFF,0XEF,0XFF,0XEF,0XDF,0XF7,0XBF,0XFF,0XDF,0XF7,0X9F,0XFF,0XFF,0XFF,0XDF,
-0XF7,0XBE,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,
-0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XF7,0XFF,0XEF,0XFF,0XEF,0XFF,0XF7,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X9D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,
-0XF7,0XFF,0XEF,0XDE,0XEF,0XDE,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XDE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0X9E,0XF7,0XFF,0XB6,0XB9,
-0XE7,0XFD,0XE7,0XFE,0XDF,0XFF,0XB6,0X9A,0XF7,0X9D,0XF7,0X9E,0XE7,0XFF,0XA6,0X19,
-0XFF,0XBF,0XF7,0XBF,0XB7,0X3C,0XBF,0XFF,0XD7,0XFF,0XDF,0XFF,0X9E,0X39,0XDF,0XFF,
-0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFF,0XF7,0XDE,0XFF,0XFF,0XFF,0XFF,0XFF,0XDE,
-0XF7,0XDE,0XFF,0XFE,0XFF,0XFF,0XFF,0XDE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF7,0XFF,0XF7,0XFF,0XF7,0XFF,0XFF,0XFF,0XF7,0XFE,0XFF,0XFE,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XF7,0XFF,0XF7,0XFF,
-0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XF7,0XFE,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDE,
-0XFF,0XFF,0XFF,0XFF,0XF7,0XDF,0XFF,0XFF,0XF7,0XDF,0XF7,0XDF,0XFF,0XFF,0XFF,0XDF,
-0XFF,0XFF,0XF7,0XBF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XF7,0XFF,0XF7,0XFF,0XF7,0XFF,0XEF,0XDE,0XF7,0XFF,0XF7,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XF7,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XDF,
-0XEF,0X9E,0XEF,0XDE,0XF7,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XF7,0X7E,0XFF,0XDF,
-0XFF,0XFF,0XF7,0XBE,0XFF,0XFF,0XF7,0XBE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XBE,0XFF,0XBF,0XFF,0XFF,0XF7,0XDF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XBE,0XFF,0XBE,0XF7,0X9D,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XDE,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,
-0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XBE,0XEF,0XFF,
-0XAE,0X58,0XE7,0XBC,0XF7,0XFF,0XEF,0XFF,0XC6,0X9B,0XFF,0XFF,0XEF,0X9D,0XE7,0XFF,
-0XB6,0XBB,0XFF,0XFF,0XFF,0XBF,0XC7,0X5C,0XBF,0X9D,0XDF,0XFF,0XE7,0XFF,0XAE,0X38,
-0XE7,0X9E,0XF7,0XFF,0XF7,0XDF,0XFF,0XBF,0XF7,0X9E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFE,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFE,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XBF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFF,
-0XF7,0XFE,0XFF,0XFF,0XFF,0XDE,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XBF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF7,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,
-0XFF,0XBF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XBF,0XFF,0XFF,
-0XEF,0XFF,0XA6,0X39,0XCF,0X3C,0XF7,0XFF,0XE7,0X5F,0X9D,0X37,0XF7,0XFF,0XDF,0XDE,
-0XBF,0X5E,0X9E,0X3A,0XF7,0XBF,0XFF,0XBF,0XC6,0XDB,0XAE,0X79,0XEF,0XDF,0XF7,0X9E,
-0XC6,0X38,0XEF,0X7C,0XFF,0XFE,0XFF,0XFE,0XFF,0XFF,0XF7,0XFF,0XF7,0XFF,0XF7,0XFF,
-0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDE,0XFF,0XFE,
-0XFF,0XBD,0XFF,0XFE,0XFF,0XFF,0XF7,0XDE,0XFF,0XFF,0XFF,0XDE,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFE,
-0XFF,0XFE,0XFF,0XFE,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFE,0XF7,0XFE,
-0XFF,0XFF,0XFF,0XDF,0XFF,0XBF,0XFF,0XBF,0XFF,0XBF,0XFF,0XDF,0XFF,0XFF,0XF7,0XFE,
-0XF7,0XFF,0XF7,0XFE,0XFF,0XFF,0XFF,0XDE,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XDE,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF7,0X9E,0XF7,0XBE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFE,0XEF,0XDD,0XF7,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X7E,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,
-0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFE,0XFF,0XFE,0XFF,0XFE,0XFF,0XFF,
-0XFF,0XFE,0XFF,0XFE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XBF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XBE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF7,0XFF,0XE7,0XDF,0XBE,0XDC,0XDF,0X9E,0XF7,0XFF,0XEF,0X5F,0XD6,0X9D,0XE7,0XBE,
-0XEF,0XFF,0XCF,0XBF,0XB6,0X7B,0XFF,0XFF,0XFF,0XDF,0XD7,0X3C,0XDF,0X5D,0XFF,0XFF,
-0XFF,0XBE,0XDE,0X99,0XEF,0X5C,0XFF,0XDE,0XEF,0XBD,0XFF,0XFF,0XEF,0XDD,0XF7,0XFF,
-0XF7,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDE,
-0XFF,0XFE,0XFF,0XBD,0XFF,0XFF,0XFF,0XFF,0XF7,0XBE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF7,0XDE,0XFF,0XFF,0XFF,0XDE,0XFF,0XFF,0XFF,0XDE,0XF7,0XFE,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XDE,0XFF,0XDF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,
-0XF7,0XFE,0XFF,0XFF,0XFF,0XDF,0XFF,0XBF,0XFF,0XDF,0XFF,0X9F,0XFF,0XFF,0XFF,0XFF,
-0XF7,0XFE,0XF7,0XFF,0XF7,0XFE,0XFF,0XFF,0XFF,0XDE,0XFF,0XDF,0XFF,0XBF,0XFF,0XFF,
-0XFF,0XFF,0XF7,0XDE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XFF,0XDF,0XFF,0X9E,0XFF,0XFF,0XFF,0XDE,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XBE,0XFF,0XBD,0XFF,0XFE,0XFF,0XFF,
-0XF7,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XBF,0XFF,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFE,0XFF,0XFE,0XFF,0XFE,0XFF,0XDD,
-0XFF,0XFE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF7,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,
-0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XF7,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF7,0XFF,0XF7,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,};
+const unsigned char img_light_on[611] = {
+ //64x64 RLE
+ 0x52, 0x4C, 0x45, 0x31, 0x00, 0x40, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF,
+ 0xFF, 0x81, 0x53, 0x9D, 0xBD, 0xFF, 0xFF, 0x81, 0x53, 0x9D, 0xBD, 0xFF, 0xFF, 0x81, 0x53, 0x9D,
+ 0xBD, 0xFF, 0xFF, 0x81, 0x53, 0x9D, 0xBD, 0xFF, 0xFF, 0x81, 0x53, 0x9D, 0xBD, 0xFF, 0xFF, 0x81,
+ 0x53, 0x9D, 0xBD, 0xFF, 0xFF, 0x81, 0x53, 0x9D, 0xBD, 0xFF, 0xFF, 0x81, 0x53, 0x9D, 0xBD, 0xFF,
+ 0xFF, 0x81, 0x53, 0x9D, 0xB9, 0xFF, 0xFF, 0x00, 0x53, 0xBD, 0x87, 0x53, 0x9D, 0x00, 0x53, 0xBD,
+ 0xB1, 0xFF, 0xFF, 0x91, 0x53, 0x9D, 0xAB, 0xFF, 0xFF, 0x89, 0x53, 0x9D, 0x81, 0x53, 0xBD, 0x89,
+ 0x53, 0x9D, 0xA7, 0xFF, 0xFF, 0x86, 0x53, 0x9D, 0x8B, 0xFF, 0xFF, 0x00, 0x53, 0xBD, 0x85, 0x53,
+ 0x9D, 0xA3, 0xFF, 0xFF, 0x84, 0x53, 0x9D, 0x93, 0xFF, 0xFF, 0x84, 0x53, 0x9D, 0xA0, 0xFF, 0xFF,
+ 0x83, 0x53, 0x9D, 0x97, 0xFF, 0xFF, 0x83, 0x53, 0x9D, 0x9E, 0xFF, 0xFF, 0x82, 0x53, 0x9D, 0x9B,
+ 0xFF, 0xFF, 0x83, 0x53, 0x9D, 0x9A, 0xFF, 0xFF, 0x83, 0x53, 0x9D, 0x9D, 0xFF, 0xFF, 0x83, 0x53,
+ 0x9D, 0x98, 0xFF, 0xFF, 0x83, 0x53, 0x9D, 0x9F, 0xFF, 0xFF, 0x83, 0x53, 0x9D, 0x96, 0xFF, 0xFF,
+ 0x83, 0x53, 0x9D, 0xA1, 0xFF, 0xFF, 0x83, 0x53, 0x9D, 0x95, 0xFF, 0xFF, 0x82, 0x53, 0x9D, 0xA3,
+ 0xFF, 0xFF, 0x82, 0x53, 0x9D, 0x94, 0xFF, 0xFF, 0x82, 0x53, 0x9D, 0xA5, 0xFF, 0xFF, 0x82, 0x53,
+ 0x9D, 0x92, 0xFF, 0xFF, 0x82, 0x53, 0x9D, 0xA7, 0xFF, 0xFF, 0x82, 0x53, 0x9D, 0x91, 0xFF, 0xFF,
+ 0x81, 0x53, 0x9D, 0xA9, 0xFF, 0xFF, 0x81, 0x53, 0x9D, 0x90, 0xFF, 0xFF, 0x82, 0x53, 0x9D, 0xA9,
+ 0xFF, 0xFF, 0x82, 0x53, 0x9D, 0x8F, 0xFF, 0xFF, 0x81, 0x53, 0x9D, 0xAB, 0xFF, 0xFF, 0x81, 0x53,
+ 0x9D, 0x8E, 0xFF, 0xFF, 0x82, 0x53, 0x9D, 0xAB, 0xFF, 0xFF, 0x82, 0x53, 0x9D, 0x8D, 0xFF, 0xFF,
+ 0x81, 0x53, 0x9D, 0xAD, 0xFF, 0xFF, 0x81, 0x53, 0x9D, 0x8C, 0xFF, 0xFF, 0x82, 0x53, 0x9D, 0xAD,
+ 0xFF, 0xFF, 0x82, 0x53, 0x9D, 0x8B, 0xFF, 0xFF, 0x82, 0x53, 0x9D, 0xAD, 0xFF, 0xFF, 0x82, 0x53,
+ 0x9D, 0x8B, 0xFF, 0xFF, 0x81, 0x53, 0x9D, 0xAF, 0xFF, 0xFF, 0x81, 0x53, 0x9D, 0x8B, 0xFF, 0xFF,
+ 0x81, 0x53, 0x9D, 0xAF, 0xFF, 0xFF, 0x81, 0x53, 0x9D, 0x8A, 0xFF, 0xFF, 0x82, 0x53, 0x9D, 0xAF,
+ 0xFF, 0xFF, 0x82, 0x53, 0x9D, 0x89, 0xFF, 0xFF, 0x82, 0x53, 0x9D, 0xB0, 0xFF, 0xFF, 0x81, 0x53,
+ 0x9D, 0x89, 0xFF, 0xFF, 0xB5, 0x53, 0x9D, 0x89, 0xFF, 0xFF, 0xB5, 0x53, 0x9D, 0x89, 0xFF, 0xFF,
+ 0xB5, 0x53, 0x9D, 0x99, 0xFF, 0xFF, 0x81, 0x53, 0x9D, 0x91, 0xFF, 0xFF, 0x81, 0x53, 0x9D, 0xA9,
+ 0xFF, 0xFF, 0x82, 0x53, 0x9D, 0x8F, 0xFF, 0xFF, 0x82, 0x53, 0x9D, 0xA9, 0xFF, 0xFF, 0x82, 0x53,
+ 0x9D, 0x8F, 0xFF, 0xFF, 0x82, 0x53, 0x9D, 0xAA, 0xFF, 0xFF, 0x82, 0x53, 0x9D, 0x8D, 0xFF, 0xFF,
+ 0x82, 0x53, 0x9D, 0xA5, 0xFF, 0xFF, 0x00, 0x53, 0x9D, 0x85, 0xFF, 0xFF, 0x82, 0x53, 0x9D, 0x8B,
+ 0xFF, 0xFF, 0x82, 0x53, 0x9D, 0x85, 0xFF, 0xFF, 0x00, 0x53, 0x9D, 0x9E, 0xFF, 0xFF, 0x82, 0x53,
+ 0x9D, 0x84, 0xFF, 0xFF, 0x84, 0x53, 0x9D, 0x87, 0xFF, 0xFF, 0x84, 0x53, 0x9D, 0x84, 0xFF, 0xFF,
+ 0x82, 0x53, 0x9D, 0x9C, 0xFF, 0xFF, 0x82, 0x53, 0x9D, 0x87, 0xFF, 0xFF, 0x85, 0x53, 0x9D, 0x81,
+ 0x53, 0xBD, 0x85, 0x53, 0x9D, 0x87, 0xFF, 0xFF, 0x82, 0x53, 0x9D, 0x9B, 0xFF, 0xFF, 0x81, 0x53,
+ 0x9D, 0x89, 0xFF, 0xFF, 0x8B, 0x53, 0x9D, 0x89, 0xFF, 0xFF, 0x81, 0x53, 0x9D, 0xAA, 0xFF, 0xFF,
+ 0x85, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xB2, 0xFF, 0xFF, 0x81, 0x53, 0x9D, 0x8F, 0xFF, 0xFF, 0x81,
+ 0x53, 0x9D, 0xAB, 0xFF, 0xFF, 0x81, 0x53, 0x9D, 0x8F, 0xFF, 0xFF, 0x81, 0x53, 0x9D, 0xAA, 0xFF,
+ 0xFF, 0x82, 0x53, 0x9D, 0x8F, 0xFF, 0xFF, 0x82, 0x53, 0x9D, 0xA9, 0xFF, 0xFF, 0x81, 0x53, 0x9D,
+ 0x87, 0xFF, 0xFF, 0x81, 0x53, 0x9D, 0x87, 0xFF, 0xFF, 0x81, 0x53, 0x9D, 0xAA, 0xFF, 0xFF, 0x00,
+ 0x53, 0x9D, 0x87, 0xFF, 0xFF, 0x81, 0x53, 0x9D, 0x87, 0xFF, 0xFF, 0x00, 0x53, 0x9D, 0xB4, 0xFF,
+ 0xFF, 0x81, 0x53, 0x9D, 0xBD, 0xFF, 0xFF, 0x81, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xDE, 0xFF, 0xFF,
+};
 
+const unsigned char img_light_off[484] = {
+ //64x64 RLE
+ 0x52, 0x4C, 0x45, 0x31, 0x00, 0x40, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0xBD, 0xFF, 0xFF,
+ 0x81, 0x20, 0xC2, 0xBD, 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0xBD, 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0xBD,
+ 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0xBD, 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0xBD, 0xFF, 0xFF, 0x81, 0x20,
+ 0xC2, 0xBA, 0xFF, 0xFF, 0x87, 0x20, 0xC2, 0xB3, 0xFF, 0xFF, 0x85, 0x20, 0xC2, 0x00, 0x20, 0xA2,
+ 0x81, 0x20, 0xC2, 0x00, 0x20, 0xA2, 0x85, 0x20, 0xC2, 0xAD, 0xFF, 0xFF, 0x83, 0x20, 0xC2, 0x8B,
+ 0xFF, 0xFF, 0x83, 0x20, 0xC2, 0xA9, 0xFF, 0xFF, 0x82, 0x20, 0xC2, 0x91, 0xFF, 0xFF, 0x82, 0x20,
+ 0xC2, 0xA6, 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0x95, 0xFF, 0xFF, 0x82, 0x20, 0xC2, 0xA2, 0xFF, 0xFF,
+ 0x81, 0x20, 0xC2, 0x99, 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0xA0, 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0x9B,
+ 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0x9E, 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0x9D, 0xFF, 0xFF, 0x81, 0x20,
+ 0xC2, 0x9C, 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0x9F, 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0x9A, 0xFF, 0xFF,
+ 0x81, 0x20, 0xC2, 0xA1, 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0x98, 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0xA3,
+ 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0x97, 0xFF, 0xFF, 0x00, 0x20, 0xC2, 0xA5, 0xFF, 0xFF, 0x00, 0x20,
+ 0xC2, 0x96, 0xFF, 0xFF, 0x00, 0x20, 0xC2, 0xA7, 0xFF, 0xFF, 0x00, 0x20, 0xC2, 0x94, 0xFF, 0xFF,
+ 0x81, 0x20, 0xC2, 0xA7, 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0x93, 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0xA7,
+ 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0x93, 0xFF, 0xFF, 0x00, 0x20, 0xC2, 0xA9, 0xFF, 0xFF, 0x00, 0x20,
+ 0xC2, 0x92, 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0xA9, 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0x91, 0xFF, 0xFF,
+ 0x00, 0x20, 0xC2, 0xAB, 0xFF, 0xFF, 0x00, 0x20, 0xC2, 0x91, 0xFF, 0xFF, 0x00, 0x20, 0xC2, 0xAB,
+ 0xFF, 0xFF, 0x00, 0x20, 0xC2, 0x91, 0xFF, 0xFF, 0x00, 0x20, 0xC2, 0xAB, 0xFF, 0xFF, 0x81, 0x20,
+ 0xC2, 0x8F, 0xFF, 0xFF, 0xAF, 0x20, 0xC2, 0x98, 0xFF, 0xFF, 0x00, 0x20, 0xA2, 0x9C, 0x20, 0xC2,
+ 0xA2, 0xFF, 0xFF, 0x00, 0x20, 0xC2, 0x99, 0xFF, 0xFF, 0x00, 0x20, 0xC2, 0xA3, 0xFF, 0xFF, 0x81,
+ 0x20, 0xC2, 0x97, 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0xA3, 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0x97, 0xFF,
+ 0xFF, 0x81, 0x20, 0xC2, 0xA4, 0xFF, 0xFF, 0x00, 0x20, 0xC2, 0x97, 0xFF, 0xFF, 0x00, 0x20, 0xC2,
+ 0xA5, 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0x95, 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0xA6, 0xFF, 0xFF, 0x81,
+ 0x20, 0xC2, 0x93, 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0xA7, 0xFF, 0xFF, 0x01, 0x20, 0xA2, 0x20, 0xC2,
+ 0x93, 0xFF, 0xFF, 0x00, 0x20, 0xC2, 0xA9, 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0x91, 0xFF, 0xFF, 0x81,
+ 0x20, 0xC2, 0xAA, 0xFF, 0xFF, 0x82, 0x20, 0xC2, 0x8D, 0xFF, 0xFF, 0x82, 0x20, 0xC2, 0xAD, 0xFF,
+ 0xFF, 0x81, 0x20, 0xC2, 0x8B, 0xFF, 0xFF, 0x81, 0x20, 0xC2, 0xB0, 0xFF, 0xFF, 0x84, 0x20, 0xC2,
+ 0x83, 0xFF, 0xFF, 0x00, 0x20, 0xA2, 0x83, 0x20, 0xC2, 0xB4, 0xFF, 0xFF, 0x87, 0x20, 0xC2, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0x9B, 0xFF, 0xFF,
+};
 
+const unsigned char img_fan_on[1085] = {
+ //64x64 RLE
+ 0x52, 0x4C, 0x45, 0x31, 0x00, 0x40, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x00, 0x29, 0x65,
+ 0x81, 0x29, 0x45, 0x00, 0x29, 0x65, 0xB9, 0xFF, 0xFF, 0x81, 0x29, 0x45, 0x04, 0x52, 0xAA, 0x6B,
+ 0x6D, 0x63, 0x4D, 0x42, 0x28, 0x29, 0x45, 0xB8, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x7B, 0xEF, 0x82,
+ 0xC6, 0x79, 0x02, 0xBE, 0x18, 0x5B, 0x0C, 0x29, 0x45, 0x87, 0xFF, 0xFF, 0x86, 0x29, 0x45, 0xA7,
+ 0xFF, 0xFF, 0x02, 0x29, 0x65, 0x4A, 0x49, 0xC6, 0x59, 0x84, 0xC6, 0x79, 0x01, 0x5B, 0x0C, 0x29,
+ 0x45, 0x8C, 0xFF, 0xFF, 0x00, 0x29, 0x45, 0xA7, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x6B, 0x6D, 0x86,
+ 0xC6, 0x79, 0x01, 0x5B, 0x0C, 0x29, 0x45, 0x8E, 0xFF, 0xFF, 0x81, 0x29, 0x45, 0xA3, 0xFF, 0xFF,
+ 0x01, 0x29, 0x45, 0x6B, 0x6D, 0x87, 0xC6, 0x79, 0x01, 0x5B, 0x0C, 0x29, 0x45, 0x8E, 0xFF, 0xFF,
+ 0x81, 0x29, 0x45, 0xA2, 0xFF, 0xFF, 0x02, 0x29, 0x65, 0x42, 0x49, 0xC6, 0x59, 0x87, 0xC6, 0x79,
+ 0x01, 0x5B, 0x0C, 0x29, 0x45, 0xB3, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x7B, 0xEF, 0x88, 0xC6, 0x79,
+ 0x01, 0x5B, 0x0C, 0x29, 0x45, 0xB3, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x7B, 0xEF, 0x88, 0xC6, 0x79,
+ 0x01, 0x5B, 0x0C, 0x29, 0x45, 0xB3, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x7B, 0xEF, 0x88, 0xC6, 0x79,
+ 0x01, 0x5B, 0x0C, 0x29, 0x45, 0x93, 0xFF, 0xFF, 0x00, 0x29, 0x65, 0x82, 0x29, 0x45, 0x9B, 0xFF,
+ 0xFF, 0x01, 0x29, 0x45, 0x7B, 0xEF, 0x88, 0xC6, 0x79, 0x01, 0x5B, 0x0C, 0x29, 0x45, 0x8E, 0xFF,
+ 0xFF, 0x83, 0x29, 0x45, 0x00, 0x4A, 0x8A, 0x81, 0x7B, 0xEF, 0x02, 0x4A, 0x69, 0x29, 0x45, 0x29,
+ 0x65, 0x9A, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x7B, 0xEF, 0x87, 0xC6, 0x79, 0x00, 0x7C, 0x30, 0x85,
+ 0x29, 0x45, 0x85, 0xFF, 0xFF, 0x83, 0x29, 0x45, 0x03, 0x39, 0xE7, 0x6B, 0x6D, 0x94, 0xD3, 0xC6,
+ 0x38, 0x83, 0xC6, 0x79, 0x01, 0x8C, 0x92, 0x29, 0x45, 0x9B, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x7B,
+ 0xEF, 0x84, 0xC6, 0x79, 0x02, 0x9D, 0x34, 0x31, 0x86, 0x29, 0x45, 0x85, 0xFF, 0xFF, 0x86, 0x29,
+ 0x45, 0x02, 0x52, 0xCB, 0x84, 0x71, 0xB5, 0xD7, 0x88, 0xC6, 0x79, 0x01, 0x5B, 0x0C, 0x29, 0x45,
+ 0x9B, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x7B, 0xEF, 0x82, 0xC6, 0x79, 0x00, 0x9D, 0x14, 0x81, 0x29,
+ 0x45, 0x87, 0xFF, 0xFF, 0x81, 0x29, 0x45, 0x02, 0x42, 0x28, 0x73, 0xAE, 0xA5, 0x34, 0x8C, 0xC6,
+ 0x79, 0x01, 0x8C, 0x92, 0x29, 0x45, 0x9C, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x7B, 0xEF, 0x81, 0xC6,
+ 0x79, 0x81, 0x29, 0x45, 0x89, 0xFF, 0xFF, 0x81, 0x29, 0x45, 0x00, 0xA5, 0x75, 0x8D, 0xC6, 0x79,
+ 0x01, 0x94, 0xD3, 0x29, 0x45, 0x9D, 0xFF, 0xFF, 0x03, 0x29, 0x45, 0x7B, 0xEF, 0x63, 0x2C, 0x29,
+ 0x45, 0x8B, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x6B, 0x6D, 0x8D, 0xC6, 0x79, 0x01, 0x5A, 0xEB, 0x29,
+ 0x65, 0x9E, 0xFF, 0xFF, 0x81, 0x29, 0x45, 0x84, 0xFF, 0xFF, 0x83, 0x29, 0x45, 0x84, 0xFF, 0xFF,
+ 0x01, 0x29, 0x45, 0xA5, 0x75, 0x8A, 0xC6, 0x79, 0x02, 0xBE, 0x18, 0x5B, 0x0C, 0x29, 0x45, 0x97,
+ 0xFF, 0xFF, 0x00, 0x29, 0x45, 0x87, 0xFF, 0xFF, 0x00, 0x29, 0x45, 0x83, 0xFF, 0xFF, 0x81, 0x29,
+ 0x45, 0x82, 0xFF, 0xFF, 0x00, 0x29, 0x45, 0x83, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x9C, 0xF3, 0x87,
+ 0xC6, 0x79, 0x04, 0xB5, 0xF7, 0x94, 0xD3, 0x73, 0xAE, 0x42, 0x08, 0x29, 0x45, 0x98, 0xFF, 0xFF,
+ 0x00, 0x29, 0x45, 0x87, 0xFF, 0xFF, 0x00, 0x29, 0x45, 0x83, 0xFF, 0xFF, 0x00, 0x29, 0x45, 0x83,
+ 0xFF, 0xFF, 0x00, 0x29, 0x45, 0x83, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x8C, 0x92, 0x83, 0xC6, 0x79,
+ 0x06, 0xB5, 0xF7, 0x9C, 0xF3, 0x73, 0xCF, 0x4A, 0x8A, 0x29, 0x65, 0x29, 0x45, 0x29, 0x65, 0x9A,
+ 0xFF, 0xFF, 0x00, 0x29, 0x45, 0x87, 0xFF, 0xFF, 0x00, 0x29, 0x45, 0x83, 0xFF, 0xFF, 0x00, 0x29,
+ 0x45, 0x83, 0xFF, 0xFF, 0x00, 0x29, 0x45, 0x83, 0xFF, 0xFF, 0x06, 0x29, 0x45, 0x84, 0x30, 0xB5,
+ 0xF7, 0x9C, 0xF3, 0x7B, 0xEF, 0x52, 0xCB, 0x31, 0x86, 0x81, 0x29, 0x45, 0x00, 0x29, 0x65, 0xA6,
+ 0xFF, 0xFF, 0x00, 0x29, 0x45, 0x83, 0xFF, 0xFF, 0x00, 0x29, 0x45, 0x83, 0xFF, 0xFF, 0x00, 0x29,
+ 0x45, 0x83, 0xFF, 0xFF, 0x02, 0x29, 0x45, 0x5A, 0xEB, 0x31, 0xC7, 0x81, 0x29, 0x45, 0x00, 0x29,
+ 0x65, 0xAA, 0xFF, 0xFF, 0x81, 0x29, 0x45, 0x83, 0xFF, 0xFF, 0x83, 0x29, 0x45, 0x84, 0xFF, 0xFF,
+ 0x82, 0x29, 0x45, 0xA4, 0xFF, 0xFF, 0x00, 0x29, 0x45, 0x88, 0xFF, 0xFF, 0x00, 0x29, 0x45, 0x8B,
+ 0xFF, 0xFF, 0x00, 0x29, 0x45, 0xA7, 0xFF, 0xFF, 0x81, 0x29, 0x45, 0x87, 0xFF, 0xFF, 0x81, 0x29,
+ 0x45, 0x8A, 0xFF, 0xFF, 0x00, 0x29, 0x45, 0xA8, 0xFF, 0xFF, 0x00, 0x29, 0x45, 0x87, 0xFF, 0xFF,
+ 0x81, 0x29, 0x45, 0x89, 0xFF, 0xFF, 0x00, 0x29, 0x45, 0xA9, 0xFF, 0xFF, 0x00, 0x29, 0x45, 0x87,
+ 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x42, 0x28, 0x81, 0x29, 0x45, 0x85, 0xFF, 0xFF, 0x81, 0x29, 0x45,
+ 0xAA, 0xFF, 0xFF, 0x81, 0x29, 0x45, 0x86, 0xFF, 0xFF, 0x03, 0x29, 0x45, 0x73, 0xAE, 0xA5, 0x75,
+ 0x6B, 0x6D, 0x86, 0x29, 0x45, 0x89, 0xFF, 0xFF, 0x81, 0x29, 0x45, 0xA0, 0xFF, 0xFF, 0x00, 0x29,
+ 0x45, 0x86, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x9D, 0x34, 0x81, 0xC6, 0x79, 0x05, 0xA5, 0x75, 0x94,
+ 0xD3, 0x8C, 0x71, 0x7C, 0x30, 0x5A, 0xEB, 0x29, 0x45, 0x8A, 0xFF, 0xFF, 0x00, 0x29, 0x45, 0xA1,
+ 0xFF, 0xFF, 0x81, 0x29, 0x45, 0x84, 0xFF, 0xFF, 0x81, 0x29, 0x45, 0x85, 0xC6, 0x79, 0x02, 0xB5,
+ 0xF7, 0x31, 0xC7, 0x29, 0x45, 0x89, 0xFF, 0xFF, 0x00, 0x29, 0x45, 0xA9, 0xFF, 0xFF, 0x01, 0x29,
+ 0x45, 0x52, 0xAA, 0x85, 0xC6, 0x79, 0x01, 0x94, 0xF3, 0x29, 0x45, 0x89, 0xFF, 0xFF, 0x00, 0x29,
+ 0x45, 0xAA, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x84, 0x30, 0x85, 0xC6, 0x79, 0x01, 0x73, 0xCF, 0x29,
+ 0x45, 0x88, 0xFF, 0xFF, 0x81, 0x29, 0x45, 0xAA, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0xAD, 0xB6, 0x85,
+ 0xC6, 0x79, 0x01, 0x52, 0xAA, 0x29, 0x65, 0x88, 0xFF, 0xFF, 0x00, 0x29, 0x45, 0xAA, 0xFF, 0xFF,
+ 0x01, 0x29, 0x45, 0x39, 0xE7, 0x85, 0xC6, 0x79, 0x01, 0xB5, 0xF7, 0x31, 0x86, 0xB5, 0xFF, 0xFF,
+ 0x01, 0x29, 0x45, 0x63, 0x4D, 0x85, 0xC6, 0x79, 0x01, 0x94, 0xD3, 0x29, 0x45, 0x85, 0xFF, 0xFF,
+ 0x81, 0x29, 0x45, 0xAD, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x94, 0xB2, 0x85, 0xC6, 0x79, 0x01, 0x6B,
+ 0xAE, 0x29, 0x45, 0xB5, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0xBE, 0x38, 0x85, 0xC6, 0x79, 0x01, 0x4A,
+ 0x8A, 0x29, 0x65, 0xB4, 0xFF, 0xFF, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x85, 0xC6, 0x79, 0x01, 0xB5,
+ 0xF7, 0x29, 0x65, 0xB5, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x7B, 0xEF, 0x85, 0xC6, 0x79, 0x01, 0x94,
+ 0xD3, 0x29, 0x45, 0xB5, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x7B, 0xEF, 0x85, 0xC6, 0x79, 0x01, 0x6B,
+ 0xAE, 0x29, 0x45, 0xB5, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x52, 0xAA, 0x84, 0xC6, 0x79, 0x02, 0xC6,
+ 0x59, 0x42, 0x49, 0x29, 0x65, 0xB6, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x84, 0x51, 0x83, 0xC6, 0x79,
+ 0x01, 0x7B, 0xEF, 0x29, 0x45, 0xB8, 0xFF, 0xFF, 0x05, 0x29, 0x45, 0x5B, 0x0C, 0x84, 0x51, 0x8C,
+ 0x92, 0x52, 0xCB, 0x29, 0x45, 0xBA, 0xFF, 0xFF, 0x82, 0x29, 0x45, 0x00, 0x29, 0x65, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA2, 0xFF, 0xFF,
+};
 
+const unsigned char img_fan_off[938] = {
+ //64x64 RLE
+ 0x52, 0x4C, 0x45, 0x31, 0x00, 0x40, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xDE, 0xFF, 0xFF, 0x81, 0x29, 0x45, 0xBB, 0xFF, 0xFF, 0x81, 0x29, 0x45, 0x81, 0x42, 0x08,
+ 0x81, 0x29, 0x45, 0xB8, 0xFF, 0xFF, 0x02, 0x29, 0x45, 0x5A, 0xEB, 0xA5, 0x55, 0x81, 0xC6, 0x79,
+ 0x02, 0xA5, 0x55, 0x5A, 0xEB, 0x29, 0x45, 0xB6, 0xFF, 0xFF, 0x02, 0x29, 0x65, 0x42, 0x28, 0xBE,
+ 0x18, 0x83, 0xC6, 0x79, 0x01, 0xBE, 0x18, 0x42, 0x28, 0xB6, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x63,
+ 0x4D, 0x85, 0xC6, 0x79, 0x01, 0x63, 0x4D, 0x29, 0x65, 0xB5, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x7B,
+ 0xEF, 0x85, 0xC6, 0x79, 0x01, 0x7B, 0xEF, 0x29, 0x45, 0xB5, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x7B,
+ 0xEF, 0x85, 0xC6, 0x79, 0x01, 0x7B, 0xEF, 0x29, 0x45, 0xB5, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x7B,
+ 0xEF, 0x85, 0xC6, 0x79, 0x01, 0x7B, 0xEF, 0x29, 0x45, 0xB5, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x7B,
+ 0xEF, 0x85, 0xC6, 0x79, 0x01, 0x7B, 0xEF, 0x29, 0x45, 0xB5, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x7B,
+ 0xEF, 0x85, 0xC6, 0x79, 0x01, 0x7B, 0xEF, 0x29, 0x45, 0xB5, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x7B,
+ 0xEF, 0x85, 0xC6, 0x79, 0x01, 0x7B, 0xEF, 0x29, 0x45, 0xB5, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x7B,
+ 0xEF, 0x85, 0xC6, 0x79, 0x01, 0x7B, 0xEF, 0x29, 0x45, 0xB5, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x7B,
+ 0xEF, 0x85, 0xC6, 0x79, 0x01, 0x7B, 0xEF, 0x29, 0x45, 0xB5, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x7B,
+ 0xEF, 0x85, 0xC6, 0x79, 0x01, 0x7B, 0xEF, 0x29, 0x45, 0xB5, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x7B,
+ 0xEF, 0x85, 0xC6, 0x79, 0x01, 0x7B, 0xEF, 0x29, 0x45, 0xB5, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x7B,
+ 0xEF, 0x85, 0xC6, 0x79, 0x01, 0x7B, 0xEF, 0x29, 0x45, 0xB5, 0xFF, 0xFF, 0x03, 0x29, 0x45, 0x7B,
+ 0xEF, 0xC6, 0x79, 0xB5, 0xD7, 0x81, 0x8C, 0x92, 0x03, 0xB5, 0xD7, 0xC6, 0x79, 0x7B, 0xEF, 0x29,
+ 0x45, 0xB5, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x4A, 0x49, 0x85, 0x29, 0x45, 0x01, 0x4A, 0x49, 0x29,
+ 0x45, 0xB5, 0xFF, 0xFF, 0x81, 0x29, 0x45, 0x84, 0xFF, 0xFF, 0x00, 0x29, 0x86, 0x81, 0x29, 0x45,
+ 0xB4, 0xFF, 0xFF, 0x81, 0x29, 0x45, 0x87, 0xFF, 0xFF, 0x81, 0x29, 0x45, 0xB2, 0xFF, 0xFF, 0x81,
+ 0x29, 0x45, 0x89, 0xFF, 0xFF, 0x81, 0x29, 0x45, 0xB1, 0xFF, 0xFF, 0x00, 0x29, 0x45, 0x8B, 0xFF,
+ 0xFF, 0x00, 0x29, 0x45, 0xB0, 0xFF, 0xFF, 0x00, 0x29, 0x65, 0x8D, 0xFF, 0xFF, 0x00, 0x29, 0x45,
+ 0xAF, 0xFF, 0xFF, 0x00, 0x29, 0x45, 0x8D, 0xFF, 0xFF, 0x00, 0x29, 0x45, 0xAE, 0xFF, 0xFF, 0x81,
+ 0x29, 0x45, 0x8D, 0xFF, 0xFF, 0x81, 0x29, 0x45, 0xAB, 0xFF, 0xFF, 0x81, 0x29, 0x45, 0x01, 0x31,
+ 0xC7, 0x29, 0x45, 0x8D, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x31, 0xC7, 0x81, 0x29, 0x45, 0xA8, 0xFF,
+ 0xFF, 0x81, 0x29, 0x45, 0x02, 0x6B, 0x8E, 0x94, 0xB2, 0x29, 0x45, 0x8D, 0xFF, 0xFF, 0x02, 0x29,
+ 0x45, 0x94, 0xD3, 0x6B, 0xAE, 0x81, 0x29, 0x45, 0xA5, 0xFF, 0xFF, 0x81, 0x29, 0x45, 0x04, 0x5A,
+ 0xEB, 0xA5, 0x75, 0xC6, 0x79, 0xBE, 0x38, 0x29, 0x45, 0x8D, 0xFF, 0xFF, 0x00, 0x39, 0xE7, 0x81,
+ 0xC6, 0x79, 0x01, 0xA5, 0x75, 0x5B, 0x0C, 0x81, 0x29, 0x45, 0xA1, 0xFF, 0xFF, 0x03, 0x29, 0x65,
+ 0x29, 0x45, 0x4A, 0x69, 0x94, 0xD3, 0x83, 0xC6, 0x79, 0x01, 0x52, 0xCB, 0x29, 0x45, 0x8B, 0xFF,
+ 0xFF, 0x01, 0x29, 0x45, 0x73, 0xAE, 0x83, 0xC6, 0x79, 0x01, 0x94, 0xF3, 0x4A, 0x69, 0x81, 0x29,
+ 0x45, 0x9E, 0xFF, 0xFF, 0x02, 0x29, 0x45, 0x39, 0xC7, 0x7C, 0x30, 0x85, 0xC6, 0x79, 0x00, 0x94,
+ 0xB2, 0x81, 0x29, 0x45, 0x89, 0xFF, 0xFF, 0x02, 0x29, 0x45, 0x31, 0xA6, 0xAD, 0x96, 0x85, 0xC6,
+ 0x79, 0x02, 0x84, 0x51, 0x31, 0xC7, 0x29, 0x45, 0x9B, 0xFF, 0xFF, 0x81, 0x29, 0x45, 0x01, 0x6B,
+ 0x8E, 0xB5, 0xF7, 0x87, 0xC6, 0x79, 0x02, 0x84, 0x51, 0x29, 0x45, 0x29, 0x86, 0x87, 0xFF, 0xFF,
+ 0x02, 0x29, 0x65, 0x29, 0x45, 0x9D, 0x34, 0x87, 0xC6, 0x79, 0x01, 0xB5, 0xF7, 0x73, 0xAE, 0x81,
+ 0x29, 0x45, 0x98, 0xFF, 0xFF, 0x02, 0x29, 0x45, 0x5B, 0x0C, 0xA5, 0x55, 0x8A, 0xC6, 0x79, 0x02,
+ 0x7C, 0x10, 0x29, 0x45, 0x31, 0xA6, 0x85, 0xFF, 0xFF, 0x81, 0x29, 0x45, 0x00, 0x8C, 0x71, 0x8A,
+ 0xC6, 0x79, 0x02, 0xA5, 0x55, 0x5B, 0x0C, 0x29, 0x45, 0x96, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x7B,
+ 0xEF, 0x8B, 0xC6, 0x79, 0x01, 0xBE, 0x38, 0x52, 0xAA, 0x89, 0x29, 0x45, 0x01, 0x63, 0x0C, 0xA5,
+ 0x34, 0x8B, 0xC6, 0x79, 0x01, 0x7B, 0xEF, 0x29, 0x45, 0x94, 0xFF, 0xFF, 0x01, 0x31, 0x86, 0x52,
+ 0xAA, 0x8B, 0xC6, 0x79, 0x00, 0x73, 0xCF, 0x81, 0x29, 0x45, 0x89, 0xFF, 0xFF, 0x03, 0x29, 0x45,
+ 0x29, 0x65, 0x6B, 0xAE, 0xB5, 0xD7, 0x8A, 0xC6, 0x79, 0x01, 0x4A, 0x8A, 0x29, 0x65, 0x93, 0xFF,
+ 0xFF, 0x01, 0x29, 0x45, 0x84, 0x30, 0x89, 0xC6, 0x79, 0x01, 0x94, 0xB2, 0x29, 0x65, 0x81, 0x29,
+ 0x45, 0x8B, 0xFF, 0xFF, 0x81, 0x29, 0x45, 0x01, 0x39, 0xE7, 0x7C, 0x30, 0x89, 0xC6, 0x79, 0x01,
+ 0x7B, 0xEF, 0x29, 0x45, 0x93, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x9D, 0x34, 0x87, 0xC6, 0x79, 0x03,
+ 0x9D, 0x34, 0x4A, 0x69, 0x29, 0x45, 0x29, 0x65, 0x8F, 0xFF, 0xFF, 0x03, 0x29, 0x65, 0x29, 0x45,
+ 0x4A, 0x69, 0x94, 0xB2, 0x87, 0xC6, 0x79, 0x01, 0x7B, 0xEF, 0x29, 0x45, 0x93, 0xFF, 0xFF, 0x01,
+ 0x29, 0x65, 0x6B, 0x6D, 0x85, 0xC6, 0x79, 0x01, 0xAD, 0x96, 0x63, 0x4D, 0x81, 0x29, 0x45, 0x93,
+ 0xFF, 0xFF, 0x81, 0x29, 0x45, 0x01, 0x5B, 0x0C, 0xA5, 0x55, 0x85, 0xC6, 0x79, 0x01, 0x5B, 0x0C,
+ 0x29, 0x45, 0x94, 0xFF, 0xFF, 0x01, 0x29, 0x45, 0x7B, 0xEF, 0x82, 0xC6, 0x79, 0x01, 0xB5, 0xF7,
+ 0x73, 0xAE, 0x81, 0x29, 0x45, 0x97, 0xFF, 0xFF, 0x03, 0x29, 0x45, 0x29, 0x65, 0x6B, 0xAE, 0xB5,
+ 0xF7, 0x81, 0xC6, 0x79, 0x02, 0xC6, 0x59, 0x7B, 0xEF, 0x29, 0x45, 0x95, 0xFF, 0xFF, 0x06, 0x29,
+ 0x65, 0x29, 0x45, 0x4A, 0x49, 0x63, 0x2C, 0x63, 0x4D, 0x31, 0xA6, 0x29, 0x45, 0x9B, 0xFF, 0xFF,
+ 0x05, 0x29, 0x45, 0x31, 0xA6, 0x63, 0x4D, 0x63, 0x0C, 0x3A, 0x08, 0x29, 0x45, 0x98, 0xFF, 0xFF,
+ 0x00, 0x29, 0x86, 0x81, 0x29, 0x45, 0x9F, 0xFF, 0xFF, 0x81, 0x29, 0x45, 0x00, 0x29, 0x65, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCC, 0xFF, 0xFF,
+};
 
-const unsigned char img_fan_off[8192] = {
- //64x64
- 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45, 0x42, 0x08, 0x42, 0x08,
- 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x5A, 0xEB, 0xA5, 0x55, 0xC6, 0x79, 0xC6, 0x79,
- 0xA5, 0x55, 0x5A, 0xEB, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x65, 0x42, 0x28, 0xBE, 0x18, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xBE, 0x18, 0x42, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x63, 0x4D, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0x63, 0x4D, 0x29, 0x65, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x7B, 0xEF, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0x7B, 0xEF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x7B, 0xEF, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0x7B, 0xEF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x7B, 0xEF, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0x7B, 0xEF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x7B, 0xEF, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0x7B, 0xEF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x7B, 0xEF, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0x7B, 0xEF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x7B, 0xEF, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0x7B, 0xEF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x7B, 0xEF, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0x7B, 0xEF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x7B, 0xEF, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0x7B, 0xEF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x7B, 0xEF, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0x7B, 0xEF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x7B, 0xEF, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0x7B, 0xEF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x7B, 0xEF, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0x7B, 0xEF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x7B, 0xEF, 0xC6, 0x79, 0xB5, 0xD7, 0x8C, 0x92, 0x8C, 0x92,
- 0xB5, 0xD7, 0xC6, 0x79, 0x7B, 0xEF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x4A, 0x49, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45,
- 0x29, 0x45, 0x29, 0x45, 0x4A, 0x49, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x29, 0x86, 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x65,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45, 0x31, 0xC7, 0x29, 0x45,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x31, 0xC7,
- 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45, 0x6B, 0x8E, 0x94, 0xB2, 0x29, 0x45,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x94, 0xD3,
- 0x6B, 0xAE, 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45, 0x5A, 0xEB, 0xA5, 0x75, 0xC6, 0x79, 0xBE, 0x38, 0x29, 0x45,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x39, 0xE7, 0xC6, 0x79,
- 0xC6, 0x79, 0xA5, 0x75, 0x5B, 0x0C, 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x65,
- 0x29, 0x45, 0x4A, 0x69, 0x94, 0xD3, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x52, 0xCB,
- 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x73, 0xAE, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x94, 0xF3, 0x4A, 0x69, 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x39, 0xC7,
- 0x7C, 0x30, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x94, 0xB2,
- 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x31, 0xA6, 0xAD, 0x96, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x84, 0x51, 0x31, 0xC7, 0x29, 0x45,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45, 0x6B, 0x8E, 0xB5, 0xF7,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0x84, 0x51, 0x29, 0x45, 0x29, 0x86, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x65, 0x29, 0x45, 0x9D, 0x34, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xB5, 0xF7, 0x73, 0xAE,
- 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x5B, 0x0C, 0xA5, 0x55, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0x7C, 0x10, 0x29, 0x45, 0x31, 0xA6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45, 0x8C, 0x71, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xA5, 0x55, 0x5B, 0x0C, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x7B, 0xEF, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xBE, 0x38, 0x52, 0xAA, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45,
- 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x63, 0x0C, 0xA5, 0x34, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0x7B, 0xEF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x31, 0x86, 0x52, 0xAA, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x73, 0xCF,
- 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x65, 0x6B, 0xAE, 0xB5, 0xD7,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x4A, 0x8A, 0x29, 0x65, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x29, 0x45, 0x84, 0x30, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x94, 0xB2, 0x29, 0x65, 0x29, 0x45,
- 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45, 0x39, 0xE7,
- 0x7C, 0x30, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x7B, 0xEF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x29, 0x45, 0x9D, 0x34, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x9D, 0x34, 0x4A, 0x69, 0x29, 0x45, 0x29, 0x65, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x65,
- 0x29, 0x45, 0x4A, 0x69, 0x94, 0xB2, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x7B, 0xEF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x29, 0x65, 0x6B, 0x6D, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xAD, 0x96, 0x63, 0x4D, 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45, 0x5B, 0x0C, 0xA5, 0x55, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x5B, 0x0C, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x7B, 0xEF, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xB5, 0xF7,
- 0x73, 0xAE, 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x65, 0x6B, 0xAE, 0xB5, 0xF7, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x59, 0x7B, 0xEF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x65, 0x29, 0x45, 0x4A, 0x49, 0x63, 0x2C, 0x63, 0x4D, 0x31, 0xA6,
- 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x31, 0xA6, 0x63, 0x4D,
- 0x63, 0x0C, 0x3A, 0x08, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x86, 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45,
- 0x29, 0x45, 0x29, 0x65, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,};
-const unsigned char img_fan_on[8192] = {
- //64x64
- 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x65,
- 0x29, 0x45, 0x29, 0x45, 0x29, 0x65, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45, 0x52, 0xAA,
- 0x6B, 0x6D, 0x63, 0x4D, 0x42, 0x28, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x7B, 0xEF, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xBE, 0x18, 0x5B, 0x0C, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45,
- 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x65, 0x4A, 0x49, 0xC6, 0x59, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x5B, 0x0C, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x6B, 0x6D, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x5B, 0x0C, 0x29, 0x45, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x6B, 0x6D, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x5B, 0x0C, 0x29, 0x45,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45,
- 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x65, 0x42, 0x49, 0xC6, 0x59, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x5B, 0x0C,
- 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x7B, 0xEF, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0x5B, 0x0C, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x7B, 0xEF,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0x5B, 0x0C, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45,
- 0x7B, 0xEF, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0x5B, 0x0C, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x29, 0x65, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x29, 0x45, 0x7B, 0xEF, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x5B, 0x0C, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45,
- 0x4A, 0x8A, 0x7B, 0xEF, 0x7B, 0xEF, 0x4A, 0x69, 0x29, 0x45, 0x29, 0x65, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x29, 0x45, 0x7B, 0xEF, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x7C, 0x30, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45,
- 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x39, 0xE7, 0x6B, 0x6D, 0x94, 0xD3, 0xC6, 0x38,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x8C, 0x92, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x7B, 0xEF, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0x9D, 0x34, 0x31, 0x86, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45,
- 0x29, 0x45, 0x52, 0xCB, 0x84, 0x71, 0xB5, 0xD7, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x5B, 0x0C, 0x29, 0x45, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x7B, 0xEF, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0x9D, 0x14, 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45, 0x42, 0x28, 0x73, 0xAE, 0xA5, 0x34,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x8C, 0x92, 0x29, 0x45, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x7B, 0xEF, 0xC6, 0x79, 0xC6, 0x79,
- 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45, 0xA5, 0x75, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x94, 0xD3, 0x29, 0x45, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x7B, 0xEF, 0x63, 0x2C,
- 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x6B, 0x6D, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x5A, 0xEB, 0x29, 0x65, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45,
- 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0xA5, 0x75,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xBE, 0x18, 0x5B, 0x0C, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x9C, 0xF3,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79,
- 0xB5, 0xF7, 0x94, 0xD3, 0x73, 0xAE, 0x42, 0x08, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x8C, 0x92,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xB5, 0xF7, 0x9C, 0xF3, 0x73, 0xCF, 0x4A, 0x8A,
- 0x29, 0x65, 0x29, 0x45, 0x29, 0x65, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x84, 0x30,
- 0xB5, 0xF7, 0x9C, 0xF3, 0x7B, 0xEF, 0x52, 0xCB, 0x31, 0x86, 0x29, 0x45, 0x29, 0x45, 0x29, 0x65,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x5A, 0xEB,
- 0x31, 0xC7, 0x29, 0x45, 0x29, 0x45, 0x29, 0x65, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45,
- 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45,
- 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45,
- 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x29, 0x45, 0x42, 0x28, 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45,
- 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x29, 0x45, 0x73, 0xAE, 0xA5, 0x75, 0x6B, 0x6D, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45,
- 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x29, 0x45, 0x9D, 0x34, 0xC6, 0x79, 0xC6, 0x79, 0xA5, 0x75, 0x94, 0xD3, 0x8C, 0x71, 0x7C, 0x30,
- 0x5A, 0xEB, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45,
- 0x29, 0x45, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xB5, 0xF7,
- 0x31, 0xC7, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45,
- 0x52, 0xAA, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x94, 0xF3,
- 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45,
- 0x84, 0x30, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x73, 0xCF,
- 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45,
- 0xAD, 0xB6, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x52, 0xAA,
- 0x29, 0x65, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x39, 0xE7,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xB5, 0xF7, 0x31, 0x86,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x63, 0x4D,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x94, 0xD3, 0x29, 0x45,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x29, 0x45,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x94, 0xB2,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x6B, 0xAE, 0x29, 0x45,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0xBE, 0x38,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x4A, 0x8A, 0x29, 0x65,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x65, 0x4A, 0x69, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xB5, 0xF7, 0x29, 0x65, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x7B, 0xEF, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x94, 0xD3, 0x29, 0x45, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x7B, 0xEF, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x6B, 0xAE, 0x29, 0x45, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x52, 0xAA, 0xC6, 0x79,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x59, 0x42, 0x49, 0x29, 0x65, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45, 0x84, 0x51,
- 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0xC6, 0x79, 0x7B, 0xEF, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x45,
- 0x5B, 0x0C, 0x84, 0x51, 0x8C, 0x92, 0x52, 0xCB, 0x29, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x65, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,};
-const unsigned char img_light_off[8192] = {
- //64x64
- 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2,
- 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2,
- 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xA2, 0x20, 0xC2, 0x20, 0xC2,
- 0x20, 0xA2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2,
- 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2,
- 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2,
- 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2,
- 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2,
- 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2,
- 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2,
- 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2,
- 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2,
- 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2,
- 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x20, 0xA2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2,
- 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2,
- 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2,
- 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xA2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2,
- 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2,
- 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x20, 0xA2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2,
- 0x20, 0xC2, 0x20, 0xC2, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,};
-const unsigned char img_light_on[8192] = {
- //64x64
- 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0xBD, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0xBD, 0x53, 0xBD,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0xBD, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D,
- 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D,
- 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D,
- 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0xBD, 0x53, 0xBD,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D,
- 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D,
- 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D,
- 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D,
- 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x53, 0x9D, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x53, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9D, 0x53, 0x9D,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,};
-const unsigned char img_temp_high[4608] = {
- //48x48
- 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
- 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
- 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x69, 0xFA, 0x69,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x69, 0xFA, 0x69,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x69, 0xFA, 0x69,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x69, 0xFA, 0x69,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x69, 0xFA, 0x69,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x69, 0xFA, 0x69,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x69, 0xFA, 0x69,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x69, 0xFA, 0x69,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x69, 0xFA, 0x69,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x69, 0xFA, 0x69,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x69, 0xFA, 0x69,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x69, 0xFA, 0x69,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x69, 0xFA, 0x69,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x69, 0xFA, 0x69,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x69, 0xFA, 0x69,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
- 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x69, 0xFA, 0x69,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x69, 0xFA, 0x69,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x69, 0xFA, 0x69,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x69, 0xFA, 0x69, 0xFA, 0x69,
- 0xFA, 0x69, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x6A, 0xFA, 0x69, 0xFA, 0x69,
- 0xFA, 0x6A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x69, 0xFA, 0x69, 0xFA, 0x69,
- 0xFA, 0x69, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x69, 0xFA, 0x69, 0xFA, 0x69,
- 0xFA, 0x69, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
- 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
- 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
- 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,};
-const unsigned char img_temp_normal[4608] = {
- //48x48
- 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
- 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
- 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x69, 0xFA, 0x69,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x69, 0xFA, 0x69,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
- 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
- 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
- 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
- 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
- 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
- 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
- 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
- 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,};
-const unsigned char img_lum[4608] = {
- //48x48
- 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02,
- 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02,
- 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
- 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02,
- 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02,
- 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,};
-const unsigned char img_humi[4608] = {
- //48x48
- 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
- 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x12, 0x09, 0x23, 0x70, 0x34, 0xD6, 0x3D, 0x9A,
- 0x2C, 0x74, 0x23, 0x2F, 0x08, 0xE4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x23, 0x70, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0x9A, 0x23, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0xA3, 0x3D, 0x58, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x23, 0xB1, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
- 0x09, 0x25, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x2C, 0x13, 0x00, 0x00, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x20, 0x00, 0x82,
- 0x3D, 0x9A, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x2C, 0x54, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x20, 0x34, 0x95,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x23, 0x70,
- 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x23, 0x2F, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x11, 0xE9, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x20, 0x11, 0x87, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x2C, 0x75, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2C, 0x54, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x1A, 0x6B, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1A, 0xAC, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x35, 0x17, 0x00, 0x61, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x20, 0x35, 0x38, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x23, 0x0E, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x20, 0x1A, 0x4A, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0x9A, 0x08, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2C, 0x54, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x23, 0x4F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x46, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x35, 0x38, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x00, 0x00, 0x23, 0x4F, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x11, 0xC8, 0x00, 0x41, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x00, 0x00, 0x34, 0xF7, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x23, 0xB1, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x21, 0x11, 0x66, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x34, 0xF7, 0x23, 0xB1,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xBA, 0x00, 0x41, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x23, 0x0E, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x2C, 0x54, 0x23, 0x4F, 0x2C, 0x12, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x34, 0xF7, 0x09, 0x04, 0x00, 0x00,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x12, 0x2A, 0x00, 0x20, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x34, 0xB6, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x1A, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x45, 0x3D, 0x79, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x34, 0xF7, 0x09, 0x04, 0x00, 0x00, 0x2B, 0xF2,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x2C, 0x33, 0x00, 0x00, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x20,
- 0x08, 0xC3, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x2B, 0xF2,
- 0x00, 0x00, 0x7B, 0xEF, 0xE7, 0x3C, 0x9C, 0xF3, 0x00, 0x00, 0x1A, 0x8C, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x34, 0xF7, 0x09, 0x04, 0x00, 0x00, 0x2B, 0xF2, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x34, 0xD6, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
- 0x11, 0xE9, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x1A, 0xED,
- 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3A, 0x08, 0x11, 0x67, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x34, 0xF7, 0x09, 0x04, 0x00, 0x00, 0x2B, 0xF2, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x23, 0xB1, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
- 0x23, 0x0E, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x2C, 0x13,
- 0x00, 0x00, 0x9C, 0xD3, 0xEF, 0x7D, 0xC6, 0x38, 0x00, 0x00, 0x1A, 0xAC, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x34, 0xF7, 0x09, 0x04, 0x00, 0x00, 0x2B, 0xF2, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x1A, 0x8B, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
- 0x2C, 0x75, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x11, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x34, 0xF7, 0x09, 0x04, 0x00, 0x00, 0x2B, 0xF2, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x34, 0xD6, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x1A, 0xED, 0x11, 0xA8, 0x1A, 0x8B, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x34, 0xF7,
- 0x09, 0x04, 0x00, 0x00, 0x2B, 0xF2, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x2C, 0x74, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xA3,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x34, 0xF7, 0x09, 0x04,
- 0x00, 0x00, 0x2B, 0xF2, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x34, 0xD6, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x11, 0x66,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x34, 0xF7, 0x09, 0x04, 0x00, 0x00,
- 0x2B, 0xF2, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x35, 0x38, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x12, 0x2A,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x34, 0xF7, 0x09, 0x04, 0x00, 0x00, 0x2B, 0xF2,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x34, 0xF7, 0x34, 0xF7, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0x9A, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1A, 0xED,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x34, 0xF7, 0x09, 0x04, 0x00, 0x00, 0x2B, 0xF2, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x35, 0x17, 0x11, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x09, 0x25, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x12, 0x09,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x34, 0xF7, 0x09, 0x04, 0x00, 0x00, 0x2B, 0xF2, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x1A, 0x4B, 0x00, 0x00, 0x5A, 0xEB, 0x6B, 0x4D, 0x18, 0xC3, 0x11, 0xE9, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0x79, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x09, 0x45,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x34, 0xF7, 0x09, 0x04, 0x00, 0x00, 0x2B, 0xF2, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x08, 0xC3, 0x4A, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0x94, 0x92, 0x00, 0x00, 0x34, 0xF7,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x35, 0x17, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x41,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x34, 0xF7, 0x09, 0x04, 0x00, 0x00, 0x2B, 0xF2, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x08, 0xC3, 0x31, 0x86, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xEF, 0x00, 0x00, 0x34, 0xF7,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x34, 0x95, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
- 0x35, 0x38, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x34, 0xF7,
- 0x09, 0x04, 0x00, 0x00, 0x2B, 0xF2, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x1A, 0x4B, 0x00, 0x00, 0x42, 0x08, 0x52, 0xAA, 0x00, 0x00, 0x11, 0xE9, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x2B, 0xD1, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
- 0x2B, 0xF2, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xBA, 0x09, 0x04,
- 0x00, 0x00, 0x2B, 0xF2, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x35, 0x17, 0x11, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x09, 0x25, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x1A, 0x8B, 0x00, 0x00,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
- 0x1A, 0x8C, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x34, 0xB6, 0x00, 0x00,
- 0x2B, 0xF2, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x34, 0xF7, 0x34, 0xF7, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x09, 0x05, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x20,
- 0x09, 0x25, 0x3D, 0xBB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x34, 0x95, 0x00, 0x00, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x23, 0x2F, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x12, 0x09, 0x00, 0x21, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x00, 0xA3, 0x3D, 0x59, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x2C, 0x33, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x00, 0x00, 0x1A, 0x8B, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x09, 0x46, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2B, 0xD1, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x12, 0x09, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xA3, 0x34, 0xD6, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x2C, 0x54, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x82, 0x2C, 0x54, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x23, 0x70, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x20, 0x23, 0x90, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x34, 0xF7,
- 0x12, 0x2A, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x09, 0x46,
- 0x2B, 0xF2, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x3D, 0xDB, 0x23, 0x2E, 0x00, 0x41,
- 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x00, 0x00, 0x08, 0xC3, 0x12, 0x0A, 0x23, 0x90, 0x34, 0xD6, 0x3D, 0xBB, 0x3D, 0xDB, 0x3D, 0xDB,
- 0x3D, 0xDB, 0x3D, 0x79, 0x34, 0x95, 0x23, 0x2F, 0x11, 0xC8, 0x00, 0x62, 0x00, 0x00, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0x09, 0x25,
- 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,};
-const unsigned char img_thunder[4608] = {
- //48x48
- 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B,
- 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B,
- 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B,
- 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B,
- 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B,
- 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B,
- 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B,
- 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B,
- 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B,
- 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B,
- 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x1B, 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B,
- 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B,
- 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B,
- 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B,
- 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B,
- 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B,
- 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B,
- 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B,
- 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B,
- 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B,
- 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFE, 0xCE, 0xFE, 0xCD, 0xFF, 0xFF, 0xEF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B,
- 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B,
- 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x85, 0x5C, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0x11, 0xFD, 0xE0, 0xFF, 0x34, 0xFF, 0xFF, 0xBE, 0x9E, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B,
- 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B,
- 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B,
- 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x7D, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34,
- 0xFD, 0xE0, 0xFD, 0xE0, 0xFF, 0x99, 0xFF, 0xFF, 0x9D, 0xDD, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B,
- 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B,
- 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x74, 0xFC, 0xF7, 0xBF, 0xFF, 0xFF, 0xFF, 0x77, 0xFD, 0xE0,
- 0xFD, 0xE0, 0xFE, 0x46, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0x1C, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B,
- 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0xFD, 0xE0, 0xFD, 0xE0,
- 0xFD, 0xE0, 0xFE, 0xAC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xFD, 0xE1, 0xFD, 0xE0, 0xFD, 0xE0,
- 0xFD, 0xE0, 0xFF, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x23, 0xFD, 0xE0, 0xFD, 0xE0, 0xFD, 0xE0,
- 0xFD, 0xE0, 0xFF, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x46, 0xFD, 0xE0, 0xFD, 0xE0, 0xFD, 0xE0, 0xFD, 0xE0,
- 0xFE, 0x24, 0xFE, 0xF0, 0xFE, 0xF0, 0xFE, 0xF0, 0xFE, 0xF0, 0xFE, 0xF0, 0xFE, 0xF0, 0xFE, 0xF0,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x89, 0xFD, 0xE0, 0xFD, 0xE0, 0xFD, 0xE0, 0xFD, 0xE0, 0xFD, 0xE0,
- 0xFD, 0xE0, 0xFD, 0xE0, 0xFD, 0xE0, 0xFD, 0xE0, 0xFD, 0xE0, 0xFD, 0xE0, 0xFE, 0xCD, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFE, 0xAC, 0xFD, 0xE0, 0xFD, 0xE0, 0xFD, 0xE0, 0xFD, 0xE0, 0xFD, 0xE0, 0xFD, 0xE0,
- 0xFD, 0xE0, 0xFD, 0xE0, 0xFD, 0xE0, 0xFD, 0xE0, 0xFD, 0xE0, 0xFE, 0x8A, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFE, 0xEF, 0xFE, 0x68, 0xFE, 0x68, 0xFE, 0x68, 0xFE, 0x68, 0xFE, 0x68, 0xFE, 0x68, 0xFD, 0xE0,
- 0xFD, 0xE0, 0xFD, 0xE0, 0xFD, 0xE0, 0xFD, 0xE0, 0xFE, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x12, 0xFD, 0xE0,
- 0xFD, 0xE0, 0xFD, 0xE0, 0xFD, 0xE0, 0xFE, 0x24, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xAC, 0xFD, 0xE0,
- 0xFD, 0xE0, 0xFD, 0xE0, 0xFD, 0xE1, 0xFF, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x46, 0xFD, 0xE0,
- 0xFD, 0xE0, 0xFD, 0xE0, 0xFF, 0xBA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0xFD, 0xE1, 0xFD, 0xE0,
- 0xFD, 0xE0, 0xFF, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xFD, 0xE0, 0xFD, 0xE0,
- 0xFF, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xCE, 0xFD, 0xE0, 0xFF, 0x12,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x68, 0xFE, 0xEF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xFE, 0xAC, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x76, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,};
-const unsigned char img_sunny[4608] = {
- //48x48
- 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50,
- 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50,
- 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50,
- 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFE, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xFE, 0x50,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,};
-const unsigned char img_cloudy[4608] = {
- //48x48
- 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80,
- 0xFE, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80,
- 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x80,
- 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80,
- 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x80, 0xFE, 0x80,
- 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80,
- 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x80, 0xFE, 0x80,
- 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80,
- 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80,
- 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80,
- 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80,
- 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80,
- 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80,
- 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80,
- 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80,
- 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80,
- 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80,
- 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80,
- 0xFE, 0x80, 0xFE, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x1F, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80,
- 0xFE, 0x80, 0xFE, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80,
- 0xFE, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1F, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x80, 0xFE, 0x80,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x80, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD6, 0xFE, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD6, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD6, 0xFE,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xD7, 0x1F, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E, 0xD7, 0x1E,
- 0xD7, 0x1E, 0xD7, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,};
-const unsigned char img_raining[4608] = {
- //48x48
- 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x72, 0x6B, 0x72, 0x73, 0x93, 0x7B, 0xD4, 0x84, 0x14,
- 0x7B, 0xD3, 0x73, 0x93, 0x6B, 0x72, 0x73, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x6B, 0x72, 0x8C, 0x75, 0xB5, 0x98, 0xBD, 0xF9, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xBD, 0xD9, 0xA5, 0x17, 0x84, 0x34, 0x73, 0x92, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x72,
- 0x84, 0x14, 0xAD, 0x78, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xCE, 0x5A, 0xC6, 0x3A, 0xA5, 0x17, 0x73, 0x93, 0x6B, 0x72,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x72, 0x9C, 0xF7,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xB5, 0xB9, 0x7B, 0xD3,
- 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x72, 0xB5, 0x98, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xB5, 0x98,
- 0x73, 0x93, 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x73, 0x93, 0x9C, 0xF7, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xB5, 0xB9, 0xA5, 0x17, 0xAD, 0x58, 0xBD, 0xFA,
- 0xA5, 0x37, 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0xD6, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xBD, 0xFA, 0xAD, 0x78, 0x8C, 0x75, 0x6B, 0x72, 0x6B, 0x72, 0x6B, 0x72, 0x6B, 0x72,
- 0x7B, 0xF4, 0x7B, 0xD3, 0x6B, 0x73, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x73, 0x93, 0xBD, 0xD9, 0xC6, 0x3A, 0xC6, 0x3A, 0xCE, 0x5A,
- 0xC6, 0x3A, 0xC6, 0x1A, 0xAD, 0x58, 0x94, 0xB6, 0x8C, 0x75, 0x84, 0x35, 0x8C, 0x55, 0x94, 0x96,
- 0x9C, 0xD6, 0xB5, 0xB9, 0xC6, 0x3A, 0xC6, 0x3A, 0xBD, 0xF9, 0xB5, 0xB8, 0xAD, 0x77, 0x9C, 0xF5,
- 0x8C, 0x74, 0x7B, 0xD3, 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x6B, 0x72, 0x73, 0x93, 0x8C, 0x55, 0xAD, 0x58, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xB5, 0x98, 0x6B, 0x72, 0x6B, 0x72, 0x84, 0x14, 0x8C, 0x54, 0x94, 0x95, 0x8C, 0x74, 0x84, 0x34,
- 0x7B, 0xF3, 0x6B, 0x72, 0x7B, 0xF4, 0x9C, 0xF7, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x1A,
- 0xBD, 0xF8, 0xB5, 0xB7, 0x8C, 0x74, 0x6B, 0x72, 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x73, 0x93, 0x6B, 0x72,
- 0xD6, 0x9C, 0xCE, 0x7B, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xBD, 0xD9, 0xBD, 0xF9, 0xC6, 0x1A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x19, 0xBD, 0xF9,
- 0xBD, 0xD8, 0xAD, 0x56, 0x94, 0x95, 0x73, 0xB3, 0x84, 0x14, 0xAD, 0x78, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x19, 0xB5, 0xB7, 0xB5, 0xB7, 0x7B, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x55, 0xE7, 0x1D,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xCE, 0x5A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x19, 0xB5, 0xB7, 0xAD, 0x56, 0x8C, 0x74, 0x6B, 0x72, 0x94, 0x95, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xBD, 0xF9, 0xB5, 0xB7, 0xB5, 0x97, 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x72, 0xEF, 0x5E, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xBD, 0xF8, 0xB5, 0xB7, 0x94, 0x95, 0x6B, 0x72, 0x8C, 0x55,
- 0xC6, 0x1A, 0xAD, 0x58, 0xA5, 0x17, 0xAD, 0x57, 0xB5, 0xB7, 0x9C, 0xD5, 0x6B, 0x72, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x73, 0xB3, 0xD6, 0xBC, 0xC6, 0x3A, 0xB5, 0xB9,
- 0xA5, 0x37, 0x94, 0x96, 0x84, 0x34, 0xA5, 0x17, 0xB5, 0xB9, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xBD, 0xD8, 0xB5, 0xB7, 0xA5, 0x16, 0x6B, 0x72,
- 0x7B, 0xD3, 0x84, 0x14, 0x73, 0xB3, 0x6B, 0x72, 0x73, 0x93, 0x84, 0x34, 0x7B, 0xD3, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x72, 0xB5, 0x98, 0x7B, 0xD3, 0x6B, 0x72,
- 0x7B, 0xD3, 0x94, 0x95, 0x94, 0x96, 0x94, 0x95, 0xC6, 0x19, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xBD, 0xF8, 0xC6, 0x1A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x1A, 0xB5, 0xB9, 0x94, 0xB5, 0x73, 0x93, 0x73, 0x93,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x73, 0x92, 0x6B, 0x72, 0x94, 0xB5, 0xBD, 0xF9,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xB5, 0xB8, 0x7B, 0xF3,
- 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x72, 0x6B, 0x72, 0xA5, 0x37, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xBD, 0xF9,
- 0x94, 0xB5, 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x72, 0xB5, 0x97, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xCE, 0x5A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xBD, 0xF9, 0x9C, 0xD5, 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x73, 0x92, 0x94, 0xB5, 0xC6, 0x19, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xB5, 0xB7, 0x8C, 0x74, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xD3, 0xB5, 0x97, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xCE, 0x5A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xBD, 0xF9, 0xC6, 0x19, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xBD, 0xD8, 0xB5, 0x97, 0x7B, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x73, 0xB3, 0x8C, 0x74, 0xB5, 0xB7, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xBD, 0xD8, 0xBD, 0xF9, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xBD, 0xF8, 0xB5, 0xB7, 0x8C, 0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x73, 0x92, 0x9C, 0xD5, 0xB5, 0xB7, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xBD, 0xD8, 0xBD, 0xF9,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xBD, 0xD8, 0x94, 0xB5, 0x73, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x6B, 0x72, 0xAD, 0x77, 0xB5, 0xB7, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x19, 0xB5, 0xB7, 0xBD, 0xD8,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xA5, 0x36, 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x6B, 0x72, 0xAD, 0x77, 0xB5, 0xB7, 0xC6, 0x19, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xCE, 0x5A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x19, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xB5, 0xB7, 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x73, 0x92, 0x9C, 0xF6, 0xB5, 0xB7, 0xBD, 0xD8, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x19, 0xA5, 0x36, 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x73, 0xB3, 0x8C, 0x74, 0xB5, 0xB7, 0xB5, 0xB7, 0xBD, 0xF8, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xCE, 0x5A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x19, 0xC6, 0x3A, 0xBD, 0xF9, 0xBD, 0xF9,
- 0xBD, 0xD8, 0xBD, 0xD8, 0xB5, 0xB7, 0x94, 0xB5, 0x73, 0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xD3, 0xB5, 0x97, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB8, 0xBD, 0xF9,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xBD, 0xD8, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB8, 0xB5, 0xB7, 0xB5, 0xB7,
- 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0x8C, 0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x73, 0x92, 0x8C, 0x54, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7,
- 0xB5, 0xB7, 0xAD, 0x77, 0xB5, 0x97, 0xB5, 0xB8, 0xB5, 0xB7, 0xBD, 0xD8, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xCE, 0x5B, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x19, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7,
- 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0x97, 0x73, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x72, 0xAD, 0x57, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7,
- 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB8, 0xC6, 0x1A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x19, 0xBD, 0xF8, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0x84, 0x14,
- 0x94, 0x95, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7,
- 0xB5, 0xB7, 0xB5, 0xB7, 0x8C, 0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x72, 0x6B, 0x72, 0xA5, 0x36, 0xB5, 0xB7, 0xB5, 0xB7,
- 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7,
- 0xBD, 0xF9, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x3A,
- 0xC6, 0x1A, 0xBD, 0xD8, 0xB5, 0xB7, 0xC6, 0x19, 0xBD, 0xF9, 0xC6, 0x3A, 0xBD, 0xD9, 0x6B, 0x72,
- 0xA5, 0x16, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7,
- 0xB5, 0xB7, 0x9C, 0xD5, 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x72, 0x8C, 0x54, 0xA5, 0x36,
- 0xB5, 0x97, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xAD, 0x77, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7,
- 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB8, 0xBD, 0xD8, 0xBD, 0xF9, 0xBD, 0xF8, 0xBD, 0xD8, 0xB5, 0xB7,
- 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xBD, 0xD8, 0x9C, 0xD6, 0x73, 0xB3,
- 0xB5, 0x97, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7,
- 0x94, 0xB5, 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x73, 0x92,
- 0x6B, 0x72, 0x73, 0xB3, 0x7B, 0xF4, 0x7B, 0xF3, 0x6B, 0x72, 0x94, 0x95, 0xB5, 0xB7, 0xB5, 0xB7,
- 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7,
- 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xA5, 0x36, 0x6B, 0x72, 0x94, 0xB5,
- 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xAD, 0x77, 0x7B, 0xF3,
- 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x72, 0x84, 0x34, 0xA5, 0x36,
- 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7,
- 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0x97, 0x94, 0x95, 0x6B, 0x72, 0x84, 0x14, 0xC6, 0x19,
- 0xC6, 0x19, 0xBD, 0xF8, 0xBD, 0xF8, 0xBD, 0xF8, 0xA5, 0x36, 0x8C, 0x74, 0x73, 0x92, 0x73, 0x93,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x73, 0x93, 0x6B, 0x72,
- 0x84, 0x34, 0x9C, 0xD5, 0xB5, 0x97, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7, 0xB5, 0xB7,
- 0xB5, 0xB7, 0xA5, 0x36, 0x94, 0x95, 0x73, 0xB3, 0x73, 0x92, 0x6B, 0x72, 0xFF, 0xFF, 0x73, 0x93,
- 0x73, 0x93, 0x6B, 0x72, 0x6B, 0x72, 0x6B, 0x72, 0x73, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x73, 0xB3, 0x6B, 0x72, 0x6B, 0x73, 0x84, 0x14, 0x8C, 0x54, 0x94, 0x95, 0x8C, 0x74, 0x84, 0x34,
- 0x7B, 0xD3, 0x6B, 0x72, 0x73, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x73, 0x93, 0x73, 0x92, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+const unsigned char img_temp_normal[576] = {
+ //48x48 2bpp
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x05, 0x50,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x15, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x02, 0x80, 0x14,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x02, 0x80, 0x14, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x14, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x14,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x14, 0x01, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0x40, 0x14,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x14, 0x01, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0x40, 0x14,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x14, 0x01, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0x40, 0x14,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x54, 0x01, 0x40, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x40, 0x05,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x01, 0x40, 0x05, 0x40, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+ 0x40, 0x05, 0x50, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x05, 0x50, 0x01,
+ 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x05, 0x50, 0x01, 0x50, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x01, 0x40, 0x05, 0x50, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+ 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x05,
+ 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x15, 0x40, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x50,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+const unsigned short img_temp_normal_palette[4] = {
+ 0xFFFF, 0x0000, 0xFA69, 0x0000,
+};
+
+const unsigned char img_temp_high[576] = {
+ //48x48 2bpp
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x05, 0x50,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x15, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0x40, 0x14,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x14, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x14,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x02, 0x80, 0x14, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x14, 0x02, 0x80, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x14, 0x02, 0x80, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x02, 0x80, 0x14,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x02, 0x80, 0x14, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x14, 0x02, 0x80, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x14, 0x02, 0x80, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x02, 0x80, 0x14,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x02, 0x80, 0x14, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x14, 0x02, 0x80, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x14, 0x02, 0x80, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x02, 0x80, 0x14,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x02, 0x80, 0x14, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x14, 0x02, 0x80, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x54, 0x02, 0x80, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x02, 0x80, 0x05,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x02, 0x80, 0x05, 0x40, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x01, 0x40, 0x02, 0x80, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+ 0x40, 0x0A, 0xA0, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x0E, 0xB0, 0x01,
+ 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x0A, 0xA0, 0x01, 0x50, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x01, 0x40, 0x0A, 0xA0, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+ 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x05,
+ 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x15, 0x40, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x50,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+const unsigned short img_temp_high_palette[4] = {
+ 0xFFFF, 0x0000, 0xFA69, 0xFA6A,
+};
+
+const unsigned char img_humi[1191] = {
+ //48x48 RLE
+ 0x52, 0x4C, 0x45, 0x31, 0x00, 0x30, 0x00, 0x30, 0xC4, 0xFF, 0xFF, 0x00, 0x00, 0x20, 0x84, 0x00,
+ 0x00, 0xA7, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x07, 0x12, 0x09, 0x23, 0x70, 0x34, 0xD6, 0x3D, 0x9A,
+ 0x2C, 0x74, 0x23, 0x2F, 0x08, 0xE4, 0x00, 0x00, 0xA4, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x23,
+ 0x70, 0x85, 0x3D, 0xDB, 0x01, 0x3D, 0x9A, 0x23, 0x0E, 0x81, 0x00, 0x00, 0xA1, 0xFF, 0xFF, 0x02,
+ 0x00, 0x00, 0x00, 0xA3, 0x3D, 0x58, 0x88, 0x3D, 0xDB, 0x00, 0x23, 0xB1, 0x81, 0x00, 0x00, 0x9F,
+ 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x09, 0x25, 0x8B, 0x3D, 0xDB, 0x00, 0x2C, 0x13, 0x81, 0x00, 0x00,
+ 0x9D, 0xFF, 0xFF, 0x02, 0x00, 0x20, 0x00, 0x82, 0x3D, 0x9A, 0x8C, 0x3D, 0xDB, 0x01, 0x2C, 0x54,
+ 0x00, 0x00, 0x9D, 0xFF, 0xFF, 0x01, 0x00, 0x20, 0x34, 0x95, 0x8E, 0x3D, 0xDB, 0x01, 0x23, 0x70,
+ 0x00, 0x00, 0x9B, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x23, 0x2F, 0x90, 0x3D, 0xDB, 0x01, 0x11, 0xE9,
+ 0x00, 0x00, 0x99, 0xFF, 0xFF, 0x01, 0x00, 0x20, 0x11, 0x87, 0x91, 0x3D, 0xDB, 0x00, 0x2C, 0x75,
+ 0x81, 0x00, 0x00, 0x98, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x2C, 0x54, 0x92, 0x3D, 0xDB, 0x01, 0x1A,
+ 0x6B, 0x00, 0x00, 0x97, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x1A, 0xAC, 0x93, 0x3D, 0xDB, 0x02, 0x35,
+ 0x17, 0x00, 0x61, 0x00, 0x00, 0x96, 0xFF, 0xFF, 0x01, 0x00, 0x20, 0x35, 0x38, 0x94, 0x3D, 0xDB,
+ 0x01, 0x23, 0x0E, 0x00, 0x00, 0x95, 0xFF, 0xFF, 0x01, 0x00, 0x20, 0x1A, 0x4A, 0x95, 0x3D, 0xDB,
+ 0x01, 0x3D, 0x9A, 0x08, 0xE4, 0x95, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x2C, 0x54, 0x96, 0x3D, 0xDB,
+ 0x01, 0x23, 0x4F, 0x00, 0x00, 0x94, 0xFF, 0xFF, 0x00, 0x09, 0x46, 0x97, 0x3D, 0xDB, 0x01, 0x35,
+ 0x38, 0x00, 0x00, 0x93, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x23, 0x4F, 0x98, 0x3D, 0xDB, 0x01, 0x11,
+ 0xC8, 0x00, 0x41, 0x92, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x34, 0xF7, 0x98, 0x3D, 0xDB, 0x01, 0x23,
+ 0xB1, 0x00, 0x00, 0x91, 0xFF, 0xFF, 0x01, 0x00, 0x21, 0x11, 0x66, 0x93, 0x3D, 0xDB, 0x01, 0x34,
+ 0xF7, 0x23, 0xB1, 0x83, 0x3D, 0xDB, 0x01, 0x3D, 0xBA, 0x00, 0x41, 0x91, 0xFF, 0xFF, 0x01, 0x00,
+ 0x00, 0x23, 0x0E, 0x86, 0x3D, 0xDB, 0x02, 0x2C, 0x54, 0x23, 0x4F, 0x2C, 0x12, 0x88, 0x3D, 0xDB,
+ 0x02, 0x34, 0xF7, 0x09, 0x04, 0x00, 0x00, 0x84, 0x3D, 0xDB, 0x01, 0x12, 0x2A, 0x00, 0x20, 0x90,
+ 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x34, 0xB6, 0x85, 0x3D, 0xDB, 0x00, 0x1A, 0x2A, 0x82, 0x00, 0x00,
+ 0x01, 0x11, 0x45, 0x3D, 0x79, 0x85, 0x3D, 0xDB, 0x03, 0x34, 0xF7, 0x09, 0x04, 0x00, 0x00, 0x2B,
+ 0xF2, 0x84, 0x3D, 0xDB, 0x01, 0x2C, 0x33, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x01, 0x00, 0x20, 0x08,
+ 0xC3, 0x85, 0x3D, 0xDB, 0x06, 0x2B, 0xF2, 0x00, 0x00, 0x7B, 0xEF, 0xE7, 0x3C, 0x9C, 0xF3, 0x00,
+ 0x00, 0x1A, 0x8C, 0x84, 0x3D, 0xDB, 0x03, 0x34, 0xF7, 0x09, 0x04, 0x00, 0x00, 0x2B, 0xF2, 0x86,
+ 0x3D, 0xDB, 0x00, 0x34, 0xD6, 0x8F, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x11, 0xE9, 0x85, 0x3D, 0xDB,
+ 0x01, 0x1A, 0xED, 0x00, 0x00, 0x82, 0xFF, 0xFF, 0x01, 0x3A, 0x08, 0x11, 0x67, 0x83, 0x3D, 0xDB,
+ 0x03, 0x34, 0xF7, 0x09, 0x04, 0x00, 0x00, 0x2B, 0xF2, 0x87, 0x3D, 0xDB, 0x00, 0x23, 0xB1, 0x8F,
+ 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x23, 0x0E, 0x85, 0x3D, 0xDB, 0x06, 0x2C, 0x13, 0x00, 0x00, 0x9C,
+ 0xD3, 0xEF, 0x7D, 0xC6, 0x38, 0x00, 0x00, 0x1A, 0xAC, 0x82, 0x3D, 0xDB, 0x03, 0x34, 0xF7, 0x09,
+ 0x04, 0x00, 0x00, 0x2B, 0xF2, 0x88, 0x3D, 0xDB, 0x01, 0x1A, 0x8B, 0x00, 0x00, 0x8E, 0xFF, 0xFF,
+ 0x01, 0x00, 0x00, 0x2C, 0x75, 0x86, 0x3D, 0xDB, 0x00, 0x11, 0x87, 0x83, 0x00, 0x00, 0x82, 0x3D,
+ 0xDB, 0x03, 0x34, 0xF7, 0x09, 0x04, 0x00, 0x00, 0x2B, 0xF2, 0x89, 0x3D, 0xDB, 0x00, 0x34, 0xD6,
+ 0x8F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x88, 0x3D, 0xDB, 0x02, 0x1A, 0xED, 0x11, 0xA8, 0x1A, 0x8B,
+ 0x82, 0x3D, 0xDB, 0x03, 0x34, 0xF7, 0x09, 0x04, 0x00, 0x00, 0x2B, 0xF2, 0x8A, 0x3D, 0xDB, 0x00,
+ 0x2C, 0x74, 0x8E, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xA3, 0x8D, 0x3D, 0xDB, 0x03, 0x34, 0xF7,
+ 0x09, 0x04, 0x00, 0x00, 0x2B, 0xF2, 0x8B, 0x3D, 0xDB, 0x01, 0x34, 0xD6, 0x00, 0x00, 0x8D, 0xFF,
+ 0xFF, 0x01, 0x00, 0x00, 0x11, 0x66, 0x8C, 0x3D, 0xDB, 0x03, 0x34, 0xF7, 0x09, 0x04, 0x00, 0x00,
+ 0x2B, 0xF2, 0x8C, 0x3D, 0xDB, 0x01, 0x35, 0x38, 0x00, 0x00, 0x8D, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+ 0x12, 0x2A, 0x8B, 0x3D, 0xDB, 0x03, 0x34, 0xF7, 0x09, 0x04, 0x00, 0x00, 0x2B, 0xF2, 0x82, 0x3D,
+ 0xDB, 0x81, 0x34, 0xF7, 0x88, 0x3D, 0xDB, 0x01, 0x3D, 0x9A, 0x00, 0x00, 0x8D, 0xFF, 0xFF, 0x01,
+ 0x00, 0x00, 0x1A, 0xED, 0x8A, 0x3D, 0xDB, 0x03, 0x34, 0xF7, 0x09, 0x04, 0x00, 0x00, 0x2B, 0xF2,
+ 0x81, 0x3D, 0xDB, 0x01, 0x35, 0x17, 0x11, 0xA7, 0x81, 0x00, 0x00, 0x00, 0x09, 0x25, 0x88, 0x3D,
+ 0xDB, 0x00, 0x00, 0x00, 0x8D, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x12, 0x09, 0x89, 0x3D, 0xDB, 0x03,
+ 0x34, 0xF7, 0x09, 0x04, 0x00, 0x00, 0x2B, 0xF2, 0x82, 0x3D, 0xDB, 0x05, 0x1A, 0x4B, 0x00, 0x00,
+ 0x5A, 0xEB, 0x6B, 0x4D, 0x18, 0xC3, 0x11, 0xE9, 0x86, 0x3D, 0xDB, 0x01, 0x3D, 0x79, 0x00, 0x00,
+ 0x8D, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x09, 0x45, 0x88, 0x3D, 0xDB, 0x03, 0x34, 0xF7, 0x09, 0x04,
+ 0x00, 0x00, 0x2B, 0xF2, 0x83, 0x3D, 0xDB, 0x01, 0x08, 0xC3, 0x4A, 0x49, 0x81, 0xFF, 0xFF, 0x02,
+ 0x94, 0x92, 0x00, 0x00, 0x34, 0xF7, 0x85, 0x3D, 0xDB, 0x01, 0x35, 0x17, 0x00, 0x00, 0x8D, 0xFF,
+ 0xFF, 0x01, 0x00, 0x00, 0x00, 0x41, 0x87, 0x3D, 0xDB, 0x03, 0x34, 0xF7, 0x09, 0x04, 0x00, 0x00,
+ 0x2B, 0xF2, 0x84, 0x3D, 0xDB, 0x01, 0x08, 0xC3, 0x31, 0x86, 0x81, 0xFF, 0xFF, 0x02, 0x7B, 0xEF,
+ 0x00, 0x00, 0x34, 0xF7, 0x85, 0x3D, 0xDB, 0x01, 0x34, 0x95, 0x00, 0x00, 0x8E, 0xFF, 0xFF, 0x01,
+ 0x00, 0x00, 0x35, 0x38, 0x85, 0x3D, 0xDB, 0x03, 0x34, 0xF7, 0x09, 0x04, 0x00, 0x00, 0x2B, 0xF2,
+ 0x85, 0x3D, 0xDB, 0x05, 0x1A, 0x4B, 0x00, 0x00, 0x42, 0x08, 0x52, 0xAA, 0x00, 0x00, 0x11, 0xE9,
+ 0x86, 0x3D, 0xDB, 0x01, 0x2B, 0xD1, 0x00, 0x00, 0x8E, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x2B, 0xF2,
+ 0x84, 0x3D, 0xDB, 0x03, 0x3D, 0xBA, 0x09, 0x04, 0x00, 0x00, 0x2B, 0xF2, 0x86, 0x3D, 0xDB, 0x01,
+ 0x35, 0x17, 0x11, 0xA7, 0x81, 0x00, 0x00, 0x00, 0x09, 0x25, 0x87, 0x3D, 0xDB, 0x01, 0x1A, 0x8B,
+ 0x00, 0x00, 0x8E, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x1A, 0x8C, 0x84, 0x3D, 0xDB, 0x02, 0x34, 0xB6,
+ 0x00, 0x00, 0x2B, 0xF2, 0x89, 0x3D, 0xDB, 0x81, 0x34, 0xF7, 0x88, 0x3D, 0xDB, 0x00, 0x09, 0x05,
+ 0x8F, 0xFF, 0xFF, 0x02, 0x00, 0x20, 0x09, 0x25, 0x3D, 0xBB, 0x9A, 0x3D, 0xDB, 0x01, 0x34, 0x95,
+ 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x23, 0x2F, 0x9A, 0x3D, 0xDB, 0x01, 0x12, 0x09,
+ 0x00, 0x21, 0x90, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xA3, 0x3D, 0x59, 0x98, 0x3D, 0xDB, 0x01,
+ 0x2C, 0x33, 0x00, 0x00, 0x92, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x1A, 0x8B, 0x98, 0x3D, 0xDB, 0x01,
+ 0x09, 0x46, 0x00, 0x20, 0x93, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x2B, 0xD1, 0x96, 0x3D, 0xDB, 0x01,
+ 0x12, 0x09, 0x00, 0x00, 0x94, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xA3, 0x34, 0xD6, 0x94, 0x3D,
+ 0xDB, 0x01, 0x2C, 0x54, 0x00, 0x00, 0x96, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x82, 0x2C, 0x54,
+ 0x92, 0x3D, 0xDB, 0x01, 0x23, 0x70, 0x00, 0x00, 0x99, 0xFF, 0xFF, 0x01, 0x00, 0x20, 0x23, 0x90,
+ 0x8F, 0x3D, 0xDB, 0x02, 0x34, 0xF7, 0x12, 0x2A, 0x00, 0x00, 0x9B, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+ 0x09, 0x46, 0x2B, 0xF2, 0x8C, 0x3D, 0xDB, 0x02, 0x23, 0x2E, 0x00, 0x41, 0x00, 0x00, 0x9E, 0xFF,
+ 0xFF, 0x05, 0x00, 0x00, 0x08, 0xC3, 0x12, 0x0A, 0x23, 0x90, 0x34, 0xD6, 0x3D, 0xBB, 0x82, 0x3D,
+ 0xDB, 0x05, 0x3D, 0x79, 0x34, 0x95, 0x23, 0x2F, 0x11, 0xC8, 0x00, 0x62, 0x00, 0x00, 0xA2, 0xFF,
+ 0xFF, 0x00, 0x00, 0x20, 0x82, 0x00, 0x00, 0x02, 0x00, 0xA3, 0x09, 0x25, 0x00, 0x41, 0x82, 0x00,
+ 0x00, 0x00, 0x00, 0x20, 0xC1, 0xFF, 0xFF,
+};
+
+const unsigned char img_lum[576] = {
+ //48x48 2bpp
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00,
+ 0x00, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x02, 0xAA, 0x80,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0x00, 0x00, 0x02, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x0A, 0xA8, 0x00, 0x00, 0x00, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA8, 0x00,
+ 0x00, 0x00, 0x2A, 0x80, 0x00, 0x01, 0x55, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x02, 0x00,
+ 0x00, 0x55, 0x55, 0x54, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55,
+ 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+ 0x55, 0x54, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x00, 0x05,
+ 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
+ 0x50, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00,
+ 0x05, 0x50, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0xA0,
+ 0x2A, 0xA8, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x05, 0x54, 0x02, 0xA8, 0xAA, 0xAA, 0x00, 0x55,
+ 0x40, 0x00, 0x00, 0x00, 0x05, 0x54, 0x02, 0xAA, 0x2A, 0xA8, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00,
+ 0x05, 0x54, 0x02, 0xAA, 0x0A, 0xA0, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x05, 0x54, 0x02, 0xA8,
+ 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x05, 0x50, 0x02, 0xA8, 0x00, 0x00, 0x00, 0x55,
+ 0x40, 0x00, 0x00, 0x00, 0x15, 0x50, 0x0A, 0xA8, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00,
+ 0x55, 0x50, 0x0A, 0xA8, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x55, 0x50, 0x0A, 0xA8,
+ 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x01, 0x55, 0x40, 0x2A, 0xA0, 0x00, 0x00, 0x00, 0x05,
+ 0x55, 0x40, 0x00, 0x05, 0x55, 0x00, 0x2A, 0xA0, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x55,
+ 0x55, 0x00, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x54, 0x00, 0xAA, 0x80,
+ 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x40, 0x02, 0xAA, 0x80, 0x00, 0x00, 0x02, 0x00,
+ 0x01, 0x55, 0x55, 0x55, 0x00, 0x0A, 0xAA, 0x00, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x15, 0x55, 0x50,
+ 0x00, 0x2A, 0xAA, 0x00, 0x00, 0x00, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xA8, 0x00,
+ 0x00, 0x02, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xA0, 0x00, 0x00, 0x02, 0xAA, 0x80,
+ 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x2A,
+ 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x02, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+const unsigned short img_lum_palette[4] = {
+ 0xFFFF, 0x0D4B, 0xFE02, 0x0000,
+};
+
+const unsigned char img_thunder[559] = {
+ //48x48 RLE
+ 0x52, 0x4C, 0x45, 0x31, 0x00, 0x30, 0x00, 0x30, 0x99, 0xFF, 0xFF, 0x82, 0x4C, 0x3B, 0xAA, 0xFF,
+ 0xFF, 0x87, 0x4C, 0x3B, 0xA5, 0xFF, 0xFF, 0x8A, 0x4C, 0x3B, 0xA3, 0xFF, 0xFF, 0x85, 0x4C, 0x3B,
+ 0x82, 0xFF, 0xFF, 0x83, 0x4C, 0x3B, 0xA1, 0xFF, 0xFF, 0x83, 0x4C, 0x3B, 0x86, 0xFF, 0xFF, 0x83,
+ 0x4C, 0x3B, 0x9B, 0xFF, 0xFF, 0x87, 0x4C, 0x3B, 0x88, 0xFF, 0xFF, 0x82, 0x4C, 0x3B, 0x9A, 0xFF,
+ 0xFF, 0x88, 0x4C, 0x3B, 0x88, 0xFF, 0xFF, 0x83, 0x4C, 0x3B, 0x97, 0xFF, 0xFF, 0x89, 0x4C, 0x3B,
+ 0x8A, 0xFF, 0xFF, 0x82, 0x4C, 0x3B, 0x97, 0xFF, 0xFF, 0x83, 0x4C, 0x3B, 0x82, 0xFF, 0xFF, 0x82,
+ 0x4C, 0x3B, 0x8A, 0xFF, 0xFF, 0x82, 0x4C, 0x3B, 0x96, 0xFF, 0xFF, 0x00, 0x4C, 0x1B, 0x81, 0x4C,
+ 0x3B, 0x92, 0xFF, 0xFF, 0x82, 0x4C, 0x3B, 0x96, 0xFF, 0xFF, 0x82, 0x4C, 0x3B, 0x93, 0xFF, 0xFF,
+ 0x83, 0x4C, 0x3B, 0x92, 0xFF, 0xFF, 0x84, 0x4C, 0x3B, 0x93, 0xFF, 0xFF, 0x85, 0x4C, 0x3B, 0x8F,
+ 0xFF, 0xFF, 0x84, 0x4C, 0x3B, 0x95, 0xFF, 0xFF, 0x85, 0x4C, 0x3B, 0x8D, 0xFF, 0xFF, 0x83, 0x4C,
+ 0x3B, 0x9A, 0xFF, 0xFF, 0x82, 0x4C, 0x3B, 0x8C, 0xFF, 0xFF, 0x83, 0x4C, 0x3B, 0x9C, 0xFF, 0xFF,
+ 0x82, 0x4C, 0x3B, 0x8B, 0xFF, 0xFF, 0x82, 0x4C, 0x3B, 0x9D, 0xFF, 0xFF, 0x82, 0x4C, 0x3B, 0x8B,
+ 0xFF, 0xFF, 0x81, 0x4C, 0x3B, 0x9F, 0xFF, 0xFF, 0x81, 0x4C, 0x3B, 0x8B, 0xFF, 0xFF, 0x81, 0x4C,
+ 0x3B, 0x9F, 0xFF, 0xFF, 0x81, 0x4C, 0x3B, 0x8B, 0xFF, 0xFF, 0x81, 0x4C, 0x3B, 0x93, 0xFF, 0xFF,
+ 0x00, 0xFF, 0xBC, 0x89, 0xFF, 0xFF, 0x82, 0x4C, 0x3B, 0x8B, 0xFF, 0xFF, 0x82, 0x4C, 0x3B, 0x91,
+ 0xFF, 0xFF, 0x00, 0xFE, 0xAB, 0x8A, 0xFF, 0xFF, 0x82, 0x4C, 0x3B, 0x8C, 0xFF, 0xFF, 0x82, 0x4C,
+ 0x3B, 0x8F, 0xFF, 0xFF, 0x03, 0xFE, 0xCE, 0xFE, 0xCD, 0xFF, 0xFF, 0xEF, 0x9F, 0x87, 0xFF, 0xFF,
+ 0x82, 0x4C, 0x3B, 0x8D, 0xFF, 0xFF, 0x8E, 0x4C, 0x3B, 0x00, 0x85, 0x5C, 0x81, 0xFF, 0xFF, 0x04,
+ 0xFF, 0x11, 0xFD, 0xE0, 0xFF, 0x34, 0xFF, 0xFF, 0xBE, 0x9E, 0x8A, 0x4C, 0x3B, 0x8E, 0xFF, 0xFF,
+ 0x8C, 0x4C, 0x3B, 0x00, 0x7D, 0x3C, 0x81, 0xFF, 0xFF, 0x00, 0xFF, 0x34, 0x81, 0xFD, 0xE0, 0x02,
+ 0xFF, 0x99, 0xFF, 0xFF, 0x9D, 0xDD, 0x88, 0x4C, 0x3B, 0x93, 0xFF, 0xFF, 0x88, 0x4C, 0x3B, 0x03,
+ 0x74, 0xFC, 0xF7, 0xBF, 0xFF, 0xFF, 0xFF, 0x77, 0x81, 0xFD, 0xE0, 0x00, 0xFE, 0x46, 0x81, 0xFF,
+ 0xFF, 0x00, 0x7D, 0x1C, 0x86, 0x4C, 0x3B, 0xA0, 0xFF, 0xFF, 0x00, 0xFF, 0x99, 0x82, 0xFD, 0xE0,
+ 0x00, 0xFE, 0xAC, 0xA9, 0xFF, 0xFF, 0x01, 0xFF, 0xDD, 0xFD, 0xE1, 0x82, 0xFD, 0xE0, 0x00, 0xFF,
+ 0x11, 0xA9, 0xFF, 0xFF, 0x00, 0xFE, 0x23, 0x83, 0xFD, 0xE0, 0x00, 0xFF, 0x77, 0xA8, 0xFF, 0xFF,
+ 0x00, 0xFE, 0x46, 0x83, 0xFD, 0xE0, 0x00, 0xFE, 0x24, 0x86, 0xFE, 0xF0, 0xA1, 0xFF, 0xFF, 0x00,
+ 0xFE, 0x89, 0x8A, 0xFD, 0xE0, 0x00, 0xFE, 0xCD, 0xA1, 0xFF, 0xFF, 0x00, 0xFE, 0xAC, 0x8A, 0xFD,
+ 0xE0, 0x00, 0xFE, 0x8A, 0xA1, 0xFF, 0xFF, 0x00, 0xFE, 0xEF, 0x85, 0xFE, 0x68, 0x84, 0xFD, 0xE0,
+ 0x00, 0xFE, 0x47, 0xA8, 0xFF, 0xFF, 0x00, 0xFF, 0x12, 0x83, 0xFD, 0xE0, 0x00, 0xFE, 0x24, 0xA9,
+ 0xFF, 0xFF, 0x00, 0xFE, 0xAC, 0x82, 0xFD, 0xE0, 0x01, 0xFD, 0xE1, 0xFF, 0xDD, 0xA9, 0xFF, 0xFF,
+ 0x00, 0xFE, 0x46, 0x82, 0xFD, 0xE0, 0x00, 0xFF, 0xBA, 0xA9, 0xFF, 0xFF, 0x01, 0xFF, 0x99, 0xFD,
+ 0xE1, 0x81, 0xFD, 0xE0, 0x00, 0xFF, 0x78, 0xAA, 0xFF, 0xFF, 0x00, 0xFF, 0x34, 0x81, 0xFD, 0xE0,
+ 0x00, 0xFF, 0x55, 0xAB, 0xFF, 0xFF, 0x02, 0xFE, 0xCE, 0xFD, 0xE0, 0xFF, 0x12, 0xAC, 0xFF, 0xFF,
+ 0x01, 0xFE, 0x68, 0xFE, 0xEF, 0xAC, 0xFF, 0xFF, 0x01, 0xFF, 0xBC, 0xFE, 0xAC, 0xAD, 0xFF, 0xFF,
+ 0x00, 0xFF, 0x76, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0xFF, 0xFF,
+};
+
+const unsigned char img_sunny[401] = {
+ //48x48 RLE
+ 0x52, 0x4C, 0x45, 0x31, 0x00, 0x30, 0x00, 0x30, 0xC6, 0xFF, 0xFF, 0x81, 0xFE, 0x50, 0xAD, 0xFF,
+ 0xFF, 0x81, 0xFE, 0x50, 0xAD, 0xFF, 0xFF, 0x81, 0xFE, 0x50, 0xAD, 0xFF, 0xFF, 0x81, 0xFE, 0x50,
+ 0xAD, 0xFF, 0xFF, 0x81, 0xFE, 0x50, 0xAD, 0xFF, 0xFF, 0x81, 0xFE, 0x50, 0xAD, 0xFF, 0xFF, 0x00,
+ 0xFE, 0x50, 0x8E, 0xFF, 0xFF, 0x81, 0xFE, 0x50, 0x8E, 0xFF, 0xFF, 0x81, 0xFE, 0x50, 0x9B, 0xFF,
+ 0xFF, 0x82, 0xFE, 0x50, 0x8E, 0xFF, 0xFF, 0x82, 0xFE, 0x50, 0x99, 0xFF, 0xFF, 0x82, 0xFE, 0x50,
+ 0x90, 0xFF, 0xFF, 0x82, 0xFE, 0x50, 0x97, 0xFF, 0xFF, 0x82, 0xFE, 0x50, 0x92, 0xFF, 0xFF, 0x82,
+ 0xFE, 0x50, 0x88, 0xFF, 0xFF, 0x83, 0xFE, 0x50, 0x89, 0xFF, 0xFF, 0x81, 0xFE, 0x50, 0x94, 0xFF,
+ 0xFF, 0x00, 0xFE, 0x50, 0x86, 0xFF, 0xFF, 0x89, 0xFE, 0x50, 0xA3, 0xFF, 0xFF, 0x8D, 0xFE, 0x50,
+ 0x9F, 0xFF, 0xFF, 0x91, 0xFE, 0x50, 0x9D, 0xFF, 0xFF, 0x91, 0xFE, 0x50, 0x9C, 0xFF, 0xFF, 0x93,
+ 0xFE, 0x50, 0x9A, 0xFF, 0xFF, 0x95, 0xFE, 0x50, 0x99, 0xFF, 0xFF, 0x95, 0xFE, 0x50, 0x98, 0xFF,
+ 0xFF, 0x97, 0xFE, 0x50, 0x97, 0xFF, 0xFF, 0x97, 0xFE, 0x50, 0x97, 0xFF, 0xFF, 0x97, 0xFE, 0x50,
+ 0x96, 0xFF, 0xFF, 0x99, 0xFE, 0x50, 0x8B, 0xFF, 0xFF, 0x85, 0xFE, 0x50, 0x83, 0xFF, 0xFF, 0x99,
+ 0xFE, 0x50, 0x83, 0xFF, 0xFF, 0x85, 0xFE, 0x50, 0x81, 0xFF, 0xFF, 0x86, 0xFE, 0x50, 0x82, 0xFF,
+ 0xFF, 0x99, 0xFE, 0x50, 0x82, 0xFF, 0xFF, 0x86, 0xFE, 0x50, 0x8B, 0xFF, 0xFF, 0x99, 0xFE, 0x50,
+ 0x96, 0xFF, 0xFF, 0x97, 0xFE, 0x50, 0x97, 0xFF, 0xFF, 0x97, 0xFE, 0x50, 0x97, 0xFF, 0xFF, 0x97,
+ 0xFE, 0x50, 0x98, 0xFF, 0xFF, 0x95, 0xFE, 0x50, 0x99, 0xFF, 0xFF, 0x95, 0xFE, 0x50, 0x9A, 0xFF,
+ 0xFF, 0x93, 0xFE, 0x50, 0x9B, 0xFF, 0xFF, 0x93, 0xFE, 0x50, 0x9D, 0xFF, 0xFF, 0x8F, 0xFE, 0x50,
+ 0x9B, 0xFF, 0xFF, 0x00, 0xFE, 0x50, 0x83, 0xFF, 0xFF, 0x8D, 0xFE, 0x50, 0x9B, 0xFF, 0xFF, 0x82,
+ 0xFE, 0x50, 0x84, 0xFF, 0xFF, 0x89, 0xFE, 0x50, 0x86, 0xFF, 0xFF, 0x00, 0xFE, 0x50, 0x94, 0xFF,
+ 0xFF, 0x82, 0xFE, 0x50, 0x88, 0xFF, 0xFF, 0x83, 0xFE, 0x50, 0x88, 0xFF, 0xFF, 0x82, 0xFE, 0x50,
+ 0x92, 0xFF, 0xFF, 0x82, 0xFE, 0x50, 0x97, 0xFF, 0xFF, 0x82, 0xFE, 0x50, 0x90, 0xFF, 0xFF, 0x82,
+ 0xFE, 0x50, 0x99, 0xFF, 0xFF, 0x82, 0xFE, 0x50, 0x90, 0xFF, 0xFF, 0x00, 0xFE, 0x50, 0x9B, 0xFF,
+ 0xFF, 0x81, 0xFE, 0x50, 0x9E, 0xFF, 0xFF, 0x81, 0xFE, 0x50, 0xAD, 0xFF, 0xFF, 0x81, 0xFE, 0x50,
+ 0xAD, 0xFF, 0xFF, 0x81, 0xFE, 0x50, 0xAD, 0xFF, 0xFF, 0x81, 0xFE, 0x50, 0xAD, 0xFF, 0xFF, 0x81,
+ 0xFE, 0x50, 0xAD, 0xFF, 0xFF, 0x81, 0xFE, 0x50, 0xAD, 0xFF, 0xFF, 0x81, 0xFE, 0x50, 0xC6, 0xFF,
+ 0xFF,
+};
+
+const unsigned char img_cloudy[272] = {
+ //48x48 RLE
+ 0x52, 0x4C, 0x45, 0x31, 0x00, 0x30, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xBA, 0xFF, 0xFF, 0x86, 0xFE, 0x80, 0xA6, 0xFF, 0xFF, 0x8A, 0xFE, 0x80, 0xA3, 0xFF, 0xFF,
+ 0x8C, 0xFE, 0x80, 0xA1, 0xFF, 0xFF, 0x8E, 0xFE, 0x80, 0xA0, 0xFF, 0xFF, 0x8E, 0xFE, 0x80, 0x9F,
+ 0xFF, 0xFF, 0x8F, 0xFE, 0x80, 0x9F, 0xFF, 0xFF, 0x8E, 0xFE, 0x80, 0xA0, 0xFF, 0xFF, 0x8D, 0xFE,
+ 0x80, 0x86, 0xFF, 0xFF, 0x86, 0xD7, 0x1E, 0x93, 0xFF, 0xFF, 0x8D, 0xFE, 0x80, 0x84, 0xFF, 0xFF,
+ 0x8A, 0xD7, 0x1E, 0x91, 0xFF, 0xFF, 0x8C, 0xFE, 0x80, 0x83, 0xFF, 0xFF, 0x00, 0xD7, 0x1F, 0x8D,
+ 0xD7, 0x1E, 0x8F, 0xFF, 0xFF, 0x84, 0xFE, 0x80, 0x8A, 0xFF, 0xFF, 0x90, 0xD7, 0x1E, 0x8E, 0xFF,
+ 0xFF, 0x83, 0xFE, 0x80, 0x8A, 0xFF, 0xFF, 0x91, 0xD7, 0x1E, 0x00, 0xD7, 0x1F, 0x8E, 0xFF, 0xFF,
+ 0x81, 0xFE, 0x80, 0x8B, 0xFF, 0xFF, 0x92, 0xD7, 0x1E, 0x8E, 0xFF, 0xFF, 0x00, 0xFE, 0x80, 0x85,
+ 0xFF, 0xFF, 0x84, 0xD7, 0x1E, 0x00, 0xD6, 0xFE, 0x94, 0xD7, 0x1E, 0x92, 0xFF, 0xFF, 0x9D, 0xD7,
+ 0x1E, 0x8F, 0xFF, 0xFF, 0x9F, 0xD7, 0x1E, 0x8F, 0xFF, 0xFF, 0x9F, 0xD7, 0x1E, 0x8E, 0xFF, 0xFF,
+ 0xA0, 0xD7, 0x1E, 0x8E, 0xFF, 0xFF, 0xA0, 0xD7, 0x1E, 0x8D, 0xFF, 0xFF, 0xA1, 0xD7, 0x1E, 0x8D,
+ 0xFF, 0xFF, 0xA1, 0xD7, 0x1E, 0x8D, 0xFF, 0xFF, 0xA1, 0xD7, 0x1E, 0x8D, 0xFF, 0xFF, 0xA0, 0xD7,
+ 0x1E, 0x00, 0xD6, 0xFE, 0x8D, 0xFF, 0xFF, 0xA0, 0xD7, 0x1E, 0x8E, 0xFF, 0xFF, 0x9F, 0xD7, 0x1E,
+ 0x00, 0xD6, 0xFE, 0x8F, 0xFF, 0xFF, 0x9E, 0xD7, 0x1E, 0x90, 0xFF, 0xFF, 0x00, 0xD7, 0x1F, 0x9C,
+ 0xD7, 0x1E, 0x92, 0xFF, 0xFF, 0x9B, 0xD7, 0x1E, 0x94, 0xFF, 0xFF, 0x99, 0xD7, 0x1E, 0x97, 0xFF,
+ 0xFF, 0x95, 0xD7, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xFF, 0xFF,
+};
+
+const unsigned char img_raining[1275] = {
+ //48x48 RLE
+ 0x52, 0x4C, 0x45, 0x31, 0x00, 0x30, 0x00, 0x30, 0xC3, 0xFF, 0xFF, 0x81, 0x6B, 0x72, 0x06, 0x73,
+ 0x93, 0x7B, 0xD4, 0x84, 0x14, 0x7B, 0xD3, 0x73, 0x93, 0x6B, 0x72, 0x73, 0xB3, 0xA4, 0xFF, 0xFF,
+ 0x03, 0x6B, 0x72, 0x8C, 0x75, 0xB5, 0x98, 0xBD, 0xF9, 0x84, 0xC6, 0x3A, 0x03, 0xBD, 0xD9, 0xA5,
+ 0x17, 0x84, 0x34, 0x73, 0x92, 0xA0, 0xFF, 0xFF, 0x02, 0x6B, 0x72, 0x84, 0x14, 0xAD, 0x78, 0x88,
+ 0xC6, 0x3A, 0x04, 0xCE, 0x5A, 0xC6, 0x3A, 0xA5, 0x17, 0x73, 0x93, 0x6B, 0x72, 0x9D, 0xFF, 0xFF,
+ 0x01, 0x6B, 0x72, 0x9C, 0xF7, 0x8D, 0xC6, 0x3A, 0x02, 0xB5, 0xB9, 0x7B, 0xD3, 0x6B, 0x72, 0x9B,
+ 0xFF, 0xFF, 0x01, 0x6B, 0x72, 0xB5, 0x98, 0x8F, 0xC6, 0x3A, 0x02, 0xB5, 0x98, 0x73, 0x93, 0x6B,
+ 0x72, 0x99, 0xFF, 0xFF, 0x01, 0x73, 0x93, 0x9C, 0xF7, 0x8D, 0xC6, 0x3A, 0x05, 0xB5, 0xB9, 0xA5,
+ 0x17, 0xAD, 0x58, 0xBD, 0xFA, 0xA5, 0x37, 0x6B, 0x72, 0x99, 0xFF, 0xFF, 0x00, 0x9C, 0xD6, 0x8B,
+ 0xC6, 0x3A, 0x02, 0xBD, 0xFA, 0xAD, 0x78, 0x8C, 0x75, 0x83, 0x6B, 0x72, 0x02, 0x7B, 0xF4, 0x7B,
+ 0xD3, 0x6B, 0x73, 0x97, 0xFF, 0xFF, 0x01, 0x73, 0x93, 0xBD, 0xD9, 0x81, 0xC6, 0x3A, 0x0A, 0xCE,
+ 0x5A, 0xC6, 0x3A, 0xC6, 0x1A, 0xAD, 0x58, 0x94, 0xB6, 0x8C, 0x75, 0x84, 0x35, 0x8C, 0x55, 0x94,
+ 0x96, 0x9C, 0xD6, 0xB5, 0xB9, 0x81, 0xC6, 0x3A, 0x06, 0xBD, 0xF9, 0xB5, 0xB8, 0xAD, 0x77, 0x9C,
+ 0xF5, 0x8C, 0x74, 0x7B, 0xD3, 0x6B, 0x72, 0x94, 0xFF, 0xFF, 0x03, 0x6B, 0x72, 0x73, 0x93, 0x8C,
+ 0x55, 0xAD, 0x58, 0x83, 0xC6, 0x3A, 0x00, 0xB5, 0x98, 0x81, 0x6B, 0x72, 0x08, 0x84, 0x14, 0x8C,
+ 0x54, 0x94, 0x95, 0x8C, 0x74, 0x84, 0x34, 0x7B, 0xF3, 0x6B, 0x72, 0x7B, 0xF4, 0x9C, 0xF7, 0x82,
+ 0xC6, 0x3A, 0x03, 0xC6, 0x1A, 0xBD, 0xF8, 0xB5, 0xB7, 0x8C, 0x74, 0x81, 0x6B, 0x72, 0x90, 0xFF,
+ 0xFF, 0x03, 0x73, 0x93, 0x6B, 0x72, 0xD6, 0x9C, 0xCE, 0x7B, 0x86, 0xC6, 0x3A, 0x02, 0xBD, 0xD9,
+ 0xBD, 0xF9, 0xC6, 0x1A, 0x81, 0xC6, 0x3A, 0x07, 0xC6, 0x19, 0xBD, 0xF9, 0xBD, 0xD8, 0xAD, 0x56,
+ 0x94, 0x95, 0x73, 0xB3, 0x84, 0x14, 0xAD, 0x78, 0x82, 0xC6, 0x3A, 0x00, 0xC6, 0x19, 0x81, 0xB5,
+ 0xB7, 0x00, 0x7B, 0xF3, 0x90, 0xFF, 0xFF, 0x01, 0x8C, 0x55, 0xE7, 0x1D, 0x81, 0xC6, 0x3A, 0x00,
+ 0xCE, 0x5A, 0x8D, 0xC6, 0x3A, 0x05, 0xC6, 0x19, 0xB5, 0xB7, 0xAD, 0x56, 0x8C, 0x74, 0x6B, 0x72,
+ 0x94, 0x95, 0x82, 0xC6, 0x3A, 0x03, 0xBD, 0xF9, 0xB5, 0xB7, 0xB5, 0x97, 0x6B, 0x72, 0x8E, 0xFF,
+ 0xFF, 0x01, 0x6B, 0x72, 0xEF, 0x5E, 0x93, 0xC6, 0x3A, 0x0B, 0xBD, 0xF8, 0xB5, 0xB7, 0x94, 0x95,
+ 0x6B, 0x72, 0x8C, 0x55, 0xC6, 0x1A, 0xAD, 0x58, 0xA5, 0x17, 0xAD, 0x57, 0xB5, 0xB7, 0x9C, 0xD5,
+ 0x6B, 0x72, 0x8C, 0xFF, 0xFF, 0x08, 0x73, 0xB3, 0xD6, 0xBC, 0xC6, 0x3A, 0xB5, 0xB9, 0xA5, 0x37,
+ 0x94, 0x96, 0x84, 0x34, 0xA5, 0x17, 0xB5, 0xB9, 0x8E, 0xC6, 0x3A, 0x0A, 0xBD, 0xD8, 0xB5, 0xB7,
+ 0xA5, 0x16, 0x6B, 0x72, 0x7B, 0xD3, 0x84, 0x14, 0x73, 0xB3, 0x6B, 0x72, 0x73, 0x93, 0x84, 0x34,
+ 0x7B, 0xD3, 0x8C, 0xFF, 0xFF, 0x08, 0x6B, 0x72, 0xB5, 0x98, 0x7B, 0xD3, 0x6B, 0x72, 0x7B, 0xD3,
+ 0x94, 0x95, 0x94, 0x96, 0x94, 0x95, 0xC6, 0x19, 0x8F, 0xC6, 0x3A, 0x01, 0xBD, 0xF8, 0xC6, 0x1A,
+ 0x83, 0xC6, 0x3A, 0x02, 0xC6, 0x1A, 0xB5, 0xB9, 0x94, 0xB5, 0x81, 0x73, 0x93, 0x8B, 0xFF, 0xFF,
+ 0x03, 0x73, 0x92, 0x6B, 0x72, 0x94, 0xB5, 0xBD, 0xF9, 0x9D, 0xC6, 0x3A, 0x02, 0xB5, 0xB8, 0x7B,
+ 0xF3, 0x6B, 0x72, 0x89, 0xFF, 0xFF, 0x81, 0x6B, 0x72, 0x00, 0xA5, 0x37, 0xA0, 0xC6, 0x3A, 0x02,
+ 0xBD, 0xF9, 0x94, 0xB5, 0x6B, 0x72, 0x88, 0xFF, 0xFF, 0x01, 0x6B, 0x72, 0xB5, 0x97, 0x84, 0xC6,
+ 0x3A, 0x00, 0xCE, 0x5A, 0x9C, 0xC6, 0x3A, 0x02, 0xBD, 0xF9, 0x9C, 0xD5, 0x6B, 0x72, 0x86, 0xFF,
+ 0xFF, 0x02, 0x73, 0x92, 0x94, 0xB5, 0xC6, 0x19, 0xA3, 0xC6, 0x3A, 0x01, 0xB5, 0xB7, 0x8C, 0x74,
+ 0x86, 0xFF, 0xFF, 0x01, 0x7B, 0xD3, 0xB5, 0x97, 0x85, 0xC6, 0x3A, 0x00, 0xCE, 0x5A, 0x96, 0xC6,
+ 0x3A, 0x01, 0xBD, 0xF9, 0xC6, 0x19, 0x84, 0xC6, 0x3A, 0x02, 0xBD, 0xD8, 0xB5, 0x97, 0x7B, 0xD3,
+ 0x84, 0xFF, 0xFF, 0x02, 0x73, 0xB3, 0x8C, 0x74, 0xB5, 0xB7, 0x9D, 0xC6, 0x3A, 0x01, 0xBD, 0xD8,
+ 0xBD, 0xF9, 0x84, 0xC6, 0x3A, 0x02, 0xBD, 0xF8, 0xB5, 0xB7, 0x8C, 0x54, 0x84, 0xFF, 0xFF, 0x02,
+ 0x73, 0x92, 0x9C, 0xD5, 0xB5, 0xB7, 0xA1, 0xC6, 0x3A, 0x01, 0xBD, 0xD8, 0xBD, 0xF9, 0x81, 0xC6,
+ 0x3A, 0x02, 0xBD, 0xD8, 0x94, 0xB5, 0x73, 0x93, 0x83, 0xFF, 0xFF, 0x02, 0x6B, 0x72, 0xAD, 0x77,
+ 0xB5, 0xB7, 0xA0, 0xC6, 0x3A, 0x02, 0xC6, 0x19, 0xB5, 0xB7, 0xBD, 0xD8, 0x82, 0xC6, 0x3A, 0x01,
+ 0xA5, 0x36, 0x6B, 0x72, 0x83, 0xFF, 0xFF, 0x03, 0x6B, 0x72, 0xAD, 0x77, 0xB5, 0xB7, 0xC6, 0x19,
+ 0x99, 0xC6, 0x3A, 0x00, 0xCE, 0x5A, 0x85, 0xC6, 0x3A, 0x00, 0xC6, 0x19, 0x83, 0xC6, 0x3A, 0x01,
+ 0xB5, 0xB7, 0x6B, 0x72, 0x83, 0xFF, 0xFF, 0x03, 0x73, 0x92, 0x9C, 0xF6, 0xB5, 0xB7, 0xBD, 0xD8,
+ 0xA4, 0xC6, 0x3A, 0x02, 0xC6, 0x19, 0xA5, 0x36, 0x6B, 0x72, 0x83, 0xFF, 0xFF, 0x01, 0x73, 0xB3,
+ 0x8C, 0x74, 0x81, 0xB5, 0xB7, 0x00, 0xBD, 0xF8, 0x85, 0xC6, 0x3A, 0x00, 0xCE, 0x5A, 0x96, 0xC6,
+ 0x3A, 0x01, 0xC6, 0x19, 0xC6, 0x3A, 0x81, 0xBD, 0xF9, 0x81, 0xBD, 0xD8, 0x02, 0xB5, 0xB7, 0x94,
+ 0xB5, 0x73, 0x92, 0x84, 0xFF, 0xFF, 0x01, 0x7B, 0xD3, 0xB5, 0x97, 0x81, 0xB5, 0xB7, 0x01, 0xB5,
+ 0xB8, 0xBD, 0xF9, 0x99, 0xC6, 0x3A, 0x00, 0xBD, 0xD8, 0x81, 0xB5, 0xB7, 0x00, 0xB5, 0xB8, 0x84,
+ 0xB5, 0xB7, 0x00, 0x8C, 0x54, 0x85, 0xFF, 0xFF, 0x01, 0x73, 0x92, 0x8C, 0x54, 0x84, 0xB5, 0xB7,
+ 0x04, 0xAD, 0x77, 0xB5, 0x97, 0xB5, 0xB8, 0xB5, 0xB7, 0xBD, 0xD8, 0x8C, 0xC6, 0x3A, 0x00, 0xCE,
+ 0x5B, 0x84, 0xC6, 0x3A, 0x00, 0xC6, 0x19, 0x87, 0xB5, 0xB7, 0x01, 0xB5, 0x97, 0x73, 0xB3, 0x86,
+ 0xFF, 0xFF, 0x01, 0x6B, 0x72, 0xAD, 0x57, 0x88, 0xB5, 0xB7, 0x01, 0xB5, 0xB8, 0xC6, 0x1A, 0x89,
+ 0xC6, 0x3A, 0x01, 0xC6, 0x19, 0xBD, 0xF8, 0x82, 0xC6, 0x3A, 0x01, 0x84, 0x14, 0x94, 0x95, 0x88,
+ 0xB5, 0xB7, 0x00, 0x8C, 0x54, 0x87, 0xFF, 0xFF, 0x81, 0x6B, 0x72, 0x00, 0xA5, 0x36, 0x89, 0xB5,
+ 0xB7, 0x00, 0xBD, 0xF9, 0x86, 0xC6, 0x3A, 0x08, 0xC6, 0x1A, 0xBD, 0xD8, 0xB5, 0xB7, 0xC6, 0x19,
+ 0xBD, 0xF9, 0xC6, 0x3A, 0xBD, 0xD9, 0x6B, 0x72, 0xA5, 0x16, 0x87, 0xB5, 0xB7, 0x01, 0x9C, 0xD5,
+ 0x6B, 0x72, 0x89, 0xFF, 0xFF, 0x03, 0x6B, 0x72, 0x8C, 0x54, 0xA5, 0x36, 0xB5, 0x97, 0x82, 0xB5,
+ 0xB7, 0x00, 0xAD, 0x77, 0x84, 0xB5, 0xB7, 0x04, 0xB5, 0xB8, 0xBD, 0xD8, 0xBD, 0xF9, 0xBD, 0xF8,
+ 0xBD, 0xD8, 0x85, 0xB5, 0xB7, 0x03, 0xBD, 0xD8, 0x9C, 0xD6, 0x73, 0xB3, 0xB5, 0x97, 0x86, 0xB5,
+ 0xB7, 0x01, 0x94, 0xB5, 0x6B, 0x72, 0x8C, 0xFF, 0xFF, 0x06, 0x73, 0x92, 0x6B, 0x72, 0x73, 0xB3,
+ 0x7B, 0xF4, 0x7B, 0xF3, 0x6B, 0x72, 0x94, 0x95, 0x8E, 0xB5, 0xB7, 0x02, 0xA5, 0x36, 0x6B, 0x72,
+ 0x94, 0xB5, 0x85, 0xB5, 0xB7, 0x02, 0xAD, 0x77, 0x7B, 0xF3, 0x6B, 0x72, 0x93, 0xFF, 0xFF, 0x02,
+ 0x6B, 0x72, 0x84, 0x34, 0xA5, 0x36, 0x8A, 0xB5, 0xB7, 0x03, 0xB5, 0x97, 0x94, 0x95, 0x6B, 0x72,
+ 0x84, 0x14, 0x81, 0xC6, 0x19, 0x82, 0xBD, 0xF8, 0x03, 0xA5, 0x36, 0x8C, 0x74, 0x73, 0x92, 0x73,
+ 0x93, 0x95, 0xFF, 0xFF, 0x04, 0x73, 0x93, 0x6B, 0x72, 0x84, 0x34, 0x9C, 0xD5, 0xB5, 0x97, 0x85,
+ 0xB5, 0xB7, 0x05, 0xA5, 0x36, 0x94, 0x95, 0x73, 0xB3, 0x73, 0x92, 0x6B, 0x72, 0xFF, 0xFF, 0x81,
+ 0x73, 0x93, 0x82, 0x6B, 0x72, 0x00, 0x73, 0x93, 0x9A, 0xFF, 0xFF, 0x0A, 0x73, 0xB3, 0x6B, 0x72,
+ 0x6B, 0x73, 0x84, 0x14, 0x8C, 0x54, 0x94, 0x95, 0x8C, 0x74, 0x84, 0x34, 0x7B, 0xD3, 0x6B, 0x72,
+ 0x73, 0x93, 0xA9, 0xFF, 0xFF, 0x01, 0x73, 0x93, 0x73, 0x92, 0xFF, 0xFF, 0xFF, 0xB7, 0xFF, 0xFF,
+ 0x00, 0x6B, 0x72, 0x8B, 0xFF, 0xFF, 0x00, 0x6B, 0x72, 0x84, 0xFF, 0xFF, 0x00, 0x6B, 0x72, 0x94,
+ 0xFF, 0xFF, 0x00, 0x6B, 0x72, 0x84, 0xFF, 0xFF, 0x00, 0x6B, 0x72, 0x85, 0xFF, 0xFF, 0x00, 0x6B,
+ 0x72, 0x84, 0xFF, 0xFF, 0x00, 0x6B, 0x72, 0x85, 0xFF, 0xFF, 0x00, 0x6B, 0x72, 0x94, 0xFF, 0xFF,
+ 0x00, 0x6B, 0x72, 0x84, 0xFF, 0xFF, 0x00, 0x6B, 0x72, 0x8B, 0xFF, 0xFF, 0x00, 0x6B, 0x72, 0x84,
+ 0xFF, 0xFF, 0x00, 0x6B, 0x72, 0x94, 0xFF, 0xFF, 0x00, 0x6B, 0x72, 0x8B, 0xFF, 0xFF, 0x00, 0x6B,
+ 0x72, 0x8B, 0xFF, 0xFF, 0x00, 0x6B, 0x72, 0x94, 0xFF, 0xFF, 0x00, 0x6B, 0x72, 0x8B, 0xFF, 0xFF,
+ 0x00, 0x6B, 0x72, 0x8A, 0xFF, 0xFF, 0x00, 0x6B, 0x72, 0x94, 0xFF, 0xFF, 0x00, 0x6B, 0x72, 0x98,
+ 0xFF, 0xFF, 0x00, 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF,
+};
+
+const unsigned char img_wifi_on[2048] = {
+ //32x32
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0xE4, 0x2E, 0xC6,
+ 0x2E, 0xC6, 0x2E, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0x56, 0xAA, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xC6,
+ 0x2E, 0xC6, 0x2E, 0xC6, 0x2E, 0xC6, 0x2E, 0xC6, 0x36, 0x68, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0x36, 0xA8, 0x26, 0xE5, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xC6,
+ 0x2E, 0xC6, 0x2E, 0xC6, 0x2E, 0xC6, 0x2E, 0xC6, 0x26, 0xC4, 0x26, 0xE5, 0x26, 0xC5, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x26, 0xC6,
+ 0x26, 0xC3, 0x26, 0xE3, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xC6,
+ 0x2E, 0xC6, 0x2E, 0xC6, 0x2E, 0xC6, 0x2E, 0xC6, 0x26, 0xE3, 0x26, 0xE3, 0x26, 0xC4, 0x1E, 0xC5,
+ 0x2E, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0xC9, 0x26, 0xC4, 0x2E, 0xC3,
+ 0x2E, 0xC3, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xC6,
+ 0x2E, 0xC6, 0x2E, 0xC6, 0x2E, 0xC6, 0x2E, 0xC6, 0x26, 0xC3, 0x26, 0xC4, 0x26, 0xC4, 0x26, 0xC4,
+ 0x26, 0xE4, 0x26, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xE7, 0x3E, 0xE7, 0x3E, 0xE7,
+ 0x3E, 0xE7, 0x3E, 0xE7, 0x2F, 0x04, 0x26, 0xE5, 0x2E, 0xC6, 0x36, 0xC7, 0x4E, 0xE9, 0x5E, 0xEC,
+ 0x56, 0xCB, 0x3E, 0xA8, 0x2E, 0xA6, 0x26, 0xC4, 0x26, 0xE4, 0x26, 0xC4, 0x26, 0xC4, 0x2E, 0xC4,
+ 0x26, 0xC4, 0x2E, 0xC4, 0x2E, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0xE4, 0x3E, 0xE7, 0x3E, 0xE7, 0x3E, 0xE7,
+ 0x3E, 0xE7, 0x3E, 0xE7, 0x2E, 0xC6, 0x5E, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0xA7, 0x2E, 0xC4, 0x26, 0xE4, 0x26, 0xC4,
+ 0x2E, 0xC4, 0x2E, 0xC4, 0x2E, 0xC4, 0x2E, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x36, 0xE5, 0x36, 0xE3, 0x3E, 0xE7, 0x3E, 0xE7, 0x3E, 0xE7,
+ 0x3E, 0xE7, 0x3E, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0x87, 0x2E, 0xC5,
+ 0x2E, 0xC5, 0x2E, 0xC4, 0x2E, 0xC4, 0x2E, 0xC4, 0x2E, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0xE6, 0x2F, 0x04, 0x36, 0xE4, 0x3E, 0xE7, 0x3E, 0xE7, 0x3E, 0xE7,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0x2E, 0xC5, 0x2E, 0xC4, 0x2E, 0xC4, 0x2E, 0xC4, 0x2E, 0xC4, 0x2E, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0x3E, 0xC8, 0x2E, 0xE4, 0x37, 0x04, 0x37, 0x04, 0x3E, 0xE7, 0x3E, 0xE7, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0x2E, 0xC4, 0x2E, 0xC4, 0x2E, 0xC4, 0x2E, 0xC4, 0x2E, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0x4F, 0x07, 0x4F, 0x07, 0x4F, 0x07, 0x4F, 0x07, 0x46, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0xC5, 0x2E, 0xE4, 0x2E, 0xC4, 0x2E, 0xE3, 0x2E, 0xA4, 0xFF, 0xFF,
+ 0x4F, 0x07, 0x4F, 0x07, 0x4F, 0x07, 0x4F, 0x07, 0x4F, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x36, 0xC5, 0x2E, 0xE4, 0x36, 0xE4, 0x2E, 0xC3, 0xFF, 0xFF,
+ 0x4F, 0x07, 0x4F, 0x07, 0x4F, 0x07, 0x4F, 0x07, 0x4F, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0xA7, 0x2E, 0xC4, 0x2F, 0x04, 0x2F, 0x03, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0x4F, 0x07, 0x4F, 0x07, 0x4F, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x56, 0xCB, 0x36, 0xA7, 0x2E, 0x86,
+ 0x2E, 0x86, 0x3E, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x36, 0xA6, 0x2F, 0x05, 0x3E, 0xE6, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x36, 0xC6, 0x2E, 0xE4, 0x2E, 0xC4, 0x2E, 0xC4,
+ 0x26, 0xC4, 0x1E, 0xC4, 0x26, 0xE5, 0x26, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xC8, 0x3E, 0xC8, 0x3E, 0xC8, 0x3E, 0xC8, 0x3E, 0xC8, 0x26, 0xE3,
+ 0x26, 0xC3, 0x26, 0xC4, 0x26, 0xC4, 0x26, 0xC4, 0x26, 0xE5, 0x3E, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x72,
+ 0xFF, 0xFF, 0x36, 0xC7, 0x3E, 0xC8, 0x3E, 0xC8, 0x3E, 0xC8, 0x3E, 0xC8, 0x3E, 0xC8, 0x26, 0xE3,
+ 0x26, 0xC3, 0x26, 0xC3, 0x26, 0xC4, 0x2E, 0xC4, 0x2E, 0xC4, 0x26, 0xE4, 0x3E, 0xA8, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0x2F, 0x04, 0x3E, 0xC8, 0x3E, 0xC8, 0x3E, 0xC8, 0x3E, 0xC8, 0x3E, 0xC8, 0x2E, 0xA5,
+ 0x2E, 0xA4, 0x26, 0xC4, 0x26, 0xC4, 0x2E, 0xC4, 0x2E, 0xC4, 0x2E, 0xE4, 0x26, 0xE4, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x72, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0x2F, 0x04, 0x37, 0x04, 0x3E, 0xC8, 0x3E, 0xC8, 0x3E, 0xC8, 0x3E, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xA6, 0x2E, 0xE4, 0x2E, 0xC4, 0x2E, 0xE4, 0x2E, 0xE4, 0x36, 0xC5,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x72, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0xA8,
+ 0x37, 0x04, 0x37, 0x04, 0x3E, 0xC8, 0x3E, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x56, 0xC9, 0x36, 0xC4, 0x36, 0xC4, 0x36, 0xE4, 0x2E, 0xE3,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x36, 0x85,
+ 0x37, 0x04, 0x37, 0x24, 0x37, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x36, 0xC4, 0x36, 0xE4, 0x37, 0x03,
+ 0x4F, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xC6,
+ 0x37, 0x25, 0x2F, 0x25, 0x57, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xC6, 0x2E, 0xE4, 0x2F, 0x04,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x72,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0x37, 0x26, 0x47, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xC6, 0x4F, 0x09,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x72,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x72, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x6B, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x24,
+ 0x37, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0xE3, 0x37, 0x23,
+ 0x2F, 0x23, 0x3F, 0x26, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0xE4, 0x37, 0x04,
+ 0x37, 0x23, 0x2F, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x36, 0xE4, 0x2E, 0xE4,
+ 0x2F, 0x03, 0x26, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xA6, 0x2E, 0xE4,
+ 0x2E, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x36, 0xC5,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,};
+};
 
-const unsigned char img_wifi_on[2048] = {
- //32x32
- 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0xE4, 0x2E, 0xC6, 0x2E, 0xC6,
- 0x2E, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x56, 0xAA, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xC6, 0x2E, 0xC6,
- 0x2E, 0xC6, 0x2E, 0xC6, 0x2E, 0xC6, 0x36, 0x68, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x36, 0xA8,
- 0x26, 0xE5, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xC6, 0x2E, 0xC6,
- 0x2E, 0xC6, 0x2E, 0xC6, 0x2E, 0xC6, 0x26, 0xC4, 0x26, 0xE5, 0x26, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x26, 0xC6, 0x26, 0xC3,
- 0x26, 0xE3, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xC6, 0x2E, 0xC6,
- 0x2E, 0xC6, 0x2E, 0xC6, 0x2E, 0xC6, 0x26, 0xE3, 0x26, 0xE3, 0x26, 0xC4, 0x1E, 0xC5, 0x2E, 0x87,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0xC9, 0x26, 0xC4, 0x2E, 0xC3, 0x2E, 0xC3,
- 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xE4, 0x2E, 0xC6, 0x2E, 0xC6,
- 0x2E, 0xC6, 0x2E, 0xC6, 0x2E, 0xC6, 0x26, 0xC3, 0x26, 0xC4, 0x26, 0xC4, 0x26, 0xC4, 0x26, 0xE4,
- 0x26, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xE7, 0x3E, 0xE7, 0x3E, 0xE7, 0x3E, 0xE7,
- 0x3E, 0xE7, 0x2F, 0x04, 0x26, 0xE5, 0x2E, 0xC6, 0x36, 0xC7, 0x4E, 0xE9, 0x5E, 0xEC, 0x56, 0xCB,
- 0x3E, 0xA8, 0x2E, 0xA6, 0x26, 0xC4, 0x26, 0xE4, 0x26, 0xC4, 0x26, 0xC4, 0x2E, 0xC4, 0x26, 0xC4,
- 0x2E, 0xC4, 0x2E, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0xE4, 0x3E, 0xE7, 0x3E, 0xE7, 0x3E, 0xE7, 0x3E, 0xE7,
- 0x3E, 0xE7, 0x2E, 0xC6, 0x5E, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0xA7, 0x2E, 0xC4, 0x26, 0xE4, 0x26, 0xC4, 0x2E, 0xC4,
- 0x2E, 0xC4, 0x2E, 0xC4, 0x2E, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x36, 0xE5, 0x36, 0xE3, 0x3E, 0xE7, 0x3E, 0xE7, 0x3E, 0xE7, 0x3E, 0xE7,
- 0x3E, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0x87, 0x2E, 0xC5, 0x2E, 0xC5,
- 0x2E, 0xC4, 0x2E, 0xC4, 0x2E, 0xC4, 0x2E, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x2E, 0xE6, 0x2F, 0x04, 0x36, 0xE4, 0x3E, 0xE7, 0x3E, 0xE7, 0x3E, 0xE7, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0xC5,
- 0x2E, 0xC4, 0x2E, 0xC4, 0x2E, 0xC4, 0x2E, 0xC4, 0x2E, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x3E, 0xC8, 0x2E, 0xE4, 0x37, 0x04, 0x37, 0x04, 0x3E, 0xE7, 0x3E, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x2E, 0xC4, 0x2E, 0xC4, 0x2E, 0xC4, 0x2E, 0xC4, 0x2E, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x4F, 0x07, 0x4F, 0x07, 0x4F, 0x07, 0x4F, 0x07, 0x46, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x2E, 0xC5, 0x2E, 0xE4, 0x2E, 0xC4, 0x2E, 0xE3, 0x2E, 0xA4, 0xFF, 0xFF, 0x4F, 0x07,
- 0x4F, 0x07, 0x4F, 0x07, 0x4F, 0x07, 0x4F, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x36, 0xC5, 0x2E, 0xE4, 0x36, 0xE4, 0x2E, 0xC3, 0xFF, 0xFF, 0x4F, 0x07,
- 0x4F, 0x07, 0x4F, 0x07, 0x4F, 0x07, 0x4F, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0xA7, 0x2E, 0xC4, 0x2F, 0x04, 0x2F, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x4F, 0x07, 0x4F, 0x07, 0x4F, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x56, 0xCB, 0x36, 0xA7, 0x2E, 0x86, 0x2E, 0x86,
- 0x3E, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x36, 0xA6, 0x2F, 0x05, 0x3E, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x4F, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x36, 0xC6, 0x2E, 0xE4, 0x2E, 0xC4, 0x2E, 0xC4, 0x26, 0xC4,
- 0x1E, 0xC4, 0x26, 0xE5, 0x26, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x3E, 0xC8, 0x3E, 0xC8, 0x3E, 0xC8, 0x3E, 0xC8, 0x3E, 0xC8, 0x26, 0xE3, 0x26, 0xC3,
- 0x26, 0xC4, 0x26, 0xC4, 0x26, 0xC4, 0x26, 0xE5, 0x3E, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x36, 0xC7, 0x3E, 0xC8, 0x3E, 0xC8, 0x3E, 0xC8, 0x3E, 0xC8, 0x3E, 0xC8, 0x26, 0xE3, 0x26, 0xC3,
- 0x26, 0xC3, 0x26, 0xC4, 0x2E, 0xC4, 0x2E, 0xC4, 0x26, 0xE4, 0x3E, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0x2F, 0x04, 0x3E, 0xC8, 0x3E, 0xC8, 0x3E, 0xC8, 0x3E, 0xC8, 0x3E, 0xC8, 0x2E, 0xA5, 0x2E, 0xA4,
- 0x26, 0xC4, 0x26, 0xC4, 0x2E, 0xC4, 0x2E, 0xC4, 0x2E, 0xE4, 0x26, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x04,
- 0x37, 0x04, 0x3E, 0xC8, 0x3E, 0xC8, 0x3E, 0xC8, 0x3E, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0x3E, 0xA6, 0x2E, 0xE4, 0x2E, 0xC4, 0x2E, 0xE4, 0x2E, 0xE4, 0x36, 0xC5, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0xA8, 0x37, 0x04,
- 0x37, 0x04, 0x3E, 0xC8, 0x3E, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0x56, 0xC9, 0x36, 0xC4, 0x36, 0xC4, 0x36, 0xE4, 0x2E, 0xE3, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x36, 0x85, 0x37, 0x04,
- 0x37, 0x24, 0x37, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x36, 0xC4, 0x36, 0xE4, 0x37, 0x03, 0x4F, 0x07,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xC6, 0x37, 0x25,
- 0x2F, 0x25, 0x57, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xC6, 0x2E, 0xE4, 0x2F, 0x04, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x37, 0x26,
- 0x47, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xC6, 0x4F, 0x09, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x24, 0x37, 0x04,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0xE3, 0x37, 0x23, 0x2F, 0x23,
- 0x3F, 0x26, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0xE4, 0x37, 0x04, 0x37, 0x23,
- 0x2F, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x36, 0xE4, 0x2E, 0xE4, 0x2F, 0x03,
- 0x26, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xA6, 0x2E, 0xE4, 0x2E, 0xC5,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x36, 0xC5, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,};
 const unsigned char img_wifi_off[2048] = {
  //32x32
- 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
@@ -6470,104 +1859,105 @@ const unsigned char img_wifi_off[2048] = {
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5,
+ 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xE9, 0xA4, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5,
- 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xE9, 0xA4, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5,
+ 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5,
  0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5,
  0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5,
+ 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5,
+ 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5,
  0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5,
- 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5,
+ 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5,
+ 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5,
- 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5,
+ 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5,
- 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5,
+ 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5,
- 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5,
+ 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xE1, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5,
- 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5,
+ 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5,
+ 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xE9, 0xC5, 0xE1, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5,
- 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xE1, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5,
- 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5,
- 0xE1, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF,
  0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xE9, 0xC5,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5,
  0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5,
  0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5,
- 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5,
- 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5,
- 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
@@ -6584,4 +1974,4 @@ const unsigned char img_wifi_off[2048] = {
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,};
+};
@@ -19,6 +19,7 @@
 #include <stdbool.h>
 
 #include "iot_errno.h"
+#include "los_tick.h"
 
 #include "iot_pwm.h"
 #include "iot_gpio.h"
@@ -28,25 +29,31 @@
 #include "picture.h"
 #include "adc_key.h"
 #include "components.h"
+#include "smart_home_event.h"
 #include "lcd.h"
 #include "string.h"
 
-// 添加MqttTest获取函数的外部声明
-extern const char* get_mqtt_test_value(void);
+/* 无操作多久后进入局部显示和睡眠(毫秒)，为0时不进入 */
+#define LCD_IDLE_PARTIAL_MS     (2 * 60 * 1000)
+#define LCD_IDLE_SLEEP_MS       (15 * 60 * 1000)
+/* 局部显示的列范围，包括提示、服药位置、事件记录和趋势图 */
+#define LCD_PARTIAL_START       0
+#define LCD_PARTIAL_END         179
 
 static bool auto_state = false;
+static uint32_t idle_partial_ms = LCD_IDLE_PARTIAL_MS;
+static uint32_t idle_sleep_ms = LCD_IDLE_SLEEP_MS;
+static UINT64 last_activity_tick = 0;
 static bool network_state = false;
+/* 云端mqtt_control下发的服药位置,只在smart_home_thread中读写 */
+static char mqtt_test_text[64] = {0};
 
 void light_menu_entry(lcd_menu_t *menu);
 void fan_menu_entry(lcd_menu_t *menu);
 
 /* 风扇菜单的数据初始化*/
 lcd_menu_t fan_menu={
-    .img={
-        .img=img_fan_off,
-        .height=64,
-        .width=64,
-    },
+    .img=IMG_FAN_OFF_IMAGE,
     .is_selected=false,
     .text={
         .fc=LCD_MAGENTA,
@@ -63,11 +70,7 @@ lcd_menu_t fan_menu={
 
 /* 照明灯的菜单初始化数据*/
 lcd_menu_t light_menu={
-    .img={
-        .img= img_light_off,
-        .height=64,
-        .width=64,
-    },
+    .img=IMG_LIGHT_OFF_IMAGE,
     .is_selected=false,
     .text={
         .fc=LCD_MAGENTA,
@@ -81,13 +84,13 @@ lcd_menu_t light_menu={
     .exitFunc=NULL,
 };
 
+/* 温度图标 */
+static const image_t temp_normal_image = IMG_TEMP_NORMAL_IMAGE;
+static const image_t temp_high_image = IMG_TEMP_HIGH_IMAGE;
+
 /* 温度面板的初始化数据*/
 lcd_display_board_t temp_db={
-    .img={
-        .img= img_temp_normal,
-        .height=48,
-        .width=48,
-    },
+    .img=IMG_TEMP_NORMAL_IMAGE,
     .text={
         .fc=LCD_MAGENTA,
         .bc=LCD_WHITE,
@@ -100,11 +103,7 @@ lcd_display_board_t temp_db={
 
 /* 湿度面板的初始化数据*/
 lcd_display_board_t humi_db={
-    .img={
-        .img= img_humi,
-        .height=48,
-        .width=48,
-    },
+    .img=IMG_HUMI_IMAGE,
     .text={
         .fc=LCD_MAGENTA,
         .bc=LCD_WHITE,
@@ -117,11 +116,7 @@ lcd_display_board_t humi_db={
 
 /* 亮度面板的初始化数据*/
 lcd_display_board_t lum_db={
-    .img={
-        .img= img_lum,
-        .height=48,
-        .width=48,
-    },
+    .img=IMG_LUM_IMAGE,
     .text={
         .fc=LCD_MAGENTA,
         .bc=LCD_WHITE,
@@ -131,6 +126,49 @@ lcd_display_board_t lum_db={
     .base_x=180,
     .base_y=174,
 };
+/* 界面控件树,各个设置函数只修改控件,由lcd_show_ui统一绘制 */
+static ui_widget_t ui_root;
+static ui_widget_t ui_title;
+static ui_widget_t ui_haavk;
+static ui_widget_t ui_wifi;
+static ui_widget_t ui_prompt;
+static ui_widget_t ui_pos_label;
+static ui_widget_t ui_pos_value;
+static ui_widget_t ui_temp;
+static ui_widget_t ui_humi;
+static ui_widget_t ui_lum;
+static ui_widget_t ui_logo;
+static ui_widget_t ui_chart;
+static ui_widget_t ui_console;
+
+static const image_t haavk_image = GIMAGE_HAAVK_IMAGE;
+static const image_t wifi_on_image = IMG_WIFI_ON_IMAGE;
+static const image_t wifi_off_image = IMG_WIFI_OFF_IMAGE;
+static const image_t logo_image = IMG_LOGO_IMAGE;
+
+/* 温湿度趋势图,样本单位为0.1℃和0.1% */
+static lcd_chart_t th_chart={
+    .base_x=15,
+    .base_y=156,
+    .height=18,
+    .bc=LCD_WHITE,
+    .series_num=2,
+    .fc={LCD_RED, LCD_BLUE},
+    .min={0, 0},
+    .max={500, 1000},
+};
+
+/* 事件记录:服药、报警和云端指令,每条只刷新一行 */
+static lcd_console_t event_console={
+    .base_x=15,
+    .base_y=105,
+    .width=160,
+    .lines=2,
+    .font_size=12,
+    .fc=LCD_BLUE,
+    .bc=LCD_WHITE,
+};
+
 /* 所有的面板集合数组,方便遍历查询*/
 lcd_display_board_t *lcd_dbs[] ={&temp_db,&humi_db,&lum_db};
 /* 所有的菜单集合数组,方便遍历查询*/
@@ -200,7 +238,96 @@ void fan_menu_entry(lcd_menu_t *menu)
 void lcd_dev_init(void)
 {
     lcd_init();
-    lcd_fill(0, 0, LCD_W, LCD_H, LCD_WHITE);
+#if LCD_BENCHMARK_ON_BOOT
+    uint32_t ms565 = lcd_benchmark_fill(LCD_FORMAT_RGB565, 10);
+    uint32_t ms444 = lcd_benchmark_fill(LCD_FORMAT_RGB444, 10);
+    printf("lcd fill x10: rgb565 %u ms, rgb444 %u ms\n", ms565, ms444);
+#endif
+    lcd_console_init(&event_console);
+    lcd_set_partial_area(LCD_PARTIAL_START, LCD_PARTIAL_END);
+    last_activity_tick = LOS_TickCountGet();
+
+    ui_container_init(&ui_root, 0, 0, LCD_W, LCD_H, LCD_WHITE);
+    ui_label_init(&ui_title, 96, 0, "智能药盒", LCD_RED, LCD_WHITE, 32);
+    ui_image_init(&ui_haavk, 41, 0, &haavk_image);
+    ui_image_init(&ui_wifi, 280, 0, network_state ? &wifi_on_image : &wifi_off_image);
+    ui_label_init(&ui_prompt, 15, 80, "当前应服药：", LCD_RED, LCD_WHITE, 24);
+    ui_label_init(&ui_pos_label, 15, 130, "位置", LCD_GRAY, LCD_WHITE, 24);
+    ui_label_init(&ui_pos_value, 63, 130, ": --", LCD_GRAY, LCD_WHITE, 24);
+    ui_board_init(&ui_temp, &temp_db);
+    ui_board_init(&ui_humi, &humi_db);
+    ui_board_init(&ui_lum, &lum_db);
+    ui_image_init(&ui_logo, 0, 176, &logo_image);
+    ui_chart_init(&ui_chart, &th_chart);
+    ui_console_init(&ui_console, &event_console);
+
+    ui_add(&ui_root, &ui_title);
+    ui_add(&ui_root, &ui_haavk);
+    ui_add(&ui_root, &ui_wifi);
+    ui_add(&ui_root, &ui_prompt);
+    ui_add(&ui_root, &ui_pos_label);
+    ui_add(&ui_root, &ui_pos_value);
+    ui_add(&ui_root, &ui_temp);
+    ui_add(&ui_root, &ui_humi);
+    ui_add(&ui_root, &ui_lum);
+    ui_add(&ui_root, &ui_logo);
+    ui_add(&ui_root, &ui_chart);
+    ui_add(&ui_root, &ui_console);
+
+    /* 标题、图标、提示文字和logo开机后不会变化 */
+    ui_set_static(&ui_title, true);
+    ui_set_static(&ui_haavk, true);
+    ui_set_static(&ui_prompt, true);
+    ui_set_static(&ui_logo, true);
+
+    /* 第一帧需要整屏绘制 */
+    ui_invalidate(&ui_root);
+    /* 按键或告警到达时在条带之间挂起刷屏,事件处理完后的ui_request继续画 */
+    ui_set_yield(smart_home_event_urgent);
+}
+
+/***************************************************************
+* 函数名称: lcd_set_idle_timeout
+* 说    明: 设置无操作后进入局部显示和睡眠的时间
+* 参    数: uint32_t partial_ms 进入局部显示的时间,0为不进入
+*           uint32_t sleep_ms 进入睡眠的时间,0为不进入
+* 返 回 值: 无
+***************************************************************/
+void lcd_set_idle_timeout(uint32_t partial_ms, uint32_t sleep_ms)
+{
+    idle_partial_ms = partial_ms;
+    idle_sleep_ms = sleep_ms;
+}
+
+/***************************************************************
+* 函数名称: lcd_wake
+* 说    明: 有操作或需要提醒时唤醒屏幕,重新开始计算无操作时间
+* 参    数: 无
+* 返 回 值: 无
+***************************************************************/
+void lcd_wake(void)
+{
+    last_activity_tick = LOS_TickCountGet();
+    lcd_set_power(LCD_POWER_ON);
+}
+
+/***************************************************************
+* 函数名称: lcd_power_update
+* 说    明: 按无操作时间切换屏幕电源状态,由周期定时器调用
+* 参    数: 无
+* 返 回 值: 无
+***************************************************************/
+void lcd_power_update(void)
+{
+    UINT64 idle = LOS_TickCountGet() - last_activity_tick;
+
+    if ((idle_sleep_ms > 0) && (idle >= LOS_MS2Tick(idle_sleep_ms))) {
+        lcd_set_power(LCD_POWER_SLEEP);
+    } else if ((idle_partial_ms > 0) && (idle >= LOS_MS2Tick(idle_partial_ms))) {
+        if (lcd_get_power() == LCD_POWER_ON) {
+            lcd_set_power(LCD_POWER_PARTIAL);
+        }
+    }
 }
 
 /**
@@ -211,6 +338,7 @@ void lcd_dev_init(void)
 void smart_home_key_process(int key_no)
 {
     printf("smart_home_key_process:%d\n",key_no);
+    lcd_wake();
     if(key_no == KEY_UP){
 
     }else if(key_no == KEY_DOWN){
@@ -235,18 +363,32 @@ void smart_home_iot_cmd_process(int iot_cmd)
         case IOT_CMD_LIGHT_ON:
             light_set_state(true);
             lcd_set_light_state(true);
+            lcd_add_log("cloud: light on");
             break;
         case IOT_CMD_LIGHT_OFF:
             light_set_state(false);
             lcd_set_light_state(false);
+            lcd_add_log("cloud: light off");
             break;
         case IOT_CMD_MOTOR_ON:
             motor_set_state(true);
             lcd_set_motor_state(true);
+            lcd_add_log("cloud: motor on");
             break;
         case IOT_CMD_MOTOR_OFF:
             motor_set_state(false);
             lcd_set_motor_state(false);
+            lcd_add_log("cloud: motor off");
+            break;
+        case IOT_CMD_AUTO_ON:
+            auto_state = true;
+            lcd_set_auto_state(true);
+            lcd_add_log("cloud: auto on");
+            break;
+        case IOT_CMD_AUTO_OFF:
+            auto_state = false;
+            lcd_set_auto_state(false);
+            lcd_add_log("cloud: auto off");
             break;
     }
 }
@@ -258,6 +400,7 @@ void smart_home_iot_cmd_process(int iot_cmd)
  */
 void smart_home_su03t_cmd_process(int su03t_cmd)
 {
+    lcd_wake();
     switch (su03t_cmd)
     {
         case light_state_on:
@@ -307,6 +450,40 @@ void smart_home_su03t_cmd_process(int su03t_cmd)
 }
 
 
+/***************************************************************
+* 函数名称: smart_home_mqtt_control_process
+* 说    明: 处理云端mqtt_control命令,保存服药位置,下一次lcd_show_ui时显示
+* 参    数: const char *value 控制参数值
+* 返 回 值: 无
+***************************************************************/
+void smart_home_mqtt_control_process(const char *value)
+{
+    printf("更新前MqttTest值: %s\n", mqtt_test_text);
+    strncpy(mqtt_test_text, value, sizeof(mqtt_test_text) - 1);
+    mqtt_test_text[sizeof(mqtt_test_text) - 1] = '\0';
+    printf("更新后MqttTest值: %s\n", mqtt_test_text);
+
+    // 这里可以根据不同的参数值执行不同的操作
+    if (strncmp(value, "A", 1) == 0) {
+        printf("执行A类操作: %s\n", value);
+        // 可以在这里添加A1, A2, A3的具体处理逻辑
+    } else if (strncmp(value, "B", 1) == 0) {
+        printf("执行B类操作: %s\n", value);
+        // 可以在这里添加B1, B2, B3的具体处理逻辑
+    }
+}
+
+/***************************************************************
+* 函数名称: get_mqtt_test_value
+* 说    明: 获取云端下发的服药位置
+* 参    数: 无
+* 返 回 值: 服药位置,没有时为空字符串
+***************************************************************/
+const char* get_mqtt_test_value(void)
+{
+    return mqtt_test_text;
+}
+
 /***************************************************************
 * 函数名称: lcd_load_ui
 * 说    明: 加载lcd ui
@@ -315,33 +492,32 @@ void smart_home_su03t_cmd_process(int su03t_cmd)
 ***************************************************************/
 void lcd_show_ui(void)
 {
-    lcd_show_chinese(96, 0, "智能药盒", LCD_RED, LCD_WHITE, 32, 0);
-    lcd_show_picture(41, 0, 50, 50, gImage_HAAVK);
-    // lcd_show_picture(224, 0, 50, 50, gImage_QC);
-
-    lcd_show_picture(280,0, 32,32, network_state? img_wifi_on : img_wifi_off);
-
-    // 修改坐标从(5,60)改为(5,70)
-    lcd_show_chinese(15, 80, "当前应服药：", LCD_RED, LCD_WHITE, 24, 0);
-    
-    // 在(5,100)位置添加显示MqttTest值，字体大小24
     const char* mqtt_test_value = get_mqtt_test_value();
+    char mqtt_display[80];
+
+    /* MqttTest只更新位置这一行的控件,没有变化时不产生刷新区域 */
     if (strlen(mqtt_test_value) > 0) {
-        char mqtt_display[80];
         snprintf(mqtt_display, sizeof(mqtt_display), ": %s", mqtt_test_value);
-        lcd_show_chinese(15, 130, "位置", LCD_RED, LCD_GRAY, 24, 0);
-        lcd_show_string(63, 130, mqtt_display, LCD_RED, LCD_GRAY, 24, 0);
+        if (strcmp(ui_pos_value.text.name, mqtt_display) != 0) {
+            snprintf(mqtt_display, sizeof(mqtt_display), "dose %s", mqtt_test_value);
+            lcd_add_log(mqtt_display);
+            /* 到了服药时间,亮屏提醒 */
+            lcd_wake();
+            snprintf(mqtt_display, sizeof(mqtt_display), ": %s", mqtt_test_value);
+        }
+        ui_label_set_color(&ui_pos_label, LCD_RED, LCD_GRAY);
+        ui_label_set_color(&ui_pos_value, LCD_RED, LCD_GRAY);
+        ui_label_set_text(&ui_pos_value, mqtt_display);
     } else {
-        lcd_show_chinese(15, 130, "位置", LCD_GRAY, LCD_WHITE, 24, 0);
-        lcd_show_string(63, 130, ": --", LCD_GRAY, LCD_WHITE, 24, 0);
+        ui_label_set_color(&ui_pos_label, LCD_GRAY, LCD_WHITE);
+        ui_label_set_color(&ui_pos_value, LCD_GRAY, LCD_WHITE);
+        ui_label_set_text(&ui_pos_value, ": --");
     }
 
     // lcd_menu_update(lcd_menus ,lcd_menu_number,menu_select_index);
 
-    // lcd_menu_show(lcd_menus ,  lcd_menu_number);
-    lcd_db_show(lcd_dbs, sizeof(lcd_dbs)/sizeof(lcd_display_board_t *));
-
-    lcd_show_picture(0,176,177,58, img_logo);
+    /* 只绘制与脏区域相交的控件,关屏时不下发 */
+    ui_render(&ui_root);
 }
 
 /***************************************************************
@@ -352,17 +528,20 @@ void lcd_show_ui(void)
 ***************************************************************/
 void lcd_set_temperature(double temperature)
 {
-    sprintf(temp_db.text.name, "%.01f℃ ", temperature);
+    char name[32];
+
+    snprintf(name, sizeof(name), "%.01f℃ ", temperature);
+    lcd_db_set_text(&temp_db, name);
     /* 对温度做高温和正常的区分*/
     if(temperature > 35)
     {
-        temp_db.text.fc = LCD_RED;
-        temp_db.img.img = img_temp_high;
+        lcd_db_set_color(&temp_db, LCD_RED);
+        lcd_db_set_image(&temp_db, &temp_high_image);
     }
     else
     {
-       temp_db.text.fc = LCD_MAGENTA;
-       temp_db.img.img = img_temp_normal;
+       lcd_db_set_color(&temp_db, LCD_MAGENTA);
+       lcd_db_set_image(&temp_db, &temp_normal_image);
     }
 }
 
@@ -374,7 +553,10 @@ void lcd_set_temperature(double temperature)
 ***************************************************************/
 void lcd_set_humidity(double humidity)
 {
-    sprintf(humi_db.text.name, "%.01f%% ", humidity);
+    char name[32];
+
+    snprintf(name, sizeof(name), "%.01f%% ", humidity);
+    lcd_db_set_text(&humi_db, name);
 
 }
 
@@ -382,16 +564,52 @@ void lcd_set_humidity(double humidity)
 * 函数名称: lcd_set_illumination
 * 说    明: 设置光照强度显示
 * 参    数: double illumination 光照强度
+* 返 回 值: 显示的文字有变化返回true
+***************************************************************/
+bool lcd_set_illumination(double illumination)
+{
+    char name[32];
+
+    snprintf(name, sizeof(name), "%.01fLx ", illumination);
+    if (strcmp(lum_db.text.name, name) == 0) {
+        return false;
+    }
+    lcd_db_set_text(&lum_db, name);
+    return true;
+}
+
+/***************************************************************
+* 函数名称: lcd_add_history
+* 说    明: 温湿度趋势图添加一个样本,只重画新的一列
+* 参    数: double temperature 温度
+*           double humidity 湿度
 * 返 回 值: 无
 ***************************************************************/
-void lcd_set_illumination(double illumination)
+void lcd_add_history(double temperature, double humidity)
 {
-    sprintf(lum_db.text.name, "%.01fLx ", illumination);
+    int values[2];
 
+    values[0] = (int)(temperature * 10);
+    values[1] = (int)(humidity * 10);
+    lcd_chart_push(&th_chart, values);
+}
+
+/***************************************************************
+* 函数名称: lcd_add_log
+* 说    明: 事件记录追加一行,下一次lcd_show_ui时显示
+* 参    数: const char *text 记录内容
+* 返 回 值: 无
+***************************************************************/
+void lcd_add_log(const char *text)
+{
+    lcd_console_append(&event_console, text);
 }
 
 void lcd_set_network_state(int state){
-    network_state = state;
+    if (network_state != (bool)state) {
+        network_state = state;
+        ui_image_set(&ui_wifi, network_state ? &wifi_on_image : &wifi_off_image);
+    }
 }
 
 /***************************************************************
@@ -444,25 +662,11 @@ void lcd_set_auto_state(bool state)
 
 /***************************************************************
 * 函数名称: lcd_update_mqtt_test_display
-* 说    明: 更新MqttTest值的显示
+* 说    明: 更新MqttTest值的显示，由控件树只重画变化的字符
 * 参    数: 无
 * 返 回 值: 无
 ***************************************************************/
 void lcd_update_mqtt_test_display(void)
 {
-    const char* mqtt_test_value = get_mqtt_test_value();
-    
-    // 先清除原来的显示区域
-    lcd_fill(15, 100, 250, 124, LCD_WHITE);
-    
-    // 显示新的MqttTest值，字体大小24
-    if (strlen(mqtt_test_value) > 0) {
-        char mqtt_display[80];
-        snprintf(mqtt_display, sizeof(mqtt_display), ": %s", mqtt_test_value);
-        lcd_show_chinese(15, 130, "位置", LCD_RED, LCD_GRAY, 24, 0);
-        lcd_show_string(63, 130, mqtt_display, LCD_RED, LCD_GRAY, 24, 0);
-    } else {
-        lcd_show_chinese(15, 130, "位置", LCD_GRAY, LCD_WHITE, 24, 0);
-        lcd_show_string(63, 130, ": --", LCD_GRAY, LCD_WHITE, 24, 0);
-    }
+    lcd_show_ui();
 }
@@ -1,29 +1,368 @@
 #include "smart_home_event.h"
+#include "iot.h"
+#include "trace.h"
 #include "ohos_init.h"
+#include "string.h"
 #include "los_task.h"
+#include "los_sem.h"
 
-static unsigned int event_queue_id;
+/* 每个优先级一个环形队列,生产者都是任务,队列操作在锁调度期间完成.
+ * 发送从不阻塞:MQTT回调和按键任务不能因为UI线程忙而停下 */
+typedef struct event_ring
+{
+    event_info_t *buf;
+    uint16_t depth;
+    uint16_t head;              /* 最早入队的事件 */
+    uint16_t count;
+    event_class_stats_t stats;
+} event_ring_t;
+
+static event_info_t safety_buf[EVENT_SAFETY_DEPTH];
+static event_info_t input_buf[EVENT_INPUT_DEPTH];
+static event_info_t background_buf[EVENT_BACKGROUND_DEPTH];
+
+static event_ring_t event_rings[EVENT_CLASS_NUM] = {
+    [EVENT_CLASS_SAFETY] = {.buf = safety_buf, .depth = EVENT_SAFETY_DEPTH},
+    [EVENT_CLASS_INPUT] = {.buf = input_buf, .depth = EVENT_INPUT_DEPTH},
+    [EVENT_CLASS_BACKGROUND] = {.buf = background_buf, .depth = EVENT_BACKGROUND_DEPTH},
+};
+
+/* 所有队列中排队的事件总数 */
+static unsigned int event_pending_sem;
+
+/* 附带数据的块池,分配和释放也在锁调度期间完成 */
+static event_payload_t event_payload_blocks[EVENT_PAYLOAD_NUM];
+static event_payload_t *event_payload_free;
+static event_pool_stats_t event_pool_stats;
+
+/***************************************************************
+* 函数名称: event_payload_alloc
+* 说    明: 从块池分配一块并拷贝数据,引用计数为1,不阻塞
+* 参    数: const void *data 数据
+*           uint16_t len 数据长度,不超过EVENT_PAYLOAD_SIZE
+* 返 回 值: 分配的块,块池用完或数据太长返回NULL
+***************************************************************/
+event_payload_t *event_payload_alloc(const void *data, uint16_t len)
+{
+    event_payload_t *payload = NULL;
+
+    if (len > EVENT_PAYLOAD_SIZE) {
+        return NULL;
+    }
+
+    LOS_TaskLock();
+    payload = event_payload_free;
+    if (payload != NULL) {
+        event_payload_free = payload->next;
+        event_pool_stats.free--;
+        if (event_pool_stats.free < event_pool_stats.low_water) {
+            event_pool_stats.low_water = event_pool_stats.free;
+        }
+    } else {
+        event_pool_stats.alloc_failed++;
+    }
+    LOS_TaskUnlock();
+
+    if (payload == NULL) {
+        return NULL;
+    }
+
+    payload->next = NULL;
+    payload->refs = 1;
+    payload->len = len;
+    memcpy(payload->data, data, len);
+    return payload;
+}
+
+/***************************************************************
+* 函数名称: event_payload_alloc_text
+* 说    明: 分配一块保存字符串,包括结尾的'\0'
+* 参    数: const char *text 字符串
+* 返 回 值: 分配的块,块池用完或字符串太长返回NULL
+***************************************************************/
+event_payload_t *event_payload_alloc_text(const char *text)
+{
+    return event_payload_alloc(text, strlen(text) + 1);
+}
+
+/***************************************************************
+* 函数名称: event_payload_ref
+* 说    明: 增加引用,消费者需要在事件处理完以后继续使用数据时调用
+* 参    数: event_payload_t *payload
+* 返 回 值: 无
+***************************************************************/
+void event_payload_ref(event_payload_t *payload)
+{
+    LOS_TaskLock();
+    payload->refs++;
+    LOS_TaskUnlock();
+}
+
+/***************************************************************
+* 函数名称: event_payload_unref
+* 说    明: 减少引用,为0时回到块池
+* 参    数: event_payload_t *payload 可以为NULL
+* 返 回 值: 无
+***************************************************************/
+void event_payload_unref(event_payload_t *payload)
+{
+    if (payload == NULL) {
+        return;
+    }
+
+    LOS_TaskLock();
+    if (--payload->refs == 0) {
+        payload->next = event_payload_free;
+        event_payload_free = payload;
+        event_pool_stats.free++;
+    }
+    LOS_TaskUnlock();
+}
+
+/***************************************************************
+* 函数名称: event_pool_get_stats
+* 说    明: 获取块池的统计
+* 参    数: event_pool_stats_t *stats 输出统计
+* 返 回 值: 无
+***************************************************************/
+void event_pool_get_stats(event_pool_stats_t *stats)
+{
+    LOS_TaskLock();
+    *stats = event_pool_stats;
+    LOS_TaskUnlock();
+}
 
-#define EVENT_QUEUE_LENGTH 10 //number of events
-#define BUFFER_LEN         20 //bytes of event
- 
 void smart_home_event_init(){
     unsigned int ret = LOS_OK;
 
-    ret = LOS_QueueCreate("eventQ", EVENT_QUEUE_LENGTH, &event_queue_id, 0, BUFFER_LEN);
+    ret = LOS_SemCreate(0, &event_pending_sem);
     if (ret != LOS_OK)
     {
-        printf("Falied to create Message Queue ret:0x%x\n", ret);
+        printf("Falied to create Semaphore ret:0x%x\n", ret);
         return;
     }
+
+    for (int i = 0; i < EVENT_CLASS_NUM; i++) {
+        event_rings[i].stats.depth = event_rings[i].depth;
+    }
+
+    event_payload_free = NULL;
+    for (int i = EVENT_PAYLOAD_NUM - 1; i >= 0; i--) {
+        event_payload_blocks[i].next = event_payload_free;
+        event_payload_free = &event_payload_blocks[i];
+    }
+    event_pool_stats.num = EVENT_PAYLOAD_NUM;
+    event_pool_stats.free = EVENT_PAYLOAD_NUM;
+    event_pool_stats.low_water = EVENT_PAYLOAD_NUM;
+}
+
+/***************************************************************
+* 函数名称: smart_home_event_class
+* 说    明: 事件类型对应的优先级
+* 参    数: event_type_t type 事件类型
+* 返 回 值: 优先级
+***************************************************************/
+event_class_t smart_home_event_class(event_type_t type)
+{
+    switch (type) {
+        case event_gas_alarm:
+            return EVENT_CLASS_SAFETY;
+        case event_key_press:
+        case event_su03t:
+            return EVENT_CLASS_INPUT;
+        case event_iot_cmd:
+        case event_mqtt_control:
+        default:
+            return EVENT_CLASS_BACKGROUND;
+    }
 }
-void smart_home_event_send(event_info_t *event)
+
+/***************************************************************
+* 函数名称: smart_home_event_policy
+* 说    明: 事件类型对应的队列满处理策略
+* 参    数: event_type_t type 事件类型
+* 返 回 值: 策略
+***************************************************************/
+static event_policy_t smart_home_event_policy(event_type_t type)
+{
+    switch (type) {
+        case event_iot_cmd:
+        case event_mqtt_control:
+            /* 云端命令是设备状态,只有最新的有意义 */
+            return EVENT_POLICY_COALESCE;
+        case event_key_press:
+        case event_su03t:
+            /* 用户输入积压时,最早的操作最先过时 */
+            return EVENT_POLICY_DROP_OLDEST;
+        case event_gas_alarm:
+        default:
+            /* 告警不能被覆盖,由生产者决定是否重发 */
+            return EVENT_POLICY_REJECT;
+    }
+}
+
+/***************************************************************
+* 函数名称: smart_home_event_same_target
+* 说    明: 两个事件是否控制同一个对象,开和关属于同一个对象
+* 参    数: const event_info_t *a, const event_info_t *b
+* 返 回 值: true 同一个对象
+***************************************************************/
+static bool smart_home_event_same_target(const event_info_t *a, const event_info_t *b)
 {
-     LOS_QueueWriteCopy(event_queue_id, event, sizeof(event_info_t),LOS_WAIT_FOREVER);
+    if (a->event != b->event) {
+        return false;
+    }
+
+    if (a->event == event_iot_cmd) {
+        /* IOT_CMD_xxx_ON/OFF成对编号:1/2灯,3/4电机,5/6自动 */
+        return (a->data.iot_data + 1) / 2 == (b->data.iot_data + 1) / 2;
+    }
+    if (a->event == event_mqtt_control) {
+        return true;
+    }
+    return false;
 }
+
+/***************************************************************
+* 函数名称: smart_home_event_send
+* 说    明: 事件放入对应优先级的队列,不阻塞.
+*           合并策略先替换排队中同一对象的事件;
+*           队列满时按事件类型的策略丢弃最早的事件或拒绝新事件
+* 参    数: event_info_t *event 事件
+*           事件的payload交给总线,被合并,丢弃或拒绝时由总线释放
+* 返 回 值: EVENT_OK 已入队或已合并
+*           EVENT_ERR_FULL 队列满,事件被拒绝
+***************************************************************/
+int smart_home_event_send(event_info_t *event)
+{
+    event_ring_t *ring = &event_rings[smart_home_event_class(event->event)];
+    event_policy_t policy = smart_home_event_policy(event->event);
+    event_payload_t *release = NULL;
+    bool queued = false;
+
+    event->trace_id = trace_new_id();
+    trace_record(event->event, event->trace_id, TRACE_PHASE_ENQUEUE);
+
+    LOS_TaskLock();
+    if (policy == EVENT_POLICY_COALESCE) {
+        for (uint16_t i = 0; i < ring->count; i++) {
+            event_info_t *old = &ring->buf[(ring->head + i) % ring->depth];
+            if (smart_home_event_same_target(old, event)) {
+                release = old->payload;
+                trace_record(old->event, old->trace_id, TRACE_PHASE_DROP);
+                *old = *event;
+                ring->stats.coalesced++;
+                LOS_TaskUnlock();
+                event_payload_unref(release);
+                return EVENT_OK;
+            }
+        }
+    }
+
+    if (ring->count < ring->depth) {
+        ring->buf[(ring->head + ring->count) % ring->depth] = *event;
+        ring->count++;
+        queued = true;
+    } else if (policy == EVENT_POLICY_DROP_OLDEST) {
+        /* 新事件占用最早事件的位置,排队数不变,不用再通知 */
+        release = ring->buf[ring->head].payload;
+        trace_record(ring->buf[ring->head].event, ring->buf[ring->head].trace_id, TRACE_PHASE_DROP);
+        ring->buf[ring->head] = *event;
+        ring->head = (ring->head + 1) % ring->depth;
+        ring->stats.dropped++;
+    } else {
+        ring->stats.rejected++;
+        LOS_TaskUnlock();
+        trace_record(event->event, event->trace_id, TRACE_PHASE_DROP);
+        event_payload_unref(event->payload);
+        return EVENT_ERR_FULL;
+    }
+
+    ring->stats.posted++;
+    if (ring->count > ring->stats.high_water) {
+        ring->stats.high_water = ring->count;
+    }
+    LOS_TaskUnlock();
+
+    event_payload_unref(release);
+    if (queued) {
+        LOS_SemPost(event_pending_sem);
+    }
+    return EVENT_OK;
+}
+
+/***************************************************************
+* 函数名称: smart_home_event_wait
+* 说    明: 等待事件,总是先取高优先级队列中的事件
+* 参    数: event_info_t *event 取出的事件,处理完以后调用smart_home_event_release
+*           int timeoutMs 等待时间
+* 返 回 值: LOS_OK成功,超时返回信号量的错误码
+***************************************************************/
 int smart_home_event_wait(event_info_t *event,int timeoutMs){
+    event_ring_t *ring = NULL;
+    unsigned int ret;
+
+    ret = LOS_SemPend(event_pending_sem, LOS_MS2Tick(timeoutMs));
+    if (ret != LOS_OK) {
+        return ret;
+    }
+
+    LOS_TaskLock();
+    for (int i = 0; i < EVENT_CLASS_NUM; i++) {
+        if (event_rings[i].count > 0) {
+            ring = &event_rings[i];
+            break;
+        }
+    }
+    /* 每个排队的事件都对应一次event_pending_sem计数,这里一定能取到 */
+    *event = ring->buf[ring->head];
+    ring->head = (ring->head + 1) % ring->depth;
+    ring->count--;
+    LOS_TaskUnlock();
+
+    trace_record(event->event, event->trace_id, TRACE_PHASE_DEQUEUE);
 
-    return LOS_QueueReadCopy(event_queue_id, event, sizeof(event_info_t), 
-        LOS_MS2Tick(timeoutMs));
+    return LOS_OK;
+}
 
-}
\ No newline at end of file
+/***************************************************************
+* 函数名称: smart_home_event_release
+* 说    明: 事件处理完以后释放附带的数据
+* 参    数: event_info_t *event 事件
+* 返 回 值: 无
+***************************************************************/
+void smart_home_event_release(event_info_t *event)
+{
+    event_payload_unref(event->payload);
+    event->payload = NULL;
+}
+
+/***************************************************************
+* 函数名称: smart_home_event_urgent
+* 说    明: 是否有告警或用户输入在排队,绘图线程用来决定是否让出刷屏
+* 参    数: 无
+* 返 回 值: true 告警或输入队列不为空
+***************************************************************/
+bool smart_home_event_urgent(void)
+{
+    return (event_rings[EVENT_CLASS_SAFETY].count > 0) || (event_rings[EVENT_CLASS_INPUT].count > 0);
+}
+
+/***************************************************************
+* 函数名称: smart_home_event_get_stats
+* 说    明: 获取一个优先级队列的统计
+* 参    数: event_class_t cls 优先级
+*           event_class_stats_t *stats 输出统计
+* 返 回 值: 无
+***************************************************************/
+void smart_home_event_get_stats(event_class_t cls, event_class_stats_t *stats)
+{
+    if (cls >= EVENT_CLASS_NUM) {
+        return;
+    }
+
+    LOS_TaskLock();
+    *stats = event_rings[cls].stats;
+    stats->count = event_rings[cls].count;
+    LOS_TaskUnlock();
+}
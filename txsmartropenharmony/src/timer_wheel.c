@@ -0,0 +1,223 @@
+#include <stdio.h>
+
+#include "timer_wheel.h"
+#include "los_task.h"
+
+/* 只在smart_home_thread中使用,不加锁 */
+static timer_wheel_timer_t *wheel_slots[TIMER_WHEEL_SLOTS];
+static timer_wheel_timer_t *wheel_timers;
+static uint32_t wheel_cursor_ms;        /* 下一个要处理的槽的时刻 */
+
+/* 毫秒时间,32位回绕后用有符号差值比较 */
+static uint32_t timer_wheel_now(void)
+{
+    return (uint32_t)(LOS_TickCountGet() * 1000 / LOSCFG_BASE_CORE_TICK_PER_SECOND);
+}
+
+static bool timer_wheel_before(uint32_t a, uint32_t b)
+{
+    return (int32_t)(a - b) < 0;
+}
+
+static uint32_t timer_wheel_slot(uint32_t ms)
+{
+    return (ms / TIMER_WHEEL_RES_MS) & (TIMER_WHEEL_SLOTS - 1);
+}
+
+/* 按due_ms计算所在的槽并挂上去 */
+static void timer_wheel_insert(timer_wheel_timer_t *timer)
+{
+    uint32_t slot_ms = (timer->due_ms + TIMER_WHEEL_RES_MS - 1) / TIMER_WHEEL_RES_MS * TIMER_WHEEL_RES_MS;
+    uint32_t slot;
+
+    /* 当前槽已经处理过,放到下一个要处理的槽,否则要等一整圈 */
+    if (timer_wheel_before(slot_ms, wheel_cursor_ms)) {
+        slot_ms = wheel_cursor_ms;
+    }
+    timer->slot_ms = slot_ms;
+    timer->active = true;
+
+    slot = timer_wheel_slot(slot_ms);
+    timer->next = wheel_slots[slot];
+    wheel_slots[slot] = timer;
+}
+
+static void timer_wheel_remove(timer_wheel_timer_t *timer)
+{
+    timer_wheel_timer_t **link = &wheel_slots[timer_wheel_slot(timer->slot_ms)];
+
+    while (*link != NULL) {
+        if (*link == timer) {
+            *link = timer->next;
+            break;
+        }
+        link = &(*link)->next;
+    }
+    timer->next = NULL;
+    timer->active = false;
+}
+
+/***************************************************************
+* 函数名称: timer_wheel_init
+* 说    明: 初始化时间轮,从当前时刻开始转
+* 参    数: 无
+* 返 回 值: 无
+***************************************************************/
+void timer_wheel_init(void)
+{
+    for (int i = 0; i < TIMER_WHEEL_SLOTS; i++) {
+        wheel_slots[i] = NULL;
+    }
+    wheel_timers = NULL;
+    wheel_cursor_ms = timer_wheel_now() / TIMER_WHEEL_RES_MS * TIMER_WHEEL_RES_MS;
+}
+
+/***************************************************************
+* 函数名称: timer_wheel_start
+* 说    明: 启动定时器,已经启动的定时器重新开始计时
+* 参    数: timer_wheel_timer_t *timer 定时器
+*           uint32_t delay_ms 第一次触发的延时
+*           uint32_t period_ms 触发周期,0为单次定时器
+* 返 回 值: 无
+***************************************************************/
+void timer_wheel_start(timer_wheel_timer_t *timer, uint32_t delay_ms, uint32_t period_ms)
+{
+    if (timer->active) {
+        timer_wheel_remove(timer);
+    }
+    if (!timer->registered) {
+        timer->registered = true;
+        timer->all_next = wheel_timers;
+        wheel_timers = timer;
+    }
+
+    timer->period_ms = period_ms;
+    timer->due_ms = timer_wheel_now() + delay_ms;
+    timer_wheel_insert(timer);
+}
+
+/***************************************************************
+* 函数名称: timer_wheel_stop
+* 说    明: 停止定时器
+* 参    数: timer_wheel_timer_t *timer 定时器
+* 返 回 值: 无
+***************************************************************/
+void timer_wheel_stop(timer_wheel_timer_t *timer)
+{
+    if (timer->active) {
+        timer_wheel_remove(timer);
+    }
+}
+
+/***************************************************************
+* 函数名称: timer_wheel_is_active
+* 说    明: 定时器是否在等待触发
+* 参    数: const timer_wheel_timer_t *timer 定时器
+* 返 回 值: true 等待触发
+***************************************************************/
+bool timer_wheel_is_active(const timer_wheel_timer_t *timer)
+{
+    return timer->active;
+}
+
+/***************************************************************
+* 函数名称: timer_wheel_next_ms
+* 说    明: 到下一个非空槽的时间,作为等待事件的超时.
+*           槽里可能是以后几圈的定时器,那样醒来后什么都不做再等一次
+* 参    数: 无
+* 返 回 值: 毫秒,已经到期返回0
+***************************************************************/
+uint32_t timer_wheel_next_ms(void)
+{
+    uint32_t now = timer_wheel_now();
+    uint32_t slot_ms = wheel_cursor_ms;
+
+    for (int i = 0; i < TIMER_WHEEL_SLOTS; i++) {
+        if (wheel_slots[timer_wheel_slot(slot_ms)] != NULL) {
+            break;
+        }
+        slot_ms += TIMER_WHEEL_RES_MS;
+    }
+
+    if (!timer_wheel_before(now, slot_ms)) {
+        return 0;
+    }
+    return slot_ms - now;
+}
+
+/***************************************************************
+* 函数名称: timer_wheel_run
+* 说    明: 处理从上次到现在经过的槽,触发到期的定时器.
+*           周期定时器按应该触发的时刻累加周期,不会因为处理晚了而漂移
+* 参    数: 无
+* 返 回 值: 无
+***************************************************************/
+void timer_wheel_run(void)
+{
+    uint32_t now = timer_wheel_now();
+    uint32_t last_ms = now / TIMER_WHEEL_RES_MS * TIMER_WHEEL_RES_MS;
+
+    /* 停了超过一圈时每个槽只需要看一次 */
+    if (!timer_wheel_before(last_ms, wheel_cursor_ms) &&
+        last_ms - wheel_cursor_ms >= TIMER_WHEEL_RES_MS * TIMER_WHEEL_SLOTS) {
+        wheel_cursor_ms = last_ms - TIMER_WHEEL_RES_MS * (TIMER_WHEEL_SLOTS - 1);
+    }
+
+    while (!timer_wheel_before(now, wheel_cursor_ms)) {
+        timer_wheel_timer_t **link = &wheel_slots[timer_wheel_slot(wheel_cursor_ms)];
+
+        /* 先移动游标再触发,回调里重新启动的定时器不会落到正在处理的槽 */
+        wheel_cursor_ms += TIMER_WHEEL_RES_MS;
+
+        while (*link != NULL) {
+            timer_wheel_timer_t *timer = *link;
+            uint32_t jitter;
+
+            /* 以后几圈的定时器留在槽里 */
+            if (timer_wheel_before(now, timer->slot_ms)) {
+                link = &timer->next;
+                continue;
+            }
+
+            *link = timer->next;
+            timer->next = NULL;
+            timer->active = false;
+
+            jitter = timer_wheel_now() - timer->due_ms;
+            timer->fired++;
+            timer->jitter_total_ms += jitter;
+            if (jitter > timer->jitter_max_ms) {
+                timer->jitter_max_ms = jitter;
+            }
+
+            if (timer->period_ms > 0) {
+                timer->due_ms += timer->period_ms;
+                while (!timer_wheel_before(now, timer->due_ms)) {
+                    timer->due_ms += timer->period_ms;
+                    timer->missed++;
+                }
+                timer_wheel_insert(timer);
+            }
+
+            timer->cb(timer->arg);
+            /* 回调可能启动或停止了这个槽里的定时器,从头再看 */
+            link = &wheel_slots[timer_wheel_slot(wheel_cursor_ms - TIMER_WHEEL_RES_MS)];
+        }
+    }
+}
+
+/***************************************************************
+* 函数名称: timer_wheel_dump
+* 说    明: 打印每个定时器的触发次数和抖动
+* 参    数: 无
+* 返 回 值: 无
+***************************************************************/
+void timer_wheel_dump(void)
+{
+    for (timer_wheel_timer_t *timer = wheel_timers; timer != NULL; timer = timer->all_next) {
+        printf("timer %-8s period %5u fired %6u jitter avg %3u max %4u ms missed %u\n",
+            timer->name, timer->period_ms, timer->fired,
+            timer->fired ? timer->jitter_total_ms / timer->fired : 0,
+            timer->jitter_max_ms, timer->missed);
+    }
+}
@@ -0,0 +1,178 @@
+#include <stdio.h>
+
+#include "trace.h"
+#include "los_task.h"
+#include "shcmd.h"
+
+#if TRACE_ENABLE
+
+/* 每条记录写完以后seq才设置为序号+1,导出时seq不对说明正在写或已被覆盖 */
+typedef struct trace_entry
+{
+    uint32_t seq;
+    uint32_t tick;
+    uint16_t id;
+    uint8_t task;
+    uint8_t event;
+    uint8_t phase;
+} trace_entry_t;
+
+/* 任何任务都可以记录,不加锁也不锁调度,写位置用原子加法分配 */
+static trace_entry_t trace_ring[TRACE_RING_SIZE];
+static uint32_t trace_head;
+static uint32_t trace_start;
+static uint32_t trace_id;
+
+/***************************************************************
+* 函数名称: trace_cmd
+* 说    明: shell命令,trace导出记录,trace clear清空记录
+* 参    数: argc, argv 命令参数
+* 返 回 值: 0
+***************************************************************/
+static UINT32 trace_cmd(UINT32 argc, const CHAR **argv)
+{
+    trace_cursor_t cursor;
+    char buf[256];
+
+    if ((argc > 0) && (argv[0][0] == 'c')) {
+        trace_clear();
+        return 0;
+    }
+
+    trace_dump_begin(&cursor);
+    while (trace_dump_read(&cursor, buf, sizeof(buf)) > 0) {
+        printf("%s", buf);
+    }
+    return 0;
+}
+
+/***************************************************************
+* 函数名称: trace_init
+* 说    明: 注册shell命令trace
+* 参    数: 无
+* 返 回 值: 无
+***************************************************************/
+void trace_init(void)
+{
+    osCmdReg(CMD_TYPE_EX, "trace", 0, (CmdCallBackFunc)trace_cmd);
+}
+
+/***************************************************************
+* 函数名称: trace_new_id
+* 说    明: 分配事件序号,同一个事件各阶段的记录使用同一个序号
+* 参    数: 无
+* 返 回 值: 序号,不为0
+***************************************************************/
+uint16_t trace_new_id(void)
+{
+    uint16_t id;
+
+    do {
+        id = (uint16_t)__atomic_add_fetch(&trace_id, 1, __ATOMIC_RELAXED);
+    } while (id == 0);
+    return id;
+}
+
+/***************************************************************
+* 函数名称: trace_record
+* 说    明: 记录一个阶段,可以在锁调度期间调用
+* 参    数: uint8_t event 事件类型
+*           uint16_t id 事件序号
+*           trace_phase_t phase 阶段
+* 返 回 值: 无
+***************************************************************/
+void trace_record(uint8_t event, uint16_t id, trace_phase_t phase)
+{
+    uint32_t seq = __atomic_fetch_add(&trace_head, 1, __ATOMIC_RELAXED);
+    trace_entry_t *entry = &trace_ring[seq & (TRACE_RING_SIZE - 1)];
+
+    __atomic_store_n(&entry->seq, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    entry->tick = (uint32_t)LOS_TickCountGet();
+    entry->id = id;
+    entry->task = (uint8_t)LOS_CurTaskIDGet();
+    entry->event = event;
+    entry->phase = phase;
+    __atomic_store_n(&entry->seq, seq + 1, __ATOMIC_RELEASE);
+}
+
+/***************************************************************
+* 函数名称: trace_clear
+* 说    明: 清空记录,之后的导出只包含清空以后的记录
+* 参    数: 无
+* 返 回 值: 无
+***************************************************************/
+void trace_clear(void)
+{
+    __atomic_store_n(&trace_start, __atomic_load_n(&trace_head, __ATOMIC_RELAXED), __ATOMIC_RELAXED);
+}
+
+/***************************************************************
+* 函数名称: trace_dump_begin
+* 说    明: 开始导出,范围是当前环中还保留的记录
+* 参    数: trace_cursor_t *cursor 导出的位置
+* 返 回 值: 无
+***************************************************************/
+void trace_dump_begin(trace_cursor_t *cursor)
+{
+    uint32_t end = __atomic_load_n(&trace_head, __ATOMIC_ACQUIRE);
+    uint32_t start = __atomic_load_n(&trace_start, __ATOMIC_RELAXED);
+
+    if (end - start > TRACE_RING_SIZE) {
+        start = end - TRACE_RING_SIZE;
+    }
+    cursor->pos = start;
+    cursor->end = end;
+    cursor->header = true;
+}
+
+/***************************************************************
+* 函数名称: trace_dump_read
+* 说    明: 导出记录为文本,每行一条,只写入完整的行.
+*           第一行为"# trace hz=每秒tick数",
+*           记录行为"T 序号 tick 任务 事件类型 阶段 事件序号"
+* 参    数: trace_cursor_t *cursor 导出的位置
+*           char *buf 输出缓冲区
+*           int size 缓冲区大小
+* 返 回 值: 写入的字节数,导出完返回0
+***************************************************************/
+int trace_dump_read(trace_cursor_t *cursor, char *buf, int size)
+{
+    int len = 0;
+    int n;
+
+    buf[0] = '\0';
+    if (cursor->header) {
+        n = snprintf(buf, size, "# trace hz=%u\n", (unsigned int)LOSCFG_BASE_CORE_TICK_PER_SECOND);
+        if (n >= size) {
+            return 0;
+        }
+        len = n;
+        cursor->header = false;
+    }
+
+    while (cursor->pos != cursor->end) {
+        trace_entry_t *entry = &trace_ring[cursor->pos & (TRACE_RING_SIZE - 1)];
+        trace_entry_t copy;
+
+        copy = *entry;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        /* 正在写或者已经被新记录覆盖,跳过 */
+        if ((copy.seq != cursor->pos + 1) || (__atomic_load_n(&entry->seq, __ATOMIC_RELAXED) != copy.seq)) {
+            cursor->pos++;
+            continue;
+        }
+
+        n = snprintf(buf + len, size - len, "T %u %u %u %u %u %u\n",
+            (unsigned int)cursor->pos, (unsigned int)copy.tick, copy.task, copy.event, copy.phase, copy.id);
+        if (n >= size - len) {
+            buf[len] = '\0';
+            break;
+        }
+        len += n;
+        cursor->pos++;
+    }
+    return len;
+}
+
+#endif
@@ -0,0 +1,475 @@
+#!/usr/bin/env python3
+# Copyright (c) 2024 iSoftStone Education Co., Ltd.
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""资源编译工具，根据 assets/assets.json 生成图片和汉字字库源文件。
+
+生成的文件:
+    src/picture.c          图片数据(RGB565原始/RLE/RGB444打包/调色板索引)
+    include/picture.h      图片声明、尺寸宏、image_t 初始化宏和 lcd_image_t 描述宏
+    include/lcd_font_cjk.h 汉字字模和按码点排序的索引表
+
+图片源文件为PNG(8位灰度/RGB/RGBA/调色板，不支持隔行扫描)。
+汉字字形来源:
+    *.txt       点阵文本，每个字以"@ 字"开头，"#"为笔画，"."为背景
+    *.bdf       BDF点阵字库
+    *.ttf/*.otf TrueType字库，需要安装 freetype-py
+txt中的字全部收录；chars中列出的字依次从后面的字库中查找。
+
+修改资源后运行:
+    python3 tools/asset_compiler.py
+编译时通过 --check 检查生成的文件是否与资源一致。
+"""
+
+import argparse
+import json
+import os
+import struct
+import sys
+import zlib
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+ASSETS = os.path.join(ROOT, "assets")
+MANIFEST = os.path.join(ASSETS, "assets.json")
+PICTURE_C = os.path.join(ROOT, "src", "picture.c")
+PICTURE_H = os.path.join(ROOT, "include", "picture.h")
+FONT_H = os.path.join(ROOT, "include", "lcd_font_cjk.h")
+
+RLE_MAGIC = b"RLE1"
+RLE_MAX_RUN = 128
+R444_MAGIC = b"R444"
+
+LICENSE = """/*
+ * Copyright (c) 2024 iSoftStone Education Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 本文件由 tools/asset_compiler.py 根据 assets/assets.json 生成，请勿手工修改 */
+"""
+
+
+def fail(msg):
+    sys.exit("asset_compiler: " + msg)
+
+
+#################################################################
+# PNG
+
+def png_read(path):
+    """读取PNG，返回(宽, 高, RGB565像素列表)"""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        fail("%s: not a PNG file" % path)
+    pos = 8
+    idat = b""
+    plte = None
+    trns = None
+    while pos < len(data):
+        length, ctype = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if ctype == b"IHDR":
+            w, h, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif ctype == b"PLTE":
+            plte = body
+        elif ctype == b"tRNS":
+            trns = body
+        elif ctype == b"IDAT":
+            idat += body
+        elif ctype == b"IEND":
+            break
+    if interlace:
+        fail("%s: interlaced PNG is not supported" % path)
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+    if color != 3 and depth != 8:
+        fail("%s: only 8-bit PNG is supported" % path)
+    bits = depth * channels
+    stride = (w * bits + 7) // 8
+    bpp = max(1, bits // 8)
+    raw = zlib.decompress(idat)
+    rows = []
+    prev = bytearray(stride)
+    p = 0
+    for _ in range(h):
+        ftype = raw[p]
+        line = bytearray(raw[p + 1:p + 1 + stride])
+        p += 1 + stride
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                pa, pb, pc = abs(b - c), abs(a - c), abs(a + b - 2 * c)
+                pred = a if pa <= pb and pa <= pc else b if pb <= pc else c
+                line[i] = (line[i] + pred) & 0xFF
+        rows.append(line)
+        prev = line
+
+    pixels = []
+    for line in rows:
+        for x in range(w):
+            if color == 3:
+                bit = x * depth
+                idx = (line[bit // 8] >> (8 - depth - bit % 8)) & ((1 << depth) - 1)
+                r, g, b = plte[idx * 3:idx * 3 + 3]
+                alpha = trns[idx] if trns is not None and idx < len(trns) else 255
+            else:
+                px = line[x * channels:(x + 1) * channels]
+                if color in (0, 4):
+                    r = g = b = px[0]
+                else:
+                    r, g, b = px[0], px[1], px[2]
+                alpha = px[-1] if color in (4, 6) else 255
+            if alpha < 128:
+                # 透明像素按白色背景处理
+                r = g = b = 255
+            pixels.append(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3))
+    return w, h, pixels
+
+
+#################################################################
+# 图片编码
+
+def encode_raw(w, h, pixels):
+    out = bytearray()
+    for p in pixels:
+        out += p.to_bytes(2, "big")
+    return bytes(out)
+
+
+def encode_rle(w, h, pixels):
+    out = bytearray(RLE_MAGIC)
+    out += w.to_bytes(2, "big") + h.to_bytes(2, "big")
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:RLE_MAX_RUN]
+            del literal[:RLE_MAX_RUN]
+            out.append(len(chunk) - 1)
+            for p in chunk:
+                out.extend(p.to_bytes(2, "big"))
+
+    i = 0
+    while i < len(pixels):
+        j = i
+        while j < len(pixels) and pixels[j] == pixels[i] and j - i < RLE_MAX_RUN:
+            j += 1
+        if j - i >= 2:
+            flush_literal()
+            out.append(0x80 | (j - i - 1))
+            out.extend(pixels[i].to_bytes(2, "big"))
+            i = j
+        else:
+            literal.append(pixels[i])
+            i += 1
+    flush_literal()
+    return bytes(out)
+
+
+def encode_rgb444(w, h, pixels):
+    # 与lcd.c中RGB565转RGB444的规则一致，各分量取高4位，两个像素打包成3个字节
+    out = bytearray(R444_MAGIC)
+    out += w.to_bytes(2, "big") + h.to_bytes(2, "big")
+    c = [((p >> 4) & 0xF00) | ((p >> 3) & 0x0F0) | ((p >> 1) & 0x00F) for p in pixels]
+    for k in range(0, len(c) - 1, 2):
+        out += bytes([c[k] >> 4, ((c[k] & 0xF) << 4) | (c[k + 1] >> 8), c[k + 1] & 0xFF])
+    if len(c) & 1:
+        out += bytes([c[-1] >> 4, (c[-1] & 0xF) << 4])
+    return bytes(out)
+
+
+def encode_indexed(name, w, h, pixels):
+    counts = {}
+    for px in pixels:
+        counts[px] = counts.get(px, 0) + 1
+    if len(counts) > 16:
+        fail("%s: %d colours, palette images allow at most 16" % (name, len(counts)))
+    bpp = 1 if len(counts) <= 2 else 2 if len(counts) <= 4 else 4
+    # 出现次数最多的颜色(一般是背景)放在索引0，调色板补齐到1<<bpp个颜色
+    palette = sorted(counts, key=lambda c: (-counts[c], c))
+    index = {c: i for i, c in enumerate(palette)}
+    palette += [0x0000] * ((1 << bpp) - len(palette))
+    per_byte = 8 // bpp
+    out = bytearray()
+    for y in range(h):
+        row = pixels[y * w:(y + 1) * w]
+        for k in range(0, w, per_byte):
+            b = 0
+            for j, px in enumerate(row[k:k + per_byte]):
+                b |= index[px] << (8 - bpp * (j + 1))
+            out.append(b)
+    return bpp, palette, bytes(out)
+
+
+def c_bytes(data):
+    return [" " + " ".join("0x%02X," % b for b in data[k:k + 16]) for k in range(0, len(data), 16)]
+
+
+def build_images(manifest):
+    c_out = [LICENSE + '#include "picture.h"\n']
+    h_out = [LICENSE + "#ifndef _PICTURE_H_\n#define _PICTURE_H_\n"]
+    for img in manifest["images"]:
+        name = img["name"]
+        macro = name.upper()
+        path = os.path.join(ASSETS, img["file"])
+        w, h, pixels = png_read(path)
+        fmt = img.get("format", "auto")
+        if fmt == "auto":
+            raw, rle = encode_raw(w, h, pixels), encode_rle(w, h, pixels)
+            fmt = "rle" if len(rle) < len(raw) else "raw"
+
+        if img.get("group"):
+            h_out.append("\n//%s" % img["group"])
+        h_out.append("#define %s_WIDTH %d" % (macro, w))
+        h_out.append("#define %s_HEIGHT %d" % (macro, h))
+        if fmt == "indexed":
+            bpp, palette, data = encode_indexed(name, w, h, pixels)
+            c_out.append("const unsigned char %s[%d] = {\n //%dx%d %dbpp" % (name, len(data), w, h, bpp))
+            c_out += c_bytes(data)
+            c_out.append("};")
+            c_out.append("const unsigned short %s_palette[%d] = {" % (name, len(palette)))
+            c_out.append(" " + " ".join("0x%04X," % c for c in palette))
+            c_out.append("};\n")
+            h_out.append("#define %s_BPP %d" % (macro, bpp))
+            h_out.append("#define %s_IMAGE IMAGE_INDEXED(%s, %d, %d, %d, %s_palette)"
+                         % (macro, name, w, h, bpp, name))
+            h_out.append("extern const unsigned char %s[%d];" % (name, len(data)))
+            h_out.append("extern const unsigned short %s_palette[%d];" % (name, len(palette)))
+        elif fmt in ("rle", "raw", "rgb444"):
+            encode = {"rle": encode_rle, "raw": encode_raw, "rgb444": encode_rgb444}[fmt]
+            data = encode(w, h, pixels)
+            c_out.append("const unsigned char %s[%d] = {\n //%dx%d%s"
+                         % (name, len(data), w, h, {"rle": " RLE", "raw": "", "rgb444": " RGB444"}[fmt]))
+            c_out += c_bytes(data)
+            c_out.append("};\n")
+            h_out.append("#define %s_IMAGE IMAGE_RGB565(%s, %d, %d)" % (macro, name, w, h))
+            if fmt != "rle":
+                # 原始和RGB444数据可以直接下发，另外生成lcd_draw_image使用的描述
+                h_out.append("#define %s_DESC LCD_IMAGE_%s(%s, %d, %d)"
+                             % (macro, "RGB565" if fmt == "raw" else "RGB444", name, w, h))
+            h_out.append("extern const unsigned char %s[%d];" % (name, len(data)))
+        else:
+            fail("%s: unknown format %r" % (name, fmt))
+    h_out.append("\n#endif /* _PICTURE_H_ */\n")
+    return "\n".join(c_out), "\n".join(h_out)
+
+
+#################################################################
+# 字库
+
+def glyphs_from_txt(path, size):
+    glyphs = {}
+    order = []
+    with open(path, encoding="utf-8") as f:
+        lines = [l.rstrip("\n") for l in f]
+    i = 0
+    while i < len(lines):
+        line = lines[i]
+        if line.startswith("@ "):
+            ch = line[2:].strip()
+            rows = lines[i + 1:i + 1 + size]
+            if len(ch) != 1 or len(rows) != size or any(len(r) != size for r in rows):
+                fail("%s:%d: glyph %r is not %dx%d" % (path, i + 1, ch, size, size))
+            if ch not in glyphs:
+                glyphs[ch] = [[c == "#" for c in r] for r in rows]
+                order.append(ch)
+            i += 1 + size
+        else:
+            i += 1
+    return order, glyphs
+
+
+def glyphs_from_bdf(path, size, chars):
+    glyphs = {}
+    with open(path, encoding="latin-1") as f:
+        lines = f.read().splitlines()
+    ascent = size
+    for line in lines:
+        if line.startswith("FONT_ASCENT "):
+            ascent = int(line.split()[1])
+    i = 0
+    while i < len(lines):
+        if not lines[i].startswith("STARTCHAR"):
+            i += 1
+            continue
+        enc = bbx = None
+        j = i + 1
+        while not lines[j].startswith("BITMAP"):
+            if lines[j].startswith("ENCODING "):
+                enc = int(lines[j].split()[1])
+            elif lines[j].startswith("BBX "):
+                bbx = [int(v) for v in lines[j].split()[1:5]]
+            j += 1
+        rows = []
+        j += 1
+        while not lines[j].startswith("ENDCHAR"):
+            rows.append(int(lines[j], 16))
+            j += 1
+        i = j + 1
+        if enc is None or enc < 0 or chr(enc) not in chars:
+            continue
+        bw, bh, bx, by = bbx
+        nbits = ((bw + 7) // 8) * 8
+        cell = [[False] * size for _ in range(size)]
+        top = ascent - (by + bh)
+        for r, bits in enumerate(rows):
+            for c in range(bw):
+                x, y = bx + c, top + r
+                if 0 <= x < size and 0 <= y < size and bits & (1 << (nbits - 1 - c)):
+                    cell[y][x] = True
+        glyphs[chr(enc)] = cell
+    return glyphs
+
+
+def glyphs_from_ttf(path, size, chars):
+    try:
+        import freetype
+    except ImportError:
+        fail("%s: TrueType fonts need the freetype-py module" % path)
+    face = freetype.Face(path)
+    face.set_pixel_sizes(0, size)
+    ascent = face.size.ascender >> 6
+    glyphs = {}
+    for ch in chars:
+        if face.get_char_index(ch) == 0:
+            continue
+        face.load_char(ch, freetype.FT_LOAD_RENDER | freetype.FT_LOAD_TARGET_MONO)
+        bm = face.glyph.bitmap
+        left, top = face.glyph.bitmap_left, ascent - face.glyph.bitmap_top
+        cell = [[False] * size for _ in range(size)]
+        for r in range(bm.rows):
+            for c in range(bm.width):
+                x, y = left + c, top + r
+                if 0 <= x < size and 0 <= y < size and bm.buffer[r * bm.pitch + c // 8] & (0x80 >> (c % 8)):
+                    cell[y][x] = True
+        glyphs[ch] = cell
+    return glyphs
+
+
+def build_fonts(manifest):
+    out = [LICENSE + "#ifndef _LCD_FONT_CJK_H_\n#define _LCD_FONT_CJK_H_\n",
+           "/* 汉字字模索引，key为(Unicode码点 << 8 | 字号)，按key升序排列 */",
+           "typedef struct\n{\n    unsigned int key;\n    const unsigned char *msk;\n} lcd_font_index_t;\n"]
+    index = []
+    for font in manifest["fonts"]:
+        size = font["size"]
+        order, glyphs = [], {}
+        wanted = [c for c in font.get("chars", "") if not c.isspace()]
+        for src in font["sources"]:
+            path = os.path.join(ASSETS, src)
+            ext = os.path.splitext(src)[1].lower()
+            if ext == ".txt":
+                o, g = glyphs_from_txt(path, size)
+                for ch in o:
+                    if ch not in glyphs:
+                        glyphs[ch] = g[ch]
+                        order.append(ch)
+                continue
+            missing = [c for c in wanted if c not in glyphs]
+            if not missing:
+                continue
+            if ext == ".bdf":
+                g = glyphs_from_bdf(path, size, missing)
+            elif ext in (".ttf", ".otf", ".ttc"):
+                g = glyphs_from_ttf(path, size, missing)
+            else:
+                fail("%s: unknown font source" % src)
+            for ch in missing:
+                if ch in g:
+                    glyphs[ch] = g[ch]
+                    order.append(ch)
+        missing = [c for c in wanted if c not in glyphs]
+        if missing:
+            fail("size %d: no glyph for %s" % (size, "".join(missing)))
+
+        bpr = (size + 7) // 8
+        table = "g_font_cjk%d" % size
+        out.append("/* %dx%d */" % (size, size))
+        out.append("static const unsigned char %s[%d][%d] =\n{" % (table, len(order), bpr * size))
+        for k, ch in enumerate(order):
+            data = bytearray()
+            for row in glyphs[ch]:
+                for b in range(bpr):
+                    v = 0
+                    for bit in range(8):
+                        c = b * 8 + bit
+                        if c < size and row[c]:
+                            v |= 1 << bit
+                    data.append(v)
+            out.append("    { /* \"%s\" */" % ch)
+            out += ["   " + l for l in c_bytes(data)]
+            out.append("    },")
+            index.append(((ord(ch) << 8) | size, "%s[%d]" % (table, k), ch))
+        out.append("};\n")
+
+    out.append("static const lcd_font_index_t g_font_index[] =\n{")
+    for key, ref, ch in sorted(index):
+        out.append("    {0x%08X, %s}, /* \"%s\" */" % (key, ref, ch))
+    out.append("};\n\n#endif /* _LCD_FONT_CJK_H_ */\n")
+    return "\n".join(out)
+
+
+#################################################################
+
+def main():
+    parser = argparse.ArgumentParser(description="compile LCD image and font assets")
+    parser.add_argument("--check", action="store_true",
+                        help="fail if the generated files are out of date instead of writing them")
+    parser.add_argument("--stamp", help="touch this file on success (for the GN action)")
+    args = parser.parse_args()
+
+    with open(MANIFEST, encoding="utf-8") as f:
+        manifest = json.load(f)
+    picture_c, picture_h = build_images(manifest)
+    outputs = {PICTURE_C: picture_c, PICTURE_H: picture_h, FONT_H: build_fonts(manifest)}
+
+    stale = []
+    for path, text in outputs.items():
+        old = None
+        if os.path.exists(path):
+            with open(path, encoding="utf-8") as f:
+                old = f.read()
+        if old == text:
+            continue
+        if args.check:
+            stale.append(os.path.relpath(path, ROOT))
+        else:
+            with open(path, "w", encoding="utf-8", newline="\n") as f:
+                f.write(text)
+            print("generated %s" % os.path.relpath(path, ROOT))
+    if stale:
+        fail("%s out of date, run tools/asset_compiler.py" % ", ".join(stale))
+    if args.stamp:
+        with open(args.stamp, "w") as f:
+            f.write("ok\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+# Copyright (c) 2024 iSoftStone Education Co., Ltd.
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""事件跟踪解码工具，统计每类事件各阶段的延时分位数。
+
+输入为串口shell命令 trace 的输出，或云端命令 trace_dump 发布到
+$oc/devices/<设备>/user/trace 的消息内容，可以混有其它日志:
+    # trace hz=<每秒tick数>
+    T <序号> <tick> <任务> <事件类型> <阶段> <事件序号>
+
+阶段(include/trace.h):
+    0 入队  1 出队  2 开始处理  3 处理完  4 整帧下发到屏幕  5 合并/丢弃/拒绝
+
+统计的延时:
+    queue    入队 -> 出队
+    handler  开始处理 -> 处理完
+    gpio     入队 -> 处理完(GPIO/PWM已经改变)
+    display  入队 -> 处理完以后第一帧下发到屏幕
+
+用法:
+    python3 tools/trace_decode.py uart.log [more.log ...]
+    cat uart.log | python3 tools/trace_decode.py
+"""
+
+import argparse
+import bisect
+import math
+import re
+import sys
+
+EVENT_NAMES = {
+    1: "key_press",
+    2: "iot_cmd",
+    3: "su03t",
+    4: "gas_alarm",
+    5: "mqtt_control",
+}
+
+PHASE_ENQUEUE = 0
+PHASE_DEQUEUE = 1
+PHASE_HANDLER_START = 2
+PHASE_HANDLER_END = 3
+PHASE_FLUSH = 4
+PHASE_DROP = 5
+
+STAGES = ("queue", "handler", "gpio", "display")
+
+HEADER_RE = re.compile(r"#\s*trace\s+hz=(\d+)")
+RECORD_RE = re.compile(r"T (\d+) (\d+) (\d+) (\d+) (\d+) (\d+)")
+
+
+def parse(lines):
+    """返回(每秒tick数, 按序号排序去重的记录列表)。"""
+    hz = 1000
+    records = {}
+    for line in lines:
+        m = HEADER_RE.search(line)
+        if m:
+            hz = int(m.group(1))
+            continue
+        # 一条MQTT消息中有多行，日志中也可能有前缀
+        for m in RECORD_RE.finditer(line):
+            seq, tick, task, event, phase, eid = (int(v) for v in m.groups())
+            records[seq] = (seq, tick, task, event, phase, eid)
+    return hz, [records[k] for k in sorted(records)]
+
+
+def tick_diff(a, b):
+    """b - a，tick为32位，按回绕处理。"""
+    return (b - a) & 0xFFFFFFFF
+
+
+def collect(records):
+    """按事件序号把各阶段对应起来，返回{事件类型: {统计项: [tick差]}}和{事件类型: 丢弃数}。"""
+    events = []
+    current = {}
+    flushes = []
+    for seq, tick, task, event, phase, eid in records:
+        if phase == PHASE_FLUSH:
+            flushes.append((seq, tick))
+            continue
+        # 事件序号16位会回绕，入队时开始一个新事件
+        if phase == PHASE_ENQUEUE or eid not in current:
+            current[eid] = {"event": event, "phases": {}, "drop": False}
+            events.append(current[eid])
+        ev = current[eid]
+        if phase == PHASE_DROP:
+            ev["drop"] = True
+        else:
+            ev["phases"].setdefault(phase, (seq, tick))
+
+    flush_seqs = [seq for seq, tick in flushes]
+    result = {}
+    dropped = {}
+    for ev in events:
+        name = EVENT_NAMES.get(ev["event"], "event_%d" % ev["event"])
+        stages = result.setdefault(name, {s: [] for s in STAGES})
+        if ev["drop"]:
+            dropped[name] = dropped.get(name, 0) + 1
+            continue
+        ph = ev["phases"]
+        if PHASE_ENQUEUE in ph and PHASE_DEQUEUE in ph:
+            stages["queue"].append(tick_diff(ph[PHASE_ENQUEUE][1], ph[PHASE_DEQUEUE][1]))
+        if PHASE_HANDLER_START in ph and PHASE_HANDLER_END in ph:
+            stages["handler"].append(tick_diff(ph[PHASE_HANDLER_START][1], ph[PHASE_HANDLER_END][1]))
+        if PHASE_ENQUEUE in ph and PHASE_HANDLER_END in ph:
+            stages["gpio"].append(tick_diff(ph[PHASE_ENQUEUE][1], ph[PHASE_HANDLER_END][1]))
+            # 处理完以后第一帧下发完成
+            k = bisect.bisect_right(flush_seqs, ph[PHASE_HANDLER_END][0])
+            if k < len(flushes):
+                stages["display"].append(tick_diff(ph[PHASE_ENQUEUE][1], flushes[k][1]))
+    return result, dropped
+
+
+def percentile(values, p):
+    """最近秩法分位数。"""
+    values = sorted(values)
+    k = max(0, int(math.ceil(p / 100.0 * len(values))) - 1)
+    return values[k]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="decode event trace and print latency percentiles")
+    parser.add_argument("files", nargs="*", help="trace dumps (default: stdin)")
+    args = parser.parse_args()
+
+    lines = []
+    if args.files:
+        for path in args.files:
+            with open(path, encoding="utf-8", errors="replace") as f:
+                lines.extend(f)
+    else:
+        lines = sys.stdin.readlines()
+
+    hz, records = parse(lines)
+    if not records:
+        print("no trace records found", file=sys.stderr)
+        return 1
+    result, dropped = collect(records)
+
+    ms = 1000.0 / hz
+    print("%d records, tick %.3f ms" % (len(records), ms))
+    print("%-14s %-8s %6s %9s %9s %9s %9s" % ("event", "stage", "count", "p50 ms", "p90 ms", "p99 ms", "max ms"))
+    for name in sorted(result):
+        for stage in STAGES:
+            values = result[name][stage]
+            if not values:
+                continue
+            print("%-14s %-8s %6d %9.1f %9.1f %9.1f %9.1f" % (
+                name, stage, len(values),
+                percentile(values, 50) * ms, percentile(values, 90) * ms,
+                percentile(values, 99) * ms, max(values) * ms))
+        if dropped.get(name):
+            print("%-14s %-8s %6d" % (name, "dropped", dropped[name]))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())